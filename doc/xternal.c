@@ -9630,8 +9630,19 @@
  *
  * A detailed description what a relaxation handler does and how to add a relaxation handler to SCIP can be found
  * \ref RELAX "here". Note that the linear programming relaxation is not implemented via the relaxation handler plugin.
- * Per default no relaxation handler exists in SCIP. However, there are two relaxation handlers in the
- * \ref RELAXATOR_MAIN "Relaxator example".
+ * Per default, the only relaxation handler in SCIP is the first-order LP relaxator, which is disabled. Further
+ * relaxation handlers can be found in the \ref RELAXATOR_MAIN "Relaxator example".
+ */
+
+/**@defgroup RelaxatorIncludes Inclusion methods
+ * @ingroup RELAXATORS
+ * @brief methods to include specific relaxation handlers into \SCIP
+ *
+ * This module contains methods to include specific relaxation handlers into \SCIP.
+ *
+ * @note All default plugins can be included at once (including all default relaxation handlers) using
+ *       SCIPincludeDefaultPlugins()
+ *
  */
 
 /**@defgroup SEPARATORS Separators
@@ -227,6 +227,29 @@ SCIP_RETCODE SCIPlpiAddCols(
    const SCIP_Real*      val                 /**< values of constraint matrix entries, or NULL if nnonz == 0 */
    );
 
+/** adds columns to the LP, whose coefficients are provided column by column by a callback
+ *
+ *  In contrast to SCIPlpiAddCols(), the caller does not gather the coefficients of all columns in one array. LP solvers
+ *  that build their own column vectors read the coefficients of each column from the callback directly, the others
+ *  gather them and call SCIPlpiAddCols().
+ *
+ *  @note the callback is called at most once per column, and the vectors of the columns must fit into nnonz entries in
+ *        total and into maxlen entries each
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPlpiAddColsCallback(
+   SCIP_LPI*             lpi,                /**< LP interface structure */
+   int                   ncols,              /**< number of columns to be added */
+   const SCIP_Real*      obj,                /**< objective function values of new columns */
+   const SCIP_Real*      lb,                 /**< lower bounds of new columns */
+   const SCIP_Real*      ub,                 /**< upper bounds of new columns */
+   char**                colnames,           /**< column names, or NULL */
+   int                   nnonz,              /**< maximal number of nonzero elements of all new columns */
+   int                   maxlen,             /**< maximal number of nonzero elements of a new column */
+   SCIP_DECL_LPIGETVEC   ((*getvec)),        /**< callback providing the coefficients of a new column */
+   void*                 vecdata             /**< data passed to the callback */
+   );
+
 /** deletes all columns in the given range from LP */
 SCIP_EXPORT
 SCIP_RETCODE SCIPlpiDelCols(
@@ -261,6 +284,28 @@ SCIP_RETCODE SCIPlpiAddRows(
    const SCIP_Real*      val                 /**< values of constraint matrix entries, or NULL if nnonz == 0 */
    );
 
+/** adds rows to the LP, whose coefficients are provided row by row by a callback
+ *
+ *  In contrast to SCIPlpiAddRows(), the caller does not gather the coefficients of all rows in one array. LP solvers
+ *  that build their own row vectors read the coefficients of each row from the callback directly, the others gather
+ *  them and call SCIPlpiAddRows().
+ *
+ *  @note the callback is called at most once per row, and the vectors of the rows must fit into nnonz entries in total
+ *        and into maxlen entries each
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPlpiAddRowsCallback(
+   SCIP_LPI*             lpi,                /**< LP interface structure */
+   int                   nrows,              /**< number of rows to be added */
+   const SCIP_Real*      lhs,                /**< left hand sides of new rows */
+   const SCIP_Real*      rhs,                /**< right hand sides of new rows */
+   char**                rownames,           /**< row names, or NULL */
+   int                   nnonz,              /**< maximal number of nonzero elements of all new rows */
+   int                   maxlen,             /**< maximal number of nonzero elements of a new row */
+   SCIP_DECL_LPIGETVEC   ((*getvec)),        /**< callback providing the coefficients of a new row */
+   void*                 vecdata             /**< data passed to the callback */
+   );
+
 /** deletes all rows in the given range from LP */
 SCIP_EXPORT
 SCIP_RETCODE SCIPlpiDelRows(
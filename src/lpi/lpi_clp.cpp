@@ -832,6 +832,65 @@ SCIP_RETCODE SCIPlpiAddCols(
    return SCIP_OKAY;
 }
 
+/** adds columns to the LP, whose coefficients are provided column by column by a callback */
+SCIP_RETCODE SCIPlpiAddColsCallback(
+   SCIP_LPI*             lpi,                /**< LP interface structure */
+   int                   ncols,              /**< number of columns to be added */
+   const SCIP_Real*      obj,                /**< objective function values of new columns */
+   const SCIP_Real*      lb,                 /**< lower bounds of new columns */
+   const SCIP_Real*      ub,                 /**< upper bounds of new columns */
+   char**                colnames,           /**< column names, or NULL */
+   int                   nnonz,              /**< maximal number of nonzero elements of all new columns */
+   int                   maxlen,             /**< maximal number of nonzero elements of a new column */
+   SCIP_DECL_LPIGETVEC   ((*getvec)),        /**< callback providing the coefficients of a new column */
+   void*                 vecdata             /**< data passed to the callback */
+   )
+{
+   SCIP_RETCODE retcode;
+   int* beg;
+   int* ind;
+   SCIP_Real* val;
+   int len;
+   int pos;
+   int k;
+
+   SCIPdebugMessage("calling SCIPlpiAddColsCallback()\n");
+
+   assert(lpi != NULL);
+   assert(getvec != NULL);
+   assert(0 <= maxlen && maxlen <= nnonz);
+   assert(ncols >= 0);
+
+   beg = NULL;
+   ind = NULL;
+   val = NULL;
+   retcode = SCIP_OKAY;
+
+   /* Clp copies the coefficients into its own storage, so they are gathered and passed as usual */
+   SCIP_ALLOC_TERMINATE( retcode, BMSallocMemoryArray(&beg, ncols), TERMINATE );
+   SCIP_ALLOC_TERMINATE( retcode, BMSallocMemoryArray(&ind, nnonz), TERMINATE );
+   SCIP_ALLOC_TERMINATE( retcode, BMSallocMemoryArray(&val, nnonz), TERMINATE );
+
+   pos = 0;
+   for( k = 0; k < ncols; ++k )
+   {
+      beg[k] = pos;
+      SCIP_CALL_TERMINATE( retcode, getvec(vecdata, k, &ind[pos], &val[pos], &len), TERMINATE );
+      assert(0 <= len && len <= maxlen);
+      pos += len;
+      assert(pos <= nnonz);
+   }
+
+   retcode = SCIPlpiAddCols(lpi, ncols, obj, lb, ub, colnames, pos, beg, ind, val);
+
+TERMINATE:
+   BMSfreeMemoryArrayNull(&val);
+   BMSfreeMemoryArrayNull(&ind);
+   BMSfreeMemoryArrayNull(&beg);
+
+   return retcode;
+}
+
 
 /** deletes all columns in the given range from LP */
 SCIP_RETCODE SCIPlpiDelCols(
@@ -981,6 +1040,64 @@ SCIP_RETCODE SCIPlpiAddRows(
    return SCIP_OKAY;
 }
 
+/** adds rows to the LP, whose coefficients are provided row by row by a callback */
+SCIP_RETCODE SCIPlpiAddRowsCallback(
+   SCIP_LPI*             lpi,                /**< LP interface structure */
+   int                   nrows,              /**< number of rows to be added */
+   const SCIP_Real*      lhs,                /**< left hand sides of new rows */
+   const SCIP_Real*      rhs,                /**< right hand sides of new rows */
+   char**                rownames,           /**< row names, or NULL */
+   int                   nnonz,              /**< maximal number of nonzero elements of all new rows */
+   int                   maxlen,             /**< maximal number of nonzero elements of a new row */
+   SCIP_DECL_LPIGETVEC   ((*getvec)),        /**< callback providing the coefficients of a new row */
+   void*                 vecdata             /**< data passed to the callback */
+   )
+{
+   SCIP_RETCODE retcode;
+   int* beg;
+   int* ind;
+   SCIP_Real* val;
+   int len;
+   int pos;
+   int k;
+
+   SCIPdebugMessage("calling SCIPlpiAddRowsCallback()\n");
+
+   assert(lpi != NULL);
+   assert(getvec != NULL);
+   assert(0 <= maxlen && maxlen <= nnonz);
+   assert(nrows >= 0);
+
+   beg = NULL;
+   ind = NULL;
+   val = NULL;
+   retcode = SCIP_OKAY;
+
+   /* Clp copies the coefficients into its own storage, so they are gathered and passed as usual */
+   SCIP_ALLOC_TERMINATE( retcode, BMSallocMemoryArray(&beg, nrows), TERMINATE );
+   SCIP_ALLOC_TERMINATE( retcode, BMSallocMemoryArray(&ind, nnonz), TERMINATE );
+   SCIP_ALLOC_TERMINATE( retcode, BMSallocMemoryArray(&val, nnonz), TERMINATE );
+
+   pos = 0;
+   for( k = 0; k < nrows; ++k )
+   {
+      beg[k] = pos;
+      SCIP_CALL_TERMINATE( retcode, getvec(vecdata, k, &ind[pos], &val[pos], &len), TERMINATE );
+      assert(0 <= len && len <= maxlen);
+      pos += len;
+      assert(pos <= nnonz);
+   }
+
+   retcode = SCIPlpiAddRows(lpi, nrows, lhs, rhs, rownames, pos, beg, ind, val);
+
+TERMINATE:
+   BMSfreeMemoryArrayNull(&val);
+   BMSfreeMemoryArrayNull(&ind);
+   BMSfreeMemoryArrayNull(&beg);
+
+   return retcode;
+}
+
 
 /** deletes all rows in the given range from LP */
 SCIP_RETCODE SCIPlpiDelRows(
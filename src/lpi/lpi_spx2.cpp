@@ -130,6 +130,8 @@
 #endif
 
 #define SOPLEX_VERBLEVEL                5    /**< verbosity level for LPINFO */
+#define SOPLEX_DENSECHGFAC            0.3    /**< bound and side changes affecting at least this fraction of the columns or
+                                              *   rows are passed to SoPlex as complete vectors */
 
 #include "scip/pub_message.h"
 
@@ -1323,6 +1325,98 @@ SCIP_RETCODE SCIPlpiAddCols(
    return SCIP_OKAY;
 }
 
+/** adds columns to the LP, whose coefficients are provided column by column by a callback */
+SCIP_RETCODE SCIPlpiAddColsCallback(
+   SCIP_LPI*             lpi,                /**< LP interface structure */
+   int                   ncols,              /**< number of columns to be added */
+   const SCIP_Real*      obj,                /**< objective function values of new columns */
+   const SCIP_Real*      lb,                 /**< lower bounds of new columns */
+   const SCIP_Real*      ub,                 /**< upper bounds of new columns */
+   char**                /*colnames*/,       /**< column names, or NULL */
+   int                   nnonz,              /**< maximal number of nonzero elements of all new columns */
+   int                   maxlen,             /**< maximal number of nonzero elements of a new column */
+   SCIP_DECL_LPIGETVEC   ((*getvec)),        /**< callback providing the coefficients of a new column */
+   void*                 vecdata             /**< data passed to the callback */
+   )
+{
+   SCIP_RETCODE retcode;
+   SCIP_Real* val;
+   int* ind;
+   int len;
+
+   SCIPdebugMessage("calling SCIPlpiAddColsCallback()\n");
+
+   assert(lpi != NULL);
+   assert(lpi->spx != NULL);
+   assert(obj != NULL);
+   assert(lb != NULL);
+   assert(ub != NULL);
+   assert(getvec != NULL);
+   assert(0 <= maxlen && maxlen <= nnonz);
+   assert(ncols >= 0);
+
+   invalidateSolution(lpi);
+
+   assert( lpi->spx->preStrongbranchingBasisFreed() );
+
+   /* the coefficients of each column are copied from the callback into the column set of SoPlex, which only needs
+    * workspace for a single column instead of all columns
+    */
+   SCIP_ALLOC( BMSallocMemoryArray(&ind, maxlen) );
+   if( BMSallocMemoryArray(&val, maxlen) == NULL )
+   {
+      BMSfreeMemoryArray(&ind);
+      return SCIP_NOMEMORY;
+   }
+
+   retcode = SCIP_OKAY;
+   SPxSCIP* spx = lpi->spx;
+   try
+   {
+      LPColSet cols(ncols, nnonz);
+      DSVector colVector(maxlen);
+      int i;
+
+      /* create column vectors with coefficients and bounds */
+      for( i = 0; i < ncols; ++i )
+      {
+         retcode = getvec(vecdata, i, ind, val, &len);
+         if( retcode != SCIP_OKAY )
+            break;
+         assert(0 <= len && len <= maxlen);
+#ifndef NDEBUG
+         for( int j = 0; j < len; ++j )
+         {
+            /* perform check that no new rows are added - this is likely to be a mistake */
+            assert( 0 <= ind[j] && ind[j] < spx->numRowsReal() );
+            assert( val[j] != 0.0 );
+         }
+#endif
+         colVector.clear();
+         colVector.add(len, ind, val);
+         cols.add(obj[i], lb[i], colVector, ub[i]);
+      }
+      if( retcode == SCIP_OKAY )
+         spx->addColsReal(cols);
+   }
+#ifndef NDEBUG
+   catch( const SPxException& x )
+   {
+      std::string s = x.what();
+      SCIPmessagePrintWarning(lpi->messagehdlr, "SoPlex threw an exception: %s\n", s.c_str());
+#else
+   catch( const SPxException& )
+   {
+#endif
+      retcode = SCIP_LPERROR;
+   }
+
+   BMSfreeMemoryArray(&val);
+   BMSfreeMemoryArray(&ind);
+
+   return retcode;
+}
+
 /** deletes all columns in the given range from LP */
 SCIP_RETCODE SCIPlpiDelCols(
    SCIP_LPI*             lpi,                /**< LP interface structure */
@@ -1455,6 +1549,96 @@ SCIP_RETCODE SCIPlpiAddRows(
    return SCIP_OKAY;
 }
 
+/** adds rows to the LP, whose coefficients are provided row by row by a callback */
+SCIP_RETCODE SCIPlpiAddRowsCallback(
+   SCIP_LPI*             lpi,                /**< LP interface structure */
+   int                   nrows,              /**< number of rows to be added */
+   const SCIP_Real*      lhs,                /**< left hand sides of new rows */
+   const SCIP_Real*      rhs,                /**< right hand sides of new rows */
+   char**                /*rownames*/,       /**< row names, or NULL */
+   int                   nnonz,              /**< maximal number of nonzero elements of all new rows */
+   int                   maxlen,             /**< maximal number of nonzero elements of a new row */
+   SCIP_DECL_LPIGETVEC   ((*getvec)),        /**< callback providing the coefficients of a new row */
+   void*                 vecdata             /**< data passed to the callback */
+   )
+{
+   SCIP_RETCODE retcode;
+   SCIP_Real* val;
+   int* ind;
+   int len;
+
+   SCIPdebugMessage("calling SCIPlpiAddRowsCallback()\n");
+
+   assert(lpi != NULL);
+   assert(lpi->spx != NULL);
+   assert(lhs != NULL);
+   assert(rhs != NULL);
+   assert(getvec != NULL);
+   assert(0 <= maxlen && maxlen <= nnonz);
+   assert(nrows >= 0);
+
+   invalidateSolution(lpi);
+
+   assert( lpi->spx->preStrongbranchingBasisFreed() );
+
+   /* the coefficients of each row are copied from the callback into the row set of SoPlex, which only needs workspace
+    * for a single row instead of all rows
+    */
+   SCIP_ALLOC( BMSallocMemoryArray(&ind, maxlen) );
+   if( BMSallocMemoryArray(&val, maxlen) == NULL )
+   {
+      BMSfreeMemoryArray(&ind);
+      return SCIP_NOMEMORY;
+   }
+
+   retcode = SCIP_OKAY;
+   try
+   {
+      SPxSCIP* spx = lpi->spx;
+      LPRowSet rows(nrows, nnonz);
+      DSVector rowVector(maxlen);
+      int i;
+
+      /* create row vectors with given sides */
+      for( i = 0; i < nrows; ++i )
+      {
+         retcode = getvec(vecdata, i, ind, val, &len);
+         if( retcode != SCIP_OKAY )
+            break;
+         assert(0 <= len && len <= maxlen);
+#ifndef NDEBUG
+         for( int j = 0; j < len; ++j )
+         {
+            /* perform check that no new columns are added - this is likely to be a mistake */
+            assert( val[j] != 0.0 );
+            assert( 0 <= ind[j] && ind[j] < spx->numColsReal() );
+         }
+#endif
+         rowVector.clear();
+         rowVector.add(len, ind, val);
+         rows.add(lhs[i], rowVector, rhs[i]);
+      }
+      if( retcode == SCIP_OKAY )
+         spx->addRowsReal(rows);
+   }
+#ifndef NDEBUG
+   catch( const SPxException& x )
+   {
+      std::string s = x.what();
+      SCIPmessagePrintWarning(lpi->messagehdlr, "SoPlex threw an exception: %s\n", s.c_str());
+#else
+   catch( const SPxException& )
+   {
+#endif
+      retcode = SCIP_LPERROR;
+   }
+
+   BMSfreeMemoryArray(&val);
+   BMSfreeMemoryArray(&ind);
+
+   return retcode;
+}
+
 /** deletes all rows in the given range from LP */
 SCIP_RETCODE SCIPlpiDelRows(
    SCIP_LPI*             lpi,                /**< LP interface structure */
@@ -1565,9 +1749,34 @@ SCIP_RETCODE SCIPlpiChgBounds(
             SCIPerrorMessage("LP Error: fixing upper bound for variable %d to -infinity.\n", ind[i]);
             return SCIP_LPERROR;
          }
+      }
+
+#if SOPLEX_VERSION > 221 || (SOPLEX_VERSION == 221 && SOPLEX_SUBVERSION >= 4)
+      /* many changes, e.g., after switching to a node far away in the tree, are applied in one sweep over the bound
+       * vectors instead of one update of the LP and the basis status per column
+       */
+      if( ncols >= SOPLEX_DENSECHGFAC * lpi->spx->numColsReal() )
+      {
+         DVector lbvec(lpi->spx->numColsReal());
+         DVector ubvec(lpi->spx->numColsReal());
 
-         lpi->spx->changeBoundsReal(ind[i], lb[i], ub[i]);
-         assert(lpi->spx->lowerReal(ind[i]) <= lpi->spx->upperReal(ind[i]) + lpi->spx->realParam(SoPlex::EPSILON_ZERO));
+         lpi->spx->getLowerReal(lbvec);
+         lpi->spx->getUpperReal(ubvec);
+         for( i = 0; i < ncols; ++i )
+         {
+            lbvec[ind[i]] = lb[i];
+            ubvec[ind[i]] = ub[i];
+         }
+         lpi->spx->changeBoundsReal(lbvec, ubvec);
+      }
+      else
+#endif
+      {
+         for( i = 0; i < ncols; ++i )
+         {
+            lpi->spx->changeBoundsReal(ind[i], lb[i], ub[i]);
+            assert(lpi->spx->lowerReal(ind[i]) <= lpi->spx->upperReal(ind[i]) + lpi->spx->realParam(SoPlex::EPSILON_ZERO));
+         }
       }
    }
 #ifndef NDEBUG
@@ -1612,11 +1821,32 @@ SCIP_RETCODE SCIPlpiChgSides(
 
    try
    {
-      for( i = 0; i < nrows; ++i )
+#if SOPLEX_VERSION > 221 || (SOPLEX_VERSION == 221 && SOPLEX_SUBVERSION >= 4)
+      /* many changes are applied in one sweep over the side vectors */
+      if( nrows >= SOPLEX_DENSECHGFAC * lpi->spx->numRowsReal() )
       {
-         assert(0 <= ind[i] && ind[i] < lpi->spx->numRowsReal());
-         lpi->spx->changeRangeReal(ind[i], lhs[i], rhs[i]);
-         assert(lpi->spx->lhsReal(ind[i]) <= lpi->spx->rhsReal(ind[i]) + lpi->spx->realParam(SoPlex::EPSILON_ZERO));
+         DVector lhsvec(lpi->spx->numRowsReal());
+         DVector rhsvec(lpi->spx->numRowsReal());
+
+         lpi->spx->getLhsReal(lhsvec);
+         lpi->spx->getRhsReal(rhsvec);
+         for( i = 0; i < nrows; ++i )
+         {
+            assert(0 <= ind[i] && ind[i] < lpi->spx->numRowsReal());
+            lhsvec[ind[i]] = lhs[i];
+            rhsvec[ind[i]] = rhs[i];
+         }
+         lpi->spx->changeRangeReal(lhsvec, rhsvec);
+      }
+      else
+#endif
+      {
+         for( i = 0; i < nrows; ++i )
+         {
+            assert(0 <= ind[i] && ind[i] < lpi->spx->numRowsReal());
+            lpi->spx->changeRangeReal(ind[i], lhs[i], rhs[i]);
+            assert(lpi->spx->lhsReal(ind[i]) <= lpi->spx->rhsReal(ind[i]) + lpi->spx->realParam(SoPlex::EPSILON_ZERO));
+         }
       }
    }
 #ifndef NDEBUG
@@ -107,6 +107,18 @@ typedef struct SCIP_LPi SCIP_LPI;                 /**< solver dependent LP inter
 typedef struct SCIP_LPiState SCIP_LPISTATE;       /**< complete LP state (i.e. basis information) */
 typedef struct SCIP_LPiNorms SCIP_LPINORMS;       /**< LP pricing norms information */
 
+/** provides the nonzero coefficients of the k-th column or row added by SCIPlpiAddColsCallback() or
+ *  SCIPlpiAddRowsCallback()
+ *
+ *  input:
+ *  - vecdata         : data passed to SCIPlpiAddColsCallback() or SCIPlpiAddRowsCallback()
+ *  - k               : index of the column or row among the added ones
+ *  - ind             : array to store the LP solver positions of the rows or columns of the nonzero coefficients
+ *  - val             : array to store the nonzero coefficients
+ *  - len             : pointer to store the number of nonzero coefficients
+ */
+#define SCIP_DECL_LPIGETVEC(x) SCIP_RETCODE x (void* vecdata, int k, int* ind, SCIP_Real* val, int* len)
+
 #ifdef __cplusplus
 }
 #endif
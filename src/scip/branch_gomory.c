@@ -77,6 +77,7 @@
 #define BRANCHRULE_MAXBOUNDDIST    1.0
 
 #define DEFAULT_MAXNCANDS          -1    /**< maximum number of branching candidates to produce a cut for */
+#define TABLEAUBATCHSIZE           16    /**< number of tableau rows that are queried from the LP at once */
 #define DEFAULT_EFFICACYWEIGHT     1.0   /**< the weight of efficacy in weighted sum cut scoring rule */
 #define DEFAULT_OBJPARALLELWEIGHT  0.0   /**< the weight of objective parallelism in weighted sum scoring rule */
 #define DEFAULT_INTSUPPORTWEIGHT   0.0   /**< the weight of integer support in weighted sum cut scoring rule */
@@ -385,14 +386,14 @@ SCIP_DECL_BRANCHEXECLP(branchExeclpGomory)
    SCIP_ROW** rows;
    SCIP_Real* lpcandssol;
    SCIP_Real* lpcandsfrac;
-   SCIP_Real* binvrow;
-   SCIP_Real* binvarow;
+   SCIP_Real** binvrows;
+   SCIP_Real** binvarows;
    SCIP_Real* cutcoefs;
    SCIP_ROW* cut;
    SCIP_COL* col;
    int* basisind;
    int* basicvarpos2tableaurow;
-   int* inds;
+   int* tableaurows;
    const char* name;
    SCIP_Real cutrhs;
    SCIP_Real score;
@@ -400,13 +401,14 @@ SCIP_DECL_BRANCHEXECLP(branchExeclpGomory)
    SCIP_Bool success;
    int nlpcands;
    int maxncands;
+   int batchsize;
    int ncols;
    int nrows;
    int lppos;
-   int ninds;
    int bestcand;
    int i;
    int j;
+   int k;
 
    name = (char *) "test";
 
@@ -467,9 +469,17 @@ SCIP_DECL_BRANCHEXECLP(branchExeclpGomory)
    SCIP_CALL( SCIPallocBufferArray(scip, &cutcoefs, ncols) );
    SCIP_CALL( SCIPallocBufferArray(scip, &basisind, nrows) );
    SCIP_CALL( SCIPallocBufferArray(scip, &basicvarpos2tableaurow, ncols) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &binvrow, nrows) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &binvarow, ncols) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &inds, nrows) );
+
+   /* the tableau rows of the candidates are queried in batches, see SCIPgetLPBInvARows() */
+   batchsize = MIN(maxncands, TABLEAUBATCHSIZE);
+   SCIP_CALL( SCIPallocBufferArray(scip, &tableaurows, batchsize) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &binvrows, batchsize) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &binvarows, batchsize) );
+   for( k = 0; k < batchsize; ++k )
+   {
+      SCIP_CALL( SCIPallocBufferArray(scip, &binvrows[k], nrows) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &binvarows[k], ncols) );
+   }
 
    /* Create basis indices mapping (from the column position to LP tableau rox index) */
    for( i = 0; i < ncols; ++i )
@@ -486,7 +496,6 @@ SCIP_DECL_BRANCHEXECLP(branchExeclpGomory)
    /* Initialise the best candidate */
    bestcand = 0;
    bestscore = -SCIPinfinity(scip);
-   ninds = -1;
 
    /* Iterate over candidates and get best cut score */
    for( i = 0; i < maxncands; i++ )
@@ -494,19 +503,29 @@ SCIP_DECL_BRANCHEXECLP(branchExeclpGomory)
       /* Initialise the score of the cut */
       score = 0;
 
-      /* Get the LP position of the branching candidate */
-      col = SCIPvarGetCol(lpcands[i]);
-      lppos = SCIPcolGetLPPos(col);
-      assert(lppos != -1);
+      /* Get the rows of B^-1 and the tableau rows for the next batch of basic integer variables with fractional
+       * solution value
+       */
+      k = i % batchsize;
+      if( k == 0 )
+      {
+         int nbatch = MIN(batchsize, maxncands - i);
+
+         for( j = 0; j < nbatch; ++j )
+         {
+            /* Get the LP position of the branching candidate */
+            col = SCIPvarGetCol(lpcands[i + j]);
+            lppos = SCIPcolGetLPPos(col);
+            assert(lppos != -1);
 
-      /* get the row of B^-1 for this basic integer variable with fractional solution value */
-      SCIP_CALL(SCIPgetLPBInvRow(scip, basicvarpos2tableaurow[lppos], binvrow, inds, &ninds));
+            tableaurows[j] = basicvarpos2tableaurow[lppos];
+         }
 
-      /* Get the Tableau row for this basic integer variable with fractional solution value */
-      SCIP_CALL(SCIPgetLPBInvARow(scip, basicvarpos2tableaurow[lppos], binvrow, binvarow, inds, &ninds));
+         SCIP_CALL( SCIPgetLPBInvARows(scip, tableaurows, nbatch, binvrows, binvarows) );
+      }
 
       /* Compute the GMI cut */
-      success = getGMIFromRow(scip, ncols, nrows, cols, rows, binvrow, binvarow, &lpcandssol[i], cutcoefs,
+      success = getGMIFromRow(scip, ncols, nrows, cols, rows, binvrows[k], binvarows[k], &lpcandssol[i], cutcoefs,
          &cutrhs, branchruledata->useweakercuts);
 
       /* Calculate the weighted sum score of measures */
@@ -541,9 +560,14 @@ SCIP_DECL_BRANCHEXECLP(branchExeclpGomory)
    }
 
    /* Free temporary memory */
-   SCIPfreeBufferArray(scip, &inds);
-   SCIPfreeBufferArray(scip, &binvrow);
-   SCIPfreeBufferArray(scip, &binvarow);
+   for( k = batchsize - 1; k >= 0; --k )
+   {
+      SCIPfreeBufferArray(scip, &binvarows[k]);
+      SCIPfreeBufferArray(scip, &binvrows[k]);
+   }
+   SCIPfreeBufferArray(scip, &binvarows);
+   SCIPfreeBufferArray(scip, &binvrows);
+   SCIPfreeBufferArray(scip, &tableaurows);
    SCIPfreeBufferArray(scip, &basicvarpos2tableaurow);
    SCIPfreeBufferArray(scip, &basisind);
    SCIPfreeBufferArray(scip, &cutcoefs);
@@ -0,0 +1,531 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   branch_learned.c
+ * @ingroup DEFPLUGINS_BRANCH
+ * @brief  branching rule that scores the candidates by a user-provided model
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/branch_learned.h"
+#include "scip/pub_branch.h"
+#include "scip/pub_fileio.h"
+#include "scip/pub_history.h"
+#include "scip/pub_lp.h"
+#include "scip/pub_message.h"
+#include "scip/pub_misc.h"
+#include "scip/pub_var.h"
+#include "scip/scip_branch.h"
+#include "scip/scip_lp.h"
+#include "scip/scip_mem.h"
+#include "scip/scip_message.h"
+#include "scip/scip_numerics.h"
+#include "scip/scip_param.h"
+#include "scip/scip_prob.h"
+#include "scip/scip_solvingstats.h"
+#include "scip/scip_tree.h"
+#include "scip/scip_var.h"
+#include <string.h>
+
+
+#define BRANCHRULE_NAME          "learned"
+#define BRANCHRULE_DESC          "branching on the candidate with the best score predicted by a user-provided model"
+#define BRANCHRULE_PRIORITY      -100000
+#define BRANCHRULE_MAXDEPTH      -1
+#define BRANCHRULE_MAXBOUNDDIST  1.0
+
+#define DEFAULT_MODELFILE        "-"         /**< file with the model, or "-" for the default linear model */
+
+
+/** features of a branching candidate, see branch_learned.h */
+enum Feature
+{
+   FEATURE_FRAC        = 0,                  /**< fractionality */
+   FEATURE_PSCOST      = 1,                  /**< normalized pseudocost score */
+   FEATURE_PSCOSTREL   = 2,                  /**< reliability of the pseudocosts */
+   FEATURE_CONFLICT    = 3,                  /**< normalized conflict score */
+   FEATURE_CONFLENGTH  = 4,                  /**< normalized conflict length score */
+   FEATURE_INFERENCE   = 5,                  /**< normalized inference score */
+   FEATURE_CUTOFF      = 6,                  /**< normalized cutoff score */
+   FEATURE_OBJ         = 7,                  /**< relative objective coefficient */
+   FEATURE_DENSITY     = 8                   /**< relative number of nonzeros of the column in the LP */
+};
+
+#define NFEATURES                9           /**< number of features */
+
+/** intercept and weights of the default linear model, which uses the default weights of reliability branching */
+static const SCIP_Real defaultweights[NFEATURES + 1] = {
+   0.0,                                      /* intercept */
+   0.0,                                      /* fractionality */
+   1.0,                                      /* pseudocost score */
+   0.0,                                      /* pseudocost reliability */
+   0.01,                                     /* conflict score */
+   0.0,                                      /* conflict length score */
+   0.0001,                                   /* inference score */
+   0.0001,                                   /* cutoff score */
+   0.0,                                      /* objective coefficient */
+   0.0                                       /* column density */
+};
+
+/** branching rule data */
+struct SCIP_BranchruleData
+{
+   char*                 modelfile;          /**< file with the model, or "-" for the default linear model */
+   SCIP_Real*            weights;            /**< intercept and weights of a linear model, or NULL */
+   SCIP_REGFOREST*       regforest;          /**< regression forest, or NULL */
+   SCIP_Real*            features;           /**< features of the candidates; feature f of candidate i is stored at
+                                              *   position f * candssize + i */
+   SCIP_Real*            scores;             /**< predicted scores of the candidates */
+   int                   candssize;          /**< number of candidates that fit into features and scores */
+};
+
+
+/*
+ * Local methods
+ */
+
+/** frees the model */
+static
+void freeModel(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_BRANCHRULEDATA*  branchruledata      /**< branching rule data */
+   )
+{
+   assert(branchruledata != NULL);
+
+   SCIPregForestFree(&branchruledata->regforest);
+   SCIPfreeBlockMemoryArrayNull(scip, &branchruledata->weights, NFEATURES + 1);
+}
+
+/** reads the model from a file; a linear model starts with "### LINEAR FEATURE_DIM=<dim>", a regression forest is
+ *  given in RFCSV format like for the tree size estimation
+ */
+static
+SCIP_RETCODE readModel(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_BRANCHRULEDATA*  branchruledata,     /**< branching rule data */
+   const char*           filename            /**< name of file with the model */
+   )
+{
+   SCIP_FILE* file;
+   char buffer[SCIP_MAXSTRLEN];
+   SCIP_Bool error = FALSE;
+   int dim;
+   int pos;
+
+   assert(branchruledata != NULL);
+   assert(branchruledata->weights == NULL && branchruledata->regforest == NULL);
+
+   file = SCIPfopen(filename, "r");
+
+   if( file == NULL )
+   {
+      SCIPerrorMessage("Could not open model file <%s>\n", filename);
+      return SCIP_NOFILE;
+   }
+
+   if( SCIPfgets(buffer, (int) sizeof(buffer), file) == NULL )
+   {
+      SCIPerrorMessage("Could not read first line of model file <%s>\n", filename);
+      error = TRUE;
+   }
+   /* linear model: intercept and one weight per feature, one number per line */
+   /* coverity[secure_coding] */
+   else if( sscanf(buffer, "### LINEAR FEATURE_DIM=%10d", &dim) == 1 )
+   {
+      if( dim != NFEATURES )
+      {
+         SCIPerrorMessage("Feature dimension %d of model file <%s> does not match the %d features of branching rule <%s>\n",
+            dim, filename, NFEATURES, BRANCHRULE_NAME);
+         error = TRUE;
+      }
+      else
+      {
+         SCIP_CALL( SCIPallocBlockMemoryArray(scip, &branchruledata->weights, NFEATURES + 1) );
+
+         for( pos = 0; pos <= NFEATURES && !error; ++pos )
+         {
+            char* endptr;
+
+            if( SCIPfgets(buffer, (int) sizeof(buffer), file) == NULL
+               || !SCIPstrToRealValue(buffer, &branchruledata->weights[pos], &endptr) )
+            {
+               SCIPerrorMessage("Could not read weight %d of model file <%s>\n", pos, filename);
+               error = TRUE;
+            }
+         }
+      }
+   }
+   /* regression forest in RFCSV format, which is read by the shared reader */
+   else if( strncmp(buffer, "### NTREES=", 11) == 0 )
+   {
+      SCIPfclose(file);
+      file = NULL;
+
+      SCIP_CALL( SCIPregForestFromFile(&branchruledata->regforest, filename) );
+
+      if( SCIPregForestGetDim(branchruledata->regforest) != NFEATURES )
+      {
+         SCIPerrorMessage("Feature dimension %d of model file <%s> does not match the %d features of branching rule <%s>\n",
+            SCIPregForestGetDim(branchruledata->regforest), filename, NFEATURES, BRANCHRULE_NAME);
+         error = TRUE;
+      }
+   }
+   else
+   {
+      SCIPerrorMessage("Unknown model format in first line of model file <%s>\n", filename);
+      error = TRUE;
+   }
+
+   if( file != NULL )
+      SCIPfclose(file);
+
+   if( error )
+   {
+      freeModel(scip, branchruledata);
+      return SCIP_READERROR;
+   }
+
+   SCIPverbMessage(scip, SCIP_VERBLEVEL_NORMAL, NULL, "branching rule <%s> read %s model from file <%s>\n",
+      BRANCHRULE_NAME, branchruledata->weights != NULL ? "linear" : "regression forest", filename);
+
+   return SCIP_OKAY;
+}
+
+/** ensures that the feature and score arrays can store the given number of candidates */
+static
+SCIP_RETCODE ensureCandsSize(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_BRANCHRULEDATA*  branchruledata,     /**< branching rule data */
+   int                   ncands              /**< number of candidates */
+   )
+{
+   int newsize;
+
+   assert(branchruledata != NULL);
+
+   if( ncands <= branchruledata->candssize )
+      return SCIP_OKAY;
+
+   newsize = SCIPcalcMemGrowSize(scip, ncands);
+
+   /* the features are stored feature by feature, so the old content is useless after resizing */
+   SCIPfreeBlockMemoryArrayNull(scip, &branchruledata->features, NFEATURES * branchruledata->candssize);
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &branchruledata->features, NFEATURES * newsize) ); /*lint !e647*/
+   SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &branchruledata->scores, branchruledata->candssize, newsize) );
+   branchruledata->candssize = newsize;
+
+   return SCIP_OKAY;
+}
+
+/** normalizes a score by the average score of all variables like reliability branching does */
+static
+SCIP_Real normalizeScore(
+   SCIP_Real             score,              /**< score of the variable */
+   SCIP_Real             avgscore            /**< average score, at least 0.1 */
+   )
+{
+   assert(avgscore >= 0.1);
+
+   return 1.0 - 1.0 / (1.0 + score / avgscore);
+}
+
+/** gathers the features of all candidates; feature by feature, such that the inference can run over contiguous
+ *  arrays
+ */
+static
+void computeFeatures(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_BRANCHRULEDATA*  branchruledata,     /**< branching rule data */
+   SCIP_VAR**            cands,              /**< branching candidates */
+   SCIP_Real*            candssol,           /**< LP solution values of the candidates */
+   SCIP_Real*            candsfrac,          /**< fractionalities of the candidates */
+   int                   ncands              /**< number of candidates */
+   )
+{
+   SCIP_Real* features;
+   SCIP_Real avgpscostscore;
+   SCIP_Real avgconflictscore;
+   SCIP_Real avgconflengthscore;
+   SCIP_Real avginferencescore;
+   SCIP_Real avgcutoffscore;
+   SCIP_Real objnorm;
+   int nlprows;
+   int stride;
+   int i;
+
+   assert(branchruledata != NULL);
+   assert(ncands <= branchruledata->candssize);
+
+   features = branchruledata->features;
+   stride = branchruledata->candssize;
+
+   avgpscostscore = SCIPgetAvgPseudocostScore(scip);
+   avgpscostscore = MAX(avgpscostscore, 0.1);
+   avgconflictscore = SCIPgetAvgConflictScore(scip);
+   avgconflictscore = MAX(avgconflictscore, 0.1);
+   avgconflengthscore = SCIPgetAvgConflictlengthScore(scip);
+   avgconflengthscore = MAX(avgconflengthscore, 0.1);
+   avginferencescore = SCIPgetAvgInferenceScore(scip);
+   avginferencescore = MAX(avginferencescore, 0.1);
+   avgcutoffscore = SCIPgetAvgCutoffScore(scip);
+   avgcutoffscore = MAX(avgcutoffscore, 0.1);
+   objnorm = SCIPgetObjNorm(scip);
+   nlprows = SCIPgetNLPRows(scip);
+
+   for( i = 0; i < ncands; ++i )
+   {
+      SCIP_VAR* var = cands[i];
+      SCIP_Real ndowns = SCIPgetVarPseudocostCountCurrentRun(scip, var, SCIP_BRANCHDIR_DOWNWARDS);
+      SCIP_Real nups = SCIPgetVarPseudocostCountCurrentRun(scip, var, SCIP_BRANCHDIR_UPWARDS);
+      SCIP_Real ncount = MIN(ndowns, nups);
+
+      features[FEATURE_FRAC * stride + i] = MIN(candsfrac[i], 1.0 - candsfrac[i]);
+      features[FEATURE_PSCOST * stride + i] = normalizeScore(SCIPgetVarPseudocostScore(scip, var, candssol[i]),
+         avgpscostscore);
+      features[FEATURE_PSCOSTREL * stride + i] = ncount / (1.0 + ncount);
+      features[FEATURE_CONFLICT * stride + i] = normalizeScore(SCIPgetVarConflictScore(scip, var), avgconflictscore);
+      features[FEATURE_CONFLENGTH * stride + i] = normalizeScore(SCIPgetVarConflictlengthScore(scip, var),
+         avgconflengthscore);
+      features[FEATURE_INFERENCE * stride + i] = normalizeScore(SCIPgetVarAvgInferenceScore(scip, var),
+         avginferencescore);
+      features[FEATURE_CUTOFF * stride + i] = normalizeScore(SCIPgetVarAvgCutoffScore(scip, var), avgcutoffscore);
+      features[FEATURE_OBJ * stride + i] = objnorm > 0.0 ? REALABS(SCIPvarGetObj(var)) / objnorm : 0.0;
+      features[FEATURE_DENSITY * stride + i] = nlprows > 0 ? SCIPcolGetNLPNonz(SCIPvarGetCol(var)) / (SCIP_Real)nlprows
+         : 0.0;
+   }
+}
+
+/** predicts the scores of all candidates by the model; the loops run over the candidates in the innermost loop and
+ *  only access the preallocated arrays of the branching rule data
+ */
+static
+void predictScores(
+   SCIP_BRANCHRULEDATA*  branchruledata,     /**< branching rule data */
+   int                   ncands              /**< number of candidates */
+   )
+{
+   const SCIP_Real* features;
+   SCIP_Real* scores;
+   int stride;
+   int i;
+
+   assert(branchruledata != NULL);
+
+   features = branchruledata->features;
+   scores = branchruledata->scores;
+   stride = branchruledata->candssize;
+
+   if( branchruledata->regforest == NULL )
+   {
+      const SCIP_Real* weights = branchruledata->weights != NULL ? branchruledata->weights : defaultweights;
+      int f;
+
+      for( i = 0; i < ncands; ++i )
+         scores[i] = weights[0];
+
+      for( f = 0; f < NFEATURES; ++f )
+      {
+         const SCIP_Real* feature = &features[f * stride];
+         SCIP_Real weight = weights[f + 1];
+
+         if( weight == 0.0 ) /*lint !e777*/
+            continue;
+
+         for( i = 0; i < ncands; ++i )
+            scores[i] += weight * feature[i];
+      }
+   }
+   else
+      SCIPregForestPredictBatch(branchruledata->regforest, features, stride, ncands, scores);
+}
+
+
+/*
+ * Callback methods of branching rule
+ */
+
+/** copy method for branchrule plugins (called when SCIP copies plugins) */
+static
+SCIP_DECL_BRANCHCOPY(branchCopyLearned)
+{  /*lint --e{715}*/
+   assert(scip != NULL);
+   assert(branchrule != NULL);
+   assert(strcmp(SCIPbranchruleGetName(branchrule), BRANCHRULE_NAME) == 0);
+
+   /* call inclusion method of branchrule */
+   SCIP_CALL( SCIPincludeBranchruleLearned(scip) );
+
+   return SCIP_OKAY;
+}
+
+/** destructor of branching rule to free user data (called when SCIP is exiting) */
+static
+SCIP_DECL_BRANCHFREE(branchFreeLearned)
+{  /*lint --e{715}*/
+   SCIP_BRANCHRULEDATA* branchruledata;
+
+   branchruledata = SCIPbranchruleGetData(branchrule);
+   assert(branchruledata != NULL);
+   assert(branchruledata->features == NULL);
+   assert(branchruledata->weights == NULL && branchruledata->regforest == NULL);
+
+   SCIPfreeBlockMemory(scip, &branchruledata);
+   SCIPbranchruleSetData(branchrule, NULL);
+
+   return SCIP_OKAY;
+}
+
+/** initialization method of branching rule (called after problem was transformed) */
+static
+SCIP_DECL_BRANCHINIT(branchInitLearned)
+{  /*lint --e{715}*/
+   SCIP_BRANCHRULEDATA* branchruledata;
+
+   branchruledata = SCIPbranchruleGetData(branchrule);
+   assert(branchruledata != NULL);
+
+   if( strcmp(branchruledata->modelfile, DEFAULT_MODELFILE) != 0 )
+   {
+      SCIP_CALL( readModel(scip, branchruledata, branchruledata->modelfile) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** deinitialization method of branching rule (called before transformed problem is freed) */
+static
+SCIP_DECL_BRANCHEXIT(branchExitLearned)
+{  /*lint --e{715}*/
+   SCIP_BRANCHRULEDATA* branchruledata;
+
+   branchruledata = SCIPbranchruleGetData(branchrule);
+   assert(branchruledata != NULL);
+
+   freeModel(scip, branchruledata);
+
+   SCIPfreeBlockMemoryArrayNull(scip, &branchruledata->scores, branchruledata->candssize);
+   SCIPfreeBlockMemoryArrayNull(scip, &branchruledata->features, NFEATURES * branchruledata->candssize);
+   branchruledata->candssize = 0;
+
+   return SCIP_OKAY;
+}
+
+/** branching execution method for fractional LP solutions */
+static
+SCIP_DECL_BRANCHEXECLP(branchExeclpLearned)
+{  /*lint --e{715}*/
+   SCIP_BRANCHRULEDATA* branchruledata;
+   SCIP_VAR** lpcands;
+   SCIP_Real* lpcandssol;
+   SCIP_Real* lpcandsfrac;
+   SCIP_Real bestscore;
+   SCIP_Bool bestnearintegral;
+   int nlpcands;
+   int bestcand;
+   int i;
+
+   assert(branchrule != NULL);
+   assert(strcmp(SCIPbranchruleGetName(branchrule), BRANCHRULE_NAME) == 0);
+   assert(scip != NULL);
+   assert(result != NULL);
+
+   SCIPdebugMsg(scip, "Execlp method of learned branching in depth %d\n", SCIPgetDepth(scip));
+
+   branchruledata = SCIPbranchruleGetData(branchrule);
+   assert(branchruledata != NULL);
+
+   /* get branching candidates */
+   SCIP_CALL( SCIPgetLPBranchCands(scip, &lpcands, &lpcandssol, &lpcandsfrac, NULL, &nlpcands, NULL) );
+   assert(nlpcands > 0);
+
+   SCIP_CALL( ensureCandsSize(scip, branchruledata, nlpcands) );
+
+   computeFeatures(scip, branchruledata, lpcands, lpcandssol, lpcandsfrac, nlpcands);
+   predictScores(branchruledata, nlpcands);
+
+   /* select the candidate with the best score; like reliability branching, avoid close to integral variables */
+   bestcand = -1;
+   bestscore = -SCIPinfinity(scip);
+   bestnearintegral = TRUE;
+   for( i = 0; i < nlpcands; ++i )
+   {
+      SCIP_Bool nearintegral = MIN(lpcandsfrac[i], 1.0 - lpcandsfrac[i]) < 10.0 * SCIPfeastol(scip);
+
+      if( bestcand == -1 || (bestnearintegral && !nearintegral)
+         || (bestnearintegral == nearintegral && branchruledata->scores[i] > bestscore) )
+      {
+         bestcand = i;
+         bestscore = branchruledata->scores[i];
+         bestnearintegral = nearintegral;
+      }
+   }
+   assert(0 <= bestcand && bestcand < nlpcands);
+
+   SCIPdebugMsg(scip, " -> %d candidates, selected candidate %d: variable <%s> (solval=%g, score=%g)\n",
+      nlpcands, bestcand, SCIPvarGetName(lpcands[bestcand]), lpcandssol[bestcand], bestscore);
+
+   /* perform the branching */
+   SCIP_CALL( SCIPbranchVar(scip, lpcands[bestcand], NULL, NULL, NULL) );
+   *result = SCIP_BRANCHED;
+
+   return SCIP_OKAY;
+}
+
+
+/*
+ * branching specific interface methods
+ */
+
+/** creates the learned branching rule and includes it in SCIP */
+SCIP_RETCODE SCIPincludeBranchruleLearned(
+   SCIP*                 scip                /**< SCIP data structure */
+   )
+{
+   SCIP_BRANCHRULEDATA* branchruledata;
+   SCIP_BRANCHRULE* branchrule;
+
+   /* create learned branching rule data */
+   SCIP_CALL( SCIPallocClearBlockMemory(scip, &branchruledata) );
+
+   /* include branching rule */
+   SCIP_CALL( SCIPincludeBranchruleBasic(scip, &branchrule, BRANCHRULE_NAME, BRANCHRULE_DESC, BRANCHRULE_PRIORITY,
+         BRANCHRULE_MAXDEPTH, BRANCHRULE_MAXBOUNDDIST, branchruledata) );
+
+   assert(branchrule != NULL);
+
+   /* set non-fundamental callbacks via specific setter functions*/
+   SCIP_CALL( SCIPsetBranchruleCopy(scip, branchrule, branchCopyLearned) );
+   SCIP_CALL( SCIPsetBranchruleFree(scip, branchrule, branchFreeLearned) );
+   SCIP_CALL( SCIPsetBranchruleInit(scip, branchrule, branchInitLearned) );
+   SCIP_CALL( SCIPsetBranchruleExit(scip, branchrule, branchExitLearned) );
+   SCIP_CALL( SCIPsetBranchruleExecLp(scip, branchrule, branchExeclpLearned) );
+
+   SCIP_CALL( SCIPaddStringParam(scip, "branching/" BRANCHRULE_NAME "/modelfile",
+         "file with a linear model or a regression forest in RFCSV format (\"-\": default linear model)",
+         &branchruledata->modelfile, FALSE, DEFAULT_MODELFILE, NULL, NULL) );
+
+   return SCIP_OKAY;
+}
@@ -0,0 +1,88 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   branch_learned.h
+ * @ingroup BRANCHINGRULES
+ * @brief  branching rule that scores the candidates by a user-provided model
+ *
+ * The learned branching rule evaluates a lightweight model on a fixed vector of features of each LP branching
+ * candidate and branches on a candidate with the largest predicted score. No LPs are solved, so the rule is meant to
+ * replace the strong branching calls of reliability branching on instance families for which a model has been trained.
+ * The features are taken from the branching history of the variable, its LP column, and the LP solution:
+ *
+ *  0. fractionality \f$\min\{\hat{x}_j - \lfloor \hat{x}_j \rfloor, \lceil \hat{x}_j \rceil - \hat{x}_j\}\f$
+ *  1. pseudocost score
+ *  2. pseudocost reliability, i.e., \f$n/(1+n)\f$ for the smaller number \f$n\f$ of pseudocost updates in the two directions
+ *  3. conflict score
+ *  4. conflict length score
+ *  5. inference score
+ *  6. cutoff score
+ *  7. absolute objective coefficient divided by the norm of the objective
+ *  8. number of nonzeros of the column in the LP divided by the number of LP rows
+ *
+ * The scores 1 and 3-6 are normalized by the average score \f$a\f$ over all variables, like in reliability
+ * branching, i.e., a score \f$s\f$ becomes \f$1 - 1/(1 + s/a)\f$.
+ *
+ * The model is read from the file given by the parameter branching/learned/modelfile. Two formats are supported. A
+ * regression forest is given in the RFCSV format of the tree size estimation (see estimation/regforestfilename); a
+ * linear model consists of the line
+ *
+ *     ### LINEAR FEATURE_DIM=9
+ *
+ * followed by the intercept and one weight per feature, one number per line. The feature dimension of the model must
+ * match the number of features above. If no file is given, a linear model with the default weights of reliability
+ * branching for the pseudocost, conflict, inference, and cutoff scores is used.
+ *
+ * There are no features of the node, such as its depth, since they are equal for all candidates of a node and hence do
+ * not change the ranking of the candidates by a linear model.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#ifndef __SCIP_BRANCH_LEARNED_H__
+#define __SCIP_BRANCH_LEARNED_H__
+
+
+#include "scip/def.h"
+#include "scip/type_retcode.h"
+#include "scip/type_scip.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** creates the learned branching rule and includes it in SCIP
+ *
+ *  @ingroup BranchingRuleIncludes
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPincludeBranchruleLearned(
+   SCIP*                 scip                /**< SCIP data structure */
+   );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
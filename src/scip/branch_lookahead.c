@@ -61,11 +61,13 @@
 #include "scip/branch_lookahead.h"
 #include "scip/cons_logicor.h"
 #include "scip/pub_branch.h"
+#include "scip/pub_lp.h"
 #include "scip/pub_message.h"
 #include "scip/pub_misc.h"
 #include "scip/pub_tree.h"
 #include "scip/pub_var.h"
 #include "scip/scip_branch.h"
+#include "scip/scip_concurrent.h"
 #include "scip/scip_cons.h"
 #include "scip/scip_general.h"
 #include "scip/scip_lp.h"
@@ -79,6 +81,7 @@
 #include "scip/scip_solvingstats.h"
 #include "scip/scip_tree.h"
 #include "scip/scip_var.h"
+#include "tpi/tpi.h"
 #include <string.h>
 
 #define BRANCHRULE_NAME            "lookahead"
@@ -114,6 +117,9 @@
 #define DEFAULT_PROPAGATE              TRUE  /**< Should domain propagation be executed before each temporary node is
                                               *   solved? */
 #define DEFAULT_USELEVEL2DATA          TRUE  /**< should branching data generated at depth level 2 be stored for re-using it? */
+#define DEFAULT_PARALLEL               FALSE /**< should the level 2 nodes be evaluated in parallel on LP clones before
+                                              *   the lookahead, if several threads are available and propagation is
+                                              *   disabled? */
 #define DEFAULT_APPLYCHILDBOUNDS       FALSE /**< should bounds known for child nodes be applied? */
 #define DEFAULT_ENFORCEMAXDOMREDS      FALSE /**< should the maximum number of domain reductions maxnviolateddomreds be enforced? */
 #define DEFAULT_UPDATEBRANCHINGRESULTS FALSE /**< should branching results (and scores) be updated w.r.t. proven dual bounds? */
@@ -1030,6 +1036,8 @@ typedef struct
    SCIP_Bool             addclique;          /**< add binary constraints with two variables found at the root node also as a clique? */
    SCIP_Bool             propagate;          /**< Should the problem be propagated before solving each inner node? */
    SCIP_Bool             uselevel2data;      /**< should branching data generated at depth level 2 be stored for re-using it? */
+   SCIP_Bool             parallel;           /**< should the level 2 nodes be evaluated in parallel on LP clones before the
+                                              *   lookahead, if several threads are available and propagation is disabled? */
    SCIP_Bool             applychildbounds;   /**< should bounds known for child nodes be applied? */
    SCIP_Bool             enforcemaxdomreds;  /**< should the maximum number of domain reductions maxnviolateddomreds be enforced? */
    SCIP_Bool             updatebranchingresults; /**< should branching results (and scores) be updated w.r.t. proven dual bounds? */
@@ -5311,6 +5319,473 @@ SCIP_Bool isStoreDecision(
       || (binconsdata != NULL && binconsdata->conslist->nelements > 0);
 }
 
+/** basis and objective offset of the base LP, taken before probing starts, for the parallel evaluation of level 2
+ *  nodes on LP clones
+ */
+typedef struct
+{
+   int*                  cstat;              /**< basis status of the LP columns */
+   int*                  rstat;              /**< basis status of the LP rows */
+   SCIP_Real             objoffset;          /**< difference between the LP objective value and the objective value of
+                                              *   the LP columns, which is the objective offset of the clones */
+   int                   ncols;              /**< number of LP columns */
+   int                   nrows;              /**< number of LP rows */
+} BASELPDATA;
+
+/** stores the basis of the current LP for the parallel evaluation of level 2 nodes; if the LP has no basis, nothing
+ *  is stored and *baselpdata is set to NULL
+ */
+static
+SCIP_RETCODE baseLPDataCreate(
+   SCIP*                 scip,               /**< SCIP data structure */
+   BASELPDATA**          baselpdata          /**< pointer to store the base LP data */
+   )
+{
+   SCIP_COL** cols;
+   SCIP_LPI* lpi;
+   int ncols;
+   int c;
+
+   assert(scip != NULL);
+   assert(baselpdata != NULL);
+
+   *baselpdata = NULL;
+
+   if( !SCIPisLPSolBasic(scip) )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPgetLPColsData(scip, &cols, &ncols) );
+   SCIP_CALL( SCIPgetLPI(scip, &lpi) );
+
+   SCIP_CALL( SCIPallocBlockMemory(scip, baselpdata) );
+   (*baselpdata)->ncols = ncols;
+   (*baselpdata)->nrows = SCIPgetNLPRows(scip);
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(*baselpdata)->cstat, (*baselpdata)->ncols) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(*baselpdata)->rstat, (*baselpdata)->nrows) );
+
+   /* the LP is flushed, so the columns and rows of the LP solver have the LP positions of SCIP's columns and rows */
+   SCIP_CALL( SCIPlpiGetBase(lpi, (*baselpdata)->cstat, (*baselpdata)->rstat) );
+
+   (*baselpdata)->objoffset = SCIPgetLPObjval(scip);
+   for( c = 0; c < ncols; ++c )
+      (*baselpdata)->objoffset -= SCIPcolGetObj(cols[c]) * SCIPcolGetPrimsol(cols[c]);
+
+   return SCIP_OKAY;
+}
+
+/** frees the base LP data */
+static
+void baseLPDataFree(
+   SCIP*                 scip,               /**< SCIP data structure */
+   BASELPDATA**          baselpdata          /**< pointer to the base LP data */
+   )
+{
+   assert(scip != NULL);
+   assert(baselpdata != NULL);
+   assert(*baselpdata != NULL);
+
+   SCIPfreeBlockMemoryArray(scip, &(*baselpdata)->rstat, (*baselpdata)->nrows);
+   SCIPfreeBlockMemoryArray(scip, &(*baselpdata)->cstat, (*baselpdata)->ncols);
+   SCIPfreeBlockMemory(scip, baselpdata);
+}
+
+/** result of a level 2 node that was evaluated on an LP clone */
+typedef struct
+{
+   SCIP_Real             lpobjval;           /**< LP objective value, including the objective offset */
+   SCIP_Real             newbound;           /**< new bound of the second branching variable */
+   int                   lppos;              /**< LP position of the column of the second branching variable */
+   SCIP_Bool             cutoff;             /**< was the LP infeasible? */
+   SCIP_Bool             upbranch;           /**< was the second branching an up branching? */
+} CLONERESULT;
+
+/** evaluation of one child of a candidate together with all its children on an LP clone */
+typedef struct
+{
+   CLONERESULT*          results;            /**< level 2 results of the child, allocated by the job */
+   SCIP_Real             newbound;           /**< new bound of the candidate */
+   int                   lppos;              /**< LP position of the column of the candidate */
+   int                   nresults;           /**< number of level 2 results */
+   int                   resultssize;        /**< size of the results array */
+   SCIP_Bool             upbranch;           /**< is the child an up branching? */
+} CLONETASK;
+
+/** data that is shared by the jobs of the parallel evaluation of level 2 nodes */
+typedef struct
+{
+   SCIP_LOCK*            lock;               /**< lock for the next task and the iterations */
+   CLONETASK*            tasks;              /**< tasks, two for each candidate */
+   SCIP_Real*            lbs;                /**< lower bounds of the LP columns */
+   SCIP_Real*            ubs;                /**< upper bounds of the LP columns */
+   SCIP_Bool*            integral;           /**< is the variable of the LP column of integral type? */
+   int*                  cstat;              /**< basis status of the LP columns of the base LP */
+   int*                  rstat;              /**< basis status of the LP rows of the base LP */
+   SCIP_Real             objoffset;          /**< objective offset of the clones */
+   SCIP_Real             cutoffbound;        /**< cutoff bound; children with larger LP value are not expanded */
+   SCIP_Real             feastol;            /**< feasibility tolerance for the integrality of LP values */
+   SCIP_Real             infinity;           /**< SCIP's infinity, the LP value of infeasible nodes */
+   SCIP_Longint          niterations;        /**< number of LP iterations used by all jobs */
+   int                   nexttask;           /**< next task that is not assigned to a job */
+   int                   ntasks;             /**< number of tasks */
+} CLONESHARED;
+
+/** a job of the parallel evaluation of level 2 nodes */
+typedef struct
+{
+   CLONESHARED*          shared;             /**< shared data */
+   SCIP_LPI*             lpi;                /**< LP clone of the job */
+   SCIP_Real*            primsol;            /**< buffer for the primal solution of a child */
+   int*                  cstat;              /**< buffer for the basis status of the columns of a child */
+   int*                  rstat;              /**< buffer for the basis status of the rows of a child */
+   int                   ncols;              /**< number of LP columns */
+} CLONEJOB;
+
+/** solves the LP of an LP clone from the given basis by the dual simplex; called by the jobs of the parallel
+ *  evaluation, so no SCIP methods may be used
+ *
+ *  @return TRUE if the LP was solved to optimality or proven to be infeasible
+ */
+static
+SCIP_Bool solveLPClone(
+   SCIP_LPI*             lpi,                /**< LP interface of the clone */
+   int*                  cstat,              /**< basis status of the columns to start from */
+   int*                  rstat,              /**< basis status of the rows to start from */
+   SCIP_Real             objoffset,          /**< objective offset of the clone */
+   SCIP_Real             infinity,           /**< value to return as LP value of an infeasible LP */
+   SCIP_Real*            lpobjval,           /**< pointer to store the LP objective value */
+   SCIP_Bool*            cutoff,             /**< pointer to store whether the LP is infeasible */
+   SCIP_Longint*         niterations         /**< pointer to add the number of iterations to */
+   )
+{
+   int iterations;
+
+   *cutoff = FALSE;
+   *lpobjval = infinity;
+
+   /* an error should not kill the overall solving process */
+   if( SCIPlpiSetBase(lpi, cstat, rstat) != SCIP_OKAY || SCIPlpiSolveDual(lpi) != SCIP_OKAY )
+      return FALSE;
+
+   if( SCIPlpiGetIterations(lpi, &iterations) == SCIP_OKAY )
+      *niterations += iterations;
+
+   if( SCIPlpiIsPrimalInfeasible(lpi) )
+   {
+      *cutoff = TRUE;
+      return TRUE;
+   }
+
+   if( !SCIPlpiIsOptimal(lpi) || SCIPlpiGetObjval(lpi, lpobjval) != SCIP_OKAY )
+      return FALSE;
+
+   *lpobjval += objoffset;
+
+   return TRUE;
+}
+
+/** job of the parallel evaluation of level 2 nodes: repeatedly takes the next child of a candidate, solves its LP on
+ *  the LP clone, and solves the LPs of both children of each of its fractional integer columns; the results are only
+ *  stored in the task, so different jobs never write to the same memory
+ */
+static
+SCIP_DECL_PARALLELJOB(execLevel2Job)
+{
+   CLONEJOB* job = (CLONEJOB*)jobarg;
+   CLONESHARED* shared = job->shared;
+
+   for( ;; )
+   {
+      CLONETASK* task;
+      SCIP_Longint niterations = 0;
+      SCIP_Real lpobjval;
+      SCIP_Real lb;
+      SCIP_Real ub;
+      SCIP_Bool cutoff;
+      SCIP_Bool lpierror = FALSE;
+      int t;
+      int c;
+
+      SCIP_CALL( SCIPtpiAcquireLock(shared->lock) );
+      t = shared->nexttask;
+      if( t < shared->ntasks )
+         ++shared->nexttask;
+      SCIP_CALL( SCIPtpiReleaseLock(shared->lock) );
+
+      if( t >= shared->ntasks )
+         break;
+
+      task = &shared->tasks[t];
+
+      lb = task->upbranch ? task->newbound : shared->lbs[task->lppos];
+      ub = task->upbranch ? shared->ubs[task->lppos] : task->newbound;
+
+      if( SCIPlpiChgBounds(job->lpi, 1, &task->lppos, &lb, &ub) != SCIP_OKAY )
+         break;
+
+      /* the children are only expanded if the LP of the child is feasible and below the cutoff bound */
+      if( solveLPClone(job->lpi, shared->cstat, shared->rstat, shared->objoffset, shared->infinity, &lpobjval, &cutoff,
+            &niterations)
+         && !cutoff && lpobjval < shared->cutoffbound
+         && SCIPlpiGetSol(job->lpi, NULL, job->primsol, NULL, NULL, NULL) == SCIP_OKAY
+         && SCIPlpiGetBase(job->lpi, job->cstat, job->rstat) == SCIP_OKAY )
+      {
+         for( c = 0; c < job->ncols && !lpierror; ++c )
+         {
+            SCIP_Real frac;
+            int k;
+
+            if( c == task->lppos || !shared->integral[c] )
+               continue;
+
+            frac = job->primsol[c] - floor(job->primsol[c] + shared->feastol);
+            if( frac <= shared->feastol )
+               continue;
+
+            for( k = 0; k < 2 && !lpierror; ++k )
+            {
+               CLONERESULT* result;
+               SCIP_Real deeperlb;
+               SCIP_Real deeperub;
+               SCIP_Real newbound;
+               SCIP_Bool solved;
+
+               newbound = (k == 0) ? floor(job->primsol[c]) : ceil(job->primsol[c]);
+               deeperlb = (k == 0) ? shared->lbs[c] : newbound;
+               deeperub = (k == 0) ? newbound : shared->ubs[c];
+
+               if( SCIPlpiChgBounds(job->lpi, 1, &c, &deeperlb, &deeperub) != SCIP_OKAY )
+               {
+                  lpierror = TRUE;
+                  break;
+               }
+
+               solved = solveLPClone(job->lpi, job->cstat, job->rstat, shared->objoffset, shared->infinity, &lpobjval,
+                  &cutoff, &niterations);
+
+               if( SCIPlpiChgBounds(job->lpi, 1, &c, &shared->lbs[c], &shared->ubs[c]) != SCIP_OKAY )
+                  lpierror = TRUE;
+
+               if( !solved )
+                  continue;
+
+               if( task->nresults >= task->resultssize )
+               {
+                  CLONERESULT* newresults = task->results;
+                  int newsize = 2 * task->resultssize + 8;
+
+                  /* the old block stays valid if the reallocation fails and is freed with the task */
+                  BMSreallocMemoryArray(&newresults, newsize);
+                  if( newresults == NULL )
+                     return SCIP_NOMEMORY;
+                  task->results = newresults;
+                  task->resultssize = newsize;
+               }
+
+               result = &task->results[task->nresults++];
+               result->lpobjval = lpobjval;
+               result->newbound = newbound;
+               result->lppos = c;
+               result->cutoff = cutoff;
+               result->upbranch = (k == 1);
+            }
+         }
+      }
+
+      lb = shared->lbs[task->lppos];
+      ub = shared->ubs[task->lppos];
+      if( SCIPlpiChgBounds(job->lpi, 1, &task->lppos, &lb, &ub) != SCIP_OKAY )
+         lpierror = TRUE;
+
+      SCIP_CALL( SCIPtpiAcquireLock(shared->lock) );
+      shared->niterations += niterations;
+      SCIP_CALL( SCIPtpiReleaseLock(shared->lock) );
+
+      /* the bounds of the clone are not reliable anymore after an error of the LP interface */
+      if( lpierror )
+         break;
+   }
+
+   return SCIP_OKAY;
+}
+
+/** evaluates the level 2 nodes of all candidates in parallel on clones of the base LP and stores the results in the
+ *  level 2 data, from where the sequential lookahead takes them instead of solving the LPs again
+ *
+ *  The children of a candidate are expanded with the fractional integer columns of their LP solution on the clone.
+ *  The clones are not propagated, so the parallel evaluation is only used if the sequential lookahead does not
+ *  propagate either, and the LPs of the clones are the probing LPs of the sequential lookahead; results that do not
+ *  match the candidates of the sequential lookahead are never used.
+ */
+static
+SCIP_RETCODE evaluateLevel2Parallel(
+   SCIP*                 scip,               /**< SCIP data structure */
+   BASELPDATA*           baselpdata,         /**< base LP data */
+   CANDIDATELIST*        candidatelist,      /**< list of candidates to branch on */
+   LEVEL2DATA*           level2data,         /**< level 2 LP results data to fill */
+   int                   nthreads            /**< number of threads to use */
+   )
+{
+   CLONESHARED shared;
+   CLONETASK* tasks;
+   CLONEJOB* jobs;
+   SCIP_COL** cols;
+   void** jobargs;
+   int ncols;
+   int ntasks;
+   int i;
+   int c;
+
+   assert(scip != NULL);
+   assert(baselpdata != NULL);
+   assert(candidatelist != NULL);
+   assert(level2data != NULL);
+   assert(nthreads > 1);
+   assert(SCIPgetProbingDepth(scip) == 0);
+
+   SCIP_CALL( SCIPgetLPColsData(scip, &cols, &ncols) );
+
+   /* the LP changed since the basis was stored */
+   if( ncols != baselpdata->ncols || SCIPgetNLPRows(scip) != baselpdata->nrows )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &tasks, 2 * candidatelist->ncandidates) );
+
+   ntasks = 0;
+   for( i = 0; i < candidatelist->ncandidates; ++i )
+   {
+      SCIP_VAR* branchvar = candidatelist->candidates[i]->branchvar;
+      SCIP_Real branchval = candidatelist->candidates[i]->branchval;
+      int lppos;
+
+      if( SCIPvarGetStatus(branchvar) != SCIP_VARSTATUS_COLUMN || SCIPcolGetLPPos(SCIPvarGetCol(branchvar)) < 0 )
+         continue;
+
+      lppos = SCIPcolGetLPPos(SCIPvarGetCol(branchvar));
+
+      BMSclearMemory(&tasks[ntasks]);
+      tasks[ntasks].lppos = lppos;
+      tasks[ntasks].newbound = SCIPfeasFloor(scip, branchval);
+      tasks[ntasks].upbranch = FALSE;
+      ++ntasks;
+
+      BMSclearMemory(&tasks[ntasks]);
+      tasks[ntasks].lppos = lppos;
+      tasks[ntasks].newbound = SCIPfeasCeil(scip, branchval);
+      tasks[ntasks].upbranch = TRUE;
+      ++ntasks;
+   }
+
+   nthreads = MIN(nthreads, ntasks);
+
+   if( nthreads > 0 )
+   {
+      SCIP_CALL( SCIPallocBufferArray(scip, &jobs, nthreads) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &jobargs, nthreads) );
+
+      BMSclearMemory(&shared);
+      shared.tasks = tasks;
+      shared.ntasks = ntasks;
+      shared.cstat = baselpdata->cstat;
+      shared.rstat = baselpdata->rstat;
+      shared.objoffset = baselpdata->objoffset;
+      shared.cutoffbound = SCIPgetCutoffbound(scip);
+      shared.feastol = SCIPfeastol(scip);
+      shared.infinity = SCIPinfinity(scip);
+
+      SCIP_CALL( SCIPallocBufferArray(scip, &shared.lbs, ncols) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &shared.ubs, ncols) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &shared.integral, ncols) );
+
+      for( c = 0; c < ncols; ++c )
+      {
+         SCIP_VAR* var = SCIPcolGetVar(cols[c]);
+
+         shared.integral[c] = SCIPvarIsIntegral(var) && SCIPvarGetType(var) != SCIP_VARTYPE_IMPLINT;
+      }
+
+      SCIP_CALL( SCIPtpiInitLock(&shared.lock) );
+
+      /* the clones get the basis of the base LP, which has the dimensions of the current LP */
+      assert(ncols == baselpdata->ncols);
+      assert(SCIPgetNLPRows(scip) == baselpdata->nrows);
+
+      for( i = 0; i < nthreads; ++i )
+      {
+         jobs[i].shared = &shared;
+         jobs[i].ncols = ncols;
+         SCIP_CALL( SCIPcreateLPICopy(scip, "lookaheadclone", TRUE, baselpdata->cstat, baselpdata->rstat, &jobs[i].lpi) );
+         SCIP_CALL( SCIPallocBufferArray(scip, &jobs[i].primsol, ncols) );
+         SCIP_CALL( SCIPallocBufferArray(scip, &jobs[i].cstat, ncols) );
+         SCIP_CALL( SCIPallocBufferArray(scip, &jobs[i].rstat, baselpdata->nrows) );
+         jobargs[i] = (void*)&jobs[i];
+      }
+
+      /* the bounds in the representation of the LP solver, which are needed to reset the bounds of the clones */
+      SCIP_CALL( SCIPlpiGetBounds(jobs[0].lpi, 0, ncols - 1, shared.lbs, shared.ubs) );
+
+      SCIP_CALL( SCIPexecParallelJobs(scip, nthreads, execLevel2Job, jobargs, nthreads) );
+
+      for( i = nthreads - 1; i >= 0; --i )
+      {
+         SCIPfreeBufferArray(scip, &jobs[i].rstat);
+         SCIPfreeBufferArray(scip, &jobs[i].cstat);
+         SCIPfreeBufferArray(scip, &jobs[i].primsol);
+         SCIP_CALL( SCIPlpiFree(&jobs[i].lpi) );
+      }
+
+      SCIPtpiDestroyLock(&shared.lock);
+
+      LABdebugMessage(scip, SCIP_VERBLEVEL_HIGH, "Evaluated level 2 nodes of %d candidates in parallel with %d "
+         "LP iterations.\n", ntasks / 2, (int)MIN(shared.niterations, INT_MAX));
+
+      /* store the results in the level 2 data in the order of the tasks, such that the result does not depend on the
+       * scheduling of the jobs
+       */
+      for( i = 0; i < ntasks; ++i )
+      {
+         int r;
+
+         for( r = 0; r < tasks[i].nresults; ++r )
+         {
+            CLONERESULT* cloneresult = &tasks[i].results[r];
+            LEVEL2RESULT* result;
+            SCIP_Bool duplicate;
+
+            level2data->branchvar1 = (unsigned int) SCIPvarGetProbindex(SCIPcolGetVar(cols[tasks[i].lppos]));
+            level2data->branchdir1 = tasks[i].upbranch;
+            level2data->branchval1 = tasks[i].newbound;
+            level2data->branchvar2 = (unsigned int) SCIPvarGetProbindex(SCIPcolGetVar(cols[cloneresult->lppos]));
+            level2data->branchdir2 = cloneresult->upbranch;
+            level2data->branchval2 = cloneresult->newbound;
+
+            /* the same level 2 node can be reached by branching on the two variables in different order */
+            SCIP_CALL( level2dataGetResult(scip, level2data, &result) );
+            if( result != NULL )
+               continue;
+
+            SCIP_CALL( level2dataStoreResult(scip, level2data, cloneresult->lpobjval, cloneresult->cutoff, TRUE,
+                  &duplicate) );
+            assert(!duplicate);
+         }
+      }
+
+      SCIPfreeBufferArray(scip, &shared.integral);
+      SCIPfreeBufferArray(scip, &shared.ubs);
+      SCIPfreeBufferArray(scip, &shared.lbs);
+      SCIPfreeBufferArray(scip, &jobargs);
+      SCIPfreeBufferArray(scip, &jobs);
+   }
+
+   for( i = 0; i < ntasks; ++i )
+   {
+      BMSfreeMemoryArrayNull(&tasks[i].results);
+   }
+
+   SCIPfreeBufferArray(scip, &tasks);
+
+   return SCIP_OKAY;
+}
+
 /** starting point to obtain a branching decision via LAB/ALAB. */
 static
 SCIP_RETCODE selectVarStart(
@@ -5331,6 +5806,7 @@ SCIP_RETCODE selectVarStart(
    DOMAINREDUCTIONS* domainreductions = NULL;
    BINCONSDATA* binconsdata = NULL;
    LEVEL2DATA* level2data = NULL;
+   BASELPDATA* baselpdata = NULL;
    SCIP_SOL* baselpsol = NULL;
    SCIP_Real lpobjval;
 #ifdef SCIP_STATISTIC
@@ -5397,6 +5873,15 @@ SCIP_RETCODE selectVarStart(
       SCIP_CALL( copyCurrentSolution(scip, &baselpsol) );
    }
 
+   /* the basis of the base LP is needed for the LP clones of the parallel evaluation of level 2 nodes, which does not
+    * propagate and is therefore only used if the lookahead does not propagate either
+    */
+   if( config->parallel && !config->propagate && recursiondepth == 2 && config->uselevel2data
+      && SCIPgetNParallelJobThreads(scip) > 1 )
+   {
+      SCIP_CALL( baseLPDataCreate(scip, &baselpdata) );
+   }
+
    LABdebugMessage(scip, SCIP_VERBLEVEL_HIGH, "About to start probing.\n");
    SCIP_CALL( SCIPstartStrongbranch(scip, TRUE) );
    SCIPenableVarHistory(scip);
@@ -5454,6 +5939,12 @@ SCIP_RETCODE selectVarStart(
       if( recursiondepth == 2 && config->uselevel2data )
       {
          SCIP_CALL( level2dataCreate(scip, &level2data) );
+
+         if( baselpdata != NULL )
+         {
+            SCIP_CALL( evaluateLevel2Parallel(scip, baselpdata, candidatelist, level2data,
+                  SCIPgetNParallelJobThreads(scip)) );
+         }
       }
 
 #ifdef SCIP_STATISTIC
@@ -5526,6 +6017,9 @@ SCIP_RETCODE selectVarStart(
    SCIP_CALL( SCIPendStrongbranch(scip) );
    LABdebugMessage(scip, SCIP_VERBLEVEL_HIGH, "Ended probing.\n");
 
+   if( baselpdata != NULL )
+      baseLPDataFree(scip, &baselpdata);
+
    LABdebugMessage(scip, SCIP_VERBLEVEL_HIGH, "Applying found data to the base node.\n");
 
    /* apply domain reductions */
@@ -6325,6 +6819,10 @@ SCIP_RETCODE SCIPincludeBranchruleLookahead(
          "branching/lookahead/uselevel2data",
          "should branching data generated at depth level 2 be stored for re-using it?",
          &branchruledata->config->uselevel2data, TRUE, DEFAULT_USELEVEL2DATA, NULL, NULL) );
+   SCIP_CALL( SCIPaddBoolParam(scip,
+         "branching/lookahead/parallel",
+         "should the level 2 nodes be evaluated in parallel on LP clones before the lookahead, if several threads are available and branching/lookahead/propagate is FALSE?",
+         &branchruledata->config->parallel, TRUE, DEFAULT_PARALLEL, NULL, NULL) );
    SCIP_CALL( SCIPaddBoolParam(scip,
          "branching/lookahead/applychildbounds",
          "should bounds known for child nodes be applied?",
@@ -536,6 +536,94 @@ SCIP_RETCODE SCIPconcurrentSolve(
    return retcode;
 }
 
+/** returns whether SCIPconcurrentExecJobs() is able to run jobs in parallel with the given number of threads
+ *
+ *  @note since other callers may occupy the thread pool at any time, this is only a hint
+ */
+SCIP_Bool SCIPconcurrentCanExecJobsParallel(
+   int                   nthreads            /**< maximal number of threads to use */
+   )
+{
+   /* the TPI uses a single global thread pool, which is occupied while the concurrent solvers are running */
+   return nthreads > 1 && SCIPtpiIsAvailable() && !SCIPtpiIsInitialized();
+}
+
+/** executes the given jobs; if a TPI is available and not already in use (e.g., by the concurrent solvers), the jobs
+ *  are distributed to at most the given number of threads, otherwise they are executed one after the other in the
+ *  calling thread
+ *
+ *  @return the smallest return code of all jobs
+ */
+SCIP_RETCODE SCIPconcurrentExecJobs(
+   int                   nthreads,           /**< maximal number of threads to use */
+   SCIP_DECL_PARALLELJOB ((*jobfunc)),       /**< job function that is called for each job argument */
+   void**                jobargs,            /**< array with the arguments of the jobs */
+   int                   njobs               /**< number of jobs */
+   )
+{
+   SCIP_RETCODE retcode;
+   SCIP_Bool initialized;
+   int jobid;
+   int i;
+
+   assert(jobfunc != NULL);
+   assert(jobargs != NULL || njobs == 0);
+
+   if( njobs <= 0 )
+      return SCIP_OKAY;
+
+   /* start the thread pool; checking whether it is free and initializing it happens atomically, since several
+    * callers may try to execute jobs at the same time
+    */
+   initialized = FALSE;
+   if( njobs > 1 && nthreads > 1 && SCIPtpiIsAvailable() )
+   {
+      SCIP_CALL( SCIPtpiTryInit(MIN(nthreads, njobs), INT_MAX, FALSE, &initialized) );
+   }
+
+   /* run sequentially if no threads are available */
+   if( !initialized )
+   {
+      retcode = SCIP_OKAY;
+
+      for( i = 0; i < njobs; ++i )
+      {
+         SCIP_RETCODE jobretcode;
+
+         jobretcode = jobfunc(jobargs[i]);
+         retcode = MIN(retcode, jobretcode);
+      }
+
+      return retcode;
+   }
+
+   jobid = SCIPtpiGetNewJobID();
+
+   TPI_PARA
+   {
+      TPI_SINGLE
+      {
+         for( i = 0; i < njobs; ++i )
+         {
+            /* cppcheck-suppress unassignedVariable */
+            SCIP_JOB*         job;
+            SCIP_SUBMITSTATUS status;
+
+            SCIP_CALL_ABORT( SCIPtpiCreateJob(&job, jobid, jobfunc, jobargs[i]) );
+            SCIP_CALL_ABORT( SCIPtpiSubmitJob(job, &status) );
+
+            assert(status == SCIP_SUBMIT_SUCCESS);
+         }
+      }
+   }
+
+   retcode = SCIPtpiCollectJobs(jobid);
+
+   SCIP_CALL( SCIPtpiExit() );
+
+   return retcode;
+}
+
 /** copy solving statistics */
 SCIP_RETCODE SCIPcopyConcurrentSolvingStats(
    SCIP*                 source,             /**< SCIP data structure */
@@ -175,6 +175,27 @@ SCIP_Longint SCIPgetConcurrentNTightenedIntBnds(
    SCIP*                 scip                /**< SCIP data structure */
    );
 
+/** executes the given jobs; if a TPI is available and not already in use (e.g., by the concurrent solvers), the jobs
+ *  are distributed to at most the given number of threads, otherwise they are executed one after the other in the
+ *  calling thread
+ *
+ *  @return the smallest return code of all jobs
+ */
+SCIP_RETCODE SCIPconcurrentExecJobs(
+   int                   nthreads,           /**< maximal number of threads to use */
+   SCIP_DECL_PARALLELJOB ((*jobfunc)),       /**< job function that is called for each job argument */
+   void**                jobargs,            /**< array with the arguments of the jobs */
+   int                   njobs               /**< number of jobs */
+   );
+
+/** returns whether SCIPconcurrentExecJobs() is able to run jobs in parallel with the given number of threads
+ *
+ *  @note since other callers may occupy the thread pool at any time, this is only a hint
+ */
+SCIP_Bool SCIPconcurrentCanExecJobsParallel(
+   int                   nthreads            /**< maximal number of threads to use */
+   );
+
 #ifdef __cplusplus
 }
 #endif
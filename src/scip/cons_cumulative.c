@@ -7309,6 +7309,9 @@ SCIP_RETCODE consCheckRedundancy(
 
 /** creates the worst case resource profile, that is, all jobs are inserted with the earliest start and latest
  *  completion time
+ *
+ *  All cores are inserted at once in O(n log n) time. Only if they exceed the capacity, they are inserted one by one to
+ *  find the core that does not fit, which is needed for the conflict analysis.
  */
 static
 SCIP_RETCODE createCoreProfile(
@@ -7327,20 +7330,31 @@ SCIP_RETCODE createCoreProfile(
    SCIP_Bool*            cutoff              /**< pointer to store if the constraint is infeasible */
    )
 {
+   SCIP_Bool infeasible;
+   int* corebegins;
+   int* coreends;
+   int* coredemands;
+   int* corejobs;
+   int ncores;
+   int c;
    int v;
 
-   /* insert all cores */
+   SCIP_CALL( SCIPallocBufferArray(scip, &corebegins, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &coreends, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &coredemands, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &corejobs, nvars) );
+
+   /* collect all cores */
+   ncores = 0;
    for( v = 0; v < nvars; ++v )
    {
       SCIP_VAR* var;
-      SCIP_Bool infeasible;
       int duration;
       int demand;
       int begin;
       int end;
       int est;
       int lst;
-      int pos;
 
       var = vars[v];
       assert(var != NULL);
@@ -7372,31 +7386,57 @@ SCIP_RETCODE createCoreProfile(
       SCIPdebugMsg(scip, "variable <%s>[%d,%d] (duration %d, demand %d): add core [%d,%d)\n",
          SCIPvarGetName(var), est, lst, duration, demand, begin, end);
 
-      /* insert the core into core resource profile (complexity O(log n)) */
-      SCIP_CALL( SCIPprofileInsertCore(profile, begin, end, demand, &pos, &infeasible) );
+      corebegins[ncores] = begin;
+      coreends[ncores] = end;
+      coredemands[ncores] = demand;
+      corejobs[ncores] = v;
+      ++ncores;
+   }
+
+   /* insert all cores into core resource profile at once (complexity O(n log n)) */
+   SCIP_CALL( SCIPprofileInsertCores(profile, corebegins, coreends, coredemands, ncores, &infeasible) );
 
-      /* in case the insertion of the core leads to an infeasibility; start the conflict analysis */
-      if( infeasible )
+   /* the cores do not fit; insert them one by one to find the first core which does not fit */
+   if( infeasible )
+   {
+      for( c = 0; c < ncores; ++c )
       {
-         assert(begin <= SCIPprofileGetTime(profile, pos));
-         assert(end > SCIPprofileGetTime(profile, pos));
+         int pos;
 
-         /* use conflict analysis to analysis the core insertion which was infeasible */
-         SCIP_CALL( analyseInfeasibelCoreInsertion(scip, nvars, vars, durations, demands, capacity, hmin, hmax,
-               var, duration, demand, SCIPprofileGetTime(profile, pos), conshdlrdata->usebdwidening, initialized, explanation) );
+         SCIP_CALL( SCIPprofileInsertCore(profile, corebegins[c], coreends[c], coredemands[c], &pos, &infeasible) );
 
-         if( explanation != NULL )
-            explanation[v] = TRUE;
+         /* in case the insertion of the core leads to an infeasibility; start the conflict analysis */
+         if( infeasible )
+         {
+            v = corejobs[c];
 
-         (*cutoff) = TRUE;
+            assert(corebegins[c] <= SCIPprofileGetTime(profile, pos));
+            assert(coreends[c] > SCIPprofileGetTime(profile, pos));
 
-         /* for the statistic we count the number of times a cutoff was detected due the time-time */
-         SCIPstatistic( SCIPconshdlrGetData(SCIPfindConshdlr(scip, CONSHDLR_NAME))->ncutofftimetable++ );
+            /* use conflict analysis to analysis the core insertion which was infeasible */
+            SCIP_CALL( analyseInfeasibelCoreInsertion(scip, nvars, vars, durations, demands, capacity, hmin, hmax,
+                  vars[v], durations[v], demands[v], SCIPprofileGetTime(profile, pos), conshdlrdata->usebdwidening,
+                  initialized, explanation) );
 
-         break;
+            if( explanation != NULL )
+               explanation[v] = TRUE;
+
+            (*cutoff) = TRUE;
+
+            /* for the statistic we count the number of times a cutoff was detected due the time-time */
+            SCIPstatistic( SCIPconshdlrGetData(SCIPfindConshdlr(scip, CONSHDLR_NAME))->ncutofftimetable++ );
+
+            break;
+         }
       }
+      assert(*cutoff);
    }
 
+   SCIPfreeBufferArray(scip, &corejobs);
+   SCIPfreeBufferArray(scip, &coredemands);
+   SCIPfreeBufferArray(scip, &coreends);
+   SCIPfreeBufferArray(scip, &corebegins);
+
    return SCIP_OKAY;
 }
 
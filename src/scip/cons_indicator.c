@@ -303,6 +303,7 @@
 #define DEFAULT_USEOTHERCONSS       FALSE    /**< Collect other constraints to alternative LP? */
 #define DEFAULT_USEOBJECTIVECUT     FALSE    /**< Use objective cut with current best solution to alternative LP? */
 #define DEFAULT_UPDATEBOUNDS        FALSE    /**< Update bounds of original variables for separation? */
+#define DEFAULT_WARMSTARTROUNDING    TRUE    /**< Warm start the alternative LP from the previous threshold in rounding separation? */
 #define DEFAULT_MAXCONDITIONALTLP     0.0    /**< max. estimated condition of the solution basis matrix of the alt. LP to be trustworthy (0.0 to disable check) */
 #define DEFAULT_MAXSEPACUTS           100    /**< maximal number of cuts separated per separation round */
 #define DEFAULT_MAXSEPACUTSROOT      2000    /**< maximal number of cuts separated per separation round in the root node */
@@ -389,6 +390,7 @@ struct SCIP_ConshdlrData
    SCIP_Bool             sepapersplocal;     /**< Allow to use local bounds in order to separate perspectice cuts? */
    SCIP_Bool             removeindicators;   /**< Remove indicator constraint if corresponding variable bound constraint has been added? */
    SCIP_Bool             updatebounds;       /**< whether the bounds of the original variables should be changed for separation */
+   SCIP_Bool             warmstartrounding;  /**< Warm start the alternative LP from the previous threshold in rounding separation? */
    SCIP_Bool             trysolutions;       /**< Try to make solutions feasible by setting indicator variables? */
    SCIP_Bool             enforcecuts;        /**< in enforcing try to generate cuts (only if sepaalternativelp is true) */
    SCIP_Bool             dualreductions;     /**< Should dual reduction steps be performed? */
@@ -1955,6 +1957,74 @@ SCIP_RETCODE unfixAltLPVariables(
 }
 
 
+/** changes the fixings of the alternative LP from the variables given by @a Sfixed to those given by @a S
+ *
+ *  Only the bounds of the variables that differ in both sets are changed, which is done by a single call to the LP
+ *  interface. On output, @a Sfixed is equal to @a S.
+ */
+static
+SCIP_RETCODE updateAltLPFixings(
+   SCIP*                 scip,               /**< SCIP pointer */
+   SCIP_LPI*             lp,                 /**< alternative LP */
+   int                   nconss,             /**< number of constraints */
+   SCIP_CONS**           conss,              /**< indicator constraints */
+   SCIP_Bool*            Sfixed,             /**< bitset of variables that are currently fixed */
+   SCIP_Bool*            S                   /**< bitset of variables that should be fixed */
+   )
+{
+   SCIP_Real* lb = NULL;
+   SCIP_Real* ub = NULL;
+   int* indices = NULL;
+   int cnt = 0;
+   int j;
+
+   assert( scip != NULL );
+   assert( lp != NULL );
+   assert( conss != NULL );
+   assert( Sfixed != NULL );
+   assert( S != NULL );
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &lb, nconss) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &ub, nconss) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &indices, nconss) );
+
+   /* collect bounds to be changed */
+   for (j = 0; j < nconss; ++j)
+   {
+      SCIP_CONSDATA* consdata;
+
+      if ( S[j] == Sfixed[j] )
+         continue;
+
+      Sfixed[j] = S[j];
+
+      assert( conss[j] != NULL );
+      consdata = SCIPconsGetData(conss[j]);
+      assert( consdata != NULL );
+
+      if ( consdata->colindex >= 0 )
+      {
+         indices[cnt] = consdata->colindex;
+         lb[cnt] = 0.0;
+         ub[cnt] = S[j] ? 0.0 : SCIPlpiInfinity(lp);
+         ++cnt;
+      }
+   }
+
+   /* change bounds */
+   if ( cnt > 0 )
+   {
+      SCIP_CALL( SCIPlpiChgBounds(lp, cnt, indices, lb, ub) );
+   }
+
+   SCIPfreeBufferArray(scip, &indices);
+   SCIPfreeBufferArray(scip, &ub);
+   SCIPfreeBufferArray(scip, &lb);
+
+   return SCIP_OKAY;
+}
+
+
 /** update bounds in first row to the current ones */
 static
 SCIP_RETCODE updateFirstRow(
@@ -3011,6 +3081,7 @@ SCIP_RETCODE extendToCover(
    SCIP_ENFOSEPATYPE     enfosepatype,       /**< type of enforcing/separating type */
    SCIP_Bool             removable,          /**< whether cuts should be removable */
    SCIP_Bool             genlogicor,         /**< should logicor constraints be generated? */
+   SCIP_Bool             warmstart,          /**< whether the first LP may be warm started from the current basis */
    int                   nconss,             /**< number of constraints */
    SCIP_CONS**           conss,              /**< indicator constraints */
    SCIP_Bool*            S,                  /**< bitset of variables */
@@ -3059,13 +3130,20 @@ SCIP_RETCODE extendToCover(
       int candindex = -1;
       int j;
 
-      if ( step == 0 )
+      if ( step == 0 && ! warmstart )
       {
          /* the first LP is solved without warm start, after that we use a warmstart. */
          SCIP_CALL_PARAM( SCIPlpiSetIntpar(lp, SCIP_LPPAR_FROMSCRATCH, TRUE) );
          SCIP_CALL( checkAltLPInfeasible(scip, lp, conshdlrdata->maxconditionaltlp, TRUE, &infeasible, error) );
          SCIP_CALL_PARAM( SCIPlpiSetIntpar(lp, SCIP_LPPAR_FROMSCRATCH, FALSE) );
       }
+      else if ( step == 0 )
+      {
+         /* start from the basis of the previous call; this basis is primal feasible only if the last alternative LP
+          * of that call was feasible, since removing fixings only relaxes bounds; if the previous call ended with a
+          * cover, i.e., an infeasible alternative LP, the primal simplex first has to restore primal feasibility */
+         SCIP_CALL( checkAltLPInfeasible(scip, lp, conshdlrdata->maxconditionaltlp, TRUE, &infeasible, error) );
+      }
       else
          SCIP_CALL( checkAltLPInfeasible(scip, lp, conshdlrdata->maxconditionaltlp, FALSE, &infeasible, error) );
 
@@ -4332,7 +4410,7 @@ SCIP_RETCODE enforceCuts(
 
    /* extend set S to a cover and generate cuts */
    error = FALSE;
-   SCIP_CALL( extendToCover(scip, conshdlr, conshdlrdata, lp, sol, enfosepatype, conshdlrdata->removable, genlogicor, nconss, conss, S, &size, &value, &error, cutoff, &nCuts) );
+   SCIP_CALL( extendToCover(scip, conshdlr, conshdlrdata, lp, sol, enfosepatype, conshdlrdata->removable, genlogicor, FALSE, nconss, conss, S, &size, &value, &error, cutoff, &nCuts) );
    *nGen = nCuts;
 
    /* return with an error if no cuts have been produced and and error occurred in extendToCover() */
@@ -4567,6 +4645,8 @@ SCIP_RETCODE separateIISRounding(
    int rounds;
    SCIP_Real threshold;
    SCIP_Bool* S;
+   SCIP_Bool* Sfixed;
+   SCIP_Bool warmstart = FALSE;
    SCIP_Bool error;
    int oldsize = -1;
    SCIPdebug( int nGenOld = *nGen; )
@@ -4611,6 +4691,7 @@ SCIP_RETCODE separateIISRounding(
    SCIP_CALL( setAltLPObj(scip, lp, sol, nconss, conss) );
 
    SCIP_CALL( SCIPallocBufferArray(scip, &S, nconss) );
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &Sfixed, nconss) );
 
    /* loop through the possible thresholds */
    for (threshold = conshdlrdata->roundingmaxthres;
@@ -4698,12 +4779,18 @@ SCIP_RETCODE separateIISRounding(
       SCIPdebugMsg(scip, "   Vars with value 1: %d  0: %d  and fractional: %d.\n", nvarsone, nvarszero, nvarsfrac);
 #endif
 
-      /* fix the variables in S */
-      SCIP_CALL( fixAltLPVariables(scip, lp, nconss, conss, S) );
+      /* fix the variables in S; since the sets are nested for decreasing thresholds, usually only the fixings of the
+       * cover of the previous threshold have to be removed */
+      SCIP_CALL( updateAltLPFixings(scip, lp, nconss, conss, Sfixed, S) );
 
-      /* extend set S to a cover and generate cuts */
+      /* extend set S to a cover and generate cuts; the final basis of the previous threshold is only used as starting
+       * basis, because it is not primal feasible if the previous threshold ended with an infeasible alternative LP */
       SCIP_CALL( extendToCover(scip, conshdlr, conshdlrdata, lp, sol, enfosepatype, conshdlrdata->removable, conshdlrdata->genlogicor,
-            nconss, conss, S, &size, &value, &error, cutoff, &nCuts) );
+            warmstart, nconss, conss, S, &size, &value, &error, cutoff, &nCuts) );
+      warmstart = conshdlrdata->warmstartrounding && ! error;
+
+      /* S has been extended by the variables that were fixed in extendToCover() */
+      BMScopyMemoryArray(Sfixed, S, nconss);
 
       /* we ignore errors in extendToCover */
       if ( nCuts > 0 )
@@ -4716,16 +4803,17 @@ SCIP_RETCODE separateIISRounding(
          /* possibly update upper bound */
          SCIP_CALL( updateObjUpperbound(scip, conshdlr, conshdlrdata) );
       }
-
-      /* reset bounds */
-      SCIP_CALL( unfixAltLPVariables(scip, lp, nconss, conss, S) );
    }
    SCIPdebug( SCIPdebugMsg(scip, "Generated %d IISs.\n", *nGen - nGenOld); )
 
+   /* reset bounds */
+   SCIP_CALL( unfixAltLPVariables(scip, lp, nconss, conss, Sfixed) );
+
 #ifndef NDEBUG
    SCIP_CALL( checkLPBoundsClean(scip, lp, nconss, conss) );
 #endif
 
+   SCIPfreeBufferArray(scip, &Sfixed);
    SCIPfreeBufferArray(scip, &S);
 
    return SCIP_OKAY;
@@ -7786,6 +7874,11 @@ SCIP_RETCODE SCIPincludeConshdlrIndicator(
          "Update bounds of original variables for separation?",
          &conshdlrdata->updatebounds, TRUE, DEFAULT_UPDATEBOUNDS, NULL, NULL) );
 
+   SCIP_CALL( SCIPaddBoolParam(scip,
+         "constraints/indicator/warmstartrounding",
+         "Warm start the alternative LP from the basis of the previous threshold in rounding separation?",
+         &conshdlrdata->warmstartrounding, TRUE, DEFAULT_WARMSTARTROUNDING, NULL, NULL) );
+
    SCIP_CALL( SCIPaddRealParam(scip,
          "constraints/indicator/maxconditionaltlp",
          "maximum estimated condition of the solution basis matrix of the alternative LP to be trustworthy (0.0 to disable check)",
@@ -142,6 +142,10 @@
                                          *   entering the LP */
 #define DEFAULT_CLIQUEEXTRACTFACTOR 0.5 /**< lower clique size limit for greedy clique extraction algorithm (relative to largest clique) */
 #define MAXCOVERSIZEITERLEWI       1000 /**< maximal size for which LEWI are iteratively separated by reducing the feasible set */
+#define MINKNAPSACKCORETABLESIZE  1000000 /**< minimal size of the dynamic programming table for which the core algorithm is tried first */
+#define MAXKNAPSACKCORESTATES     1000000 /**< maximal number of states stored by the core algorithm for knapsack problems */
+#define MAXKNAPSACKCOREWORK      10000000 /**< maximal number of states processed by the core algorithm for knapsack
+                                           *   problems that are solved by SCIPsolveKnapsackExactly() */
 
 #define DEFAULT_USEGUBS           FALSE /**< should GUB information be used for separation? */
 #define GUBCONSGROWVALUE              6 /**< memory growing value for GUB constraint array */
@@ -1061,29 +1065,335 @@ SCIP_RETCODE checkCons(
    return SCIP_OKAY;
 }
 
-/* IDX computes the integer index for the optimal solution array */
-#define IDX(j,d) ((j)*(intcap)+(d))
+/** merges the list of states with the states obtained by adding (@p sign = 1) or removing (@p sign = -1) an item and
+ *  discards dominated states and states whose upper bound does not exceed the value of the best feasible state
+ */
+static
+void mergeKnapsackCoreStates(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_Longint*         stweights,          /**< weights of all states */
+   SCIP_Real*            stprofits,          /**< profits of all states */
+   int*                  stparents,          /**< parent states of all states */
+   int*                  stitems,            /**< item changed with respect to the parent state for all states */
+   int*                  nstates,            /**< pointer to number of states */
+   int*                  curlist,            /**< current list of states, sorted by increasing weight and profit */
+   int                   ncurlist,           /**< length of current list */
+   int*                  newlist,            /**< array to store the new list of states */
+   int*                  nnewlist,           /**< pointer to store the length of the new list */
+   SCIP_Longint          weight,             /**< weight of the item */
+   SCIP_Real             profit,             /**< profit of the item */
+   int                   k,                  /**< position of the item in the efficiency order */
+   int                   sign,               /**< 1 if the item is added, -1 if it is removed */
+   SCIP_Longint          capacity,           /**< capacity of knapsack */
+   SCIP_Real             addeff,             /**< efficiency of the next item that can be added, or 0.0 */
+   SCIP_Real             remeff,             /**< efficiency of the next item that can be removed, or SCIP_INVALID */
+   SCIP_Bool             intprofits,         /**< are all profits integral? */
+   SCIP_Real*            lowerbound,         /**< pointer to value of the best feasible state */
+   int*                  best                /**< pointer to the best feasible state */
+   )
+{
+   SCIP_Longint dweight = sign * weight;
+   SCIP_Real dprofit = sign * profit;
+   SCIP_Real lastprofit = -SCIPinfinity(scip);
+   int a = 0;
+   int b = 0;
 
-/** solves knapsack problem in maximization form exactly using dynamic programming;
- *  if needed, one can provide arrays to store all selected items and all not selected items
- *
- * @note in case you provide the solitems or nonsolitems array you also have to provide the counter part, as well
+   *nnewlist = 0;
+
+   while( a < ncurlist || b < ncurlist )
+   {
+      SCIP_Longint stweight;
+      SCIP_Real stprofit;
+      SCIP_Real ub;
+      int st;
+
+      /* take the state with smaller weight from both sorted lists; for equal weights, the other state is dominated */
+      if( b >= ncurlist || (a < ncurlist && (stweights[curlist[a]] < stweights[curlist[b]] + dweight
+            || (stweights[curlist[a]] == stweights[curlist[b]] + dweight
+               && stprofits[curlist[a]] >= stprofits[curlist[b]] + dprofit))) )
+      {
+         st = curlist[a++];
+         stweight = stweights[st];
+         stprofit = stprofits[st];
+         if( b < ncurlist && stweights[curlist[b]] + dweight == stweight )
+            ++b;
+      }
+      else
+      {
+         st = -1;
+         stweight = stweights[curlist[b]] + dweight;
+         stprofit = stprofits[curlist[b]] + dprofit;
+         if( a < ncurlist && stweights[curlist[a]] == stweight )
+            ++a;
+         ++b;
+      }
+
+      /* the state is dominated by a state of smaller weight */
+      if( stprofit <= lastprofit )
+         continue;
+      lastprofit = stprofit;
+
+      /* the remaining capacity can only be filled with items of at most the efficiency of the next item that can be
+       * added, and excess weight can only be removed with items of at least the efficiency of the next item that can be
+       * removed
+       */
+      if( stweight <= capacity )
+         ub = stprofit + (SCIP_Real) (capacity - stweight) * addeff;
+      else if( remeff != SCIP_INVALID ) /*lint !e777*/
+         ub = stprofit - (SCIP_Real) (stweight - capacity) * remeff;
+      else
+         continue;
+
+      if( intprofits )
+         ub = SCIPfloor(scip, ub);
+
+      /* store new state */
+      if( st < 0 )
+      {
+         st = *nstates;
+         stweights[st] = stweight;
+         stprofits[st] = stprofit;
+         stparents[st] = curlist[b - 1];
+         stitems[st] = k;
+         ++(*nstates);
+      }
+
+      /* update best feasible state */
+      if( stweight <= capacity && stprofit > *lowerbound )
+      {
+         *lowerbound = stprofit;
+         *best = st;
+      }
+
+      /* keep state only if it may lead to a better solution */
+      if( ! SCIPisGE(scip, *lowerbound, ub) )
+         newlist[(*nnewlist)++] = st;
+   }
+}
+
+/** solves knapsack problem in maximization form exactly by a core-based dynamic programming algorithm
  *
- * @note the algorithm will first compute a greedy solution and terminate
- *       if the greedy solution is proven to be optimal.
- *       The dynamic programming algorithm runs with a time and space complexity
- *       of O(nitems * capacity).
+ *  The items are sorted by nonincreasing efficiency and the states are stored relative to the break solution, which
+ *  contains all items before the break item. Starting at the break item, the core is expanded alternately by the next
+ *  item after the core, which may be added, and the next item before the core, which may be removed. The list of
+ *  states is kept free of dominated states, and states whose upper bound does not exceed the value of the best feasible
+ *  state are discarded (see Pisinger, A minimal algorithm for the 0-1 knapsack problem, Operations Research 45, 1997).
+ *  Since the number of states does not depend on the capacity, this also works for very large capacities.
  *
- * @todo If only the objective is relevant, it is easy to change the code to use only one slice with O(capacity) space.
- *       There are recursive methods (see the book by Kellerer et al.) that require O(capacity) space, but it remains
- *       to be checked whether they are faster and whether they can reconstruct the solution.
- *       Dembo and Hammer (see Kellerer et al. Section 5.1.3, page 126) found a method that relies on a fast probing method.
- *       This fixes additional elements to 0 or 1 similar to a reduced cost fixing.
- *       This could be implemented, however, it would be technically a bit cumbersome,
- *       since one needs the greedy solution and the LP-value for this.
- *       This is currently only available after the redundant items have already been sorted out.
+ *  If too many states would have to be stored or more than @p maxwork states would have to be processed, the algorithm
+ *  stops and @p success is set to FALSE; in this case, the solution arrays and the solution value are not changed.
  */
-SCIP_RETCODE SCIPsolveKnapsackExactly(
+static
+SCIP_RETCODE solveKnapsackCore(
+   SCIP*                 scip,               /**< SCIP data structure */
+   int                   nitems,             /**< number of available items */
+   SCIP_Longint*         weights,            /**< item weights, each positive and not larger than the capacity */
+   SCIP_Real*            profits,            /**< item profits, each positive */
+   SCIP_Longint          capacity,           /**< capacity of knapsack, smaller than the sum of all weights */
+   int*                  items,              /**< item numbers */
+   SCIP_Bool             intprofits,         /**< are all profits integral? */
+   int*                  solitems,           /**< array to store items in solution, or NULL */
+   int*                  nonsolitems,        /**< array to store items not in solution, or NULL */
+   int*                  nsolitems,          /**< pointer to store number of items in solution, or NULL */
+   int*                  nnonsolitems,       /**< pointer to store number of items not in solution, or NULL */
+   SCIP_Real*            solval,             /**< pointer to add the optimal solution value to, or NULL */
+   SCIP_Real             maxwork,            /**< maximal number of states to process */
+   SCIP_Bool*            success             /**< pointer to store whether the problem was solved */
+   )
+{
+   SCIP_Longint* stweights;
+   SCIP_Real* stprofits;
+   int* stparents;
+   int* stitems;
+   int* curlist;
+   int* newlist;
+   int* sorted;
+   SCIP_Real* effs;
+   SCIP_Longint breakweight = 0;
+   SCIP_Longint nwork = 0;
+   SCIP_Real breakprofit = 0.0;
+   SCIP_Real lowerbound;
+   SCIP_Bool addnext = TRUE;
+   SCIP_Bool stopped = FALSE;
+   int statessize;
+   int listsize;
+   int nstates;
+   int ncurlist;
+   int best;
+   int breakitem;
+   int s;
+   int t;
+   int k;
+
+   assert(scip != NULL);
+   assert(nitems > 0);
+   assert(weights != NULL);
+   assert(profits != NULL);
+   assert(items != NULL);
+   assert(success != NULL);
+
+   *success = FALSE;
+
+   /* sort items by nonincreasing efficiency */
+   SCIP_CALL( SCIPallocBufferArray(scip, &effs, nitems) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &sorted, nitems) );
+   for( k = 0; k < nitems; ++k )
+   {
+      assert(0 < weights[k] && weights[k] <= capacity);
+      assert(profits[k] > 0.0);
+
+      effs[k] = profits[k] / (SCIP_Real) weights[k];
+      sorted[k] = k;
+   }
+   SCIPsortDownRealInt(effs, sorted, nitems);
+
+   /* determine the break item */
+   for( breakitem = 0; breakitem < nitems && breakweight + weights[sorted[breakitem]] <= capacity; ++breakitem )
+   {
+      breakweight += weights[sorted[breakitem]];
+      breakprofit += profits[sorted[breakitem]];
+   }
+   assert(breakitem < nitems);
+
+   statessize = SCIPcalcMemGrowSize(scip, 2 * nitems);
+   listsize = statessize;
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &stweights, statessize) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &stprofits, statessize) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &stparents, statessize) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &stitems, statessize) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &curlist, listsize) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &newlist, listsize) );
+
+   /* the break solution is the root state */
+   stweights[0] = breakweight;
+   stprofits[0] = breakprofit;
+   stparents[0] = -1;
+   stitems[0] = -1;
+   nstates = 1;
+   curlist[0] = 0;
+   ncurlist = 1;
+   lowerbound = breakprofit;
+   best = 0;
+
+   s = breakitem - 1;
+   t = breakitem;
+
+   /* expand the core until all items are processed or no state can lead to a better solution */
+   while( ncurlist > 0 && (s >= 0 || t < nitems) )
+   {
+      int* tmplist;
+      int nnewlist;
+      int sign;
+
+      /* alternate between adding the next item after the core and removing the next item before the core */
+      if( t < nitems && (addnext || s < 0) )
+      {
+         k = t++;
+         sign = 1;
+      }
+      else
+      {
+         k = s--;
+         sign = -1;
+      }
+      addnext = (sign == -1);
+
+      nwork += ncurlist;
+      if( nstates + ncurlist > MAXKNAPSACKCORESTATES || (SCIP_Real) nwork > maxwork )
+      {
+         SCIPdebugMsg(scip, "Core algorithm stopped after %d states.\n", nstates);
+         stopped = TRUE;
+         break;
+      }
+
+      /* ensure memory for the new states and the new list */
+      if( nstates + ncurlist > statessize )
+      {
+         int newsize = SCIPcalcMemGrowSize(scip, nstates + ncurlist);
+
+         SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &stweights, statessize, newsize) );
+         SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &stprofits, statessize, newsize) );
+         SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &stparents, statessize, newsize) );
+         SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &stitems, statessize, newsize) );
+         statessize = newsize;
+      }
+      if( 2 * ncurlist > listsize )
+      {
+         int newsize = SCIPcalcMemGrowSize(scip, 2 * ncurlist);
+
+         SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &curlist, listsize, newsize) );
+         SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &newlist, listsize, newsize) );
+         listsize = newsize;
+      }
+
+      mergeKnapsackCoreStates(scip, stweights, stprofits, stparents, stitems, &nstates, curlist, ncurlist, newlist,
+         &nnewlist, weights[sorted[k]], profits[sorted[k]], k, sign, capacity, t < nitems ? effs[t] : 0.0,
+         s >= 0 ? effs[s] : SCIP_INVALID, intprofits, &lowerbound, &best);
+      assert(nstates <= statessize);
+
+      tmplist = curlist;
+      curlist = newlist;
+      newlist = tmplist;
+      ncurlist = nnewlist;
+   }
+
+   /* the best state is optimal if no state that can lead to a better solution is left; if the algorithm stopped, the
+    * item k was not processed, even if it was the last one
+    */
+   if( ! stopped && (ncurlist == 0 || (s < 0 && t >= nitems)) )
+   {
+      SCIP_Bool* flipped;
+      SCIP_Real value = 0.0;
+      SCIP_Longint solweight = 0;
+
+      SCIPdebugMsg(scip, "Core algorithm found optimal solution with value %g using %d states.\n", lowerbound, nstates);
+
+      /* collect the items whose status differs from the break solution */
+      SCIP_CALL( SCIPallocClearBufferArray(scip, &flipped, nitems) );
+      for( k = best; stitems[k] >= 0; k = stparents[k] )
+         flipped[stitems[k]] = TRUE;
+
+      for( k = 0; k < nitems; ++k )
+      {
+         if( (k < breakitem) != flipped[k] )
+         {
+            if( solitems != NULL )
+               solitems[(*nsolitems)++] = items[sorted[k]]; /*lint !e413*/
+            value += profits[sorted[k]];
+            solweight += weights[sorted[k]];
+         }
+         else if( solitems != NULL )
+            nonsolitems[(*nnonsolitems)++] = items[sorted[k]]; /*lint !e413*/
+      }
+      assert(solweight <= capacity);
+      SCIPfreeBufferArray(scip, &flipped);
+
+      if( solval != NULL )
+         *solval += value;
+
+      *success = TRUE;
+   }
+
+   SCIPfreeBlockMemoryArray(scip, &newlist, listsize);
+   SCIPfreeBlockMemoryArray(scip, &curlist, listsize);
+   SCIPfreeBlockMemoryArray(scip, &stitems, statessize);
+   SCIPfreeBlockMemoryArray(scip, &stparents, statessize);
+   SCIPfreeBlockMemoryArray(scip, &stprofits, statessize);
+   SCIPfreeBlockMemoryArray(scip, &stweights, statessize);
+   SCIPfreeBufferArray(scip, &sorted);
+   SCIPfreeBufferArray(scip, &effs);
+
+   return SCIP_OKAY;
+}
+
+/* IDX computes the integer index for the optimal solution array */
+#define IDX(j,d) ((j)*(intcap)+(d))
+
+/** solves knapsack problem in maximization form exactly; the dynamic programming table is only used if it has at most
+ *  the given number of entries, larger problems are only solved by the core algorithm with the given work limit
+ */
+static
+SCIP_RETCODE solveKnapsackExactly(
    SCIP*                 scip,               /**< SCIP data structure */
    int                   nitems,             /**< number of available items */
    SCIP_Longint*         weights,            /**< item weights */
@@ -1095,6 +1405,8 @@ SCIP_RETCODE SCIPsolveKnapsackExactly(
    int*                  nsolitems,          /**< pointer to store number of items in solution, or NULL */
    int*                  nnonsolitems,       /**< pointer to store number of items not in solution, or NULL */
    SCIP_Real*            solval,             /**< pointer to store optimal solution value, or NULL */
+   SCIP_Real             maxtablesize,       /**< maximal number of entries of the dynamic programming table */
+   SCIP_Real             maxcorework,        /**< maximal number of states processed by the core algorithm */
    SCIP_Bool*            success             /**< pointer to store if an error occured during solving
                                               *   (normally a memory problem) */
    )
@@ -1418,6 +1730,27 @@ SCIP_RETCODE SCIPsolveKnapsackExactly(
       goto TERMINATE;
    }
 
+   /* for large tables, first try the core algorithm, whose running time does not depend on the capacity */
+   if( (SCIP_Real) nmyitems * (SCIP_Real) (capacity - minweight + 1) > MIN(MINKNAPSACKCORETABLESIZE, maxtablesize) )
+   {
+      SCIP_Bool coresuccess;
+
+      SCIP_CALL( solveKnapsackCore(scip, nmyitems, myweights, myprofits, capacity, myitems, intprofits, solitems,
+            nonsolitems, nsolitems, nnonsolitems, solval, maxcorework, &coresuccess) );
+
+      if( coresuccess )
+         goto TERMINATE;
+   }
+
+   /* the table would be too large */
+   if( (SCIP_Real) nmyitems * (SCIP_Real) (capacity - minweight + 1) > maxtablesize )
+   {
+      SCIPdebugMsg(scip, "Dynamic programming table would be too large.\n");
+
+      *success = FALSE;
+      goto TERMINATE;
+   }
+
    /* in the following table we do not need the first minweight columns */
    capacity -= (minweight - 1);
 
@@ -1583,6 +1916,75 @@ SCIP_RETCODE SCIPsolveKnapsackExactly(
    return SCIP_OKAY;
 }
 
+/** solves knapsack problem in maximization form exactly using dynamic programming;
+ *  if needed, one can provide arrays to store all selected items and all not selected items
+ *
+ * @note in case you provide the solitems or nonsolitems array you also have to provide the counter part, as well
+ *
+ * @note the algorithm will first compute a greedy solution and terminate
+ *       if the greedy solution is proven to be optimal.
+ *       The dynamic programming algorithm runs with a time and space complexity
+ *       of O(nitems * capacity). If this table is large, a core-based dynamic programming algorithm over
+ *       nondominated states is tried first, whose effort does not depend on the capacity.
+ *
+ * @todo If only the objective is relevant, it is easy to change the code to use only one slice with O(capacity) space.
+ *       There are recursive methods (see the book by Kellerer et al.) that require O(capacity) space, but it remains
+ *       to be checked whether they are faster and whether they can reconstruct the solution.
+ *       Dembo and Hammer (see Kellerer et al. Section 5.1.3, page 126) found a method that relies on a fast probing method.
+ *       This fixes additional elements to 0 or 1 similar to a reduced cost fixing.
+ *       This could be implemented, however, it would be technically a bit cumbersome,
+ *       since one needs the greedy solution and the LP-value for this.
+ *       This is currently only available after the redundant items have already been sorted out.
+ */
+SCIP_RETCODE SCIPsolveKnapsackExactly(
+   SCIP*                 scip,               /**< SCIP data structure */
+   int                   nitems,             /**< number of available items */
+   SCIP_Longint*         weights,            /**< item weights */
+   SCIP_Real*            profits,            /**< item profits */
+   SCIP_Longint          capacity,           /**< capacity of knapsack */
+   int*                  items,              /**< item numbers */
+   int*                  solitems,           /**< array to store items in solution, or NULL */
+   int*                  nonsolitems,        /**< array to store items not in solution, or NULL */
+   int*                  nsolitems,          /**< pointer to store number of items in solution, or NULL */
+   int*                  nnonsolitems,       /**< pointer to store number of items not in solution, or NULL */
+   SCIP_Real*            solval,             /**< pointer to store optimal solution value, or NULL */
+   SCIP_Bool*            success             /**< pointer to store if an error occured during solving
+                                              *   (normally a memory problem) */
+   )
+{
+   SCIP_CALL( solveKnapsackExactly(scip, nitems, weights, profits, capacity, items, solitems, nonsolitems, nsolitems,
+         nnonsolitems, solval, SCIP_REAL_MAX, (SCIP_Real) MAXKNAPSACKCOREWORK, success) );
+
+   return SCIP_OKAY;
+}
+
+/** solves knapsack problem in maximization form exactly like SCIPsolveKnapsackExactly(), but uses the dynamic
+ *  programming table only if it has at most the given number of entries; larger problems are only solved by the core
+ *  algorithm, which stops after processing the given number of states, and success is set to FALSE if it stops
+ */
+SCIP_RETCODE SCIPsolveKnapsackExactlyLimited(
+   SCIP*                 scip,               /**< SCIP data structure */
+   int                   nitems,             /**< number of available items */
+   SCIP_Longint*         weights,            /**< item weights */
+   SCIP_Real*            profits,            /**< item profits */
+   SCIP_Longint          capacity,           /**< capacity of knapsack */
+   int*                  items,              /**< item numbers */
+   int*                  solitems,           /**< array to store items in solution, or NULL */
+   int*                  nonsolitems,        /**< array to store items not in solution, or NULL */
+   int*                  nsolitems,          /**< pointer to store number of items in solution, or NULL */
+   int*                  nnonsolitems,       /**< pointer to store number of items not in solution, or NULL */
+   SCIP_Real*            solval,             /**< pointer to store optimal solution value, or NULL */
+   SCIP_Real             maxtablesize,       /**< maximal number of entries of the dynamic programming table */
+   SCIP_Real             maxcorework,        /**< maximal number of states processed by the core algorithm */
+   SCIP_Bool*            success             /**< pointer to store if the problem was solved */
+   )
+{
+   SCIP_CALL( solveKnapsackExactly(scip, nitems, weights, profits, capacity, items, solitems, nonsolitems, nsolitems,
+         nnonsolitems, solval, maxtablesize, maxcorework, success) );
+
+   return SCIP_OKAY;
+}
+
 /** solves knapsack problem in maximization form approximately by solving the LP-relaxation of the problem using Dantzig's
  *  method and rounding down the solution; if needed, one can provide arrays to store all selected items and all not
  *  selected items
@@ -2569,7 +2971,9 @@ SCIP_RETCODE getCover(
    }
 
    /* solves (modified) transformed knapsack problem approximately by solving the LP-relaxation of the (modified)
-    * transformed knapsack problem using Dantzig's method and rounding down the solution.
+    * transformed knapsack problem using Dantzig's method and rounding down the solution; the cover is only the starting
+    * point of the lifting and this is called for every knapsack in every separation round, so the exact solving by
+    * SCIPsolveKnapsackExactly() is not worth its effort here.
     * let z* be the solution, then
     *   j in C,          if z*_j = 0 and
     *   i in N\C,        if z*_j = 1.
@@ -210,7 +210,8 @@ SCIP_ROW* SCIPgetRowKnapsack(
  * @note the algorithm will first compute a greedy solution and terminate
  *       if the greedy solution is proven to be optimal.
  *       The dynamic programming algorithm runs with a time and space complexity
- *       of O(nitems * capacity).
+ *       of O(nitems * capacity). If this table is large, a core-based dynamic programming algorithm over
+ *       nondominated states is tried first, whose effort does not depend on the capacity.
  */
 SCIP_EXPORT
 SCIP_RETCODE SCIPsolveKnapsackExactly(
@@ -229,6 +230,28 @@ SCIP_RETCODE SCIPsolveKnapsackExactly(
                                               *   (normally a memory problem) */
    );
 
+/** solves knapsack problem in maximization form exactly like SCIPsolveKnapsackExactly(), but uses the dynamic
+ *  programming table only if it has at most the given number of entries; larger problems are only solved by the core
+ *  algorithm, which stops after processing the given number of states, and success is set to FALSE if it stops
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPsolveKnapsackExactlyLimited(
+   SCIP*                 scip,               /**< SCIP data structure */
+   int                   nitems,             /**< number of available items */
+   SCIP_Longint*         weights,            /**< item weights */
+   SCIP_Real*            profits,            /**< item profits */
+   SCIP_Longint          capacity,           /**< capacity of knapsack */
+   int*                  items,              /**< item numbers */
+   int*                  solitems,           /**< array to store items in solution, or NULL */
+   int*                  nonsolitems,        /**< array to store items not in solution, or NULL */
+   int*                  nsolitems,          /**< pointer to store number of items in solution, or NULL */
+   int*                  nnonsolitems,       /**< pointer to store number of items not in solution, or NULL */
+   SCIP_Real*            solval,             /**< pointer to store optimal solution value, or NULL */
+   SCIP_Real             maxtablesize,       /**< maximal number of entries of the dynamic programming table */
+   SCIP_Real             maxcorework,        /**< maximal number of states processed by the core algorithm */
+   SCIP_Bool*            success             /**< pointer to store if the problem was solved */
+   );
+
 /** solves knapsack problem in maximization form approximately by solving the LP-relaxation of the problem using Dantzig's
  *  method and rounding down the solution; if needed, one can provide arrays to store all selected items and all not
  *  selected items
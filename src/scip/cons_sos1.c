@@ -93,6 +93,7 @@
 #include "scip/pub_tree.h"
 #include "scip/pub_var.h"
 #include "scip/scip_branch.h"
+#include "scip/scip_concurrent.h"
 #include "scip/scip_conflict.h"
 #include "scip/scip_cons.h"
 #include "scip/scip_copy.h"
@@ -107,6 +108,7 @@
 #include "scip/scip_param.h"
 #include "scip/scip_prob.h"
 #include "scip/scip_probing.h"
+#include "scip/scip_randnumgen.h"
 #include "scip/scip_sol.h"
 #include "scip/scip_solvingstats.h"
 #include "scip/scip_tree.h"
@@ -182,6 +184,11 @@
 #define DEFAULT_MAXIMPLCUTS          50 /**< maximal number of implied bound cuts separated per branching node */
 #define DEFAULT_MAXIMPLCUTSROOT     150 /**< maximal number of implied bound cuts separated per iteration in the root node */
 
+/* heuristic methods */
+#define DEFAULT_MWISRUNS              1 /**< number of runs of the greedy heuristic for the maximum weighted independent set problem
+                                         *   with perturbed weights, which are executed in parallel if possible */
+#define MWISSEED                    307 /**< seed for the perturbation of the weights in the greedy MWIS heuristic */
+
 /* event handler properties */
 #define EVENTHDLR_NAME         "SOS1"
 #define EVENTHDLR_DESC         "bound change event handler for SOS1 constraints"
@@ -222,6 +229,24 @@ struct SCIP_NodeData
 typedef struct SCIP_NodeData SCIP_NODEDATA;
 
 
+/** data of one run of the greedy heuristic for the maximum weighted independent set problem; the run only reads the
+ *  conflict graph and the variables, such that several runs can be executed in parallel
+ */
+struct SCIP_MWISRun
+{
+   SCIP*                 scip;               /**< SCIP pointer */
+   SCIP_CONSHDLR*        conshdlr;           /**< SOS1 constraint handler */
+   SCIP_DIGRAPH*         conflictgraph;      /**< conflict graph */
+   SCIP_Bool*            indicatorzero;      /**< vector that indicates which variables are currently fixed to zero */
+   SCIP_Real*            weights;            /**< weights determining the order of the variables (sorted by the run) */
+   int*                  order;              /**< array to store the variables in the order of the weights */
+   SCIP_Bool*            mark;               /**< array to store the processed nodes */
+   SCIP_Bool*            indset;             /**< on input the variables fixed to be nonzero, on output an independent set */
+   int                   nsos1vars;          /**< number of SOS1 variables */
+};
+typedef struct SCIP_MWISRun SCIP_MWISRUN;
+
+
 /** successor data of a given nodes successor in the implication graph */
 struct SCIP_SuccData
 {
@@ -316,6 +341,8 @@ struct SCIP_ConshdlrData
    int                   implcutsdepth;      /**< node depth of separating implied bound cuts (-1: no limit) */
    int                   maximplcuts;        /**< maximal number of implied bound cuts separated per branching node */
    int                   maximplcutsroot;    /**< maximal number of implied bound cuts separated per iteration in the root node */
+   /* heuristic methods */
+   int                   mwisruns;           /**< number of runs of the greedy MWIS heuristic with perturbed weights */
 };
 
 
@@ -6185,7 +6212,12 @@ SCIP_RETCODE initTCliquegraph(
 }
 
 
-/** update weights of tclique graph */
+/** update weights of tclique graph
+ *
+ *  All weights are recomputed in one linear pass over the SOS1 variables. An incremental update would not save work,
+ *  since the weights depend on the LP solution to be separated, which changes between separation rounds, and on the
+ *  local bounds, of which no incremental view is kept.
+ */
 static
 SCIP_RETCODE updateWeightsTCliquegraph(
    SCIP*                 scip,               /**< SCIP pointer */
@@ -7345,14 +7377,13 @@ SCIP_RETCODE separateSOS1(
 static
 SCIP_RETCODE getVectorOfWeights(
    SCIP*                 scip,               /**< SCIP pointer */
-   SCIP_SOL*             sol,                /**< primal solution or NULL for current LP solution */
+   SCIP_Real*            absvals,            /**< absolute solution values of the SOS1 variables */
    SCIP_DIGRAPH*         conflictgraph,      /**< conflict graph */
    int                   nsos1vars,          /**< number of SOS1 variables */
    SCIP_Bool*            indicatorzero,      /**< vector that indicates which variables are currently fixed to zero */
    SCIP_Real*            weights             /**< pointer to store weights determining the order of the variables (length = nsos1vars) */
    )
 {
-   SCIP_VAR* var;
    SCIP_Real val;
    SCIP_Real sum;
    int nviols;
@@ -7362,6 +7393,7 @@ SCIP_RETCODE getVectorOfWeights(
    int j;
 
    assert( scip != NULL );
+   assert( absvals != NULL );
    assert( conflictgraph != NULL );
    assert( indicatorzero != NULL );
    assert( weights != NULL );
@@ -7374,8 +7406,7 @@ SCIP_RETCODE getVectorOfWeights(
          weights[i] = 0.0;
       else
       {
-         var = SCIPnodeGetVarSOS1(conflictgraph, i);
-         val = REALABS( SCIPgetSolVal(scip, sol, var) );
+         val = absvals[i];
          if ( SCIPisFeasZero(scip, val) )
             weights[i] = 0.0;
          else
@@ -7388,7 +7419,7 @@ SCIP_RETCODE getVectorOfWeights(
             {
                SCIP_Real valsucc;
 
-               valsucc = REALABS( SCIPgetSolVal(scip, sol, SCIPnodeGetVarSOS1(conflictgraph, succ[j])) );
+               valsucc = absvals[succ[j]];
                if( ! SCIPisFeasZero(scip, valsucc) )
                {
                   sum += MIN(10E05, valsucc);
@@ -7540,61 +7571,44 @@ SCIP_RETCODE markNeighborsMWISHeuristic(
 }
 
 
-/** calls greedy algorithm for the maximum weighted independent set problem (MWIS)
- *
- * We compute a feasible solution to
- * \f[
- *  \begin{array}{ll}
- *  \min\limits_{z} & {x^*}^T z \\
- *                  & z_i + z_j \leq 1, \qquad (i,j)\in E \\
- *                  &       z_i \in  \{0,1\}, \qquad\quad  i\in V
- * \end{array}
- * \f]
- * by the algorithm GGWMIN of Shuichi Sakai, Mitsunori Togasaki and Koichi Yamazaki in "A note on greedy algorithms for the
- * maximum weighted independent set problem", Discrete Applied Mathematics. Here \f$x^*\f$ denotes the current LP
- * relaxation solution. Note that the solution of the MWIS is the indicator vector of an independent set.
+/** executes one run of the greedy algorithm for the maximum weighted independent set problem, see
+ *  maxWeightIndSetHeuristic(); the variables are processed in nonincreasing order of the weights of the run
  */
 static
-SCIP_RETCODE maxWeightIndSetHeuristic(
-   SCIP*                 scip,               /**< SCIP pointer */
-   SCIP_SOL*             sol,                /**< primal solution or NULL for current LP solution */
-   SCIP_CONSHDLR*        conshdlr,           /**< SOS1 constraint handler */
-   SCIP_DIGRAPH*         conflictgraph,      /**< conflict graph */
-   int                   nsos1vars,          /**< number of SOS1 variables */
-   SCIP_Bool*            indicatorzero,      /**< vector that indicates which variables are currently fixed to zero */
-   SCIP_Bool*            indset              /**< pointer to store indicator vector of an independent set */
+SCIP_RETCODE runGreedyMWIS(
+   SCIP_MWISRUN*         run                 /**< data of the run */
    )
 {
-   SCIP_Bool* mark = NULL;
-   SCIP_Real* weights = NULL;
-   int* indscipvars = NULL;
+   SCIP_Bool* indicatorzero;
+   SCIP_Bool* indset;
+   SCIP_Bool* mark;
+   int* order;
+   int nsos1vars;
    int ind;
    int nsucc;
    int i;
    int k;
 
-   assert( scip != NULL );
-   assert( conflictgraph != NULL );
-   assert( indicatorzero != NULL );
-   assert( indset != NULL );
+   assert( run != NULL );
+   assert( run->scip != NULL );
+   assert( run->conflictgraph != NULL );
 
-   /* allocate buffer arrays */
-   SCIP_CALL( SCIPallocBufferArray(scip, &mark, nsos1vars) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &weights, nsos1vars) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &indscipvars, nsos1vars) );
+   indicatorzero = run->indicatorzero;
+   indset = run->indset;
+   mark = run->mark;
+   order = run->order;
+   nsos1vars = run->nsos1vars;
 
    /* sort SOS1 variables in nonincreasing order of weights */
    for (i = 0; i < nsos1vars; ++i)
-      indscipvars[i] = i;
-
-   SCIP_CALL( getVectorOfWeights(scip, sol, conflictgraph, nsos1vars, indicatorzero, weights) );
-   SCIPsortDownRealInt(weights, indscipvars, nsos1vars);
+      order[i] = i;
+   SCIPsortDownRealInt(run->weights, order, nsos1vars);
 
    /* mark fixed variables and variables without any neighbors in the conflict graph */
    k = 0;
    for (i = 0; i < nsos1vars; ++i)
    {
-      nsucc = SCIPdigraphGetNSuccessors(conflictgraph, i);
+      nsucc = SCIPdigraphGetNSuccessors(run->conflictgraph, i);
 
       if ( indset[i] == 0 )
       {
@@ -7619,7 +7633,7 @@ SCIP_RETCODE maxWeightIndSetHeuristic(
          ++k;
          mark[i] = TRUE;
 
-         SCIP_CALL( markNeighborsMWISHeuristic(scip, conshdlr, conflictgraph, i, mark, indset, &k, &cutoff) );
+         SCIP_CALL( markNeighborsMWISHeuristic(run->scip, run->conshdlr, run->conflictgraph, i, mark, indset, &k, &cutoff) );
          assert( ! cutoff );
       }
    }
@@ -7629,7 +7643,7 @@ SCIP_RETCODE maxWeightIndSetHeuristic(
    {
       assert( i < nsos1vars );
 
-      ind = indscipvars[i];
+      ind = order[i];
 
       if ( ! mark[ind] )
       {
@@ -7640,17 +7654,163 @@ SCIP_RETCODE maxWeightIndSetHeuristic(
          mark[ind] = TRUE;
          ++k;
 
-         SCIP_CALL( markNeighborsMWISHeuristic(scip, conshdlr, conflictgraph, ind, mark, indset, &k, &cutoff) );
+         SCIP_CALL( markNeighborsMWISHeuristic(run->scip, run->conshdlr, run->conflictgraph, ind, mark, indset, &k, &cutoff) );
          if ( cutoff )
             indset[ind] = 0;
       }
    }
    assert( k == nsos1vars );
 
+   return SCIP_OKAY;
+}
+
+
+/** executes a run of the greedy MWIS heuristic as a parallel job */
+static
+SCIP_DECL_PARALLELJOB(execMWISRun)
+{
+   SCIP_CALL( runGreedyMWIS((SCIP_MWISRUN*)jobarg) );
+
+   return SCIP_OKAY;
+}
+
+
+/** calls greedy algorithm for the maximum weighted independent set problem (MWIS)
+ *
+ * We compute a feasible solution to
+ * \f[
+ *  \begin{array}{ll}
+ *  \min\limits_{z} & {x^*}^T z \\
+ *                  & z_i + z_j \leq 1, \qquad (i,j)\in E \\
+ *                  &       z_i \in  \{0,1\}, \qquad\quad  i\in V
+ * \end{array}
+ * \f]
+ * by the algorithm GGWMIN of Shuichi Sakai, Mitsunori Togasaki and Koichi Yamazaki in "A note on greedy algorithms for the
+ * maximum weighted independent set problem", Discrete Applied Mathematics. Here \f$x^*\f$ denotes the current LP
+ * relaxation solution. Note that the solution of the MWIS is the indicator vector of an independent set.
+ *
+ * If more than one run is requested, the further runs use randomly perturbed weights and are executed in parallel if
+ * possible; the independent set that keeps the largest absolute solution values is returned.
+ */
+static
+SCIP_RETCODE maxWeightIndSetHeuristic(
+   SCIP*                 scip,               /**< SCIP pointer */
+   SCIP_SOL*             sol,                /**< primal solution or NULL for current LP solution */
+   SCIP_CONSHDLR*        conshdlr,           /**< SOS1 constraint handler */
+   SCIP_DIGRAPH*         conflictgraph,      /**< conflict graph */
+   int                   nsos1vars,          /**< number of SOS1 variables */
+   int                   nruns,              /**< number of runs with different weights */
+   SCIP_Bool*            indicatorzero,      /**< vector that indicates which variables are currently fixed to zero */
+   SCIP_Bool*            indset              /**< pointer to store indicator vector of an independent set */
+   )
+{
+   SCIP_MWISRUN* runs = NULL;
+   SCIP_Real* absvals = NULL;
+   SCIP_Real bestvalue;
+   int best;
+   int i;
+   int r;
+
+   assert( scip != NULL );
+   assert( conflictgraph != NULL );
+   assert( indicatorzero != NULL );
+   assert( indset != NULL );
+   assert( nruns >= 1 );
+
+   /* get the absolute solution values only once, since the weights of a node depend on the values of its neighbors */
+   SCIP_CALL( SCIPallocBufferArray(scip, &absvals, nsos1vars) );
+   for (i = 0; i < nsos1vars; ++i)
+      absvals[i] = REALABS( SCIPgetSolVal(scip, sol, SCIPnodeGetVarSOS1(conflictgraph, i)) );
+
+   /* allocate buffer arrays of the runs; the first run works on the given independent set */
+   SCIP_CALL( SCIPallocBufferArray(scip, &runs, nruns) );
+   for (r = 0; r < nruns; ++r)
+   {
+      runs[r].scip = scip;
+      runs[r].conshdlr = conshdlr;
+      runs[r].conflictgraph = conflictgraph;
+      runs[r].indicatorzero = indicatorzero;
+      runs[r].nsos1vars = nsos1vars;
+      SCIP_CALL( SCIPallocBufferArray(scip, &runs[r].weights, nsos1vars) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &runs[r].order, nsos1vars) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &runs[r].mark, nsos1vars) );
+      if ( r == 0 )
+         runs[r].indset = indset;
+      else
+      {
+         SCIP_CALL( SCIPduplicateBufferArray(scip, &runs[r].indset, indset, nsos1vars) );
+      }
+   }
+
+   SCIP_CALL( getVectorOfWeights(scip, absvals, conflictgraph, nsos1vars, indicatorzero, runs[0].weights) );
+
+   if ( nruns == 1 )
+   {
+      SCIP_CALL( runGreedyMWIS(&runs[0]) );
+   }
+   else
+   {
+      SCIP_RANDNUMGEN* randnumgen;
+      void** jobargs;
+
+      /* perturb the weights of the further runs in the main thread, such that the result does not depend on the
+       * scheduling of the runs */
+      SCIP_CALL( SCIPcreateRandom(scip, &randnumgen, (unsigned int)(MWISSEED + SCIPgetNNodes(scip)), TRUE) );
+      for (r = 1; r < nruns; ++r)
+      {
+         for (i = 0; i < nsos1vars; ++i)
+            runs[r].weights[i] = runs[0].weights[i] * SCIPrandomGetReal(randnumgen, 0.5, 1.5);
+      }
+      SCIPfreeRandom(scip, &randnumgen);
+
+      SCIP_CALL( SCIPallocBufferArray(scip, &jobargs, nruns) );
+      for (r = 0; r < nruns; ++r)
+         jobargs[r] = (void*)&runs[r];
+
+      SCIP_CALL( SCIPexecParallelJobs(scip, MIN(SCIPgetNParallelJobThreads(scip), nruns), execMWISRun, jobargs, nruns) );
+
+      SCIPfreeBufferArray(scip, &jobargs);
+   }
+
+   /* choose the independent set that keeps the largest absolute solution values; ties are broken by the first run */
+   best = 0;
+   bestvalue = -1.0;
+   for (r = 0; r < nruns; ++r)
+   {
+      SCIP_Real value = 0.0;
+
+      for (i = 0; i < nsos1vars; ++i)
+      {
+         if ( runs[r].indset[i] == 1 )
+            value += absvals[i];
+      }
+
+      if ( value > bestvalue )
+      {
+         best = r;
+         bestvalue = value;
+      }
+   }
+
+   if ( best > 0 )
+   {
+      SCIPdebugMsg(scip, "MWIS run %d with perturbed weights found the best independent set\n", best);
+      BMScopyMemoryArray(indset, runs[best].indset, nsos1vars);
+   }
+
    /* free buffer arrays */
-   SCIPfreeBufferArrayNull(scip, &indscipvars);
-   SCIPfreeBufferArrayNull(scip, &weights);
-   SCIPfreeBufferArrayNull(scip, &mark);
+   for (r = nruns - 1; r >= 0; --r)
+   {
+      if ( r > 0 )
+      {
+         SCIPfreeBufferArray(scip, &runs[r].indset);
+      }
+      SCIPfreeBufferArray(scip, &runs[r].mark);
+      SCIPfreeBufferArray(scip, &runs[r].order);
+      SCIPfreeBufferArray(scip, &runs[r].weights);
+   }
+   SCIPfreeBufferArray(scip, &runs);
+   SCIPfreeBufferArray(scip, &absvals);
 
    return SCIP_OKAY;
 }
@@ -7739,7 +7899,8 @@ SCIP_RETCODE makeSOS1conflictgraphFeasible(
    }
 
    /* call greedy algorithm for the maximum weighted independent set problem */
-   SCIP_CALL( maxWeightIndSetHeuristic(scip, sol, conshdlr, conflictgraph, nsos1vars, indicatorzero, indset) );
+   SCIP_CALL( maxWeightIndSetHeuristic(scip, sol, conshdlr, conflictgraph, nsos1vars,
+         SCIPconshdlrGetData(conshdlr)->mwisruns, indicatorzero, indset) );
 
    /* make solution feasible */
    for (j = 0; j < nsos1vars; ++j)
@@ -10565,6 +10726,11 @@ SCIP_RETCODE SCIPincludeConshdlrSOS1(
          "maximal number of implied bound cuts separated per iteration in the root node",
          &conshdlrdata->maximplcutsroot, TRUE, DEFAULT_MAXIMPLCUTSROOT, 0, INT_MAX, NULL, NULL) );
 
+   /* heuristic methods */
+   SCIP_CALL( SCIPaddIntParam(scip, "constraints/" CONSHDLR_NAME "/mwisruns",
+         "number of runs of the greedy heuristic for the maximum weighted independent set problem with perturbed weights (executed in parallel if possible)",
+         &conshdlrdata->mwisruns, TRUE, DEFAULT_MWISRUNS, 1, INT_MAX, NULL, NULL) );
+
    return SCIP_OKAY;
 }
 
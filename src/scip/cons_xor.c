@@ -127,9 +127,19 @@
  * Data structures
  */
 
-/** type used for matrix entries in function checkGauss() */
+/** type used for the right-hand side and solution entries in function checkSystemGF2() */
 typedef unsigned short Type;
 
+/** type used for the rows of the matrix in function checkSystemGF2(); each word stores GF2WORDBITS consecutive entries,
+ *  such that a row operation over GF2 is an exclusive or of whole words
+ */
+typedef uint64_t GF2Word;
+
+#define GF2WORDBITS                  64 /**< number of matrix entries stored in one GF2Word */
+#define GF2NWORDS(n)          (((n) + GF2WORDBITS - 1) / GF2WORDBITS) /**< number of words for a row with n entries */
+#define GF2GETENTRY(row, j)   ((Type) (((row)[(j) / GF2WORDBITS] >> ((j) % GF2WORDBITS)) & 1)) /**< entry j of a row */
+#define GF2SETENTRY(row, j)   ((row)[(j) / GF2WORDBITS] |= ((GF2Word) 1) << ((j) % GF2WORDBITS)) /**< sets entry j of a row to 1 */
+
 /** constraint data for xor constraints */
 struct SCIP_ConsData
 {
@@ -2183,6 +2193,9 @@ SCIP_RETCODE separateCons(
  *  Here, \f$A \in R^{m \times n},\; b \in R^m\f$. On exit, the vector @p p contains a permutation of the row indices
  *  used for pivoting and the function returns the rank @p r of @p A. For each row \f$i = 1, \ldots, r\f$, the entry @p
  *  s[i] contains the column index of the first nonzero in row @p i.
+ *
+ *  The rows of @p A are packed into words of GF2WORDBITS entries, so that the elimination of a row adds the pivot row
+ *  word by word, starting at the word containing the pivot column.
  */
 static
 int computeRowEchelonGF2(
@@ -2191,10 +2204,11 @@ int computeRowEchelonGF2(
    int                   n,                  /**< number of columns */
    int*                  p,                  /**< row permutation */
    int*                  s,                  /**< steps indicators of the row echelon form */
-   Type**                A,                  /**< matrix */
+   GF2Word**             A,                  /**< matrix with packed rows */
    Type*                 b                   /**< rhs */
    )
 {
+   int nwords;
    int pi;
    int i;
    int j;
@@ -2205,6 +2219,8 @@ int computeRowEchelonGF2(
    assert( p != NULL );
    assert( s != NULL );
 
+   nwords = GF2NWORDS(n);
+
    /* init permutation and step indicators */
    for (i = 0; i < m; ++i)
    {
@@ -2228,7 +2244,7 @@ int computeRowEchelonGF2(
       {
          /* search in current column j */
          k = i;
-         while ( k < m && A[p[k]][j] == 0 )
+         while ( k < m && GF2GETENTRY(A[p[k]], j) == 0 )
             ++k;
 
          /* found pivot */
@@ -2250,7 +2266,7 @@ int computeRowEchelonGF2(
 
       /* store step index */
       s[i] = j;
-      assert( A[p[k]][j] != 0 );
+      assert( GF2GETENTRY(A[p[k]], j) != 0 );
 
       /* swap row indices */
       if ( k != i )
@@ -2260,17 +2276,21 @@ int computeRowEchelonGF2(
          p[k] = h;
       }
       pi = p[i];
-      assert( A[pi][s[i]] != 0 );
+      assert( GF2GETENTRY(A[pi], s[i]) != 0 );
 
-      /* do elimination */
+      /* do elimination; the entries of the pivot row before column s[i] are 0, so the words before the one containing
+       * s[i] need not be added */
       for (k = i+1; k < m; ++k)
       {
          int pk = p[k];
          /* if entry in leading column is nonzero (otherwise we already have a 0) */
-         if ( A[pk][s[i]] != 0 )
+         if ( GF2GETENTRY(A[pk], s[i]) != 0 )
          {
-            for (j = s[i]; j < n; ++j)
-               A[pk][j] = A[pk][j] ^ A[pi][j];  /*lint !e732*/
+            GF2Word* rowk = A[pk];
+            GF2Word* rowi = A[pi];
+
+            for (j = s[i] / GF2WORDBITS; j < nwords; ++j)
+               rowk[j] ^= rowi[j];
             b[pk] = b[pk] ^ b[pi];  /*lint !e732*/
          }
       }
@@ -2300,7 +2320,7 @@ void solveRowEchelonGF2(
    int                   r,                  /**< rank of matrix */
    int*                  p,                  /**< row permutation */
    int*                  s,                  /**< steps indicators of the row echelon form */
-   Type**                A,                  /**< matrix */
+   GF2Word**             A,                  /**< matrix with packed rows */
    Type*                 b,                  /**< rhs */
    Type*                 x                   /**< solution vector on exit */
    )
@@ -2331,7 +2351,7 @@ void solveRowEchelonGF2(
       for (k = i+1; k < r; ++k)
       {
          assert( i <= s[k] && s[k] <= n );
-         if ( A[p[i]][s[k]] != 0 )
+         if ( GF2GETENTRY(A[p[i]], s[k]) != 0 )
             val = val ^ x[s[k]];  /*lint !e732*/
       }
 
@@ -2369,7 +2389,8 @@ SCIP_RETCODE checkSystemGF2(
    SCIP_Real* xorvals;
    SCIP_VAR** xorvars;
    SCIP_Bool noaggr = TRUE;
-   Type** A;
+   GF2Word** A;
+   GF2Word* Amem;
    Type* b;
    int* s;
    int* p;
@@ -2378,6 +2399,7 @@ SCIP_RETCODE checkSystemGF2(
    int nconssactive = 0;
    int nconssmat = 0;
    int nvarsmat = 0;
+   int nwords;
    int nvars;
    int rank;
    int i;
@@ -2508,9 +2530,11 @@ SCIP_RETCODE checkSystemGF2(
       xorbackidx[xoridx[j]] = j;
    }
 
-   /* init matrix and rhs */
+   /* init matrix and rhs; the packed rows are stored consecutively in one array */
+   nwords = GF2NWORDS(nvarsmat);
    SCIP_CALL( SCIPallocBufferArray(scip, &b, nconssactive) );
    SCIP_CALL( SCIPallocBufferArray(scip, &A, nconssactive) );
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &Amem, nconssactive * nwords) );
    for (i = 0; i < nconss; ++i)
    {
       if ( ! xoractive[i] )
@@ -2521,8 +2545,7 @@ SCIP_RETCODE checkSystemGF2(
       assert( consdata != NULL );
       assert( consdata->nvars > 0 );
 
-      SCIP_CALL( SCIPallocBufferArray(scip, &(A[nconssmat]), nvarsmat) ); /*lint !e866*/
-      BMSclearMemoryArray(A[nconssmat], nvarsmat); /*lint !e866*/
+      A[nconssmat] = Amem + (size_t) nconssmat * nwords;
 
       /* correct rhs w.r.t. to fixed variables and count nonfixed variables in constraint */
       b[nconssmat] = (Type) consdata->rhs;
@@ -2597,7 +2620,7 @@ SCIP_RETCODE checkSystemGF2(
                idx = SCIPhashmapGetImageInt(varhash, var);
                assert( idx < nvarsmat );
                assert( 0 <= xorbackidx[idx] && xorbackidx[idx] < nvarsmat );
-               A[nconssmat][xorbackidx[idx]] = 1;
+               GF2SETENTRY(A[nconssmat], xorbackidx[idx]);
             }
          }
       }
@@ -2615,7 +2638,7 @@ SCIP_RETCODE checkSystemGF2(
    for (i = 0; i < nconssmat; ++i)
    {
       for (j = 0; j < nvarsmat; ++j)
-         SCIPinfoMessage(scip, NULL, "%d ", A[i][j]);
+         SCIPinfoMessage(scip, NULL, "%d ", GF2GETENTRY(A[i], j));
       SCIPinfoMessage(scip, NULL, " = %d\n", b[i]);
    }
    SCIPinfoMessage(scip, NULL, "\n");
@@ -2636,7 +2659,7 @@ SCIP_RETCODE checkSystemGF2(
       for (i = 0; i < nconssmat; ++i)
       {
          for (j = 0; j < nvarsmat; ++j)
-            SCIPinfoMessage(scip, NULL, "%d ", A[p[i]][j]);
+            SCIPinfoMessage(scip, NULL, "%d ", GF2GETENTRY(A[p[i]], j));
          SCIPinfoMessage(scip, NULL, " = %d\n", b[p[i]]);
       }
       SCIPinfoMessage(scip, NULL, "\n");
@@ -2810,21 +2833,7 @@ SCIP_RETCODE checkSystemGF2(
    /* free storage */
    SCIPfreeBufferArray(scip, &s);
    SCIPfreeBufferArray(scip, &p);
-   j = nconssmat - 1;
-   for (i = nconss - 1; i >= 0 ; --i)
-   {
-      consdata = SCIPconsGetData(conss[i]);
-      assert(consdata != NULL);
-
-      if ( consdata->nvars == 0 )
-         continue;
-
-      if( !xoractive[i] )
-         continue;
-
-      SCIPfreeBufferArray(scip, &(A[j]));
-      --j;
-   }
+   SCIPfreeBufferArray(scip, &Amem);
    SCIPfreeBufferArray(scip, &A);
    SCIPfreeBufferArray(scip, &b);
    SCIPfreeBufferArray(scip, &xorbackidx);
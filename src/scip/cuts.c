@@ -4909,6 +4909,7 @@ SCIP_RETCODE SCIPcutGenerationHeuristicCMIR(
 #define MAXDELTA                  1e-09
 #define MAXSCALE                 1000.0
 #define MAXDYNPROGSPACE         1000000
+#define MAXCOREWORK              100000 /**< maximal number of states processed by the core knapsack algorithm */
 #endif
 
 #define MAXABSVBCOEF               1e+5 /**< maximal absolute coefficient in variable bounds used for snf relaxation */
@@ -6446,7 +6447,8 @@ SCIP_RETCODE getFlowCover(
    }
 
    /* Use the following strategy
-    *   solve KP^SNF_int exactly,          if a suitable factor C is found and (nitems*capacity) <= MAXDYNPROGSPACE,
+    *   solve KP^SNF_int exactly,          if a suitable factor C is found and either (nitems*capacity) <= MAXDYNPROGSPACE
+    *                                      or the core algorithm succeeds,
     *   solve KP^SNF_rat approximately,    otherwise
     */
 
@@ -6471,8 +6473,7 @@ SCIP_RETCODE getFlowCover(
    /* suitable factor C was found*/
    if( scalesuccess )
    {
-      SCIP_Real tmp1;
-      SCIP_Real tmp2;
+      SCIP_Bool success;
 
       /* transform KP^SNF to KP^SNF_int */
       for( j = 0; j < nitems; ++j )
@@ -6492,34 +6493,24 @@ SCIP_RETCODE getFlowCover(
       nnonflowcovervarsafterfix = *nnonflowcovervars;
       QUAD_ASSIGN_Q(flowcoverweightafterfix, flowcoverweight);
 
-      tmp1 = (SCIP_Real) (nitems + 1);
-      tmp2 = (SCIP_Real) ((transcapacityint) + 1);
-      if( transcapacityint * nitems <= MAXDYNPROGSPACE && tmp1 * tmp2 <= INT_MAX / 8.0)
-      {
-         SCIP_Bool success;
-
-         /* solve KP^SNF_int by dynamic programming */
-         SCIP_CALL(SCIPsolveKnapsackExactly(scip, nitems, transweightsint, transprofitsint, transcapacityint,
-               itemsint, solitems, nonsolitems, &nsolitems, &nnonsolitems, NULL, &success));
+      /* solve KP^SNF_int by dynamic programming; for large capacities, only the core algorithm is used, such that the
+       * dynamic programming table is bounded by MAXDYNPROGSPACE; since the separation is called often, the core
+       * algorithm gives up after MAXCOREWORK states and the knapsack is solved approximately
+       */
+      SCIP_CALL(SCIPsolveKnapsackExactlyLimited(scip, nitems, transweightsint, transprofitsint, transcapacityint,
+            itemsint, solitems, nonsolitems, &nsolitems, &nnonsolitems, NULL, (SCIP_Real) MAXDYNPROGSPACE,
+            (SCIP_Real) MAXCOREWORK, &success));
 
-         if( !success )
-         {
-            /* solve KP^SNF_rat approximately */
-            SCIP_CALL(SCIPsolveKnapsackApproximatelyLT(scip, nitems, transweightsreal, transprofitsreal,
-                  transcapacityreal, items, solitems, nonsolitems, &nsolitems, &nnonsolitems, NULL));
-         }
-#if !defined(NDEBUG) || defined(SCIP_DEBUG)
-         else
-            kpexact = TRUE;
-#endif
-      }
-      else
+      if( !success )
       {
          /* solve KP^SNF_rat approximately */
-         SCIP_CALL(SCIPsolveKnapsackApproximatelyLT(scip, nitems, transweightsreal, transprofitsreal, transcapacityreal,
-               items, solitems, nonsolitems, &nsolitems, &nnonsolitems, NULL));
-         assert(!kpexact);
+         SCIP_CALL(SCIPsolveKnapsackApproximatelyLT(scip, nitems, transweightsreal, transprofitsreal,
+               transcapacityreal, items, solitems, nonsolitems, &nsolitems, &nnonsolitems, NULL));
       }
+#if !defined(NDEBUG) || defined(SCIP_DEBUG)
+      else
+         kpexact = TRUE;
+#endif
    }
    else
    {
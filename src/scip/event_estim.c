@@ -139,8 +139,7 @@ typedef enum RestartPolicy RESTARTPOLICY;
 #define DES_ALPHA_OPENNODES 0.6
 #define DES_BETA_OPENNODES  0.15
 
-#define MAX_REGFORESTSIZE 10000000               /**< size limit (number of nodes) for regression forest */
-
+#define NREGFORESTFEATURES 9                     /**< number of features of the regression forest for the search completion */
 
 
 /* computation of search completion */
@@ -211,9 +210,6 @@ enum TsPos
 
 typedef enum TsPos TSPOS;
 
-/** regression forest data structure */
-typedef struct SCIP_RegForest SCIP_REGFOREST;
-
 /** statistics collected from profile used for prediction */
 struct TreeProfileStats
 {
@@ -363,17 +359,6 @@ struct NodeInfo
 };
 typedef struct NodeInfo NODEINFO;
 
-struct SCIP_RegForest
-{
-   int                   ntrees;             /**< number of trees in this forest */
-   int                   dim;                /**< feature dimension */
-   int*                  nbegin;             /**< array of root node indices of each tree */
-   int*                  child;              /**< child index pair of each internal node, or (-1, -1) for leaves */
-   int*                  splitidx;           /**< data index for split at node, or -1 at a leaf */
-   SCIP_Real*            value;              /**< split position at internal nodes, prediction at leaves */
-   int                   size;               /**< length of node arrays */
-};
-
 /*
  * Local methods
  */
@@ -396,212 +381,6 @@ char* real2String(
    return buf;
 }
 
-/** free a regression forest data structure */
-static
-void SCIPregForestFree(
-   SCIP_REGFOREST**      regforest           /**< regression forest data structure */
-   )
-{
-   SCIP_REGFOREST* regforestptr;
-
-   assert(regforest != NULL);
-
-   if( *regforest == NULL )
-      return;
-   regforestptr = *regforest;
-
-   BMSfreeMemoryArrayNull(&regforestptr->nbegin);
-   BMSfreeMemoryArrayNull(&regforestptr->child);
-   BMSfreeMemoryArrayNull(&regforestptr->splitidx);
-   BMSfreeMemoryArrayNull(&regforestptr->value);
-
-   BMSfreeMemory(regforest);
-}
-
-/** make a prediction with regression forest */
-static
-SCIP_Real SCIPregForestPredict(
-   SCIP_REGFOREST*       regforest,          /**< regression forest data structure */
-   SCIP_Real*            datapoint           /**< a data point that matches the dimension of this regression forest */
-   )
-{
-   int treeidx;
-   SCIP_Real value = 0.0;
-
-   assert(regforest != NULL);
-   assert(datapoint != NULL);
-
-   SCIPdebugMessage("Start prediction method of regression forest\n");
-
-   /* loop through the trees */
-   for( treeidx = 0; treeidx < regforest->ntrees; ++treeidx )
-   {
-      int treepos = regforest->nbegin[treeidx];
-      int* childtree = &(regforest->child[2 * treepos]);
-      int* splitidxtree = &(regforest->splitidx[treepos]);
-      int pos = 0;
-      SCIP_Real* valuetree = &(regforest->value[treepos]);
-
-      SCIPdebugMessage("Tree %d at position %d\n", treeidx, treepos);
-
-      /* find the correct leaf */
-      while( splitidxtree[pos] != - 1 )
-      {
-         int goright;
-
-         assert(splitidxtree[pos] < regforest->dim);
-
-         goright = (datapoint[splitidxtree[pos]] > valuetree[pos]) ? 1 : 0;
-         pos = childtree[2 * pos + goright];
-      }
-
-      value += valuetree[pos];
-   }
-
-   /* return the average value that the trees predict */
-   return value / (SCIP_Real)(regforest->ntrees);
-}
-
-/** read a regression forest from an rfcsv file
- *
- *  TODO improve this parser to better capture wrong user input, e.g., if the dimension is wrong
- */
-static
-SCIP_RETCODE SCIPregForestFromFile(
-   SCIP_REGFOREST**      regforest,          /**< regression forest data structure */
-   const char*           filename            /**< name of file with the regression forest data */
-   )
-{
-   SCIP_RETCODE retcode = SCIP_OKAY;
-   SCIP_FILE* file;
-   SCIP_REGFOREST* regforestptr;
-   char buffer[SCIP_MAXSTRLEN];
-   char firstlineformat[SCIP_MAXSTRLEN];
-   char dataformat[SCIP_MAXSTRLEN];
-   char valuestr[SCIP_MAXSTRLEN];
-   SCIP_Bool error = FALSE;
-   int ntrees;
-   int dim;
-   int size;
-   int sscanret;
-   int pos;
-   int treepos;
-
-   /* try to open file */
-   file = SCIPfopen(filename, "r");
-
-   if( file == NULL )
-      return SCIP_NOFILE;
-
-   /* parse read the first line that contains the number of trees, feature dimension, and total number of nodes */
-   (void) SCIPsnprintf(firstlineformat, SCIP_MAXSTRLEN, "### NTREES=%%10d FEATURE_DIM=%%10d LENGTH=%%10d\n");
-   if( SCIPfgets(buffer, (int) sizeof(buffer), file) == NULL )
-   {
-      error = TRUE;
-      SCIPerrorMessage("Could not read first line of regression file '%s'\n", filename);
-      goto CLOSEFILE;
-   }
-
-   /* coverity[secure_coding] */
-   sscanret = sscanf(buffer, firstlineformat, &ntrees, &dim, &size);
-
-   if( sscanret != 3 )
-   {
-      error = TRUE;
-      SCIPerrorMessage("Could not extract tree information from buffer line [%s]\n", buffer);
-      goto CLOSEFILE;
-   }
-
-   SCIPdebugMessage("Read ntrees=%d, dim=%d, size=%d (return value %d)\n", ntrees, dim, size, sscanret);
-
-   /* check if the tree is too big, or numbers are negative */
-   if( size > MAX_REGFORESTSIZE )
-   {
-      error = TRUE;
-      SCIPerrorMessage("Requested size %d exceeds size limit %d for regression trees", size, MAX_REGFORESTSIZE);
-      goto CLOSEFILE;
-   }
-
-   if( dim <= 0 || ntrees <= 0 || size <= 0 )
-   {
-      error = TRUE;
-      SCIPerrorMessage("Cannot create regression tree with negative size, dimension, or number of trees\n");
-      goto CLOSEFILE;
-   }
-
-   /* allocate memory in regression forest data structure */
-   SCIP_ALLOC_TERMINATE( retcode, BMSallocMemory(regforest), FREEFOREST );
-   BMSclearMemory(*regforest);
-   regforestptr = *regforest;
-
-   /* coverity[tainted_data] */
-   SCIP_ALLOC_TERMINATE( retcode, BMSallocMemoryArray(&regforestptr->nbegin, ntrees), FREEFOREST );
-   SCIP_ALLOC_TERMINATE( retcode, BMSallocMemoryArray(&regforestptr->child, 2 * size), FREEFOREST ); /*lint !e647*/
-   SCIP_ALLOC_TERMINATE( retcode, BMSallocMemoryArray(&regforestptr->splitidx, size), FREEFOREST );
-   SCIP_ALLOC_TERMINATE( retcode, BMSallocMemoryArray(&regforestptr->value, size), FREEFOREST );
-
-   regforestptr->dim = dim;
-   regforestptr->size = size;
-   regforestptr->ntrees = ntrees;
-
-   SCIPdebugMessage("Random Forest allocated\n");
-
-   /* loop through the rest of the file, which contains the comma separated node data */
-   (void) SCIPsnprintf(dataformat, SCIP_MAXSTRLEN, "%%10d,%%10d,%%10d,%%10d,%%%ds\n", SCIP_MAXSTRLEN);
-
-   pos = 0;
-   treepos = 0;
-   while( !SCIPfeof(file) && !error )
-   {
-      int node;
-      char* endptr;
-
-      /* get next line */
-      if( SCIPfgets(buffer, (int) sizeof(buffer), file) == NULL )
-         break;
-
-      sscanret = sscanf(buffer, dataformat,
-         &node,
-         &regforestptr->child[2 * pos],
-         &regforestptr->child[2 * pos + 1],
-         &regforestptr->splitidx[pos],
-         valuestr);
-
-      if( sscanret != 5 )
-      {
-         SCIPerrorMessage("Something wrong with line %d '%s'", pos + 1, buffer);
-         error = TRUE;
-      }
-
-      (void)SCIPstrToRealValue(valuestr, &regforestptr->value[pos], &endptr);
-
-      /* new root node - increase the tree index position */
-      if( node == 0 )
-      {
-         assert(treepos < regforestptr->ntrees);
-
-         regforestptr->nbegin[treepos++] = pos;
-      }
-
-      ++pos;
-   }
-
-   goto CLOSEFILE;
-
-/* insufficient memory for allocating regression forest */
-FREEFOREST:
-   assert(retcode == SCIP_NOMEMORY);
-   SCIPregForestFree(regforest);
-
-CLOSEFILE:
-   SCIPfclose(file);
-
-   if( error )
-      retcode = SCIP_INVALIDDATA;
-
-   return retcode;
-}
-
 /** compare two tree profile statistics for equality */
 static
 SCIP_Bool isEqualTreeProfileStats(
@@ -2134,7 +1913,7 @@ SCIP_RETCODE getSearchCompletion(
    SCIP_Real*            completed           /**< pointer to store the search tree completion */
    )
 {
-   SCIP_Real values[9];
+   SCIP_Real values[NREGFORESTFEATURES];
    TREEDATA* treedata;
    char completiontype;
 
@@ -2662,6 +2441,15 @@ SCIP_DECL_EVENTINIT(eventInitEstim)
    if( 0 != strncmp(eventhdlrdata->regforestfilename, DEFAULT_REGFORESTFILENAME, strlen(DEFAULT_REGFORESTFILENAME)) )
    {
       SCIP_CALL( SCIPregForestFromFile(&eventhdlrdata->regforest, eventhdlrdata->regforestfilename) );
+
+      if( SCIPregForestGetDim(eventhdlrdata->regforest) != NREGFORESTFEATURES )
+      {
+         SCIPerrorMessage("Feature dimension %d of regression forest file <%s> does not match the %d features of the tree size estimation\n",
+            SCIPregForestGetDim(eventhdlrdata->regforest), eventhdlrdata->regforestfilename, NREGFORESTFEATURES);
+         SCIPregForestFree(&eventhdlrdata->regforest);
+
+         return SCIP_READERROR;
+      }
    }
 
    eventhdlrdata->lastrestartrun = 0;
@@ -0,0 +1,680 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   heur_fixandpropagate.c
+ * @ingroup DEFPLUGINS_HEUR
+ * @brief  fix-and-propagate heuristic that runs many attempts in parallel on a sparse copy of the LP rows
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "blockmemshell/memory.h"
+#include "scip/heur_fixandpropagate.h"
+#include "scip/pub_heur.h"
+#include "scip/pub_lp.h"
+#include "scip/pub_message.h"
+#include "scip/pub_misc.h"
+#include "scip/pub_misc_sort.h"
+#include "scip/pub_var.h"
+#include "scip/scip_concurrent.h"
+#include "scip/scip_heur.h"
+#include "scip/scip_lp.h"
+#include "scip/scip_mem.h"
+#include "scip/scip_message.h"
+#include "scip/scip_numerics.h"
+#include "scip/scip_param.h"
+#include "scip/scip_probing.h"
+#include "scip/scip_randnumgen.h"
+#include "scip/scip_sol.h"
+#include "scip/scip_solvingstats.h"
+#include "scip/scip_tree.h"
+#include "tpi/tpi.h"
+#include <string.h>
+
+#define HEUR_NAME             "fixandpropagate"
+#define HEUR_DESC             "fix-and-propagate heuristic that runs many attempts in parallel on a sparse copy of the LP rows"
+#define HEUR_DISPCHAR         SCIP_HEURDISPCHAR_PROP
+#define HEUR_PRIORITY         1500
+#define HEUR_FREQ             -1
+#define HEUR_FREQOFS          0
+#define HEUR_MAXDEPTH         -1
+#define HEUR_TIMING           SCIP_HEURTIMING_BEFORENODE
+#define HEUR_USESSUBSCIP      FALSE  /**< does the heuristic use a secondary SCIP instance? */
+
+#define DEFAULT_NATTEMPTS         8  /**< number of fix-and-propagate attempts */
+#define DEFAULT_COMPLETELP     TRUE  /**< should the continuous columns of the best attempt be completed by an LP? */
+#define DEFAULT_RANDSEED         59  /**< initial random seed */
+
+/** primal heuristic data */
+struct SCIP_HeurData
+{
+   int                   nattempts;          /**< number of fix-and-propagate attempts */
+   SCIP_Bool             completelp;         /**< should the continuous columns of the best attempt be completed by an LP? */
+};
+
+/** outcome of a fix-and-propagate attempt */
+enum FapStatus
+{
+   FAP_FAILED   = 0,                         /**< a fixing and its alternative were infeasible */
+   FAP_INTEGRAL = 1,                         /**< all integer columns were fixed, but some continuous columns are not */
+   FAP_COMPLETE = 2                          /**< all columns were fixed and all rows are satisfied */
+};
+typedef enum FapStatus FAPSTATUS;
+
+/** a fix-and-propagate attempt; only the job executing the attempt writes to it */
+struct FapAttempt
+{
+   SCIP_RANDNUMGEN*      randnumgen;         /**< random number generator of the attempt */
+   SCIP_Real*            solvals;            /**< values of the columns fixed by the attempt */
+   SCIP_Real             intobj;             /**< objective value of the integer columns fixed by the attempt */
+   FAPSTATUS             status;             /**< outcome of the attempt */
+};
+typedef struct FapAttempt FAPATTEMPT;
+
+/** copy of the LP rows with the bounds and activities that all attempts start from; the data is only read by the
+ *  jobs, except for the next attempt, which is protected by the lock
+ */
+struct FapMatrix
+{
+   SCIP_LINPROP*         linprop;            /**< rows for the propagation on thread-local bounds */
+   SCIP_Real*            obj;                /**< objective coefficients of the columns */
+   int*                  nlocksdown;         /**< number of model down-locks of the variables of the columns */
+   int*                  nlocksup;           /**< number of model up-locks of the variables of the columns */
+   int*                  intcols;            /**< integer columns in the order of decreasing number of locks */
+   SCIP_Bool*            isint;              /**< is the column of integral type? */
+   FAPATTEMPT*           attempts;           /**< fix-and-propagate attempts */
+   SCIP_LOCK*            lock;               /**< lock for the next attempt */
+   SCIP_Real             infinity;           /**< value for infinity */
+   int                   ncols;              /**< number of columns */
+   int                   nintcols;           /**< number of integer columns */
+   int                   nattempts;          /**< number of attempts */
+   int                   nextattempt;        /**< next attempt that is not assigned to a job */
+};
+typedef struct FapMatrix FAPMATRIX;
+
+
+/*
+ * Local methods
+ */
+
+/** returns the value to fix an integer column to: the bound in the given direction, or the value closest to zero if
+ *  this bound is infinite
+ */
+static
+SCIP_Real fapGetFixVal(
+   SCIP_Real             lb,                 /**< lower bound of the column */
+   SCIP_Real             ub,                 /**< upper bound of the column */
+   SCIP_Real             infinity,           /**< value for infinity */
+   SCIP_Bool             roundup             /**< should the column be fixed to its upper bound? */
+   )
+{
+   if( roundup && ub < infinity )
+      return ub;
+   if( !roundup && lb > -infinity )
+      return lb;
+
+   return MAX(lb, MIN(ub, 0.0));
+}
+
+/** executes a fix-and-propagate attempt on the bounds and activities of the worker
+ *
+ *  Attempt 0 fixes the integer columns in the order of decreasing number of locks, the other attempts in a random
+ *  order. The attempts alternate between rounding in the direction of fewer locks, in the direction of the objective,
+ *  and randomly.
+ */
+static
+void fapRunAttempt(
+   FAPMATRIX*            matrix,             /**< matrix */
+   SCIP_LINPROPWORKER*   worker,             /**< thread-local bounds and activities */
+   int*                  order,              /**< buffer for the order in which the integer columns are fixed */
+   int                   a                   /**< index of the attempt */
+   )
+{
+   FAPATTEMPT* attempt = &matrix->attempts[a];
+   const SCIP_Real* lb;
+   const SCIP_Real* ub;
+   SCIP_Bool complete;
+   int k;
+   int c;
+
+   attempt->status = FAP_FAILED;
+   attempt->intobj = 0.0;
+
+   SCIPlinpropWorkerReset(worker);
+   lb = SCIPlinpropWorkerGetLbs(worker);
+   ub = SCIPlinpropWorkerGetUbs(worker);
+
+   BMScopyMemoryArray(order, matrix->intcols, matrix->nintcols);
+   if( a > 0 )
+      SCIPrandomPermuteIntArray(attempt->randnumgen, order, 0, matrix->nintcols);
+
+   for( k = 0; k < matrix->nintcols; ++k )
+   {
+      SCIP_Bool roundup;
+      SCIP_Bool feasible = FALSE;
+      int trial;
+
+      c = order[k];
+
+      /* the column may have been fixed by propagation */
+      if( lb[c] == ub[c] ) /*lint !e777*/
+         continue;
+
+      switch( a % 3 )
+      {
+      case 0:
+         roundup = (matrix->nlocksdown[c] > matrix->nlocksup[c]);
+         break;
+      case 1:
+         roundup = (matrix->obj[c] < 0.0 || (matrix->obj[c] == 0.0 && matrix->nlocksdown[c] > matrix->nlocksup[c])); /*lint !e777*/
+         break;
+      default:
+         roundup = (SCIPrandomGetInt(attempt->randnumgen, 0, 1) == 1);
+         break;
+      }
+
+      /* fix the column in the selected direction and try the other one if the fixing turns out to be infeasible */
+      for( trial = 0; trial < 2 && !feasible; ++trial )
+      {
+         feasible = SCIPlinpropWorkerFix(worker, c, fapGetFixVal(lb[c], ub[c], matrix->infinity, roundup));
+
+         if( feasible )
+            SCIPlinpropWorkerCommit(worker);
+         else
+            SCIPlinpropWorkerUndo(worker);
+
+         roundup = !roundup;
+      }
+
+      if( !feasible )
+         return;
+   }
+
+   complete = TRUE;
+   for( c = 0; c < matrix->ncols; ++c )
+   {
+      attempt->solvals[c] = lb[c];
+
+      if( matrix->isint[c] )
+         attempt->intobj += matrix->obj[c] * lb[c];
+      else if( lb[c] != ub[c] ) /*lint !e777*/
+         complete = FALSE;
+   }
+
+   if( !complete )
+   {
+      attempt->status = FAP_INTEGRAL;
+      return;
+   }
+
+   /* rows may not be propagated completely because of the work limit */
+   if( SCIPlinpropWorkerIsFeasible(worker) )
+      attempt->status = FAP_COMPLETE;
+}
+
+/** job of the fix-and-propagate heuristic: repeatedly takes the next attempt and executes it on thread-local copies
+ *  of the bounds and activities
+ */
+static
+SCIP_DECL_PARALLELJOB(fapExecJob)
+{
+   FAPMATRIX* matrix = (FAPMATRIX*)jobarg;
+   SCIP_LINPROPWORKER* worker = NULL;
+   SCIP_RETCODE retcode = SCIP_OKAY;
+   int* order = NULL;
+
+   SCIP_CALL_TERMINATE( retcode, SCIPlinpropWorkerCreate(&worker, matrix->linprop), TERMINATE );
+   SCIP_ALLOC_TERMINATE( retcode, BMSallocMemoryArray(&order, MAX(matrix->nintcols, 1)), TERMINATE );
+
+   for( ;; )
+   {
+      int a;
+
+      SCIP_CALL_TERMINATE( retcode, SCIPtpiAcquireLock(matrix->lock), TERMINATE );
+      a = matrix->nextattempt;
+      if( a < matrix->nattempts )
+         ++matrix->nextattempt;
+      SCIP_CALL_TERMINATE( retcode, SCIPtpiReleaseLock(matrix->lock), TERMINATE );
+
+      if( a >= matrix->nattempts )
+         break;
+
+      fapRunAttempt(matrix, worker, order, a);
+   }
+
+TERMINATE:
+   BMSfreeMemoryArrayNull(&order);
+   SCIPlinpropWorkerFree(&worker);
+
+   return retcode;
+}
+
+/** creates the copy of the LP rows with the local bounds of the LP columns */
+static
+SCIP_RETCODE fapMatrixCreate(
+   SCIP*                 scip,               /**< SCIP data structure */
+   FAPMATRIX*            matrix              /**< matrix to initialize */
+   )
+{
+   SCIP_COL** cols;
+   SCIP_ROW** rows;
+   SCIP_Real* rowvals;
+   SCIP_Real* lhs;
+   SCIP_Real* rhs;
+   SCIP_Real* lb;
+   SCIP_Real* ub;
+   int* rowbeg;
+   int* rowcols;
+   int* nlocks;
+   int nnonz;
+   int ncols;
+   int nrows;
+   int c;
+   int r;
+   int i;
+
+   SCIP_CALL( SCIPgetLPColsData(scip, &cols, &ncols) );
+   SCIP_CALL( SCIPgetLPRowsData(scip, &rows, &nrows) );
+
+   BMSclearMemory(matrix);
+   matrix->ncols = ncols;
+   matrix->infinity = SCIPinfinity(scip);
+
+   nnonz = 0;
+   for( r = 0; r < nrows; ++r )
+      nnonz += SCIProwGetNNonz(rows[r]);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &matrix->obj, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &matrix->nlocksdown, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &matrix->nlocksup, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &matrix->intcols, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &matrix->isint, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &rowbeg, nrows + 1) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &rowcols, MAX(nnonz, 1)) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &rowvals, MAX(nnonz, 1)) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &lhs, nrows) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &rhs, nrows) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &lb, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &ub, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &nlocks, ncols) );
+
+   for( c = 0; c < ncols; ++c )
+   {
+      SCIP_VAR* var = SCIPcolGetVar(cols[c]);
+
+      lb[c] = SCIPisInfinity(scip, -SCIPcolGetLb(cols[c])) ? -matrix->infinity : SCIPcolGetLb(cols[c]);
+      ub[c] = SCIPisInfinity(scip, SCIPcolGetUb(cols[c])) ? matrix->infinity : SCIPcolGetUb(cols[c]);
+      matrix->obj[c] = SCIPcolGetObj(cols[c]);
+      matrix->nlocksdown[c] = SCIPvarGetNLocksDownType(var, SCIP_LOCKTYPE_MODEL);
+      matrix->nlocksup[c] = SCIPvarGetNLocksUpType(var, SCIP_LOCKTYPE_MODEL);
+      matrix->isint[c] = SCIPcolIsIntegral(cols[c]);
+
+      if( matrix->isint[c] )
+      {
+         nlocks[matrix->nintcols] = matrix->nlocksdown[c] + matrix->nlocksup[c];
+         matrix->intcols[matrix->nintcols] = c;
+         ++matrix->nintcols;
+      }
+   }
+
+   /* the first attempt fixes the columns with many locks first, since they are most likely to imply other fixings */
+   SCIPsortDownIntInt(nlocks, matrix->intcols, matrix->nintcols);
+
+   /* fill the rows, skipping the columns that are not in the LP */
+   nnonz = 0;
+   for( r = 0; r < nrows; ++r )
+   {
+      SCIP_COL** rowcolsr = SCIProwGetCols(rows[r]);
+      SCIP_Real* rowvalsr = SCIProwGetVals(rows[r]);
+
+      rowbeg[r] = nnonz;
+      lhs[r] = SCIPisInfinity(scip, -SCIProwGetLhs(rows[r])) ? -matrix->infinity
+         : SCIProwGetLhs(rows[r]) - SCIProwGetConstant(rows[r]);
+      rhs[r] = SCIPisInfinity(scip, SCIProwGetRhs(rows[r])) ? matrix->infinity
+         : SCIProwGetRhs(rows[r]) - SCIProwGetConstant(rows[r]);
+
+      for( i = 0; i < SCIProwGetNNonz(rows[r]); ++i )
+      {
+         int lppos = SCIPcolGetLPPos(rowcolsr[i]);
+
+         if( lppos < 0 )
+            continue;
+
+         rowcols[nnonz] = lppos;
+         rowvals[nnonz] = rowvalsr[i];
+         ++nnonz;
+      }
+   }
+   rowbeg[nrows] = nnonz;
+
+   /* the activities w.r.t. the local bounds are updated incrementally by the attempts */
+   SCIP_CALL( SCIPlinpropCreate(&matrix->linprop, nrows, ncols, rowbeg, rowcols, rowvals, lhs, rhs, lb, ub,
+         matrix->isint, matrix->infinity, SCIPfeastol(scip), SCIPepsilon(scip)) );
+
+   SCIPfreeBufferArray(scip, &nlocks);
+   SCIPfreeBufferArray(scip, &ub);
+   SCIPfreeBufferArray(scip, &lb);
+   SCIPfreeBufferArray(scip, &rhs);
+   SCIPfreeBufferArray(scip, &lhs);
+   SCIPfreeBufferArray(scip, &rowvals);
+   SCIPfreeBufferArray(scip, &rowcols);
+   SCIPfreeBufferArray(scip, &rowbeg);
+
+   return SCIP_OKAY;
+}
+
+/** frees the copy of the LP rows */
+static
+void fapMatrixFree(
+   SCIP*                 scip,               /**< SCIP data structure */
+   FAPMATRIX*            matrix              /**< matrix */
+   )
+{
+   SCIPlinpropFree(&matrix->linprop);
+
+   SCIPfreeBufferArray(scip, &matrix->isint);
+   SCIPfreeBufferArray(scip, &matrix->intcols);
+   SCIPfreeBufferArray(scip, &matrix->nlocksup);
+   SCIPfreeBufferArray(scip, &matrix->nlocksdown);
+   SCIPfreeBufferArray(scip, &matrix->obj);
+}
+
+/** fixes the integer columns to the values of an attempt in probing mode and solves the LP over the continuous
+ *  columns; the LP solution is tried as a solution
+ */
+static
+SCIP_RETCODE completeAttemptByLP(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_HEUR*            heur,               /**< heuristic */
+   FAPMATRIX*            matrix,             /**< matrix */
+   FAPATTEMPT*           attempt,            /**< attempt that fixed all integer columns */
+   SCIP_Bool*            stored              /**< pointer to store whether a solution was stored */
+   )
+{
+   SCIP_COL** cols;
+   SCIP_Bool lperror;
+   SCIP_Bool cutoff;
+   int ncols;
+   int c;
+
+   assert(attempt->status == FAP_INTEGRAL);
+
+   *stored = FALSE;
+
+   SCIP_CALL( SCIPgetLPColsData(scip, &cols, &ncols) );
+   assert(ncols == matrix->ncols);
+
+   SCIP_CALL( SCIPstartProbing(scip) );
+   SCIP_CALL( SCIPnewProbingNode(scip) );
+
+   cutoff = FALSE;
+   for( c = 0; c < ncols && !cutoff; ++c )
+   {
+      SCIP_VAR* var;
+
+      if( !matrix->isint[c] )
+         continue;
+
+      var = SCIPcolGetVar(cols[c]);
+
+      if( SCIPisLT(scip, attempt->solvals[c], SCIPvarGetLbLocal(var))
+         || SCIPisGT(scip, attempt->solvals[c], SCIPvarGetUbLocal(var)) )
+         cutoff = TRUE;
+      else if( SCIPvarGetLbLocal(var) < SCIPvarGetUbLocal(var) )
+      {
+         SCIP_CALL( SCIPfixVarProbing(scip, var, attempt->solvals[c]) );
+      }
+   }
+
+   if( !cutoff )
+   {
+      SCIP_CALL( SCIPsolveProbingLP(scip, -1, &lperror, &cutoff) );
+
+      if( !lperror && !cutoff && SCIPgetLPSolstat(scip) == SCIP_LPSOLSTAT_OPTIMAL )
+      {
+         SCIP_SOL* sol;
+
+         SCIP_CALL( SCIPcreateSol(scip, &sol, heur) );
+         SCIP_CALL( SCIPlinkLPSol(scip, sol) );
+         SCIP_CALL( SCIPtrySolFree(scip, &sol, FALSE, FALSE, TRUE, TRUE, TRUE, stored) );
+      }
+   }
+
+   SCIP_CALL( SCIPendProbing(scip) );
+
+   return SCIP_OKAY;
+}
+
+
+/*
+ * Callback methods
+ */
+
+/** copy method for primal heuristic plugins (called when SCIP copies plugins) */
+static
+SCIP_DECL_HEURCOPY(heurCopyFixandpropagate)
+{  /*lint --e{715}*/
+   assert(scip != NULL);
+   assert(heur != NULL);
+   assert(strcmp(SCIPheurGetName(heur), HEUR_NAME) == 0);
+
+   /* call inclusion method of primal heuristic */
+   SCIP_CALL( SCIPincludeHeurFixandpropagate(scip) );
+
+   return SCIP_OKAY;
+}
+
+/** destructor of primal heuristic to free user data (called when SCIP is exiting) */
+static
+SCIP_DECL_HEURFREE(heurFreeFixandpropagate)
+{  /*lint --e{715}*/
+   SCIP_HEURDATA* heurdata;
+
+   assert(heur != NULL);
+   assert(strcmp(SCIPheurGetName(heur), HEUR_NAME) == 0);
+   assert(scip != NULL);
+
+   /* free heuristic data */
+   heurdata = SCIPheurGetData(heur);
+   assert(heurdata != NULL);
+
+   SCIPfreeBlockMemory(scip, &heurdata);
+   SCIPheurSetData(heur, NULL);
+
+   return SCIP_OKAY;
+}
+
+/** execution method of primal heuristic */
+static
+SCIP_DECL_HEUREXEC(heurExecFixandpropagate)
+{  /*lint --e{715}*/
+   SCIP_HEURDATA* heurdata;
+   SCIP_COL** cols;
+   FAPMATRIX matrix;
+   void** jobargs;
+   SCIP_Bool cutoff;
+   int bestintegral;
+   int nthreads;
+   int ncols;
+   int a;
+   int c;
+
+   assert(heur != NULL);
+   assert(strcmp(SCIPheurGetName(heur), HEUR_NAME) == 0);
+   assert(scip != NULL);
+   assert(result != NULL);
+
+   *result = SCIP_DIDNOTRUN;
+
+   heurdata = SCIPheurGetData(heur);
+   assert(heurdata != NULL);
+
+   /* only run if we are allowed to solve an LP at the current node in the tree, since the rows are taken from the LP */
+   if( !SCIPhasCurrentNodeLP(scip) )
+      return SCIP_OKAY;
+
+   if( !SCIPisLPConstructed(scip) )
+   {
+      SCIP_CALL( SCIPconstructLP(scip, &cutoff) );
+
+      /* manually cut off the node if the LP construction detected infeasibility (heuristics cannot return such a result) */
+      if( cutoff )
+      {
+         SCIP_CALL( SCIPcutoffNode(scip, SCIPgetCurrentNode(scip)) );
+         return SCIP_OKAY;
+      }
+
+      SCIP_CALL( SCIPflushLP(scip) );
+   }
+
+   SCIP_CALL( SCIPgetLPColsData(scip, &cols, &ncols) );
+
+   if( SCIPgetNLPRows(scip) == 0 || ncols == 0 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( fapMatrixCreate(scip, &matrix) );
+
+   if( matrix.nintcols == 0 )
+   {
+      fapMatrixFree(scip, &matrix);
+      return SCIP_OKAY;
+   }
+
+   *result = SCIP_DIDNOTFIND;
+
+   matrix.nattempts = heurdata->nattempts;
+   SCIP_CALL( SCIPallocBufferArray(scip, &matrix.attempts, matrix.nattempts) );
+
+   /* each attempt has its own random number generator, such that the result does not depend on the scheduling */
+   for( a = 0; a < matrix.nattempts; ++a )
+   {
+      SCIP_CALL( SCIPcreateRandom(scip, &matrix.attempts[a].randnumgen,
+            (unsigned int)(DEFAULT_RANDSEED + a + SCIPheurGetNCalls(heur)), TRUE) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &matrix.attempts[a].solvals, ncols) );
+      matrix.attempts[a].status = FAP_FAILED;
+   }
+
+   nthreads = MIN(SCIPgetNParallelJobThreads(scip), matrix.nattempts);
+   SCIP_CALL( SCIPallocBufferArray(scip, &jobargs, nthreads) );
+   for( a = 0; a < nthreads; ++a )
+      jobargs[a] = (void*)&matrix;
+
+   SCIP_CALL( SCIPtpiInitLock(&matrix.lock) );
+
+   SCIP_CALL( SCIPexecParallelJobs(scip, nthreads, fapExecJob, jobargs, nthreads) );
+
+   SCIPtpiDestroyLock(&matrix.lock);
+
+   /* try the complete attempts in their order and remember the best attempt that fixed all integer columns */
+   bestintegral = -1;
+   for( a = 0; a < matrix.nattempts; ++a )
+   {
+      FAPATTEMPT* attempt = &matrix.attempts[a];
+
+      SCIPdebugMsg(scip, "attempt %d: status %d, objective of integer columns %g\n", a, attempt->status,
+         attempt->intobj);
+
+      if( attempt->status == FAP_COMPLETE )
+      {
+         SCIP_SOL* sol;
+         SCIP_Bool stored;
+
+         SCIP_CALL( SCIPcreateSol(scip, &sol, heur) );
+
+         for( c = 0; c < ncols; ++c )
+         {
+            SCIP_CALL( SCIPsetSolVal(scip, sol, SCIPcolGetVar(cols[c]), attempt->solvals[c]) );
+         }
+
+         SCIP_CALL( SCIPtrySolFree(scip, &sol, FALSE, FALSE, TRUE, TRUE, TRUE, &stored) );
+
+         if( stored )
+            *result = SCIP_FOUNDSOL;
+      }
+      else if( attempt->status == FAP_INTEGRAL
+         && (bestintegral == -1 || attempt->intobj < matrix.attempts[bestintegral].intobj) )
+         bestintegral = a;
+   }
+
+   if( heurdata->completelp && bestintegral >= 0 && !SCIPinProbing(scip) )
+   {
+      SCIP_Bool stored;
+
+      SCIP_CALL( completeAttemptByLP(scip, heur, &matrix, &matrix.attempts[bestintegral], &stored) );
+
+      if( stored )
+         *result = SCIP_FOUNDSOL;
+   }
+
+   SCIPfreeBufferArray(scip, &jobargs);
+
+   for( a = matrix.nattempts - 1; a >= 0; --a )
+   {
+      SCIPfreeBufferArray(scip, &matrix.attempts[a].solvals);
+      SCIPfreeRandom(scip, &matrix.attempts[a].randnumgen);
+   }
+   SCIPfreeBufferArray(scip, &matrix.attempts);
+
+   fapMatrixFree(scip, &matrix);
+
+   return SCIP_OKAY;
+}
+
+
+/*
+ * primal heuristic specific interface methods
+ */
+
+/** creates the fixandpropagate heuristic and includes it in SCIP */
+SCIP_RETCODE SCIPincludeHeurFixandpropagate(
+   SCIP*                 scip                /**< SCIP data structure */
+   )
+{
+   SCIP_HEURDATA* heurdata;
+   SCIP_HEUR* heur;
+
+   /* create fixandpropagate primal heuristic data */
+   SCIP_CALL( SCIPallocBlockMemory(scip, &heurdata) );
+
+   /* include primal heuristic */
+   SCIP_CALL( SCIPincludeHeurBasic(scip, &heur,
+         HEUR_NAME, HEUR_DESC, HEUR_DISPCHAR, HEUR_PRIORITY, HEUR_FREQ, HEUR_FREQOFS,
+         HEUR_MAXDEPTH, HEUR_TIMING, HEUR_USESSUBSCIP, heurExecFixandpropagate, heurdata) );
+
+   assert(heur != NULL);
+
+   /* set non-NULL pointers to callback methods */
+   SCIP_CALL( SCIPsetHeurCopy(scip, heur, heurCopyFixandpropagate) );
+   SCIP_CALL( SCIPsetHeurFree(scip, heur, heurFreeFixandpropagate) );
+
+   /* add fixandpropagate primal heuristic parameters */
+   SCIP_CALL( SCIPaddIntParam(scip, "heuristics/" HEUR_NAME "/nattempts",
+         "number of fix-and-propagate attempts, which are executed in parallel if possible",
+         &heurdata->nattempts, FALSE, DEFAULT_NATTEMPTS, 1, INT_MAX, NULL, NULL) );
+   SCIP_CALL( SCIPaddBoolParam(scip, "heuristics/" HEUR_NAME "/completelp",
+         "should the continuous columns of the best attempt that fixes all integer columns be completed by an LP?",
+         &heurdata->completelp, TRUE, DEFAULT_COMPLETELP, NULL, NULL) );
+
+   return SCIP_OKAY;
+}
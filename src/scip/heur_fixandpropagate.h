@@ -0,0 +1,69 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   heur_fixandpropagate.h
+ * @ingroup PRIMALHEURISTICS
+ * @brief  fix-and-propagate heuristic that runs many attempts in parallel on a sparse copy of the LP rows
+ *
+ * The heuristic copies the rows of the LP into a compressed sparse row and column representation together with the
+ * minimal and maximal activities of the rows. Each attempt fixes the integer columns one after the other in its own
+ * order to one of their bounds and propagates the rows by activity-based bound tightening, which updates the
+ * activities incrementally. If a fixing turns out to be infeasible, it is undone and the other bound is tried; if this
+ * is infeasible, too, the attempt aborts. The first attempt fixes the columns in the order of decreasing number of
+ * locks, the others in a random order; the attempts alternate between rounding in the direction of fewer locks, in the
+ * direction of the objective, and randomly.
+ *
+ * The attempts only work on thread-local copies of the bounds and activities, so they are executed as parallel jobs if
+ * SCIP was compiled with a parallel task processing interface. Attempts that fix all columns are tried as solutions in
+ * the order of the attempts, and the continuous columns of the best attempt that fixes all integer columns are
+ * completed by solving an LP.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#ifndef __SCIP_HEUR_FIXANDPROPAGATE_H__
+#define __SCIP_HEUR_FIXANDPROPAGATE_H__
+
+#include "scip/def.h"
+#include "scip/type_retcode.h"
+#include "scip/type_scip.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** creates the fixandpropagate heuristic and includes it in SCIP
+ *
+ *  @ingroup PrimalHeuristicIncludes
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPincludeHeurFixandpropagate(
+   SCIP*                 scip                /**< SCIP data structure */
+   );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -41,6 +41,8 @@
 #include "scip/pub_misc_sort.h"
 #include "scip/pub_nlp.h"
 #include "scip/pub_var.h"
+#include "scip/scip_concurrent.h"
+#include "scip/scip_copy.h"
 #include "scip/scip_general.h"
 #include "scip/scip_heur.h"
 #include "scip/scip_mem.h"
@@ -52,7 +54,11 @@
 #include "scip/scip_prob.h"
 #include "scip/scip_randnumgen.h"
 #include "scip/scip_sol.h"
+#include "scip/scip_solve.h"
+#include "scip/scip_solvingstats.h"
 #include "scip/scip_timing.h"
+#include "scip/scip_var.h"
+#include "tpi/tpi.h"
 #include <string.h>
 
 
@@ -76,6 +82,7 @@
 #define DEFAULT_GRADLIMIT     5e+6           /**< default limit for gradient computations for all improvePoint() calls */
 #define DEFAULT_MAXNCLUSTER   3              /**< default maximum number of considered clusters per heuristic call */
 #define DEFAULT_ONLYNLPS      TRUE           /**< should the heuristic run only on continuous problems? */
+#define DEFAULT_PARALLEL      FALSE          /**< should the sub-NLPs of the clusters be solved in parallel? */
 
 #define MINFEAS               -1e+4          /**< minimum feasibility for a point; used for filtering and improving
                                               *   feasibility */
@@ -104,8 +111,33 @@ struct SCIP_HeurData
    SCIP_Real             gradlimit;          /**< limit for gradient computations for all improvePoint() calls (0 for no limit) */
    int                   maxncluster;        /**< maximum number of considered clusters per heuristic call */
    SCIP_Bool             onlynlps;           /**< should the heuristic run only on continuous problems? */
+   SCIP_Bool             parallel;           /**< should the sub-NLPs of the clusters be solved in parallel? */
 };
 
+/** data shared by the parallel sub-NLP solves */
+typedef struct
+{
+   SCIP_LOCK*            lock;               /**< lock protecting the best objective value */
+   SCIP_Real             bestobj;            /**< best objective value of the main SCIP and of all sub-NLP solutions, in the
+                                              *   original space of the sub-SCIPs */
+} NLPSHARED;
+
+/** data of a parallel sub-NLP solve; the sub-SCIP is used exclusively by the job */
+typedef struct
+{
+   NLPSHARED*            shared;             /**< data shared by all jobs */
+   SCIP*                 subscip;            /**< independent copy of the problem for the cluster */
+   SCIP_VAR**            subvars;            /**< sub-SCIP variable of each problem variable, or NULL */
+   SCIP_Real*            startvals;          /**< start point for the original sub-SCIP variables */
+   SCIP_Real*            solvals;            /**< NLP solution values of the original sub-SCIP variables */
+   SCIP_Real             opttol;             /**< optimality tolerance for the NLP solve */
+   SCIP_Real             feastol;            /**< feasibility tolerance for the NLP solve */
+   SCIP_Real             solobj;             /**< objective value of the NLP solution */
+   int                   iterlimit;          /**< iteration limit for the NLP solve */
+   SCIP_Bool             foundsol;           /**< did the job find a solution that improved the shared bound? */
+   SCIP_RETCODE          retcode;            /**< return code of the job */
+} NLPJOB;
+
 
 /*
  * Local methods
@@ -641,21 +673,19 @@ SCIP_RETCODE clusterPointsGreedy(
    return SCIP_OKAY;
 }
 
-/** calls the sub-NLP heuristic for a given cluster */
+/** computes the rounded average of the points of a cluster, which is used as reference point for the sub-NLP */
 static
-SCIP_RETCODE solveNLP(
+SCIP_RETCODE computeRefpoint(
    SCIP*                 scip,               /**< SCIP data structure */
    SCIP_HEUR*            heur,               /**< multi-start heuristic */
-   SCIP_HEUR*            nlpheur,            /**< pointer to NLP local search heuristics */
    SCIP_SOL**            points,             /**< array containing improved points */
    int                   npoints,            /**< total number of points */
-   SCIP_Bool*            success             /**< pointer to store if we could find a solution */
+   SCIP_SOL**            refpoint            /**< pointer to store the created reference point */
    )
 {
    SCIP_VAR** vars;
-   SCIP_SOL* refpoint;
-   SCIP_RESULT nlpresult;
    SCIP_Real val;
+   SCIP_Bool success;
    int nbinvars;
    int nintvars;
    int nvars;
@@ -663,11 +693,11 @@ SCIP_RETCODE solveNLP(
 
    assert(points != NULL);
    assert(npoints > 0);
+   assert(refpoint != NULL);
 
    SCIP_CALL( SCIPgetVarsData(scip, &vars, &nvars, &nbinvars, &nintvars, NULL, NULL) );
-   *success = FALSE;
 
-   SCIP_CALL( SCIPcreateSol(scip, &refpoint, heur) );
+   SCIP_CALL( SCIPcreateSol(scip, refpoint, heur) );
 
    /* compute reference point */
    for( i = 0; i < nvars; ++i )
@@ -682,19 +712,19 @@ SCIP_RETCODE solveNLP(
          val += SCIPgetSolVal(scip, points[p], vars[i]);
       }
 
-      SCIP_CALL( SCIPsetSolVal(scip, refpoint, vars[i], val / npoints) );
+      SCIP_CALL( SCIPsetSolVal(scip, *refpoint, vars[i], val / npoints) );
    }
 
    /* round point for sub-NLP heuristic */
-   SCIP_CALL( SCIProundSol(scip, refpoint, success) );
-   SCIPdebugMsg(scip, "rounding of refpoint successfully? %u\n", *success);
+   SCIP_CALL( SCIProundSol(scip, *refpoint, &success) );
+   SCIPdebugMsg(scip, "rounding of refpoint successfully? %u\n", success);
 
    /* round variables manually if the locks did not allow us to round them */
-   if( !(*success) )
+   if( !success )
    {
       for( i = 0; i < nbinvars + nintvars; ++i )
       {
-         val = SCIPgetSolVal(scip, refpoint, vars[i]);
+         val = SCIPgetSolVal(scip, *refpoint, vars[i]);
 
          if( !SCIPisFeasIntegral(scip, val) )
          {
@@ -707,11 +737,35 @@ SCIP_RETCODE solveNLP(
             val = MAX(val, SCIPvarGetLbLocal(vars[i])); /*lint !e666*/
             assert(SCIPisFeasIntegral(scip, val));
 
-            SCIP_CALL( SCIPsetSolVal(scip, refpoint, vars[i], val) );
+            SCIP_CALL( SCIPsetSolVal(scip, *refpoint, vars[i], val) );
          }
       }
    }
 
+   return SCIP_OKAY;
+}
+
+/** calls the sub-NLP heuristic for a given cluster */
+static
+SCIP_RETCODE solveNLP(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_HEUR*            heur,               /**< multi-start heuristic */
+   SCIP_HEUR*            nlpheur,            /**< pointer to NLP local search heuristics */
+   SCIP_SOL**            points,             /**< array containing improved points */
+   int                   npoints,            /**< total number of points */
+   SCIP_Bool*            success             /**< pointer to store if we could find a solution */
+   )
+{
+   SCIP_SOL* refpoint;
+   SCIP_RESULT nlpresult;
+
+   assert(points != NULL);
+   assert(npoints > 0);
+
+   *success = FALSE;
+
+   SCIP_CALL( computeRefpoint(scip, heur, points, npoints, &refpoint) );
+
    /* call sub-NLP heuristic */
    SCIP_CALL( SCIPapplyHeurSubNlp(scip, nlpheur, &nlpresult, refpoint, NULL) );
    SCIP_CALL( SCIPfreeSol(scip, &refpoint) );
@@ -722,6 +776,405 @@ SCIP_RETCODE solveNLP(
    return SCIP_OKAY;
 }
 
+/** solves the NLP of a sub-SCIP that has been set up by createNLPJob(); runs in its own thread and therefore only
+ *  touches the sub-SCIP of the job and, under the lock, the shared bound
+ *
+ *  The NLP is solved in any case, since the node limit of zero stops the sub-SCIP before its root node is processed,
+ *  such that its dual bound is not available to skip the NLP.
+ */
+static
+SCIP_RETCODE runNLPJob(
+   NLPJOB*               job                 /**< sub-NLP job */
+   )
+{
+   NLPSHARED* shared = job->shared;
+   SCIP* subscip = job->subscip;
+   SCIP_VAR** subvars;
+   SCIP_VAR** nlpvars;
+   SCIP_Real* startpoint;
+   SCIP_SOL* sol;
+   int nnlpvars;
+   int i;
+
+   /* presolve and build the NLP; the node limit of zero stops the solve right after the initialization */
+   SCIP_CALL( SCIPsolve(subscip) );
+
+   if( SCIPgetStage(subscip) != SCIP_STAGE_SOLVING || !SCIPisNLPConstructed(subscip) )
+      return SCIP_OKAY;
+
+   /* translate the start point of the original sub-SCIP variables to the variables of the NLP */
+   nlpvars = SCIPgetNLPVars(subscip);
+   nnlpvars = SCIPgetNNLPVars(subscip);
+   SCIP_ALLOC( BMSallocMemoryArray(&startpoint, nnlpvars) );
+
+   for( i = 0; i < nnlpvars; ++i )
+   {
+      SCIP_VAR* subvar;
+      SCIP_Real scalar;
+      SCIP_Real constant;
+
+      subvar = nlpvars[i];
+      scalar = 1.0;
+      constant = 0.0;
+      SCIP_CALL( SCIPvarGetOrigvarSum(&subvar, &scalar, &constant) );
+
+      if( subvar == NULL )
+         startpoint[i] = constant;
+      else if( REALABS(job->startvals[SCIPvarGetProbindex(subvar)]) > 1.0e+12 )
+         startpoint[i] = MIN(MAX(0.0, SCIPvarGetLbGlobal(nlpvars[i])), SCIPvarGetUbGlobal(nlpvars[i]));  /*lint !e666*/
+      else
+         startpoint[i] = scalar * job->startvals[SCIPvarGetProbindex(subvar)] + constant;
+   }
+
+   SCIP_CALL( SCIPsetNLPInitialGuess(subscip, startpoint) );
+   BMSfreeMemoryArray(&startpoint);
+
+   SCIP_CALL( SCIPsolveNLP(subscip,
+      .iterlimit = job->iterlimit,
+      .opttol = job->opttol,
+      .feastol = job->feastol
+   ) );  /*lint !e666*/
+
+   if( SCIPgetNLPSolstat(subscip) > SCIP_NLPSOLSTAT_FEASIBLE )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPcreateNLPSol(subscip, &sol, NULL) );
+   job->solobj = SCIPgetSolOrigObj(subscip, sol);
+
+   /* keep the solution only if it improves on all solutions known so far */
+   SCIP_CALL( SCIPtpiAcquireLock(shared->lock) );
+   if( SCIPisLT(subscip, job->solobj, shared->bestobj) )
+   {
+      shared->bestobj = job->solobj;
+      job->foundsol = TRUE;
+   }
+   SCIP_CALL( SCIPtpiReleaseLock(shared->lock) );
+
+   if( job->foundsol )
+   {
+      subvars = SCIPgetOrigVars(subscip);
+
+      for( i = 0; i < SCIPgetNOrigVars(subscip); ++i )
+         job->solvals[i] = SCIPgetSolVal(subscip, sol, SCIPvarGetTransVar(subvars[i]));
+   }
+
+   SCIP_CALL( SCIPfreeSol(subscip, &sol) );
+
+   return SCIP_OKAY;
+}
+
+/** executes a sub-NLP job; errors are stored in the job and reported by the main thread */
+static
+SCIP_DECL_PARALLELJOB(execNLPJob)
+{
+   NLPJOB* job = (NLPJOB*)jobarg;
+
+   job->retcode = runNLPJob(job);
+
+   return SCIP_OKAY;
+}
+
+/** creates a sub-SCIP for a cluster that can be solved in a separate thread
+ *
+ *  The sub-SCIP is a thread-safe copy of the global problem, where the discrete variables are fixed to the values of
+ *  the reference point of the cluster. It does not share any data with the main SCIP, such that its NLP, NLPI problem
+ *  and expression evaluation are thread-local.
+ */
+static
+SCIP_RETCODE createNLPJob(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_HEUR*            heur,               /**< multi-start heuristic */
+   NLPSHARED*            shared,             /**< data shared by all jobs */
+   NLPJOB*               job,                /**< job to initialize */
+   SCIP_SOL**            points,             /**< array containing the improved points of the cluster */
+   int                   npoints,            /**< number of points in the cluster */
+   SCIP_Bool*            success             /**< pointer to store whether the sub-SCIP could be created */
+   )
+{
+   SCIP_HASHMAP* varmap;
+   SCIP_SOL* refpoint;
+   SCIP_VAR** vars;
+   SCIP_Bool valid;
+   SCIP_Bool continuous;
+   int nbinvars;
+   int nintvars;
+   int nvars;
+   int i;
+
+   *success = FALSE;
+
+   SCIP_CALL( SCIPgetVarsData(scip, &vars, &nvars, &nbinvars, &nintvars, NULL, NULL) );
+   continuous = nbinvars == 0 && nintvars == 0;
+
+   BMSclearMemory(job);
+   job->shared = shared;
+   job->retcode = SCIP_OKAY;
+
+   SCIP_CALL( SCIPcreate(&job->subscip) );
+   SCIP_CALL( SCIPhashmapCreate(&varmap, SCIPblkmem(scip), nvars) );
+
+   valid = FALSE;
+   SCIP_CALL( SCIPcopy(scip, job->subscip, varmap, NULL, "multistart", TRUE, FALSE, TRUE, FALSE, &valid) );
+
+   if( SCIPgetNNlpis(job->subscip) <= 0 )
+   {
+      SCIPhashmapFree(&varmap);
+      return SCIP_OKAY;
+   }
+
+   /* use the same NLP solver settings as the sub-NLP heuristic */
+   SCIP_CALL( SCIPgetRealParam(scip, "heuristics/subnlp/opttol", &job->opttol) );
+   SCIP_CALL( SCIPgetIntParam(scip, "heuristics/subnlp/iterinit", &job->iterlimit) );
+   job->feastol = SCIPfeastol(scip);
+
+   SCIP_CALL( SCIPcopyLimits(scip, job->subscip) );
+   SCIP_CALL( SCIPsetLongintParam(job->subscip, "limits/nodes", 0LL) );
+   SCIP_CALL( SCIPsetIntParam(job->subscip, "limits/maxorigsol", 0) );
+   SCIP_CALL( SCIPsetBoolParam(job->subscip, "misc/catchctrlc", FALSE) );
+#ifdef SCIP_DEBUG
+   SCIP_CALL( SCIPsetIntParam(job->subscip, "display/verblevel", 5) );
+#else
+   SCIP_CALL( SCIPsetIntParam(job->subscip, "display/verblevel", 0) );
+#endif
+   SCIP_CALL( SCIPsetHeuristics(job->subscip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetSubscipsOff(job->subscip, TRUE) );
+   SCIP_CALL( SCIPsetPresolving(job->subscip, continuous ? SCIP_PARAMSETTING_OFF : SCIP_PARAMSETTING_FAST, TRUE) );
+
+   SCIP_ALLOC( BMSallocClearMemoryArray(&job->startvals, SCIPgetNOrigVars(job->subscip)) );
+   SCIP_ALLOC( BMSallocMemoryArray(&job->solvals, SCIPgetNOrigVars(job->subscip)) );
+   SCIP_ALLOC( BMSallocMemoryArray(&job->subvars, nvars) );
+
+   /* transfer the reference point to the sub-SCIP and fix the discrete variables */
+   SCIP_CALL( computeRefpoint(scip, heur, points, npoints, &refpoint) );
+
+   for( i = 0; i < nvars; ++i )
+   {
+      SCIP_VAR* subvar;
+      SCIP_Real val;
+
+      subvar = (SCIP_VAR*)SCIPhashmapGetImage(varmap, (void*)vars[i]);
+      job->subvars[i] = subvar;
+
+      if( subvar == NULL )
+         continue;
+
+      val = SCIPgetSolVal(scip, refpoint, vars[i]);
+      job->startvals[SCIPvarGetProbindex(subvar)] = val;
+
+      if( i < nbinvars + nintvars )
+      {
+         SCIP_CALL( SCIPchgVarLb(job->subscip, subvar, val) );
+         SCIP_CALL( SCIPchgVarUb(job->subscip, subvar, val) );
+      }
+   }
+
+   SCIP_CALL( SCIPfreeSol(scip, &refpoint) );
+   SCIPhashmapFree(&varmap);
+
+   *success = TRUE;
+
+   return SCIP_OKAY;
+}
+
+/** frees the sub-SCIP and the arrays of a sub-NLP job */
+static
+SCIP_RETCODE freeNLPJob(
+   NLPJOB*               job                 /**< sub-NLP job */
+   )
+{
+   BMSfreeMemoryArrayNull(&job->subvars);
+   BMSfreeMemoryArrayNull(&job->solvals);
+   BMSfreeMemoryArrayNull(&job->startvals);
+
+   if( job->subscip != NULL )
+   {
+      SCIP_CALL( SCIPfree(&job->subscip) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** returns whether the NLP solver used by the sub-NLP heuristic can be called concurrently from several threads
+ *
+ *  Ipopt itself is reentrant, but its default linear solver MUMPS keeps global state and must not be used from
+ *  several threads at the same time. We therefore only consider Ipopt to be thread-safe if one of the linear solvers
+ *  of HSL, Pardiso, or SPRAL is explicitly selected via the parameter nlpi/ipopt/linear_solver. All other NLP solvers
+ *  are treated as not thread-safe.
+ */
+static
+SCIP_Bool isNLPSolverThreadsafe(
+   SCIP*                 scip                /**< SCIP data structure */
+   )
+{
+   static const char* threadsafesolvers[] = { "ma27", "ma57", "ma77", "ma86", "ma97", "pardiso", "pardisomkl", "spral" };
+   SCIP_NLPI* nlpi;
+   char* nlpsolver;
+   char* linsolver;
+   int i;
+
+   if( SCIPgetNNlpis(scip) == 0 )
+      return FALSE;
+
+   /* determine the NLP solver in the same way as the NLP does */
+   if( SCIPgetStringParam(scip, "nlp/solver", &nlpsolver) != SCIP_OKAY )
+      return FALSE;
+
+   if( nlpsolver[0] == '\0' )
+      nlpi = SCIPgetNlpis(scip)[0];
+   else
+      nlpi = SCIPfindNlpi(scip, nlpsolver);
+
+   if( nlpi == NULL || strcmp(SCIPnlpiGetName(nlpi), "ipopt") != 0 )
+      return FALSE;
+
+   /* the parameter only exists if Ipopt was built with a choice of linear solvers */
+   if( SCIPgetParam(scip, "nlpi/ipopt/linear_solver") == NULL
+      || SCIPgetStringParam(scip, "nlpi/ipopt/linear_solver", &linsolver) != SCIP_OKAY )
+      return FALSE;
+
+   for( i = 0; i < (int)(sizeof(threadsafesolvers) / sizeof(threadsafesolvers[0])); ++i )
+   {
+      if( strcmp(linsolver, threadsafesolvers[i]) == 0 )
+         return TRUE;
+   }
+
+   return FALSE;
+}
+
+/** solves the sub-NLPs of all clusters in parallel
+ *
+ *  The NLPI problems of the main SCIP and of the sub-NLP heuristic use the memory, clocks, and expression handlers of
+ *  their SCIP instance and thus cannot be solved concurrently. Instead, every cluster gets an independent copy of the
+ *  problem, which is solved by one job of the thread pool. The jobs share the best objective value found so far and
+ *  only keep NLP solutions that improve on it. The solutions are passed to the main SCIP in the order of the clusters.
+ */
+static
+SCIP_RETCODE solveNLPsParallel(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_HEUR*            heur,               /**< multi-start heuristic */
+   SCIP_SOL**            points,             /**< array containing improved points, sorted by cluster index */
+   int*                  clusteridx,         /**< cluster index of each point (INT_MAX for points in no cluster) */
+   int                   npoints,            /**< total number of points */
+   int                   ncluster,           /**< number of clusters */
+   int                   nthreads,           /**< number of threads to use */
+   SCIP_RESULT*          result              /**< pointer to store the result */
+   )
+{
+   NLPSHARED shared;
+   NLPJOB* jobs;
+   void** jobargs;
+   SCIP_VAR** vars;
+   SCIP_SOL* bestsol;
+   int njobs;
+   int nvars;
+   int start;
+   int i;
+
+   SCIP_CALL( SCIPgetVarsData(scip, &vars, &nvars, NULL, NULL, NULL, NULL) );
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &jobs, ncluster) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &jobargs, ncluster) );
+
+   shared.bestobj = SCIPinfinity(scip);
+   shared.lock = NULL;
+
+   /* set up one sub-SCIP per cluster */
+   njobs = 0;
+   start = 0;
+   while( start < npoints && clusteridx[start] != INT_MAX && njobs < ncluster && !SCIPisStopped(scip) )
+   {
+      SCIP_Bool success;
+      int end;
+
+      end = start;
+      while( end < npoints && clusteridx[start] == clusteridx[end] )
+         ++end;
+
+      SCIP_CALL( createNLPJob(scip, heur, &shared, &jobs[njobs], &points[start], end - start, &success) );
+
+      if( success )
+      {
+         jobargs[njobs] = (void*)&jobs[njobs];
+         ++njobs;
+      }
+      else
+      {
+         SCIP_CALL( freeNLPJob(&jobs[njobs]) );
+      }
+
+      start = end;
+   }
+
+   /* the sub-SCIPs are copies of the transformed problem without its objective offset, so the NLP solutions are compared
+    * to the objective value of the incumbent in the original space of the sub-SCIPs, which is the same for all jobs
+    */
+   bestsol = SCIPgetBestSol(scip);
+   if( njobs > 0 && bestsol != NULL )
+   {
+      shared.bestobj = SCIPgetOrigObjoffset(jobs[0].subscip);
+      for( i = 0; i < nvars; ++i )
+      {
+         if( jobs[0].subvars[i] != NULL )
+            shared.bestobj += SCIPvarGetObj(jobs[0].subvars[i]) * SCIPgetSolVal(scip, bestsol, vars[i]);
+      }
+   }
+
+   if( njobs > 0 )
+   {
+      SCIP_CALL( SCIPtpiInitLock(&shared.lock) );
+      SCIP_CALL( SCIPexecParallelJobs(scip, MIN(nthreads, njobs), execNLPJob, jobargs, njobs) );
+      SCIPtpiDestroyLock(&shared.lock);
+   }
+
+   /* try the solutions in the order of the clusters, such that the result does not depend on the scheduling */
+   for( i = 0; i < njobs; ++i )
+   {
+      if( jobs[i].retcode != SCIP_OKAY )
+      {
+         SCIPwarningMessage(scip, "Error while solving subproblem in multistart heuristic; sub-SCIP terminated with code <%d>\n",
+            jobs[i].retcode);
+      }
+      else if( SCIPgetStage(jobs[i].subscip) == SCIP_STAGE_SOLVING )
+      {
+         SCIPmergeNLPIStatistics(jobs[i].subscip, scip, FALSE);
+      }
+
+      if( jobs[i].foundsol )
+      {
+         SCIP_SOL* sol;
+         SCIP_Bool stored;
+         int v;
+
+         SCIP_CALL( SCIPcreateSol(scip, &sol, heur) );
+
+         for( v = 0; v < nvars; ++v )
+         {
+            if( jobs[i].subvars[v] != NULL )
+            {
+               SCIP_CALL( SCIPsetSolVal(scip, sol, vars[v], jobs[i].solvals[SCIPvarGetProbindex(jobs[i].subvars[v])]) );
+            }
+         }
+
+         SCIP_CALL( SCIPtrySolFree(scip, &sol, FALSE, FALSE, TRUE, TRUE, TRUE, &stored) );
+         SCIPdebugMsg(scip, "sub-NLP of cluster %d has objective value %g, solution %s\n", i, jobs[i].solobj,
+            stored ? "stored" : "rejected");
+
+         if( stored )
+            *result = SCIP_FOUNDSOL;
+      }
+   }
+
+   for( i = njobs - 1; i >= 0; --i )
+   {
+      SCIP_CALL( freeNLPJob(&jobs[i]) );
+   }
+
+   SCIPfreeBufferArray(scip, &jobargs);
+   SCIPfreeBufferArray(scip, &jobs);
+
+   return SCIP_OKAY;
+}
+
 /** recursive helper function to count the number of nodes in a sub-expr */
 static
 int getExprSize(
@@ -858,6 +1311,14 @@ SCIP_RETCODE applyHeur(
    /*
     * 4. compute start point for each cluster and use it in the sub-NLP heuristic (@ref heur_subnlp.h)
     */
+   /* the sub-NLPs are only solved concurrently if the NLP solver is thread-safe, otherwise sequentially */
+   if( heurdata->parallel && ncluster > 1 && SCIPgetNParallelJobThreads(scip) > 1 && isNLPSolverThreadsafe(scip) )
+   {
+      SCIP_CALL( solveNLPsParallel(scip, heur, points, clusteridx, nusefulpoints, ncluster,
+            SCIPgetNParallelJobThreads(scip), result) );
+      goto TERMINATE;
+   }
+
    start = 0;
    while( start < nusefulpoints && clusteridx[start] != INT_MAX && !SCIPisStopped(scip) )
    {
@@ -1060,5 +1521,9 @@ SCIP_RETCODE SCIPincludeHeurMultistart(
          "should the heuristic run only on continuous problems?",
          &heurdata->onlynlps, FALSE, DEFAULT_ONLYNLPS, NULL, NULL) );
 
+   SCIP_CALL( SCIPaddBoolParam(scip, "heuristics/" HEUR_NAME "/parallel",
+         "should the sub-NLPs of the clusters be solved in parallel on independent problem copies (only if Ipopt uses a thread-safe linear solver, see nlpi/ipopt/linear_solver)?",
+         &heurdata->parallel, FALSE, DEFAULT_PARALLEL, NULL, NULL) );
+
    return SCIP_OKAY;
 }
@@ -74,6 +74,10 @@
  *
  *    Since the sub-NLP heuristic requires a starting point which is integer feasible we round each fractional
  *    value \f$ s_i \f$ to its closest integer.
+ *
+ *    If heuristics/multistart/parallel is set and a thread pool is available, the sub-problems of the clusters are
+ *    solved in parallel, each on an independent copy of the problem. A solution found by one of them is used as bound
+ *    by the others to skip sub-problems that cannot improve on it.
  */
 
 
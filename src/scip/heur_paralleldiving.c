@@ -0,0 +1,700 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   heur_paralleldiving.c
+ * @ingroup DEFPLUGINS_HEUR
+ * @brief  LP diving heuristic that executes a portfolio of dives in parallel on copies of the LP relaxation
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "blockmemshell/memory.h"
+#include "lpi/lpi.h"
+#include "scip/heur_paralleldiving.h"
+#include "scip/pub_heur.h"
+#include "scip/pub_lp.h"
+#include "scip/pub_message.h"
+#include "scip/pub_var.h"
+#include "scip/scip_branch.h"
+#include "scip/scip_concurrent.h"
+#include "scip/scip_general.h"
+#include "scip/scip_heur.h"
+#include "scip/scip_lp.h"
+#include "scip/scip_mem.h"
+#include "scip/scip_message.h"
+#include "scip/scip_numerics.h"
+#include "scip/scip_param.h"
+#include "scip/scip_prob.h"
+#include "scip/scip_sol.h"
+#include "scip/scip_solvingstats.h"
+#include "scip/scip_var.h"
+#include <string.h>
+
+#define HEUR_NAME             "paralleldiving"
+#define HEUR_DESC             "LP diving heuristic that executes a portfolio of dives in parallel on copies of the LP"
+#define HEUR_DISPCHAR         SCIP_HEURDISPCHAR_DIVING
+#define HEUR_PRIORITY         -1003100
+#define HEUR_FREQ             -1
+#define HEUR_FREQOFS          0
+#define HEUR_MAXDEPTH         -1
+#define HEUR_TIMING           SCIP_HEURTIMING_AFTERLPPLUNGE
+#define HEUR_USESSUBSCIP      FALSE  /**< does the heuristic use a secondary SCIP instance? */
+
+
+/*
+ * Default parameter settings
+ */
+
+#define DEFAULT_MAXLPITERQUOT      0.05 /**< maximal fraction of diving LP iterations compared to node LP iterations */
+#define DEFAULT_MAXLPITEROFS       1000 /**< additional number of allowed LP iterations */
+#define DEFAULT_MAXNDIVES             4 /**< maximal number of dives that are executed in parallel */
+
+/** variable selection rules of the dives of the portfolio */
+enum DiveRule
+{
+   DIVERULE_FRACTIONAL  = 0,                 /**< rule of the fractional diving heuristic */
+   DIVERULE_COEFFICIENT = 1,                 /**< rule of the coefficient diving heuristic */
+   DIVERULE_PSEUDOCOST  = 2,                 /**< rule of the pseudo cost diving heuristic */
+   DIVERULE_VECLEN      = 3                  /**< rule of the vector length diving heuristic */
+};
+typedef enum DiveRule DIVERULE;
+
+#define NDIVERULES 4
+
+/** primal heuristic data */
+struct SCIP_HeurData
+{
+   SCIP_Longint          nlpiterations;      /**< LP iterations used in this heuristic */
+   SCIP_Real             maxlpiterquot;      /**< maximal fraction of diving LP iterations compared to node LP iterations */
+   int                   maxlpiterofs;       /**< additional number of allowed LP iterations */
+   int                   maxndives;          /**< maximal number of dives that are executed in parallel */
+};
+
+/** column data that is shared by all dives; it is collected by the main thread, since the dives may not call SCIP */
+typedef struct
+{
+   SCIP_Real*            obj;                /**< objective coefficients of the LP columns */
+   SCIP_Real*            lbs;                /**< lower bounds of the LP columns in the representation of the LP solver */
+   SCIP_Real*            ubs;                /**< upper bounds of the LP columns in the representation of the LP solver */
+   SCIP_Real*            pscostdown;         /**< pseudo costs of the LP columns for a change of -1 */
+   SCIP_Real*            pscostup;           /**< pseudo costs of the LP columns for a change of +1 */
+   SCIP_Real*            rootsol;            /**< root LP solution values of the LP columns */
+   int*                  nlocksdown;         /**< number of model down-locks of the variables of the LP columns */
+   int*                  nlocksup;           /**< number of model up-locks of the variables of the LP columns */
+   int*                  colveclen;          /**< number of nonzeros of the LP columns */
+   SCIP_Bool*            integral;           /**< is the variable of the LP column of integral type? */
+   SCIP_Bool*            binary;             /**< is the variable of the LP column binary? */
+   SCIP_Real             objnorm;            /**< Euclidean norm of the objective function */
+   SCIP_Real             objoffset;          /**< objective offset of the copies of the LP */
+   SCIP_Real             cutoffbound;        /**< cutoff bound; dives stop if the LP value reaches it */
+   SCIP_Real             feastol;            /**< feasibility tolerance for the integrality of LP values */
+   SCIP_Real             epsilon;            /**< tolerance for the comparison of fractionalities */
+   SCIP_Real             sumepsilon;         /**< summation tolerance */
+   int                   ncols;              /**< number of LP columns */
+   int                   nrows;              /**< number of LP rows */
+} DIVESHARED;
+
+/** a dive of the portfolio */
+typedef struct
+{
+   DIVESHARED*           shared;             /**< shared data */
+   SCIP_LPI*             lpi;                /**< copy of the LP that the dive works on */
+   SCIP_Real*            lbs;                /**< current lower bounds of the columns of the dive */
+   SCIP_Real*            ubs;                /**< current upper bounds of the columns of the dive */
+   SCIP_Real*            primsol;            /**< buffer for the LP solution */
+   SCIP_Real*            solvals;            /**< values of the LP columns in the solution found by the dive */
+   SCIP_Real             solobj;             /**< LP objective value of the solution found by the dive */
+   SCIP_Longint          niterations;        /**< number of LP iterations of the dive */
+   SCIP_Longint          maxniterations;     /**< maximal number of LP iterations of the dive */
+   DIVERULE              rule;               /**< variable selection rule of the dive */
+   int                   ndivelps;           /**< number of LPs solved by the dive */
+   SCIP_Bool             foundsol;           /**< did the dive end in an integral LP solution? */
+} DIVEJOB;
+
+
+/*
+ * Local methods
+ */
+
+/** resolves the LP of a dive by the dual simplex, starting from the basis of the previous LP; called by the dives, so
+ *  no SCIP methods may be used
+ *
+ *  @return TRUE if the LP was solved to optimality or proven to be infeasible
+ */
+static
+SCIP_Bool solveDiveLP(
+   DIVEJOB*              job,                /**< dive */
+   SCIP_Real*            lpobjval,           /**< pointer to store the LP objective value, including the offset */
+   SCIP_Bool*            infeasible          /**< pointer to store whether the LP is infeasible */
+   )
+{
+   int iterations;
+
+   *infeasible = FALSE;
+
+   /* an error should not kill the overall solving process */
+   if( SCIPlpiSolveDual(job->lpi) != SCIP_OKAY )
+      return FALSE;
+
+   ++job->ndivelps;
+   if( SCIPlpiGetIterations(job->lpi, &iterations) == SCIP_OKAY )
+      job->niterations += iterations;
+
+   if( SCIPlpiIsPrimalInfeasible(job->lpi) )
+   {
+      *infeasible = TRUE;
+      return TRUE;
+   }
+
+   if( !SCIPlpiIsOptimal(job->lpi) || SCIPlpiGetObjval(job->lpi, lpobjval) != SCIP_OKAY )
+      return FALSE;
+
+   *lpobjval += job->shared->objoffset;
+
+   return TRUE;
+}
+
+/** computes the score and the rounding direction of a fractional column by the variable selection rule of a dive; the
+ *  rules follow the score callbacks of the fractional, coefficient, pseudo cost, and vector length diving heuristics,
+ *  but use only the column data collected beforehand and break ties deterministically instead of randomly
+ */
+static
+void getDiveScore(
+   DIVESHARED*           shared,             /**< shared data */
+   DIVERULE              rule,               /**< variable selection rule */
+   int                   c,                  /**< LP position of the column */
+   SCIP_Real             candsol,            /**< LP solution value of the column */
+   SCIP_Real             candsfrac,          /**< fractionality of the LP solution value */
+   SCIP_Real*            score,              /**< pointer to store the score */
+   SCIP_Bool*            roundup             /**< pointer to store whether the column should be rounded up */
+   )
+{
+   SCIP_Bool mayrounddown = (shared->nlocksdown[c] == 0);
+   SCIP_Bool mayroundup = (shared->nlocksup[c] == 0);
+
+   switch( rule )
+   {
+   case DIVERULE_FRACTIONAL:
+   {
+      SCIP_Real obj = shared->obj[c];
+      SCIP_Real objgain;
+
+      if( mayrounddown != mayroundup )
+         *roundup = mayrounddown;
+      else
+         *roundup = (candsfrac > 0.5);
+
+      if( shared->objnorm > shared->epsilon )
+         obj /= shared->objnorm;
+
+      if( *roundup )
+      {
+         candsfrac = 1.0 - candsfrac;
+         objgain = obj * candsfrac;
+      }
+      else
+         objgain = -obj * candsfrac;
+
+      /* penalize too small fractions */
+      if( candsfrac < 0.01 )
+         candsfrac += 10.0;
+
+      /* prefer decisions on binary variables */
+      if( !shared->binary[c] )
+         candsfrac *= 1000.0;
+
+      /* prefer variables that cannot be rounded */
+      if( !(mayrounddown || mayroundup) )
+         *score = -candsfrac;
+      else
+         *score = -2.0 - objgain;
+      break;
+   }
+   case DIVERULE_COEFFICIENT:
+   {
+      if( mayrounddown && mayroundup )
+         *roundup = (candsfrac > 0.5);
+      else if( mayrounddown || mayroundup )
+         *roundup = mayrounddown;
+      else
+      {
+         *roundup = (shared->nlocksdown[c] > shared->nlocksup[c]
+            || (shared->nlocksdown[c] == shared->nlocksup[c] && candsfrac > 0.5));
+      }
+
+      if( *roundup )
+      {
+         candsfrac = 1.0 - candsfrac;
+         *score = shared->nlocksup[c];
+      }
+      else
+         *score = shared->nlocksdown[c];
+
+      /* penalize too small fractions */
+      if( candsfrac < 0.01 )
+         *score *= 0.01;
+
+      /* prefer decisions on binary variables */
+      if( !shared->binary[c] )
+         *score *= 0.1;
+
+      /* penalize the variable if it may be rounded */
+      if( mayrounddown || mayroundup )
+         *score -= shared->nrows;
+      break;
+   }
+   case DIVERULE_PSEUDOCOST:
+   {
+      SCIP_Real pscostdown;
+      SCIP_Real pscostup;
+
+      candsfrac = MAX(candsfrac, 0.1);
+      candsfrac = MIN(candsfrac, 0.9);
+
+      pscostdown = candsfrac * shared->pscostdown[c];
+      pscostup = (1.0 - candsfrac) * shared->pscostup[c];
+
+      if( mayrounddown != mayroundup )
+         *roundup = mayrounddown;
+      else if( candsol < shared->rootsol[c] - 0.4 )
+         *roundup = FALSE;
+      else if( candsol > shared->rootsol[c] + 0.4 )
+         *roundup = TRUE;
+      else if( candsfrac < 0.3 )
+         *roundup = FALSE;
+      else if( candsfrac > 0.7 )
+         *roundup = TRUE;
+      else
+         *roundup = (pscostdown > pscostup + shared->epsilon);
+
+      if( *roundup )
+         *score = sqrt(candsfrac) * (1.0 + pscostdown) / (1.0 + pscostup);
+      else
+         *score = sqrt(1.0 - candsfrac) * (1.0 + pscostup) / (1.0 + pscostdown);
+
+      /* prefer decisions on binary variables that cannot be rounded */
+      if( shared->binary[c] && !(mayrounddown || mayroundup) )
+         *score *= 1000.0;
+      break;
+   }
+   case DIVERULE_VECLEN:
+   {
+      SCIP_Real objdelta;
+
+      /* round in the direction that does not deteriorate the objective */
+      *roundup = (shared->obj[c] >= 0.0);
+      objdelta = (*roundup ? (1.0 - candsfrac) * shared->obj[c] : -candsfrac * shared->obj[c]);
+      assert(objdelta >= 0.0);
+
+      /* prefer long columns, which have an impact on many rows, with small objective deterioration */
+      *score = (shared->colveclen[c] + 1.0) / (objdelta + shared->sumepsilon);
+
+      /* prefer decisions on binary variables */
+      if( !shared->binary[c] )
+         *score *= 0.001;
+      break;
+   }
+   default:
+      SCIPABORT();
+      *score = 0.0;
+      *roundup = FALSE;
+   } /*lint !e788*/
+}
+
+/** job of a dive: fixes fractional columns of the LP copy chosen by the variable selection rule of the dive and
+ *  resolves the LP until the LP solution is integral, the LP gets infeasible, the LP value reaches the cutoff bound, or
+ *  the iteration limit is reached; an integral LP solution is only stored in the dive, so different dives never write
+ *  to the same memory
+ */
+static
+SCIP_DECL_PARALLELJOB(execDiveJob)
+{
+   DIVEJOB* job = (DIVEJOB*)jobarg;
+   DIVESHARED* shared = job->shared;
+   SCIP_Real lpobjval;
+   SCIP_Bool infeasible;
+
+   if( !solveDiveLP(job, &lpobjval, &infeasible) || infeasible )
+      return SCIP_OKAY;
+
+   while( lpobjval < shared->cutoffbound && job->niterations < job->maxniterations )
+   {
+      SCIP_Real bestscore = -SCIP_REAL_MAX;
+      SCIP_Real oldlb;
+      SCIP_Real oldub;
+      SCIP_Bool bestroundup = FALSE;
+      int bestcand = -1;
+      int backtrack;
+      int c;
+
+      if( SCIPlpiGetSol(job->lpi, NULL, job->primsol, NULL, NULL, NULL) != SCIP_OKAY )
+         return SCIP_OKAY;
+
+      /* select the fractional column with the best score; ties are broken by the LP position */
+      for( c = 0; c < shared->ncols; ++c )
+      {
+         SCIP_Real frac;
+         SCIP_Real score;
+         SCIP_Bool roundup;
+
+         if( !shared->integral[c] )
+            continue;
+
+         frac = job->primsol[c] - floor(job->primsol[c] + shared->feastol);
+         if( frac <= shared->feastol )
+            continue;
+
+         getDiveScore(shared, job->rule, c, job->primsol[c], frac, &score, &roundup);
+
+         if( score > bestscore || bestcand == -1 )
+         {
+            bestscore = score;
+            bestroundup = roundup;
+            bestcand = c;
+         }
+      }
+
+      /* the LP solution is integral */
+      if( bestcand == -1 )
+      {
+         BMScopyMemoryArray(job->solvals, job->primsol, shared->ncols);
+         job->solobj = lpobjval;
+         job->foundsol = TRUE;
+         return SCIP_OKAY;
+      }
+
+      oldlb = job->lbs[bestcand];
+      oldub = job->ubs[bestcand];
+
+      /* fix the column in the selected direction and use one level of backtracking if the LP gets infeasible */
+      for( backtrack = 0; backtrack < 2; ++backtrack )
+      {
+         job->lbs[bestcand] = bestroundup ? ceil(job->primsol[bestcand]) : oldlb;
+         job->ubs[bestcand] = bestroundup ? oldub : floor(job->primsol[bestcand]);
+
+         if( SCIPlpiChgBounds(job->lpi, 1, &bestcand, &job->lbs[bestcand], &job->ubs[bestcand]) != SCIP_OKAY )
+            return SCIP_OKAY;
+
+         if( !solveDiveLP(job, &lpobjval, &infeasible) )
+            return SCIP_OKAY;
+
+         if( !infeasible )
+            break;
+
+         bestroundup = !bestroundup;
+      }
+
+      if( infeasible )
+         break;
+   }
+
+   return SCIP_OKAY;
+}
+
+
+/*
+ * Callback methods
+ */
+
+/** copy method for primal heuristic plugins (called when SCIP copies plugins) */
+static
+SCIP_DECL_HEURCOPY(heurCopyParalleldiving)
+{  /*lint --e{715}*/
+   assert(scip != NULL);
+   assert(heur != NULL);
+   assert(strcmp(SCIPheurGetName(heur), HEUR_NAME) == 0);
+
+   /* call inclusion method of primal heuristic */
+   SCIP_CALL( SCIPincludeHeurParalleldiving(scip) );
+
+   return SCIP_OKAY;
+}
+
+/** destructor of primal heuristic to free user data (called when SCIP is exiting) */
+static
+SCIP_DECL_HEURFREE(heurFreeParalleldiving)
+{  /*lint --e{715}*/
+   SCIP_HEURDATA* heurdata;
+
+   assert(heur != NULL);
+   assert(strcmp(SCIPheurGetName(heur), HEUR_NAME) == 0);
+   assert(scip != NULL);
+
+   /* free heuristic data */
+   heurdata = SCIPheurGetData(heur);
+   assert(heurdata != NULL);
+
+   SCIPfreeBlockMemory(scip, &heurdata);
+   SCIPheurSetData(heur, NULL);
+
+   return SCIP_OKAY;
+}
+
+/** initialization method of primal heuristic (called after problem was transformed) */
+static
+SCIP_DECL_HEURINIT(heurInitParalleldiving)
+{  /*lint --e{715}*/
+   SCIP_HEURDATA* heurdata;
+
+   assert(heur != NULL);
+   assert(strcmp(SCIPheurGetName(heur), HEUR_NAME) == 0);
+
+   heurdata = SCIPheurGetData(heur);
+   assert(heurdata != NULL);
+
+   heurdata->nlpiterations = 0;
+
+   return SCIP_OKAY;
+}
+
+/** execution method of primal heuristic */
+static
+SCIP_DECL_HEUREXEC(heurExecParalleldiving)
+{  /*lint --e{715}*/
+   SCIP_HEURDATA* heurdata;
+   DIVESHARED shared;
+   DIVEJOB* jobs;
+   SCIP_COL** cols;
+   SCIP_LPI* lpi;
+   void** jobargs;
+   int* cstat;
+   int* rstat;
+   SCIP_Longint maxnlpiterations;
+   int nthreads;
+   int njobs;
+   int ncols;
+   int nrows;
+   int i;
+   int c;
+
+   assert(heur != NULL);
+   assert(strcmp(SCIPheurGetName(heur), HEUR_NAME) == 0);
+   assert(scip != NULL);
+   assert(result != NULL);
+   assert(SCIPhasCurrentNodeLP(scip));
+
+   *result = SCIP_DIDNOTRUN;
+
+   heurdata = SCIPheurGetData(heur);
+   assert(heurdata != NULL);
+
+   /* the dives only pay off if they can be executed in parallel */
+   nthreads = SCIPgetNParallelJobThreads(scip);
+   njobs = MIN3(nthreads, heurdata->maxndives, NDIVERULES);
+   if( njobs <= 1 )
+      return SCIP_OKAY;
+
+   /* the copies of the LP start from the basis of the optimal LP solution of the node */
+   if( nodeinfeasible || SCIPgetLPSolstat(scip) != SCIP_LPSOLSTAT_OPTIMAL || !SCIPisLPSolBasic(scip) )
+      return SCIP_OKAY;
+
+   if( SCIPgetNLPBranchCands(scip) == 0 )
+      return SCIP_OKAY;
+
+   /* calculate the maximal number of LP iterations until the heuristic is aborted */
+   maxnlpiterations = (SCIP_Longint)((1.0 + 10.0*(SCIPheurGetNBestSolsFound(heur)+1.0)/(SCIPheurGetNCalls(heur)+1.0))
+      * heurdata->maxlpiterquot * SCIPgetNNodeLPIterations(scip));
+   maxnlpiterations += heurdata->maxlpiterofs;
+
+   /* don't try to dive, if we took too many LP iterations during diving */
+   if( heurdata->nlpiterations >= maxnlpiterations )
+      return SCIP_OKAY;
+
+   *result = SCIP_DIDNOTFIND;
+
+   SCIP_CALL( SCIPgetLPColsData(scip, &cols, &ncols) );
+   nrows = SCIPgetNLPRows(scip);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &cstat, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &rstat, nrows) );
+
+   /* the LP is flushed, so the columns and rows of the LP solver have the LP positions of SCIP's columns and rows */
+   SCIP_CALL( SCIPgetLPI(scip, &lpi) );
+   SCIP_CALL( SCIPlpiGetBase(lpi, cstat, rstat) );
+
+   BMSclearMemory(&shared);
+   shared.ncols = ncols;
+   shared.nrows = nrows;
+   shared.objnorm = SCIPgetObjNorm(scip);
+   shared.cutoffbound = SCIPgetCutoffbound(scip);
+   shared.feastol = SCIPfeastol(scip);
+   shared.epsilon = SCIPepsilon(scip);
+   shared.sumepsilon = SCIPsumepsilon(scip);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &shared.obj, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &shared.lbs, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &shared.ubs, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &shared.pscostdown, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &shared.pscostup, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &shared.rootsol, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &shared.nlocksdown, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &shared.nlocksup, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &shared.colveclen, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &shared.integral, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &shared.binary, ncols) );
+
+   shared.objoffset = SCIPgetLPObjval(scip);
+   for( c = 0; c < ncols; ++c )
+   {
+      SCIP_VAR* var = SCIPcolGetVar(cols[c]);
+
+      shared.obj[c] = SCIPcolGetObj(cols[c]);
+      shared.pscostdown[c] = SCIPgetVarPseudocostVal(scip, var, -1.0);
+      shared.pscostup[c] = SCIPgetVarPseudocostVal(scip, var, 1.0);
+      shared.rootsol[c] = SCIPvarGetRootSol(var);
+      shared.nlocksdown[c] = SCIPvarGetNLocksDownType(var, SCIP_LOCKTYPE_MODEL);
+      shared.nlocksup[c] = SCIPvarGetNLocksUpType(var, SCIP_LOCKTYPE_MODEL);
+      shared.colveclen[c] = SCIPcolGetNNonz(cols[c]);
+      shared.integral[c] = SCIPvarIsIntegral(var) && SCIPvarGetType(var) != SCIP_VARTYPE_IMPLINT;
+      shared.binary[c] = SCIPvarIsBinary(var);
+      shared.objoffset -= SCIPcolGetObj(cols[c]) * SCIPcolGetPrimsol(cols[c]);
+   }
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &jobs, njobs) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &jobargs, njobs) );
+
+   for( i = 0; i < njobs; ++i )
+   {
+      BMSclearMemory(&jobs[i]);
+      jobs[i].shared = &shared;
+      jobs[i].rule = (DIVERULE)i;
+      jobs[i].maxniterations = (maxnlpiterations - heurdata->nlpiterations) / njobs + 1;
+      SCIP_CALL( SCIPcreateLPICopy(scip, "paralleldiving", TRUE, cstat, rstat, &jobs[i].lpi) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &jobs[i].lbs, ncols) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &jobs[i].ubs, ncols) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &jobs[i].primsol, ncols) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &jobs[i].solvals, ncols) );
+      jobargs[i] = (void*)&jobs[i];
+   }
+
+   /* the bounds in the representation of the LP solver */
+   SCIP_CALL( SCIPlpiGetBounds(jobs[0].lpi, 0, ncols - 1, shared.lbs, shared.ubs) );
+   for( i = 0; i < njobs; ++i )
+   {
+      BMScopyMemoryArray(jobs[i].lbs, shared.lbs, ncols);
+      BMScopyMemoryArray(jobs[i].ubs, shared.ubs, ncols);
+   }
+
+   SCIP_CALL( SCIPexecParallelJobs(scip, nthreads, execDiveJob, jobargs, njobs) );
+
+   /* try the solutions in the order of the dives, such that the result does not depend on the scheduling of the jobs */
+   for( i = 0; i < njobs; ++i )
+   {
+      heurdata->nlpiterations += jobs[i].niterations;
+
+      SCIPdebugMsg(scip, "dive %d: %d LPs, %" SCIP_LONGINT_FORMAT " LP iterations, %s\n", i, jobs[i].ndivelps,
+         jobs[i].niterations, jobs[i].foundsol ? "found integral LP solution" : "no solution");
+
+      if( jobs[i].foundsol && jobs[i].solobj < SCIPgetCutoffbound(scip) )
+      {
+         SCIP_SOL* sol;
+         SCIP_Bool stored;
+
+         SCIP_CALL( SCIPcreateLPSol(scip, &sol, heur) );
+
+         for( c = 0; c < ncols; ++c )
+         {
+            SCIP_CALL( SCIPsetSolVal(scip, sol, SCIPcolGetVar(cols[c]), jobs[i].solvals[c]) );
+         }
+
+         SCIP_CALL( SCIPtrySolFree(scip, &sol, FALSE, FALSE, TRUE, TRUE, TRUE, &stored) );
+
+         if( stored )
+         {
+            SCIPdebugMsg(scip, "found solution of dive %d with objective value %g\n", i, jobs[i].solobj);
+            *result = SCIP_FOUNDSOL;
+         }
+      }
+   }
+
+   for( i = njobs - 1; i >= 0; --i )
+   {
+      SCIPfreeBufferArray(scip, &jobs[i].solvals);
+      SCIPfreeBufferArray(scip, &jobs[i].primsol);
+      SCIPfreeBufferArray(scip, &jobs[i].ubs);
+      SCIPfreeBufferArray(scip, &jobs[i].lbs);
+      SCIP_CALL( SCIPlpiFree(&jobs[i].lpi) );
+   }
+
+   SCIPfreeBufferArray(scip, &jobargs);
+   SCIPfreeBufferArray(scip, &jobs);
+   SCIPfreeBufferArray(scip, &shared.binary);
+   SCIPfreeBufferArray(scip, &shared.integral);
+   SCIPfreeBufferArray(scip, &shared.colveclen);
+   SCIPfreeBufferArray(scip, &shared.nlocksup);
+   SCIPfreeBufferArray(scip, &shared.nlocksdown);
+   SCIPfreeBufferArray(scip, &shared.rootsol);
+   SCIPfreeBufferArray(scip, &shared.pscostup);
+   SCIPfreeBufferArray(scip, &shared.pscostdown);
+   SCIPfreeBufferArray(scip, &shared.ubs);
+   SCIPfreeBufferArray(scip, &shared.lbs);
+   SCIPfreeBufferArray(scip, &shared.obj);
+   SCIPfreeBufferArray(scip, &rstat);
+   SCIPfreeBufferArray(scip, &cstat);
+
+   return SCIP_OKAY;
+}
+
+
+/*
+ * primal heuristic specific interface methods
+ */
+
+/** creates the paralleldiving heuristic and includes it in SCIP */
+SCIP_RETCODE SCIPincludeHeurParalleldiving(
+   SCIP*                 scip                /**< SCIP data structure */
+   )
+{
+   SCIP_HEURDATA* heurdata;
+   SCIP_HEUR* heur;
+
+   /* create paralleldiving primal heuristic data */
+   SCIP_CALL( SCIPallocBlockMemory(scip, &heurdata) );
+   heurdata->nlpiterations = 0;
+
+   /* include primal heuristic */
+   SCIP_CALL( SCIPincludeHeurBasic(scip, &heur,
+         HEUR_NAME, HEUR_DESC, HEUR_DISPCHAR, HEUR_PRIORITY, HEUR_FREQ, HEUR_FREQOFS,
+         HEUR_MAXDEPTH, HEUR_TIMING, HEUR_USESSUBSCIP, heurExecParalleldiving, heurdata) );
+
+   assert(heur != NULL);
+
+   /* set non-NULL pointers to callback methods */
+   SCIP_CALL( SCIPsetHeurCopy(scip, heur, heurCopyParalleldiving) );
+   SCIP_CALL( SCIPsetHeurFree(scip, heur, heurFreeParalleldiving) );
+   SCIP_CALL( SCIPsetHeurInit(scip, heur, heurInitParalleldiving) );
+
+   /* add paralleldiving primal heuristic parameters */
+   SCIP_CALL( SCIPaddRealParam(scip, "heuristics/" HEUR_NAME "/maxlpiterquot",
+         "maximal fraction of diving LP iterations compared to node LP iterations",
+         &heurdata->maxlpiterquot, FALSE, DEFAULT_MAXLPITERQUOT, 0.0, SCIP_REAL_MAX, NULL, NULL) );
+   SCIP_CALL( SCIPaddIntParam(scip, "heuristics/" HEUR_NAME "/maxlpiterofs",
+         "additional number of allowed LP iterations",
+         &heurdata->maxlpiterofs, FALSE, DEFAULT_MAXLPITEROFS, 0, INT_MAX, NULL, NULL) );
+   SCIP_CALL( SCIPaddIntParam(scip, "heuristics/" HEUR_NAME "/maxndives",
+         "maximal number of dives that are executed in parallel, each with another variable selection rule",
+         &heurdata->maxndives, FALSE, DEFAULT_MAXNDIVES, 2, NDIVERULES, NULL, NULL) );
+
+   return SCIP_OKAY;
+}
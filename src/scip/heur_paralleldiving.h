@@ -0,0 +1,69 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   heur_paralleldiving.h
+ * @ingroup PRIMALHEURISTICS
+ * @brief  LP diving heuristic that executes a portfolio of dives in parallel on copies of the LP relaxation
+ *
+ * Diving heuristic: Each dive of the portfolio runs in its own thread on a copy of the LP relaxation of the current
+ * node and iteratively fixes some fractional variable and resolves the LP, thereby simulating a depth-first-search in
+ * the tree. The dives differ in the rule that selects the variable and the rounding direction; the rules follow the
+ * fractional, coefficient, pseudo cost, and vector length diving heuristics. One-level backtracking is applied: If the
+ * LP gets infeasible, the last fixing is undone, and the opposite fixing is tried. If this is infeasible, too, the dive
+ * aborts. The LP solutions that are integral are tried as solutions after all dives have finished, in the order of the
+ * rules, such that the result does not depend on the scheduling of the threads.
+ *
+ * The dives run synchronously: the heuristic call, and thus the node processing, waits until all dives have finished;
+ * the dives do not run in the background of the tree search. The dives operate on copies of the LP only and do not
+ * propagate the fixings. The heuristic is disabled by default and only runs if SCIP was compiled with a parallel task
+ * processing interface and parallel/maxnthreads is larger than one.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#ifndef __SCIP_HEUR_PARALLELDIVING_H__
+#define __SCIP_HEUR_PARALLELDIVING_H__
+
+#include "scip/def.h"
+#include "scip/type_retcode.h"
+#include "scip/type_scip.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** creates the paralleldiving heuristic and includes it in SCIP
+ *
+ *  @ingroup PrimalHeuristicIncludes
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPincludeHeurParalleldiving(
+   SCIP*                 scip                /**< SCIP data structure */
+   );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
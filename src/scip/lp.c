@@ -43,6 +43,7 @@
 
 #include "lpi/lpi.h"
 #include "scip/clock.h"
+#include "scip/concurrent.h"
 #include "scip/cons.h"
 #include "scip/event.h"
 #include "scip/intervalarith.h"
@@ -65,9 +66,15 @@
 #include "scip/struct_stat.h"
 #include "scip/struct_var.h"
 #include "scip/var.h"
+#include "tpi/tpi.h"
 #include <string.h>
 
 
+#define SCIP_TABCACHE_MAXSIZE  10000000LL /**< maximal number of values stored in the tableau row cache */
+#define SCIP_TABCACHE_MEMFRAC  0.05       /**< maximal fraction of the memory limit used by the tableau row cache */
+#define DIRTYRANGEFAC          4          /**< changes are sorted by a sweep over their range of LP solver positions if the
+                                           *   range is at most this factor times larger than the number of changes */
+
 /* activate this to use the row activities as given by the LPI instead of recalculating
  * using the LP solver activity is potentially faster, but may not be consistent with the SCIP_ROW calculations
  * see also #2594 for more details on possible trouble
@@ -209,6 +216,41 @@ SCIP_RETCODE ensureChgrowsSize(
    return SCIP_OKAY;
 }
 
+/** frees all rows stored in the tableau row cache */
+static
+void lpClearTableauCache(
+   SCIP_LP*              lp,                 /**< current LP data */
+   BMS_BLKMEM*           blkmem              /**< block memory */
+   )
+{
+   int r;
+
+   assert(lp != NULL);
+   assert(blkmem != NULL);
+
+   /* the rows were allocated with the dimensions the cache was set up for */
+   for( r = 0; r < lp->tabcachenrows; ++r )
+   {
+      BMSfreeBlockMemoryArrayNull(blkmem, &lp->tabcachebinvrows[r], lp->tabcachenrows);
+      BMSfreeBlockMemoryArrayNull(blkmem, &lp->tabcachebinvarows[r], lp->tabcachencols);
+   }
+   lp->tabcachememsize = 0;
+   lp->tabcachestamp = -1;
+}
+
+/** marks the rows in the tableau row cache as outdated; must be called whenever the state of the LP solver changes,
+ *  e.g., before the LP is solved or a basis is loaded into the LP solver
+ */
+static
+void lpInvalidateTableauCache(
+   SCIP_LP*              lp                  /**< current LP data */
+   )
+{
+   assert(lp != NULL);
+
+   ++lp->lpistamp;
+}
+
 /** ensures, that lpicols array can store at least num entries */
 static
 SCIP_RETCODE ensureLpicolsSize(
@@ -418,6 +460,9 @@ SCIP_RETCODE lpRestoreSolVals(
    assert(lp != NULL);
    assert(blkmem != NULL);
 
+   /* the solution of the LP solver changed, even if the restored solution is marked as solved */
+   lpInvalidateTableauCache(lp);
+
    /* if stored values are available, restore them */
    storedsolvals = lp->storedsolvals;
    if( storedsolvals != NULL )
@@ -4186,6 +4231,7 @@ SCIP_RETCODE SCIPlpStartStrongbranch(
 
    lp->strongbranching = TRUE;
    SCIPdebugMessage("starting strong branching ...\n");
+   lpInvalidateTableauCache(lp);
    SCIP_CALL( SCIPlpiStartStrongbranch(lp->lpi) );
 
    return SCIP_OKAY;
@@ -8000,7 +8046,43 @@ void computeLPBounds(
       (*ub) = col->ub;
 }
 
-/** applies all cached column additions to the LP solver */
+/** provides the coefficients of the k-th added column in terms of the rows of the LP solver */
+static
+SCIP_DECL_LPIGETVEC(lpGetAddedColVec)
+{  /*lint --e{715}*/
+   SCIP_LP* lp;
+   SCIP_COL* col;
+   int i;
+
+   lp = (SCIP_LP*)vecdata;
+   assert(lp != NULL);
+   assert(0 <= k && lp->nlpicols + k < lp->ncols);
+
+   col = lp->cols[lp->nlpicols + k];
+   assert(col != NULL);
+   assert(col->lpipos == lp->nlpicols + k);
+
+   *len = 0;
+   for( i = 0; i < col->nlprows; ++i )
+   {
+      assert(col->rows[i] != NULL);
+      if( col->rows[i]->lpipos >= 0 )
+      {
+         assert(col->rows[i]->lpipos < lp->nrows);
+         ind[*len] = col->rows[i]->lpipos;
+         val[*len] = col->vals[i];
+         ++(*len);
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** applies all cached column additions to the LP solver
+ *
+ *  The coefficients of the columns are not gathered here, but read by the LP interface column by column through a
+ *  callback, such that LP solvers that build their own column vectors do not need a copy of all added coefficients.
+ */
 static
 SCIP_RETCODE lpFlushAddCols(
    SCIP_LP*              lp,                 /**< current LP data */
@@ -8012,19 +8094,14 @@ SCIP_RETCODE lpFlushAddCols(
    SCIP_Real* obj;
    SCIP_Real* lb;
    SCIP_Real* ub;
-   int* beg;
-   int* ind;
-   SCIP_Real* val;
    char** name;
    SCIP_COL* col;
    SCIP_Real lpiinf;
    int c;
    int pos;
-   int nnonz;
    int naddcols;
    int naddcoefs;
-   int i;
-   int lpipos;
+   int maxlen;
 
    assert(lp != NULL);
    assert(lp->lpifirstchgcol == lp->nlpicols);
@@ -8046,21 +8123,21 @@ SCIP_RETCODE lpFlushAddCols(
    /* count the (maximal) number of added coefficients, calculate the number of added columns */
    naddcols = lp->ncols - lp->nlpicols;
    naddcoefs = 0;
+   maxlen = 0;
    for( c = lp->nlpicols; c < lp->ncols; ++c )
+   {
       naddcoefs += lp->cols[c]->len;
+      maxlen = MAX(maxlen, lp->cols[c]->len);
+   }
    assert(naddcols > 0);
 
    /* get temporary memory for changes */
    SCIP_CALL( SCIPsetAllocBufferArray(set, &obj, naddcols) );
    SCIP_CALL( SCIPsetAllocBufferArray(set, &lb, naddcols) );
    SCIP_CALL( SCIPsetAllocBufferArray(set, &ub, naddcols) );
-   SCIP_CALL( SCIPsetAllocBufferArray(set, &beg, naddcols) );
-   SCIP_CALL( SCIPsetAllocBufferArray(set, &ind, naddcoefs) );
-   SCIP_CALL( SCIPsetAllocBufferArray(set, &val, naddcoefs) );
    SCIP_CALL( SCIPsetAllocBufferArray(set, &name, naddcols) );
 
    /* fill temporary memory with column data */
-   nnonz = 0;
    for( pos = 0, c = lp->nlpicols; c < lp->ncols; ++pos, ++c )
    {
       col = lp->cols[c];
@@ -8069,7 +8146,6 @@ SCIP_RETCODE lpFlushAddCols(
       assert(SCIPvarGetStatus(col->var) == SCIP_VARSTATUS_COLUMN);
       assert(SCIPvarGetCol(col->var) == col);
       assert(col->lppos == c);
-      assert(nnonz + col->nlprows <= naddcoefs);
 
       SCIPsetDebugMsg(set, "flushing added column <%s>: ", SCIPvarGetName(col->var));
       debugColPrint(set, col);
@@ -8101,46 +8177,34 @@ SCIP_RETCODE lpFlushAddCols(
       /* compute bounds that should be flushed into the LP (taking into account lazy bounds) */
       computeLPBounds(lp, set, col, lpiinf, &(lb[pos]), &(ub[pos]));
 
-      beg[pos] = nnonz;
       name[pos] = (char*)SCIPvarGetName(col->var);
 
       col->flushedobj = obj[pos];
       col->flushedlb = lb[pos];
       col->flushedub = ub[pos];
 
-      for( i = 0; i < col->nlprows; ++i )
+#ifndef NDEBUG
       {
-         assert(col->rows[i] != NULL);
-         lpipos = col->rows[i]->lpipos;
-         if( lpipos >= 0 )
+         int i;
+
+         for( i = col->nlprows; i < col->len; ++i )
          {
-            assert(lpipos < lp->nrows);
-            assert(nnonz < naddcoefs);
-            ind[nnonz] = lpipos;
-            val[nnonz] = col->vals[i];
-            nnonz++;
+            assert(col->rows[i] != NULL);
+            assert(col->rows[i]->lpipos == -1); /* because the row deletions are already performed */
          }
       }
-#ifndef NDEBUG
-      for( i = col->nlprows; i < col->len; ++i )
-      {
-         assert(col->rows[i] != NULL);
-         assert(col->rows[i]->lpipos == -1); /* because the row deletions are already performed */
-      }
 #endif
    }
 
-   /* call LP interface */
+   /* call LP interface, which reads the coefficients of the columns through lpGetAddedColVec() */
    SCIPsetDebugMsg(set, "flushing col additions: enlarge LP from %d to %d columns\n", lp->nlpicols, lp->ncols);
-   SCIP_CALL( SCIPlpiAddCols(lp->lpi, naddcols, obj, lb, ub, name, nnonz, beg, ind, val) );
+   SCIP_CALL( SCIPlpiAddColsCallback(lp->lpi, naddcols, obj, lb, ub, name, naddcoefs, maxlen, lpGetAddedColVec,
+         (void*)lp) );
    lp->nlpicols = lp->ncols;
    lp->lpifirstchgcol = lp->nlpicols;
 
    /* free temporary memory */
    SCIPsetFreeBufferArray(set, &name);
-   SCIPsetFreeBufferArray(set, &val);
-   SCIPsetFreeBufferArray(set, &ind);
-   SCIPsetFreeBufferArray(set, &beg);
    SCIPsetFreeBufferArray(set, &ub);
    SCIPsetFreeBufferArray(set, &lb);
    SCIPsetFreeBufferArray(set, &obj);
@@ -8223,7 +8287,42 @@ SCIP_RETCODE lpFlushDelRows(
    return SCIP_OKAY;
 }
 
-/** applies all cached row additions and removals to the LP solver */
+/** provides the coefficients of the k-th added row in terms of the columns of the LP solver */
+static
+SCIP_DECL_LPIGETVEC(lpGetAddedRowVec)
+{  /*lint --e{715}*/
+   SCIP_LP* lp;
+   SCIP_ROW* row;
+   int i;
+
+   lp = (SCIP_LP*)vecdata;
+   assert(lp != NULL);
+   assert(0 <= k && lp->nlpirows + k < lp->nrows);
+
+   row = lp->rows[lp->nlpirows + k];
+   assert(row != NULL);
+   assert(row->lpipos == lp->nlpirows + k);
+
+   *len = 0;
+   for( i = 0; i < row->nlpcols; ++i )
+   {
+      assert(row->cols[i] != NULL);
+      if( row->cols[i]->lpipos >= 0 )
+      {
+         assert(row->cols[i]->lpipos < lp->ncols);
+         ind[*len] = row->cols[i]->lpipos;
+         val[*len] = row->vals[i];
+         ++(*len);
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** applies all cached row additions and removals to the LP solver
+ *
+ *  As for the columns, the LP interface reads the coefficients of the rows row by row through a callback.
+ */
 static
 SCIP_RETCODE lpFlushAddRows(
    SCIP_LP*              lp,                 /**< current LP data */
@@ -8234,19 +8333,14 @@ SCIP_RETCODE lpFlushAddRows(
 {
    SCIP_Real* lhs;
    SCIP_Real* rhs;
-   int* beg;
-   int* ind;
-   SCIP_Real* val;
    char** name;
    SCIP_ROW* row;
    SCIP_Real lpiinf;
    int r;
    int pos;
-   int nnonz;
    int naddrows;
    int naddcoefs;
-   int i;
-   int lpipos;
+   int maxlen;
 
    assert(lp != NULL);
    assert(lp->lpifirstchgrow == lp->nlpirows);
@@ -8266,26 +8360,25 @@ SCIP_RETCODE lpFlushAddRows(
    /* count the (maximal) number of added coefficients, calculate the number of added rows */
    naddrows = lp->nrows - lp->nlpirows;
    naddcoefs = 0;
+   maxlen = 0;
    for( r = lp->nlpirows; r < lp->nrows; ++r )
+   {
       naddcoefs += lp->rows[r]->len;
+      maxlen = MAX(maxlen, lp->rows[r]->len);
+   }
    assert(naddrows > 0);
 
    /* get temporary memory for changes */
    SCIP_CALL( SCIPsetAllocBufferArray(set, &lhs, naddrows) );
    SCIP_CALL( SCIPsetAllocBufferArray(set, &rhs, naddrows) );
-   SCIP_CALL( SCIPsetAllocBufferArray(set, &beg, naddrows) );
-   SCIP_CALL( SCIPsetAllocBufferArray(set, &ind, naddcoefs) );
-   SCIP_CALL( SCIPsetAllocBufferArray(set, &val, naddcoefs) );
    SCIP_CALL( SCIPsetAllocBufferArray(set, &name, naddrows) );
 
    /* fill temporary memory with row data */
-   nnonz = 0;
    for( pos = 0, r = lp->nlpirows; r < lp->nrows; ++pos, ++r )
    {
       row = lp->rows[r];
       assert(row != NULL);
       assert(row->lppos == r);
-      assert(nnonz + row->nlpcols <= naddcoefs);
 
       SCIPsetDebugMsg(set, "flushing added row <%s>: ", row->name);
       debugRowPrint(set, row);
@@ -8314,48 +8407,33 @@ SCIP_RETCODE lpFlushAddRows(
          rhs[pos] = lpiinf;
       else
          rhs[pos] = row->rhs - row->constant;
-      beg[pos] = nnonz;
       name[pos] = row->name;
 
       row->flushedlhs = lhs[pos];
       row->flushedrhs = rhs[pos];
 
-      SCIPsetDebugMsg(set, "flushing added row (SCIP_LPI): %+g <=", lhs[pos]);
-      for( i = 0; i < row->nlpcols; ++i )
+#ifndef NDEBUG
       {
-         assert(row->cols[i] != NULL);
-         lpipos = row->cols[i]->lpipos;
-         if( lpipos >= 0 )
+         int i;
+
+         for( i = row->nlpcols; i < row->len; ++i )
          {
-            assert(lpipos < lp->ncols);
-            assert(nnonz < naddcoefs);
-            SCIPsetDebugMsgPrint(set, " %+gx%d(<%s>)", row->vals[i], lpipos+1, SCIPvarGetName(row->cols[i]->var));
-            ind[nnonz] = lpipos;
-            val[nnonz] = row->vals[i];
-            nnonz++;
+            assert(row->cols[i] != NULL);
+            assert(row->cols[i]->lpipos == -1); /* because the column deletions are already performed */
          }
       }
-      SCIPsetDebugMsgPrint(set, " <= %+g\n", rhs[pos]);
-#ifndef NDEBUG
-      for( i = row->nlpcols; i < row->len; ++i )
-      {
-         assert(row->cols[i] != NULL);
-         assert(row->cols[i]->lpipos == -1); /* because the column deletions are already performed */
-      }
 #endif
    }
 
-   /* call LP interface */
+   /* call LP interface, which reads the coefficients of the rows through lpGetAddedRowVec() */
    SCIPsetDebugMsg(set, "flushing row additions: enlarge LP from %d to %d rows\n", lp->nlpirows, lp->nrows);
-   SCIP_CALL( SCIPlpiAddRows(lp->lpi, naddrows, lhs, rhs, name, nnonz, beg, ind, val) );
+   SCIP_CALL( SCIPlpiAddRowsCallback(lp->lpi, naddrows, lhs, rhs, name, naddcoefs, maxlen, lpGetAddedRowVec,
+         (void*)lp) );
    lp->nlpirows = lp->nrows;
    lp->lpifirstchgrow = lp->nlpirows;
 
    /* free temporary memory */
    SCIPsetFreeBufferArray(set, &name);
-   SCIPsetFreeBufferArray(set, &val);
-   SCIPsetFreeBufferArray(set, &ind);
-   SCIPsetFreeBufferArray(set, &beg);
    SCIPsetFreeBufferArray(set, &rhs);
    SCIPsetFreeBufferArray(set, &lhs);
 
@@ -8371,7 +8449,68 @@ SCIP_RETCODE lpFlushAddRows(
    return SCIP_OKAY;
 }
 
-/** applies all cached column bound and objective changes to the LP */
+/** sorts the LP solver positions of cached changes increasingly
+ *
+ *  If the changes are dense within the range of positions that they touch (the dirty range), the positions are sorted by
+ *  a single sweep over this range, otherwise by a comparison sort. In both cases, the effort is independent of the LP
+ *  size.
+ */
+static
+SCIP_RETCODE sortChgPositions(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   int*                  pos,                /**< LP solver positions of changes */
+   int                   npos,               /**< number of changes */
+   int                   firstpos,           /**< smallest position of the dirty range */
+   int                   lastpos             /**< largest position of the dirty range */
+   )
+{
+   assert(pos != NULL || npos == 0);
+   assert(npos <= 1 || firstpos <= lastpos);
+
+   if( npos <= 1 )
+      return SCIP_OKAY;
+
+   if( lastpos - firstpos < DIRTYRANGEFAC * npos )
+   {
+      SCIP_Bool* changed;
+      int nrange;
+      int k;
+
+      nrange = lastpos - firstpos + 1;
+      SCIP_CALL( SCIPsetAllocCleanBufferArray(set, &changed, nrange) );
+
+      for( k = 0; k < npos; ++k )
+      {
+         assert(firstpos <= pos[k] && pos[k] <= lastpos);
+         changed[pos[k] - firstpos] = TRUE;
+      }
+
+      npos = 0;
+      for( k = 0; k < nrange; ++k )
+      {
+         if( changed[k] )
+         {
+            pos[npos] = firstpos + k;
+            ++npos;
+            changed[k] = FALSE;
+         }
+      }
+
+      SCIPsetFreeCleanBufferArray(set, &changed);
+   }
+   else
+      SCIPsortInt(pos, npos);
+
+   return SCIP_OKAY;
+}
+
+/** applies all cached column bound and objective changes to the LP
+ *
+ *  Every column appears at most once in the list of changed columns, no matter how often its data changed since the
+ *  last flush, e.g., during a node switch. Only the difference to the data stored in the LP solver is transferred, such
+ *  that the changes of a node switch along the same path cancel out. The remaining changes are passed in one call per
+ *  kind and sorted by LP solver position, so the effort is proportional to the number of changed columns.
+ */
 static
 SCIP_RETCODE lpFlushChgCols(
    SCIP_LP*              lp,                 /**< current LP data */
@@ -8388,6 +8527,8 @@ SCIP_RETCODE lpFlushChgCols(
    SCIP_Real* lb;
    SCIP_Real* ub;
    SCIP_Real lpiinf;
+   int firstpos;
+   int lastpos;
    int nobjchg;
    int nbdchg;
    int i;
@@ -8401,13 +8542,17 @@ SCIP_RETCODE lpFlushChgCols(
    lpiinf = SCIPlpiInfinity(lp->lpi);
 
    /* get temporary memory for changes */
-   SCIP_CALL( SCIPsetAllocBufferArray(set, &objind, lp->ncols) );
-   SCIP_CALL( SCIPsetAllocBufferArray(set, &obj, lp->ncols) );
-   SCIP_CALL( SCIPsetAllocBufferArray(set, &bdind, lp->ncols) );
-   SCIP_CALL( SCIPsetAllocBufferArray(set, &lb, lp->ncols) );
-   SCIP_CALL( SCIPsetAllocBufferArray(set, &ub, lp->ncols) );
-
-   /* collect all cached bound and objective changes */
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &objind, lp->nchgcols) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &obj, lp->nchgcols) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &bdind, lp->nchgcols) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &lb, lp->nchgcols) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &ub, lp->nchgcols) );
+
+   /* collect the positions of all cached bound and objective changes that differ from the LP solver's data, and the
+    * dirty range of positions they touch
+    */
+   firstpos = INT_MAX;
+   lastpos = -1;
    nobjchg = 0;
    nbdchg = 0;
    for( i = 0; i < lp->nchgcols; ++i )
@@ -8445,10 +8590,11 @@ SCIP_RETCODE lpFlushChgCols(
             newobj = col->obj;
             if( col->flushedobj != newobj ) /*lint !e777*/
             {
-               assert(nobjchg < lp->ncols);
+               assert(nobjchg < lp->nchgcols);
                objind[nobjchg] = col->lpipos;
-               obj[nobjchg] = newobj;
                nobjchg++;
+               firstpos = MIN(firstpos, col->lpipos);
+               lastpos = MAX(lastpos, col->lpipos);
                col->flushedobj = newobj;
             }
             col->objchanged = FALSE;
@@ -8464,11 +8610,11 @@ SCIP_RETCODE lpFlushChgCols(
 
             if( col->flushedlb != newlb || col->flushedub != newub ) /*lint !e777*/
             {
-               assert(nbdchg < lp->ncols);
+               assert(nbdchg < lp->nchgcols);
                bdind[nbdchg] = col->lpipos;
-               lb[nbdchg] = newlb;
-               ub[nbdchg] = newub;
                nbdchg++;
+               firstpos = MIN(firstpos, col->lpipos);
+               lastpos = MAX(lastpos, col->lpipos);
                col->flushedlb = newlb;
                col->flushedub = newub;
             }
@@ -8482,6 +8628,11 @@ SCIP_RETCODE lpFlushChgCols(
    /* change objective values in LP */
    if( nobjchg > 0 )
    {
+      SCIP_CALL( sortChgPositions(set, objind, nobjchg, firstpos, lastpos) );
+
+      for( i = 0; i < nobjchg; ++i )
+         obj[i] = lp->lpicols[objind[i]]->flushedobj;
+
       SCIPsetDebugMsg(set, "flushing objective changes: change %d objective values of %d changed columns\n", nobjchg, lp->nchgcols);
       SCIP_CALL( SCIPlpiChgObj(lp->lpi, nobjchg, objind, obj) );
 
@@ -8496,6 +8647,15 @@ SCIP_RETCODE lpFlushChgCols(
    /* change bounds in LP */
    if( nbdchg > 0 )
    {
+      SCIP_CALL( sortChgPositions(set, bdind, nbdchg, firstpos, lastpos) );
+
+      for( i = 0; i < nbdchg; ++i )
+      {
+         col = lp->lpicols[bdind[i]];
+         lb[i] = col->flushedlb;
+         ub[i] = col->flushedub;
+      }
+
       SCIPsetDebugMsg(set, "flushing bound changes: change %d bounds of %d changed columns\n", nbdchg, lp->nchgcols);
       SCIP_CALL( SCIPlpiChgBounds(lp->lpi, nbdchg, bdind, lb, ub) );
 
@@ -8519,7 +8679,11 @@ SCIP_RETCODE lpFlushChgCols(
    return SCIP_OKAY;
 }
 
-/** applies all cached row side changes to the LP */
+/** applies all cached row side changes to the LP
+ *
+ *  As for the columns, only the sides that differ from the LP solver's data are transferred, in one call and sorted by
+ *  LP solver position.
+ */
 static
 SCIP_RETCODE lpFlushChgRows(
    SCIP_LP*              lp,                 /**< current LP data */
@@ -8534,6 +8698,8 @@ SCIP_RETCODE lpFlushChgRows(
    SCIP_Real* lhs;
    SCIP_Real* rhs;
    SCIP_Real lpiinf;
+   int firstpos;
+   int lastpos;
    int i;
    int nchg;
 
@@ -8546,11 +8712,15 @@ SCIP_RETCODE lpFlushChgRows(
    lpiinf = SCIPlpiInfinity(lp->lpi);
 
    /* get temporary memory for changes */
-   SCIP_CALL( SCIPsetAllocBufferArray(set, &ind, lp->nrows) );
-   SCIP_CALL( SCIPsetAllocBufferArray(set, &lhs, lp->nrows) );
-   SCIP_CALL( SCIPsetAllocBufferArray(set, &rhs, lp->nrows) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &ind, lp->nchgrows) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &lhs, lp->nchgrows) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &rhs, lp->nchgrows) );
 
-   /* collect all cached left and right hand side changes */
+   /* collect the positions of all cached left and right hand side changes that differ from the LP solver's data, and
+    * the dirty range of positions they touch
+    */
+   firstpos = INT_MAX;
+   lastpos = -1;
    nchg = 0;
    for( i = 0; i < lp->nchgrows; ++i )
    {
@@ -8580,11 +8750,11 @@ SCIP_RETCODE lpFlushChgRows(
             newrhs = (SCIPsetIsInfinity(set, row->rhs) ? lpiinf : row->rhs - row->constant);
             if( row->flushedlhs != newlhs || row->flushedrhs != newrhs ) /*lint !e777*/
             {
-               assert(nchg < lp->nrows);
+               assert(nchg < lp->nchgrows);
                ind[nchg] = row->lpipos;
-               lhs[nchg] = newlhs;
-               rhs[nchg] = newrhs;
                nchg++;
+               firstpos = MIN(firstpos, row->lpipos);
+               lastpos = MAX(lastpos, row->lpipos);
                row->flushedlhs = newlhs;
                row->flushedrhs = newrhs;
             }
@@ -8597,6 +8767,15 @@ SCIP_RETCODE lpFlushChgRows(
    /* change left and right hand sides in LP */
    if( nchg > 0 )
    {
+      SCIP_CALL( sortChgPositions(set, ind, nchg, firstpos, lastpos) );
+
+      for( i = 0; i < nchg; ++i )
+      {
+         row = lp->lpirows[ind[i]];
+         lhs[i] = row->flushedlhs;
+         rhs[i] = row->flushedrhs;
+      }
+
       SCIPsetDebugMsg(set, "flushing side changes: change %d sides of %d rows\n", nchg, lp->nchgrows);
       SCIP_CALL( SCIPlpiChgSides(lp->lpi, nchg, ind, lhs, rhs) );
 
@@ -8730,6 +8909,136 @@ SCIP_RETCODE SCIPlpFlush(
    return SCIP_OKAY;
 }
 
+/** sets parameter of type int in a copy of the LP solver, ignoring unknown parameters */
+static
+SCIP_RETCODE lpiCopySetIntpar(
+   SCIP_LPI*             lpi,                /**< LP solver interface */
+   SCIP_LPPARAM          lpparam,            /**< LP parameter */
+   int                   value               /**< value to set parameter to */
+   )
+{
+   SCIP_RETCODE retcode;
+
+   retcode = SCIPlpiSetIntpar(lpi, lpparam, value);
+
+   return (retcode == SCIP_PARAMETERUNKNOWN ? SCIP_OKAY : retcode);
+}
+
+/** sets parameter of type SCIP_Real in a copy of the LP solver, ignoring unknown parameters */
+static
+SCIP_RETCODE lpiCopySetRealpar(
+   SCIP_LPI*             lpi,                /**< LP solver interface */
+   SCIP_LPPARAM          lpparam,            /**< LP parameter */
+   SCIP_Real             value               /**< value to set parameter to */
+   )
+{
+   SCIP_RETCODE retcode;
+
+   retcode = SCIPlpiSetRealpar(lpi, lpparam, value);
+
+   return (retcode == SCIP_PARAMETERUNKNOWN ? SCIP_OKAY : retcode);
+}
+
+/** creates a copy of the flushed LP in a new LP solver interface; the copy uses the tolerances, scaling, and presolving
+ *  settings that are currently set in the LP solver of the LP, but no starting basis
+ *
+ *  @note the copy has to be freed with SCIPlpiFree() by the caller
+ */
+SCIP_RETCODE SCIPlpCreateLPICopy(
+   SCIP_LP*              lp,                 /**< current LP data */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_MESSAGEHDLR*     messagehdlr,        /**< message handler */
+   const char*           name,               /**< name of the LP copy */
+   SCIP_Bool             copyobj,            /**< should the objective of the columns be copied? otherwise, the
+                                              *   objective of the copy is zero */
+   SCIP_LPI**            lpicopy             /**< pointer to store the copy of the LP solver interface */
+   )
+{
+   SCIP_OBJSEN objsen;
+   SCIP_RETCODE retcode;
+   SCIP_Real* obj = NULL;
+   SCIP_Real* lb = NULL;
+   SCIP_Real* ub = NULL;
+   SCIP_Real* lhs = NULL;
+   SCIP_Real* rhs = NULL;
+   SCIP_Real* val = NULL;
+   int* beg = NULL;
+   int* ind = NULL;
+   int ncols;
+   int nrows;
+   int nnonz;
+
+   assert(lp != NULL);
+   assert(lp->flushed);
+   assert(lp->lpi != NULL);
+   assert(set != NULL);
+   assert(name != NULL);
+   assert(lpicopy != NULL);
+
+   *lpicopy = NULL;
+   retcode = SCIP_OKAY;
+
+   SCIP_CALL( SCIPlpiGetNCols(lp->lpi, &ncols) );
+   SCIP_CALL( SCIPlpiGetNRows(lp->lpi, &nrows) );
+   SCIP_CALL( SCIPlpiGetNNonz(lp->lpi, &nnonz) );
+   SCIP_CALL( SCIPlpiGetObjsen(lp->lpi, &objsen) );
+
+   SCIP_CALL_TERMINATE( retcode, SCIPsetAllocBufferArray(set, &obj, ncols), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPsetAllocBufferArray(set, &lb, ncols), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPsetAllocBufferArray(set, &ub, ncols), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPsetAllocBufferArray(set, &beg, ncols), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPsetAllocBufferArray(set, &lhs, nrows), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPsetAllocBufferArray(set, &rhs, nrows), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPsetAllocBufferArray(set, &ind, nnonz), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPsetAllocBufferArray(set, &val, nnonz), TERMINATE );
+
+   if( ncols > 0 )
+   {
+      if( copyobj )
+      {
+         SCIP_CALL_TERMINATE( retcode, SCIPlpiGetObj(lp->lpi, 0, ncols-1, obj), TERMINATE );
+      }
+      else
+         BMSclearMemoryArray(obj, ncols);
+      SCIP_CALL_TERMINATE( retcode, SCIPlpiGetCols(lp->lpi, 0, ncols-1, lb, ub, &nnonz, beg, ind, val), TERMINATE );
+   }
+   if( nrows > 0 )
+   {
+      SCIP_CALL_TERMINATE( retcode, SCIPlpiGetSides(lp->lpi, 0, nrows-1, lhs, rhs), TERMINATE );
+   }
+
+   SCIP_CALL_TERMINATE( retcode, SCIPlpiCreate(lpicopy, messagehdlr, name, objsen), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, SCIPlpiLoadColLP(*lpicopy, objsen, ncols, obj, lb, ub, NULL, nrows, lhs, rhs, NULL,
+         nnonz, beg, ind, val), TERMINATE );
+
+   /* transfer the settings of the LP solver */
+   SCIP_CALL_TERMINATE( retcode, lpiCopySetRealpar(*lpicopy, SCIP_LPPAR_FEASTOL, lp->lpifeastol), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, lpiCopySetRealpar(*lpicopy, SCIP_LPPAR_DUALFEASTOL, lp->lpidualfeastol), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, lpiCopySetRealpar(*lpicopy, SCIP_LPPAR_BARRIERCONVTOL, lp->lpibarrierconvtol), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, lpiCopySetIntpar(*lpicopy, SCIP_LPPAR_SCALING, lp->lpiscaling), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, lpiCopySetIntpar(*lpicopy, SCIP_LPPAR_PRESOLVING, lp->lpipresolving), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, lpiCopySetIntpar(*lpicopy, SCIP_LPPAR_LPINFO, FALSE), TERMINATE );
+   SCIP_CALL_TERMINATE( retcode, lpiCopySetIntpar(*lpicopy, SCIP_LPPAR_THREADS, 1), TERMINATE );
+
+TERMINATE:
+   if( retcode != SCIP_OKAY && *lpicopy != NULL )
+   {
+      (void) SCIPlpiFree(lpicopy);
+      *lpicopy = NULL;
+   }
+
+   BMSfreeBufferMemoryArrayNull(set->buffer, &val);
+   BMSfreeBufferMemoryArrayNull(set->buffer, &ind);
+   BMSfreeBufferMemoryArrayNull(set->buffer, &rhs);
+   BMSfreeBufferMemoryArrayNull(set->buffer, &lhs);
+   BMSfreeBufferMemoryArrayNull(set->buffer, &beg);
+   BMSfreeBufferMemoryArrayNull(set->buffer, &ub);
+   BMSfreeBufferMemoryArrayNull(set->buffer, &lb);
+   BMSfreeBufferMemoryArrayNull(set->buffer, &obj);
+
+   return retcode;
+}
+
 /** marks the LP to be flushed, even if the LP thinks it is not flushed */
 SCIP_RETCODE SCIPlpMarkFlushed(
    SCIP_LP*              lp,                 /**< current LP data */
@@ -9123,6 +9432,8 @@ SCIP_RETCODE SCIPlpCreate(
    (*lp)->feastol = SCIP_INVALID; /* to have it initialized */
    SCIPlpResetFeastol(*lp, set);
    (*lp)->validdegeneracylp = -1;
+   (*lp)->deferredcleanupnode = -1;
+   (*lp)->ndeferredobsoletes = 0;
    (*lp)->objsqrnorm = 0.0;
    (*lp)->objsumnorm = 0.0;
    (*lp)->lpicolssize = 0;
@@ -9139,6 +9450,13 @@ SCIP_RETCODE SCIPlpCreate(
    (*lp)->rowssize = 0;
    (*lp)->nrows = 0;
    (*lp)->chgcolssize = 0;
+   (*lp)->tabcachebinvrows = NULL;
+   (*lp)->tabcachebinvarows = NULL;
+   (*lp)->tabcachestamp = -1;
+   (*lp)->lpistamp = 0;
+   (*lp)->tabcachememsize = 0;
+   (*lp)->tabcachenrows = 0;
+   (*lp)->tabcachencols = 0;
    (*lp)->nchgcols = 0;
    (*lp)->chgrowssize = 0;
    (*lp)->nchgrows = 0;
@@ -9400,6 +9718,9 @@ SCIP_RETCODE SCIPlpFree(
    BMSfreeMemoryArrayNull(&(*lp)->lpirows);
    BMSfreeMemoryArrayNull(&(*lp)->chgcols);
    BMSfreeMemoryArrayNull(&(*lp)->chgrows);
+   lpClearTableauCache(*lp, blkmem);
+   BMSfreeMemoryArrayNull(&(*lp)->tabcachebinvarows);
+   BMSfreeMemoryArrayNull(&(*lp)->tabcachebinvrows);
    BMSfreeMemoryArrayNull(&(*lp)->lazycols);
    BMSfreeMemoryArrayNull(&(*lp)->cols);
    BMSfreeMemoryArrayNull(&(*lp)->rows);
@@ -9846,61 +10167,197 @@ SCIP_RETCODE SCIPlpGetBase(
    return SCIP_OKAY;
 }
 
-/** gets a row from the inverse basis matrix B^-1 */
-SCIP_RETCODE SCIPlpGetBInvRow(
-   SCIP_LP*              lp,                 /**< LP data */
-   int                   r,                  /**< row number */
-   SCIP_Real*            coef,               /**< pointer to store the coefficients of the row */
-   int*                  inds,               /**< array to store the non-zero indices, or NULL */
-   int*                  ninds               /**< pointer to store the number of non-zero indices, or NULL
-                                              *   (-1: if we do not store sparsity informations) */
+/** makes sure that the tableau row cache belongs to the current state of the LP solver; the cache is emptied whenever
+ *  the LP was solved again or a basis was loaded since the rows were stored, such that all callers working on the same
+ *  LP solution share the computed tableau rows
+ */
+static
+SCIP_RETCODE lpValidateTableauCache(
+   SCIP_LP*              lp,                 /**< current LP data */
+   BMS_BLKMEM*           blkmem              /**< block memory */
    )
 {
    assert(lp != NULL);
-   assert(lp->flushed);
-   assert(lp->solved);
-   assert(lp->solisbasic);
-   assert(0 <= r && r < lp->nrows);  /* the basis matrix is nrows x nrows */
-   assert(coef != NULL);
 
-   SCIP_CALL( SCIPlpiGetBInvRow(lp->lpi, r, coef, inds, ninds) );
+   if( lp->tabcachestamp == lp->lpistamp && lp->tabcachenrows == lp->nrows && lp->tabcachencols == lp->ncols )
+      return SCIP_OKAY;
+
+   lpClearTableauCache(lp, blkmem);
+
+   if( lp->nrows != lp->tabcachenrows )
+   {
+      SCIP_ALLOC( BMSreallocMemoryArray(&lp->tabcachebinvrows, MAX(lp->nrows, 1)) );
+      SCIP_ALLOC( BMSreallocMemoryArray(&lp->tabcachebinvarows, MAX(lp->nrows, 1)) );
+      lp->tabcachenrows = lp->nrows;
+   }
+   if( lp->nrows > 0 )
+   {
+      BMSclearMemoryArray(lp->tabcachebinvrows, lp->nrows);
+      BMSclearMemoryArray(lp->tabcachebinvarows, lp->nrows);
+   }
+   lp->tabcachencols = lp->ncols;
+   lp->tabcachestamp = lp->lpistamp;
 
    return SCIP_OKAY;
 }
 
-/** gets a column from the inverse basis matrix B^-1 */
-SCIP_RETCODE SCIPlpGetBInvCol(
-   SCIP_LP*              lp,                 /**< LP data */
-   int                   c,                  /**< column number of B^-1; this is NOT the number of the column in the LP
-                                              *   returned by SCIPcolGetLPPos(); you have to call SCIPgetBasisInd()
-                                              *   to get the array which links the B^-1 column numbers to the row and
-                                              *   column numbers of the LP! c must be between 0 and nrows-1, since the
-                                              *   basis has the size nrows * nrows */
-   SCIP_Real*            coef,               /**< pointer to store the coefficients of the column */
+/** copies a cached dense tableau row into the given arrays, computing the sparsity pattern if requested */
+static
+void lpCopyTableauCacheRow(
+   SCIP_Real*            cachedrow,          /**< cached dense row */
+   int                   len,                /**< length of the row */
+   SCIP_Real*            coef,               /**< array to store the coefficients of the row */
    int*                  inds,               /**< array to store the non-zero indices, or NULL */
-   int*                  ninds               /**< pointer to store the number of non-zero indices, or NULL
-                                              *   (-1: if we do not store sparsity informations) */
+   int*                  ninds               /**< pointer to store the number of non-zero indices, or NULL */
    )
 {
-   assert(lp != NULL);
-   assert(lp->flushed);
-   assert(lp->solved);
-   assert(lp->solisbasic);
-   assert(0 <= c && c < lp->nrows);  /* the basis matrix is nrows x nrows */
+   int i;
+
+   assert(cachedrow != NULL);
    assert(coef != NULL);
 
-   SCIP_CALL( SCIPlpiGetBInvCol(lp->lpi, c, coef, inds, ninds) );
+   BMScopyMemoryArray(coef, cachedrow, len);
 
-   return SCIP_OKAY;
+   if( ninds == NULL )
+      return;
+
+   if( inds == NULL )
+   {
+      *ninds = -1;
+      return;
+   }
+
+   *ninds = 0;
+   for( i = 0; i < len; ++i )
+   {
+      if( coef[i] != 0.0 )
+         inds[(*ninds)++] = i;
+   }
 }
 
-/** gets a row from the product of inverse basis matrix B^-1 and coefficient matrix A (i.e. from B^-1 * A) */
-SCIP_RETCODE SCIPlpGetBInvARow(
-   SCIP_LP*              lp,                 /**< LP data */
-   int                   r,                  /**< row number */
-   SCIP_Real*            binvrow,            /**< row in B^-1 from prior call to SCIPlpGetBInvRow(), or NULL */
-   SCIP_Real*            coef,               /**< pointer to store the coefficients of the row */
-   int*                  inds,               /**< array to store the non-zero indices, or NULL */
+/** stores a tableau row computed by the LP solver in the tableau row cache, unless the cache is full
+ *
+ *  The rows are stored in block memory, such that they count towards the memory usage of SCIP. The cache holds at most
+ *  SCIP_TABCACHE_MAXSIZE values and at most a fraction SCIP_TABCACHE_MEMFRAC of the memory limit; no rows are stored in
+ *  memory saving mode.
+ */
+static
+SCIP_RETCODE lpStoreTableauCacheRow(
+   SCIP_LP*              lp,                 /**< current LP data */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< problem statistics */
+   SCIP_Real**           cachedrow,          /**< pointer to the cache slot of the row */
+   int                   len,                /**< length of the row */
+   SCIP_Real*            coef,               /**< coefficients of the row as returned by the LP solver */
+   int*                  inds,               /**< non-zero indices as returned by the LP solver, or NULL */
+   int*                  ninds               /**< number of non-zero indices as returned by the LP solver, or NULL */
+   )
+{
+   SCIP_Real maxsize;
+   int i;
+
+   assert(lp != NULL);
+   assert(set != NULL);
+   assert(stat != NULL);
+   assert(cachedrow != NULL);
+   assert(*cachedrow == NULL);
+
+   if( len == 0 || stat->memsavemode )
+      return SCIP_OKAY;
+
+   maxsize = SCIP_TABCACHE_MEMFRAC * set->limit_memory * 1048576.0 / sizeof(SCIP_Real);
+   maxsize = MIN(maxsize, (SCIP_Real)SCIP_TABCACHE_MAXSIZE);
+   if( (SCIP_Real)(lp->tabcachememsize + len) > maxsize )
+      return SCIP_OKAY;
+
+   /* if the LP solver returned sparsity information, only the entries at the given indices are reliable */
+   if( inds != NULL && ninds != NULL && *ninds >= 0 )
+   {
+      SCIP_ALLOC( BMSallocClearBlockMemoryArray(blkmem, cachedrow, len) );
+      for( i = 0; i < *ninds; ++i )
+         (*cachedrow)[inds[i]] = coef[inds[i]];
+   }
+   else
+   {
+      SCIP_ALLOC( BMSduplicateBlockMemoryArray(blkmem, cachedrow, coef, len) );
+   }
+   lp->tabcachememsize += len;
+
+   return SCIP_OKAY;
+}
+
+/** gets a row from the inverse basis matrix B^-1 */
+SCIP_RETCODE SCIPlpGetBInvRow(
+   SCIP_LP*              lp,                 /**< LP data */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< problem statistics */
+   int                   r,                  /**< row number */
+   SCIP_Real*            coef,               /**< pointer to store the coefficients of the row */
+   int*                  inds,               /**< array to store the non-zero indices, or NULL */
+   int*                  ninds               /**< pointer to store the number of non-zero indices, or NULL
+                                              *   (-1: if we do not store sparsity informations) */
+   )
+{
+   assert(lp != NULL);
+   assert(lp->flushed);
+   assert(lp->solved);
+   assert(lp->solisbasic);
+   assert(0 <= r && r < lp->nrows);  /* the basis matrix is nrows x nrows */
+   assert(coef != NULL);
+
+   SCIP_CALL( lpValidateTableauCache(lp, blkmem) );
+
+   if( lp->tabcachebinvrows[r] != NULL )
+   {
+      lpCopyTableauCacheRow(lp->tabcachebinvrows[r], lp->nrows, coef, inds, ninds);
+      return SCIP_OKAY;
+   }
+
+   SCIP_CALL( SCIPlpiGetBInvRow(lp->lpi, r, coef, inds, ninds) );
+
+   SCIP_CALL( lpStoreTableauCacheRow(lp, blkmem, set, stat, &lp->tabcachebinvrows[r], lp->nrows, coef, inds, ninds) );
+
+   return SCIP_OKAY;
+}
+
+/** gets a column from the inverse basis matrix B^-1 */
+SCIP_RETCODE SCIPlpGetBInvCol(
+   SCIP_LP*              lp,                 /**< LP data */
+   int                   c,                  /**< column number of B^-1; this is NOT the number of the column in the LP
+                                              *   returned by SCIPcolGetLPPos(); you have to call SCIPgetBasisInd()
+                                              *   to get the array which links the B^-1 column numbers to the row and
+                                              *   column numbers of the LP! c must be between 0 and nrows-1, since the
+                                              *   basis has the size nrows * nrows */
+   SCIP_Real*            coef,               /**< pointer to store the coefficients of the column */
+   int*                  inds,               /**< array to store the non-zero indices, or NULL */
+   int*                  ninds               /**< pointer to store the number of non-zero indices, or NULL
+                                              *   (-1: if we do not store sparsity informations) */
+   )
+{
+   assert(lp != NULL);
+   assert(lp->flushed);
+   assert(lp->solved);
+   assert(lp->solisbasic);
+   assert(0 <= c && c < lp->nrows);  /* the basis matrix is nrows x nrows */
+   assert(coef != NULL);
+
+   SCIP_CALL( SCIPlpiGetBInvCol(lp->lpi, c, coef, inds, ninds) );
+
+   return SCIP_OKAY;
+}
+
+/** gets a row from the product of inverse basis matrix B^-1 and coefficient matrix A (i.e. from B^-1 * A) */
+SCIP_RETCODE SCIPlpGetBInvARow(
+   SCIP_LP*              lp,                 /**< LP data */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< problem statistics */
+   int                   r,                  /**< row number */
+   SCIP_Real*            binvrow,            /**< row in B^-1 from prior call to SCIPlpGetBInvRow(), or NULL */
+   SCIP_Real*            coef,               /**< pointer to store the coefficients of the row */
+   int*                  inds,               /**< array to store the non-zero indices, or NULL */
    int*                  ninds               /**< pointer to store the number of non-zero indices, or NULL
                                               *  (-1: if we do not store sparsity informations) */
    )
@@ -9912,8 +10369,61 @@ SCIP_RETCODE SCIPlpGetBInvARow(
    assert(0 <= r && r < lp->nrows);  /* the basis matrix is nrows x nrows */
    assert(coef != NULL);
 
+   SCIP_CALL( lpValidateTableauCache(lp, blkmem) );
+
+   if( lp->tabcachebinvarows[r] != NULL )
+   {
+      lpCopyTableauCacheRow(lp->tabcachebinvarows[r], lp->ncols, coef, inds, ninds);
+      return SCIP_OKAY;
+   }
+
+   /* use the cached row of B^-1 if the caller did not provide it */
+   if( binvrow == NULL )
+      binvrow = lp->tabcachebinvrows[r];
+
    SCIP_CALL( SCIPlpiGetBInvARow(lp->lpi, r, binvrow, coef, inds, ninds) );
 
+   SCIP_CALL( lpStoreTableauCacheRow(lp, blkmem, set, stat, &lp->tabcachebinvarows[r], lp->ncols, coef, inds, ninds) );
+
+   return SCIP_OKAY;
+}
+
+/** gets several rows of the product of inverse basis matrix B^-1 and coefficient matrix A at once
+ *
+ *  The rows are stored densely; rows that were already computed for the current LP solution are taken from the tableau
+ *  row cache, and the remaining ones are computed by the LP solver and added to the cache. Since the LP interface has no
+ *  method to solve for several right hand sides at once, the missing rows are computed one after the other.
+ */
+SCIP_RETCODE SCIPlpGetBInvARows(
+   SCIP_LP*              lp,                 /**< LP data */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< problem statistics */
+   int*                  rows,               /**< basis row numbers of the requested rows */
+   int                   nrows,              /**< number of requested rows */
+   SCIP_Real**           binvrows,           /**< array of nrows arrays to store the rows of B^-1, or NULL */
+   SCIP_Real**           binvarows           /**< array of nrows arrays to store the rows of B^-1 * A */
+   )
+{
+   int i;
+
+   assert(lp != NULL);
+   assert(rows != NULL || nrows == 0);
+   assert(binvarows != NULL || nrows == 0);
+
+   for( i = 0; i < nrows; ++i )
+   {
+      SCIP_Real* binvrow = NULL;
+
+      if( binvrows != NULL )
+      {
+         SCIP_CALL( SCIPlpGetBInvRow(lp, blkmem, set, stat, rows[i], binvrows[i], NULL, NULL) );
+         binvrow = binvrows[i];
+      }
+
+      SCIP_CALL( SCIPlpGetBInvARow(lp, blkmem, set, stat, rows[i], binvrow, binvarows[i], NULL, NULL) );
+   }
+
    return SCIP_OKAY;
 }
 
@@ -10082,6 +10592,7 @@ SCIP_RETCODE SCIPlpSetState(
       lp->solisbasic = FALSE;
    else
    {
+      lpInvalidateTableauCache(lp);
       SCIP_CALL( SCIPlpiSetState(lp->lpi, blkmem, lpistate) );
       lp->solisbasic = SCIPlpiHasStateBasis(lp->lpi, lpistate);
    }
@@ -10378,6 +10889,7 @@ SCIP_RETCODE lpPrimalSimplex(
    }
 
    /* call primal simplex */
+   lpInvalidateTableauCache(lp);
    retcode = SCIPlpiSolvePrimal(lp->lpi);
    if( retcode == SCIP_LPERROR )
    {
@@ -10536,6 +11048,7 @@ SCIP_RETCODE lpDualSimplex(
    }
 
    /* call dual simplex */
+   lpInvalidateTableauCache(lp);
    retcode = SCIPlpiSolveDual(lp->lpi);
    if( retcode == SCIP_LPERROR )
    {
@@ -10711,6 +11224,7 @@ SCIP_RETCODE lpLexDualSimplex(
    }
 
    /* call dual simplex for first lp */
+   lpInvalidateTableauCache(lp);
    retcode = SCIPlpiSolveDual(lp->lpi);
    if( retcode == SCIP_LPERROR )
    {
@@ -11082,6 +11596,7 @@ SCIP_RETCODE lpLexDualSimplex(
             SCIP_CALL( SCIPlpiChgSides(lp->lpi, cntrow, indrow, newlhs, newrhs) );
 
             /* solve with primal simplex, because we are primal feasible, but not necessarily dual feasible */
+            lpInvalidateTableauCache(lp);
             retcode = SCIPlpiSolvePrimal(lp->lpi);
             if( retcode == SCIP_LPERROR )
             {
@@ -11172,6 +11687,7 @@ SCIP_RETCODE lpLexDualSimplex(
       SCIP_CALL( SCIPlpiChgObj(lp->lpi, lp->nlpicols, indallcol, oldobj) );
 
       /* resolve to update solvers internal data structures - should only produce few pivots - is this needed? */
+      lpInvalidateTableauCache(lp);
       retcode = SCIPlpiSolveDual(lp->lpi);
       if( retcode == SCIP_LPERROR )
       {
@@ -11319,6 +11835,7 @@ SCIP_RETCODE lpBarrier(
    }
 
    /* call barrier algorithm */
+   lpInvalidateTableauCache(lp);
    retcode = SCIPlpiSolveBarrier(lp->lpi, crossover);
    if( retcode == SCIP_LPERROR )
    {
@@ -12209,6 +12726,251 @@ SCIP_RETCODE lpSolve(
    return SCIP_OKAY;
 }
 
+/** LP solver that takes part in the concurrent solve of the root LP */
+struct ConcurrentLpi
+{
+   SCIP_LPI*             lpi;                /**< copy of the LP solver interface */
+   struct ConcurrentLpRace* race;            /**< race this LP solver takes part in */
+   SCIP_LPALGO           lpalgo;             /**< LP algorithm that is applied to the copy */
+   int                   iterations;         /**< number of iterations of the solve */
+   int                   idx;                /**< index of the LP solver in the race */
+};
+typedef struct ConcurrentLpi CONCURRENTLPI;
+
+/** data shared by all LP solvers in the concurrent solve of the root LP */
+struct ConcurrentLpRace
+{
+   CONCURRENTLPI*        conclpis;           /**< LP solvers taking part in the race */
+   SCIP_LOCK*            lock;               /**< lock protecting the winner */
+   int                   nconclpis;          /**< number of LP solvers taking part in the race */
+   int                   winner;             /**< index of the first LP solver that found an optimal basis, or -1 */
+};
+typedef struct ConcurrentLpRace CONCURRENTLPRACE;
+
+/** job that solves one copy of the root LP; the first copy that finishes with an optimal basis interrupts all others */
+static
+SCIP_DECL_PARALLELJOB(solveConcurrentLpi)
+{
+   CONCURRENTLPI* conclpi;
+   CONCURRENTLPRACE* race;
+   SCIP_RETCODE retcode;
+   SCIP_Bool finished;
+   int i;
+
+   conclpi = (CONCURRENTLPI*) jobarg;
+   assert(conclpi != NULL);
+   assert(conclpi->lpi != NULL);
+
+   race = conclpi->race;
+   assert(race != NULL);
+
+   /* do not start if the race is already decided */
+   SCIP_CALL( SCIPtpiAcquireLock(race->lock) );
+   finished = (race->winner >= 0);
+   SCIP_CALL( SCIPtpiReleaseLock(race->lock) );
+
+   if( finished )
+      return SCIP_OKAY;
+
+   switch( conclpi->lpalgo )
+   {
+   case SCIP_LPALGO_PRIMALSIMPLEX:
+      retcode = SCIPlpiSolvePrimal(conclpi->lpi);
+      break;
+   case SCIP_LPALGO_DUALSIMPLEX:
+      retcode = SCIPlpiSolveDual(conclpi->lpi);
+      break;
+   case SCIP_LPALGO_BARRIERCROSSOVER:
+      retcode = SCIPlpiSolveBarrier(conclpi->lpi, TRUE);
+      break;
+   case SCIP_LPALGO_BARRIER:
+   default:
+      SCIPerrorMessage("invalid LP algorithm for concurrent root LP\n");
+      return SCIP_INVALIDDATA;
+   }
+
+   /* an LP error only means that this LP solver lost the race */
+   if( retcode == SCIP_LPERROR )
+      return SCIP_OKAY;
+   SCIP_CALL( retcode );
+
+   if( !SCIPlpiIsOptimal(conclpi->lpi) || !SCIPlpiIsStable(conclpi->lpi) )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPlpiGetIterations(conclpi->lpi, &conclpi->iterations) );
+
+   /* an error while interrupting the other LP solvers is only returned after the lock has been released */
+   SCIP_CALL( SCIPtpiAcquireLock(race->lock) );
+   if( race->winner < 0 )
+   {
+      race->winner = conclpi->idx;
+
+      for( i = 0; i < race->nconclpis && retcode == SCIP_OKAY; ++i )
+      {
+         if( i != conclpi->idx )
+            retcode = SCIPlpiInterrupt(race->conclpis[i].lpi, TRUE);
+      }
+   }
+   SCIP_CALL( SCIPtpiReleaseLock(race->lock) );
+
+   return retcode;
+}
+
+/** solves copies of the initial root LP concurrently with different LP algorithms and loads the basis of the first LP
+ *  solver that finishes into the LP solver of the LP; the winning basis is always a simplex basis, because barrier is
+ *  only raced with crossover
+ */
+static
+SCIP_RETCODE lpSolveConcurrentRoot(
+   SCIP_LP*              lp,                 /**< current LP data */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_MESSAGEHDLR*     messagehdlr,        /**< message handler */
+   SCIP_STAT*            stat,               /**< problem statistics */
+   SCIP_Bool*            success             /**< pointer to store whether a starting basis was loaded */
+   )
+{
+   CONCURRENTLPRACE race;
+   CONCURRENTLPI* conclpis;
+   void** jobargs;
+   SCIP_Real lptimelimit;
+   SCIP_RETCODE retcode;
+   const char* algos;
+   int nthreads;
+   int nalgos;
+   int i;
+
+   assert(lp != NULL);
+   assert(lp->flushed);
+   assert(set != NULL);
+   assert(stat != NULL);
+   assert(success != NULL);
+
+   *success = FALSE;
+
+   algos = set->lp_concurrentalgos;
+   nalgos = (int) strlen(algos);
+   nthreads = MIN(nalgos, set->parallel_maxnthreads);
+
+   /* a race needs at least two participants that really run in parallel */
+   if( nthreads <= 1 || !SCIPconcurrentCanExecJobsParallel(nthreads) )
+      return SCIP_OKAY;
+
+   /* as for lp/initalgorithm, 'c' denotes barrier with crossover; barrier without crossover is not raced, since it does
+    * not provide a basis, and every algorithm may be raced only once, since copies with the same algorithm would only
+    * duplicate work
+    */
+   for( i = 0; i < nalgos; ++i )
+   {
+      if( strchr("pdc", algos[i]) == NULL )
+      {
+         SCIPerrorMessage("invalid LP algorithm <%c> in parameter lp/concurrentalgos\n", algos[i]);
+         return SCIP_PARAMETERWRONGVAL;
+      }
+      if( strchr(&algos[i+1], algos[i]) != NULL )
+      {
+         SCIPerrorMessage("LP algorithm <%c> appears more than once in parameter lp/concurrentalgos\n", algos[i]);
+         return SCIP_PARAMETERWRONGVAL;
+      }
+   }
+
+   lptimelimit = SCIPlpiInfinity(lp->lpi);
+   if( set->istimelimitfinite )
+   {
+      lptimelimit = set->limit_time - SCIPclockGetTime(stat->solvingtime);
+      if( lptimelimit <= 0.0 )
+         return SCIP_OKAY;
+   }
+
+   SCIPclockStart(stat->concurrentlptime, set);
+
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &conclpis, nthreads) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &jobargs, nthreads) );
+   SCIP_CALL( SCIPtpiInitLock(&race.lock) );
+   race.conclpis = conclpis;
+   race.nconclpis = nthreads;
+   race.winner = -1;
+
+   /* the LP solver copies are created and freed in the calling thread; only the solves run in parallel */
+   for( i = 0; i < nthreads; ++i )
+   {
+      switch( algos[i] )
+      {
+      case 'p':
+         conclpis[i].lpalgo = SCIP_LPALGO_PRIMALSIMPLEX;
+         break;
+      case 'd':
+         conclpis[i].lpalgo = SCIP_LPALGO_DUALSIMPLEX;
+         break;
+      default:
+         assert(algos[i] == 'c');
+         conclpis[i].lpalgo = SCIP_LPALGO_BARRIERCROSSOVER;
+         break;
+      }
+
+      SCIP_CALL( SCIPlpCreateLPICopy(lp, set, messagehdlr, "concurrentlp", TRUE, &conclpis[i].lpi) );
+      if( lptimelimit < SCIPlpiInfinity(lp->lpi) )
+      {
+         SCIP_CALL( lpiCopySetRealpar(conclpis[i].lpi, SCIP_LPPAR_LPTILIM, lptimelimit) );
+      }
+      SCIP_CALL( lpiCopySetIntpar(conclpis[i].lpi, SCIP_LPPAR_RANDOMSEED,
+            (int) (SCIPsetInitializeRandomSeed(set, (unsigned) (set->random_randomseed + i)) % INT_MAX)) );
+
+      conclpis[i].race = &race;
+      conclpis[i].iterations = 0;
+      conclpis[i].idx = i;
+      jobargs[i] = (void*) &conclpis[i];
+   }
+
+   retcode = SCIPconcurrentExecJobs(nthreads, solveConcurrentLpi, jobargs, nthreads);
+
+   /* warm start the LP solver of the LP from the basis of the winner */
+   if( retcode == SCIP_OKAY && race.winner >= 0 )
+   {
+      CONCURRENTLPI* winner;
+      int* cstat;
+      int* rstat;
+
+      winner = &conclpis[race.winner];
+
+      SCIP_CALL( SCIPsetAllocBufferArray(set, &cstat, lp->nlpicols) );
+      SCIP_CALL( SCIPsetAllocBufferArray(set, &rstat, lp->nlpirows) );
+
+      SCIP_CALL( SCIPlpiGetBase(winner->lpi, cstat, rstat) );
+      lpInvalidateTableauCache(lp);
+      SCIP_CALL( SCIPlpiSetBase(lp->lpi, cstat, rstat) );
+
+      SCIPsetFreeBufferArray(set, &rstat);
+      SCIPsetFreeBufferArray(set, &cstat);
+
+      SCIPstatIncrement(stat, set, nconcurrentlps);
+      SCIPstatAdd(stat, set, nconcurrentlpiterations, winner->iterations);
+
+      SCIPmessagePrintVerbInfo(messagehdlr, set->disp_verblevel, SCIP_VERBLEVEL_HIGH,
+         "concurrent root LP: %s finished first after %d iterations\n", lpalgoName(winner->lpalgo), winner->iterations);
+
+      *success = TRUE;
+   }
+
+   for( i = nthreads - 1; i >= 0; --i )
+   {
+      SCIP_CALL( SCIPlpiFree(&conclpis[i].lpi) );
+   }
+
+   SCIPtpiDestroyLock(&race.lock);
+   SCIPsetFreeBufferArray(set, &jobargs);
+   SCIPsetFreeBufferArray(set, &conclpis);
+
+   SCIPclockStop(stat->concurrentlptime, set);
+
+   /* errors in the LP solver copies are not fatal, since the LP is solved regularly in this case */
+   if( retcode != SCIP_OKAY && retcode != SCIP_LPERROR )
+   {
+      SCIP_CALL( retcode );
+   }
+
+   return SCIP_OKAY;
+}
+
 /** flushes the LP and solves it with the primal or dual simplex algorithm, depending on the current basis feasibility */
 static
 SCIP_RETCODE lpFlushAndSolve(
@@ -12247,6 +13009,22 @@ SCIP_RETCODE lpFlushAndSolve(
    resolve = lp->solisbasic && (lp->dualfeasible || lp->primalfeasible) && !fromscratch;
    algo = resolve ? set->lp_resolvealgorithm : set->lp_initalgorithm;
 
+   /* solve the initial root LP concurrently with several LP algorithms and warm start from the basis of the winner */
+   if( set->lp_concurrentroot && !resolve && !fromscratch && stat->nnodes == 1 && !lp->diving && !lp->probing
+      && lp->looseobjvalinf == 0 && lp->ncols > 0 && lp->nrows > 0 )
+   {
+      SCIP_Bool success;
+
+      SCIP_CALL( lpSolveConcurrentRoot(lp, set, messagehdlr, stat, &success) );
+
+      /* the loaded basis is optimal, which is verified by the primal simplex without iterations */
+      if( success )
+      {
+         resolve = TRUE;
+         algo = 'p';
+      }
+   }
+
    switch( algo )
    {
    case 's':
@@ -12561,7 +13339,17 @@ SCIP_RETCODE SCIPlpSolveAndEval(
             SCIP_CALL( SCIPlpUpdateAges(lp, stat) );
             if( stat->nlps % ((set->lp_rowagelimit+1)/2 + 1) == 0 ) /*lint !e776*/
             {
-               SCIP_CALL( SCIPlpRemoveNewObsoletes(lp, blkmem, set, stat, eventqueue, eventfilter) );
+               /* deleting rows invalidates the factorization of the LP solver, such that we may postpone their
+                * removal to the next node switch
+                */
+               if( set->lp_deferrowcleanup )
+               {
+                  SCIP_CALL( SCIPlpDeferNewObsoletes(lp, set, stat) );
+               }
+               else
+               {
+                  SCIP_CALL( SCIPlpRemoveNewObsoletes(lp, blkmem, set, stat, eventqueue, eventfilter) );
+               }
             }
 
             if( !lp->solved )
@@ -15570,6 +16358,24 @@ SCIP_RETCODE lpRemoveObsoleteCols(
    return SCIP_OKAY;
 }
 
+/** returns whether the given LP row is a removable basic row that is too old */
+static
+SCIP_Bool rowIsObsolete(
+   SCIP_ROW*             row,                /**< LP row */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat                /**< problem statistics */
+   )
+{
+   assert(row != NULL);
+   assert(set != NULL);
+   assert(stat != NULL);
+
+   return row->removable
+      && row->obsoletenode != stat->nnodes  /* don't remove row a second time from same node (avoid cycling), or a first time if marked nonremovable locally */
+      && row->age > set->lp_rowagelimit
+      && (SCIP_BASESTAT)row->basisstatus == SCIP_BASESTAT_BASIC;
+}
+
 /** removes all basic rows, that are too old, beginning with the given firstrow */
 static
 SCIP_RETCODE lpRemoveObsoleteRows(
@@ -15619,10 +16425,7 @@ SCIP_RETCODE lpRemoveObsoleteRows(
       assert(rows[r] == lpirows[r]);
       assert(rows[r]->lppos == r);
       assert(rows[r]->lpipos == r);
-      if( rows[r]->removable
-         && rows[r]->obsoletenode != stat->nnodes  /* don't remove row a second time from same node (avoid cycling), or a first time if marked nonremovable locally */
-         && rows[r]->age > set->lp_rowagelimit
-         && (SCIP_BASESTAT)rows[r]->basisstatus == SCIP_BASESTAT_BASIC )
+      if( rowIsObsolete(rows[r], set, stat) )
       {
          rowdstat[r] = 1;
          ndelrows++;
@@ -15678,6 +16481,139 @@ SCIP_RETCODE SCIPlpRemoveNewObsoletes(
    return SCIP_OKAY;
 }
 
+/** removes all non-basic columns in the part of the LP created at the current node, that are too old, and marks the
+ *  current node for a deferred removal of the obsolete basic rows, which is performed by
+ *  SCIPlpRemoveDeferredObsoletes() when the focus node is converted into a fork or pseudofork, and which is dropped by
+ *  SCIPlpDiscardDeferredObsoletes() when the rows of the focus node are removed from the LP anyway
+ *
+ *  Removing rows from the LP solver invalidates its factorization; at a node switch, the LP is resolved anyway.
+ */
+SCIP_RETCODE SCIPlpDeferNewObsoletes(
+   SCIP_LP*              lp,                 /**< current LP data */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat                /**< problem statistics */
+   )
+{
+   int nobsoletes;
+   int r;
+
+   assert(lp != NULL);
+   assert(lp->solved);
+   assert(!lp->diving);
+   assert(SCIPlpGetSolstat(lp) == SCIP_LPSOLSTAT_OPTIMAL);
+   assert(set != NULL);
+   assert(stat != NULL);
+
+   if( lp->firstnewcol < lp->ncols )
+   {
+      SCIP_CALL( lpRemoveObsoleteCols(lp, set, stat, lp->firstnewcol) );
+   }
+
+   /* nothing to do, if lpRemoveObsoleteRows() would not remove any row */
+   if( lp->nremovablerows == 0 || set->lp_rowagelimit == -1 || !lp->solisbasic )
+      return SCIP_OKAY;
+
+   nobsoletes = 0;
+   for( r = lp->firstnewrow; r < lp->nrows; ++r )
+   {
+      if( rowIsObsolete(lp->rows[r], set, stat) )
+         ++nobsoletes;
+   }
+
+   if( nobsoletes == 0 )
+      return SCIP_OKAY;
+
+   if( lp->deferredcleanupnode != stat->nnodes )
+   {
+      SCIPsetDebugMsg(set, "deferring removal of %d obsolete rows starting with %d/%d\n", nobsoletes, lp->firstnewrow,
+         lp->nrows);
+
+      lp->deferredcleanupnode = stat->nnodes;
+      lp->ndeferredobsoletes = nobsoletes;
+      SCIPstatIncrement(stat, set, nrowremovalsdeferred);
+   }
+   else if( nobsoletes > lp->ndeferredobsoletes )
+   {
+      /* without deferring, the rows that became obsolete since the last call would be removed now, which would
+       * invalidate the factorization once more
+       */
+      lp->ndeferredobsoletes = nobsoletes;
+      SCIPstatIncrement(stat, set, navoidedrowrefactors);
+   }
+
+   return SCIP_OKAY;
+}
+
+/** removes the obsolete basic rows in the part of the LP created at the current node, if their removal was deferred
+ *  by SCIPlpDeferNewObsoletes() at the current node; if the LP is not solved to optimality anymore, the pending removal
+ *  is dropped, because the basic rows cannot be identified
+ */
+SCIP_RETCODE SCIPlpRemoveDeferredObsoletes(
+   SCIP_LP*              lp,                 /**< current LP data */
+   BMS_BLKMEM*           blkmem,             /**< block memory buffers */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< problem statistics */
+   SCIP_EVENTQUEUE*      eventqueue,         /**< event queue */
+   SCIP_EVENTFILTER*     eventfilter         /**< global event filter */
+   )
+{
+   int oldnrows;
+
+   assert(lp != NULL);
+   assert(set != NULL);
+   assert(stat != NULL);
+
+   if( lp->deferredcleanupnode != stat->nnodes )
+      return SCIP_OKAY;
+
+   lp->deferredcleanupnode = -1;
+
+   assert(!lp->diving);
+
+   if( !lp->flushed || !lp->solved || SCIPlpGetSolstat(lp) != SCIP_LPSOLSTAT_OPTIMAL )
+   {
+      SCIPstatIncrement(stat, set, navoidedrowrefactors);
+      return SCIP_OKAY;
+   }
+
+   if( lp->firstnewrow >= lp->nrows )
+      return SCIP_OKAY;
+
+   oldnrows = lp->nrows;
+
+   SCIP_CALL( lpRemoveObsoleteRows(lp, blkmem, set, stat, eventqueue, eventfilter, lp->firstnewrow) );
+
+   if( lp->nrows < oldnrows )
+   {
+      SCIPstatIncrement(stat, set, ndeferredrowremovals);
+      SCIPstatAdd(stat, set, ndeferredrowsdel, (SCIP_Longint)(oldnrows - lp->nrows));
+   }
+
+   return SCIP_OKAY;
+}
+
+/** drops the removal of obsolete rows deferred by SCIPlpDeferNewObsoletes() at the current node, because the rows
+ *  created at the current node are removed from the LP anyway
+ */
+void SCIPlpDiscardDeferredObsoletes(
+   SCIP_LP*              lp,                 /**< current LP data */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat                /**< problem statistics */
+   )
+{
+   assert(lp != NULL);
+   assert(set != NULL);
+   assert(stat != NULL);
+
+   if( lp->deferredcleanupnode != stat->nnodes )
+      return;
+
+   lp->deferredcleanupnode = -1;
+
+   /* the refactorization of the first deferred removal is avoided completely */
+   SCIPstatIncrement(stat, set, navoidedrowrefactors);
+}
+
 /** removes all non-basic columns and basic rows in whole LP, that are too old */
 SCIP_RETCODE SCIPlpRemoveAllObsoletes(
    SCIP_LP*              lp,                 /**< current LP data */
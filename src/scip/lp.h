@@ -863,6 +863,9 @@ SCIP_RETCODE SCIPlpGetBase(
 /** gets a row from the inverse basis matrix B^-1 */
 SCIP_RETCODE SCIPlpGetBInvRow(
    SCIP_LP*              lp,                 /**< LP data */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< problem statistics */
    int                   r,                  /**< row number */
    SCIP_Real*            coef,               /**< pointer to store the coefficients of the row */
    int*                  inds,               /**< array to store the non-zero indices, or NULL */
@@ -887,6 +890,9 @@ SCIP_RETCODE SCIPlpGetBInvCol(
 /** gets a row from the product of inverse basis matrix B^-1 and coefficient matrix A (i.e. from B^-1 * A) */
 SCIP_RETCODE SCIPlpGetBInvARow(
    SCIP_LP*              lp,                 /**< LP data */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< problem statistics */
    int                   r,                  /**< row number */
    SCIP_Real*            binvrow,            /**< row in B^-1 from prior call to SCIPlpGetBInvRow(), or NULL */
    SCIP_Real*            coef,               /**< pointer to store the coefficients of the row */
@@ -895,6 +901,18 @@ SCIP_RETCODE SCIPlpGetBInvARow(
                                               *  (-1: if we do not store sparsity informations) */
    );
 
+/** gets several rows of the product of inverse basis matrix B^-1 and coefficient matrix A at once */
+SCIP_RETCODE SCIPlpGetBInvARows(
+   SCIP_LP*              lp,                 /**< LP data */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< problem statistics */
+   int*                  rows,               /**< basis row numbers of the requested rows */
+   int                   nrows,              /**< number of requested rows */
+   SCIP_Real**           binvrows,           /**< array of nrows arrays to store the rows of B^-1, or NULL */
+   SCIP_Real**           binvarows           /**< array of nrows arrays to store the rows of B^-1 * A */
+   );
+
 /** gets a column from the product of inverse basis matrix B^-1 and coefficient matrix A (i.e. from B^-1 * A),
  *  i.e., it computes B^-1 * A_c with A_c being the c'th column of A
  */
@@ -1018,6 +1036,21 @@ SCIP_RETCODE SCIPlpFlush(
    SCIP_EVENTQUEUE*      eventqueue          /**< event queue */
    );
 
+/** creates a copy of the flushed LP in a new LP solver interface; the copy uses the tolerances, scaling, and presolving
+ *  settings that are currently set in the LP solver of the LP, but no starting basis
+ *
+ *  @note the copy has to be freed with SCIPlpiFree() by the caller
+ */
+SCIP_RETCODE SCIPlpCreateLPICopy(
+   SCIP_LP*              lp,                 /**< current LP data */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_MESSAGEHDLR*     messagehdlr,        /**< message handler */
+   const char*           name,               /**< name of the LP copy */
+   SCIP_Bool             copyobj,            /**< should the objective of the columns be copied? otherwise, the
+                                              *   objective of the copy is zero */
+   SCIP_LPI**            lpicopy             /**< pointer to store the copy of the LP solver interface */
+   );
+
 /** marks the LP to be flushed, even if the LP thinks it is not flushed */
 SCIP_RETCODE SCIPlpMarkFlushed(
    SCIP_LP*              lp,                 /**< current LP data */
@@ -1283,6 +1316,39 @@ SCIP_RETCODE SCIPlpRemoveNewObsoletes(
    SCIP_EVENTFILTER*     eventfilter         /**< global event filter */
    );
 
+/** removes all non-basic columns in the part of the LP created at the current node, that are too old, and marks the
+ *  current node for a deferred removal of the obsolete basic rows, which is performed by
+ *  SCIPlpRemoveDeferredObsoletes() when the focus node is converted into a fork or pseudofork, and which is dropped by
+ *  SCIPlpDiscardDeferredObsoletes() when the rows of the focus node are removed from the LP anyway
+ */
+SCIP_RETCODE SCIPlpDeferNewObsoletes(
+   SCIP_LP*              lp,                 /**< current LP data */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat                /**< problem statistics */
+   );
+
+/** removes the obsolete basic rows in the part of the LP created at the current node, if their removal was deferred
+ *  by SCIPlpDeferNewObsoletes() at the current node; if the LP is not solved to optimality anymore, the pending removal
+ *  is dropped, because the basic rows cannot be identified
+ */
+SCIP_RETCODE SCIPlpRemoveDeferredObsoletes(
+   SCIP_LP*              lp,                 /**< current LP data */
+   BMS_BLKMEM*           blkmem,             /**< block memory buffers */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< problem statistics */
+   SCIP_EVENTQUEUE*      eventqueue,         /**< event queue */
+   SCIP_EVENTFILTER*     eventfilter         /**< global event filter */
+   );
+
+/** drops the removal of obsolete rows deferred by SCIPlpDeferNewObsoletes() at the current node, because the rows
+ *  created at the current node are removed from the LP anyway
+ */
+void SCIPlpDiscardDeferredObsoletes(
+   SCIP_LP*              lp,                 /**< current LP data */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat                /**< problem statistics */
+   );
+
 /** removes all non-basic columns and basic rows in whole LP, that are too old */
 SCIP_RETCODE SCIPlpRemoveAllObsoletes(
    SCIP_LP*              lp,                 /**< current LP data */
@@ -7049,6 +7049,138 @@ SCIP_RETCODE SCIPprofileInsertCore(
    return SCIP_OKAY;
 }
 
+/** inserts the given cores into an empty resource profile at once
+ *
+ *  The start and end times of the cores are sorted and the profile is built in one sweep over them, which takes
+ *  O(n log n) time for n cores, whereas inserting them one by one via SCIPprofileInsertCore() takes O(n^2) time in the
+ *  worst case. The resulting time points and loads are the same as for the single insertions. If the cores exceed the
+ *  capacity of the profile at some time point, the profile is left empty and infeasible is set to TRUE; the cores can
+ *  then be inserted one by one to detect the first core that does not fit.
+ */
+SCIP_RETCODE SCIPprofileInsertCores(
+   SCIP_PROFILE*         profile,            /**< empty resource profile */
+   int*                  lefts,              /**< left sides of the cores */
+   int*                  rights,             /**< right sides of the cores */
+   int*                  heights,            /**< heights of the cores */
+   int                   ncores,             /**< number of cores */
+   SCIP_Bool*            infeasible          /**< pointer to store if the cores do not fit due to capacity */
+   )
+{
+   int* starts;
+   int* startheights;
+   int* ends;
+   int* endheights;
+   int ntimepoints;
+   int load;
+   int nnonzero;
+   int c;
+   int i;
+   int j;
+
+   assert(profile != NULL);
+   assert(profile->ntimepoints == 1);
+   assert(profile->timepoints[0] == 0);
+   assert(profile->loads[0] == 0);
+   assert(ncores >= 0);
+   assert(infeasible != NULL);
+
+   (*infeasible) = FALSE;
+
+   if( ncores == 0 )
+      return SCIP_OKAY;
+
+   assert(lefts != NULL);
+   assert(rights != NULL);
+   assert(heights != NULL);
+
+   SCIP_ALLOC( BMSallocMemoryArray(&starts, ncores) );
+   SCIP_ALLOC( BMSallocMemoryArray(&startheights, ncores) );
+   SCIP_ALLOC( BMSallocMemoryArray(&ends, ncores) );
+   SCIP_ALLOC( BMSallocMemoryArray(&endheights, ncores) );
+
+   /* cores of height zero are ignored, as by SCIPprofileInsertCore() */
+   nnonzero = 0;
+   for( c = 0; c < ncores; ++c )
+   {
+      assert(0 <= lefts[c] && lefts[c] < rights[c]);
+      assert(heights[c] >= 0);
+
+      if( heights[c] == 0 )
+         continue;
+
+      starts[nnonzero] = lefts[c];
+      startheights[nnonzero] = heights[c];
+      ends[nnonzero] = rights[c];
+      endheights[nnonzero] = heights[c];
+      ++nnonzero;
+   }
+   ncores = nnonzero;
+
+   SCIPsortIntInt(starts, startheights, ncores);
+   SCIPsortIntInt(ends, endheights, ncores);
+
+   /* each core adds at most two time points to the initial time point 0 */
+   if( profile->arraysize < 2 * ncores + 1 )
+   {
+      profile->arraysize = 2 * ncores + 1;
+      SCIP_ALLOC( BMSreallocMemoryArray(&profile->timepoints, profile->arraysize) );
+      SCIP_ALLOC( BMSreallocMemoryArray(&profile->loads, profile->arraysize) );
+   }
+
+   /* sweep over the start and end times; the load of a time point includes the cores starting there and excludes the
+    * cores ending there, since cores are half-open intervals
+    */
+   ntimepoints = 1;
+   load = 0;
+   i = 0;
+   j = 0;
+   while( j < ncores )
+   {
+      int timepoint;
+
+      timepoint = (i < ncores && starts[i] < ends[j]) ? starts[i] : ends[j];
+      assert(timepoint >= 0);
+
+      while( i < ncores && starts[i] == timepoint )
+         load += startheights[i++];
+
+      while( j < ncores && ends[j] == timepoint )
+         load -= endheights[j++];
+
+      assert(load >= 0);
+
+      if( load > profile->capacity )
+         (*infeasible) = TRUE;
+
+      if( timepoint == 0 )
+         profile->loads[0] = load;
+      else
+      {
+         profile->timepoints[ntimepoints] = timepoint;
+         profile->loads[ntimepoints] = load;
+         ++ntimepoints;
+      }
+   }
+   assert(i == ncores);
+   assert(load == 0);
+
+   BMSfreeMemoryArray(&endheights);
+   BMSfreeMemoryArray(&ends);
+   BMSfreeMemoryArray(&startheights);
+   BMSfreeMemoryArray(&starts);
+
+   if( *infeasible )
+   {
+      SCIPdebugMessage("bulk core insertion detected infeasibility\n");
+      profile->loads[0] = 0;
+      profile->ntimepoints = 1;
+   }
+   else
+      profile->ntimepoints = ntimepoints;
+
+   return SCIP_OKAY;
+}
+
 /** subtracts the demand from the resource profile during core time */
 SCIP_RETCODE SCIPprofileDeleteCore(
    SCIP_PROFILE*         profile,            /**< resource profile to use */
@@ -0,0 +1,745 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   misc_linprop.c
+ * @ingroup OTHER_CFILES
+ * @brief  fast propagation of linear rows on thread-local bounds for parallel probing and fix-and-propagate
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "blockmemshell/memory.h"
+#include "scip/pub_message.h"
+#include "scip/pub_misc.h"
+#include "scip/pub_misc_linprop.h"
+#include "scip/struct_misc.h"
+#include <math.h>
+#include <string.h>
+
+#define LINPROP_MAXWORK       10000  /**< maximal number of nonzeros processed in the propagation of one fixing */
+#define LINPROP_RECOMPFREQ      100  /**< number of incremental updates after which the activities of a row are
+                                      *   recomputed from scratch */
+#define LINPROP_RECOMPCANCEL   1e-3  /**< the activities of a row are recomputed from scratch if they are smaller than
+                                      *   this fraction of the magnitude of the row, since they may suffer from
+                                      *   cancellation */
+
+
+/** adds (sign = +1) or removes (sign = -1) the contribution of a column to the activities of a row */
+static
+void linpropUpdateActivity(
+   SCIP_Real             val,                /**< coefficient of the column in the row */
+   SCIP_Real             lb,                 /**< lower bound of the column */
+   SCIP_Real             ub,                 /**< upper bound of the column */
+   SCIP_Real             infinity,           /**< value for infinity */
+   int                   sign,               /**< +1 to add, -1 to remove the contribution */
+   SCIP_Real*            minact,             /**< finite part of the minimal activity */
+   SCIP_Real*            maxact,             /**< finite part of the maximal activity */
+   int*                  nmininf,            /**< number of infinite contributions to the minimal activity */
+   int*                  nmaxinf             /**< number of infinite contributions to the maximal activity */
+   )
+{
+   SCIP_Real minbd;
+   SCIP_Real maxbd;
+
+   minbd = val > 0.0 ? lb : ub;
+   maxbd = val > 0.0 ? ub : lb;
+
+   if( REALABS(minbd) >= infinity )
+      *nmininf += sign;
+   else
+      *minact += sign * val * minbd;
+
+   if( REALABS(maxbd) >= infinity )
+      *nmaxinf += sign;
+   else
+      *maxact += sign * val * maxbd;
+}
+
+/** creates the shared copy of linear rows given in compressed sparse row format, with the given bounds of the columns */
+SCIP_RETCODE SCIPlinpropCreate(
+   SCIP_LINPROP**        linprop,            /**< pointer to store the shared rows */
+   int                   nrows,              /**< number of rows */
+   int                   ncols,              /**< number of columns */
+   const int*            rowbeg,             /**< start of the rows in rowcols and rowvals, with an entry for nrows */
+   const int*            rowcols,            /**< column indices of the rows */
+   const SCIP_Real*      rowvals,            /**< coefficients of the rows */
+   const SCIP_Real*      lhs,                /**< left hand sides, or -infinity */
+   const SCIP_Real*      rhs,                /**< right hand sides, or infinity */
+   const SCIP_Real*      lb,                 /**< lower bounds of the columns, or -infinity */
+   const SCIP_Real*      ub,                 /**< upper bounds of the columns, or infinity */
+   const SCIP_Bool*      isint,              /**< is the column of integral type? */
+   SCIP_Real             infinity,           /**< value for infinity */
+   SCIP_Real             feastol,            /**< feasibility tolerance */
+   SCIP_Real             epsilon             /**< absolute values smaller than this are considered zero */
+   )
+{
+   SCIP_LINPROP* lp;
+   int* colpos;
+   int nnonz;
+   int c;
+   int r;
+   int i;
+
+   assert(linprop != NULL);
+   assert(nrows >= 0);
+   assert(ncols >= 0);
+   assert(rowbeg != NULL);
+   assert(lhs != NULL || nrows == 0);
+   assert(rhs != NULL || nrows == 0);
+   assert(lb != NULL || ncols == 0);
+   assert(ub != NULL || ncols == 0);
+   assert(isint != NULL || ncols == 0);
+
+   nnonz = rowbeg[nrows];
+
+   SCIP_ALLOC( BMSallocClearMemory(linprop) );
+   lp = *linprop;
+
+   lp->nrows = nrows;
+   lp->ncols = ncols;
+   lp->infinity = infinity;
+   lp->feastol = feastol;
+   lp->epsilon = epsilon;
+
+   SCIP_ALLOC( BMSduplicateMemoryArray(&lp->rowbeg, rowbeg, nrows + 1) );
+   SCIP_ALLOC( BMSallocMemoryArray(&lp->rowcols, MAX(nnonz, 1)) );
+   SCIP_ALLOC( BMSallocMemoryArray(&lp->rowvals, MAX(nnonz, 1)) );
+   SCIP_ALLOC( BMSallocClearMemoryArray(&lp->colbeg, ncols + 1) );
+   SCIP_ALLOC( BMSallocMemoryArray(&lp->colrows, MAX(nnonz, 1)) );
+   SCIP_ALLOC( BMSallocMemoryArray(&lp->colvals, MAX(nnonz, 1)) );
+   SCIP_ALLOC( BMSallocMemoryArray(&lp->lhs, MAX(nrows, 1)) );
+   SCIP_ALLOC( BMSallocMemoryArray(&lp->rhs, MAX(nrows, 1)) );
+   SCIP_ALLOC( BMSallocMemoryArray(&lp->minact, MAX(nrows, 1)) );
+   SCIP_ALLOC( BMSallocMemoryArray(&lp->maxact, MAX(nrows, 1)) );
+   SCIP_ALLOC( BMSallocMemoryArray(&lp->nmininf, MAX(nrows, 1)) );
+   SCIP_ALLOC( BMSallocMemoryArray(&lp->nmaxinf, MAX(nrows, 1)) );
+   SCIP_ALLOC( BMSallocMemoryArray(&lp->actmag, MAX(nrows, 1)) );
+   SCIP_ALLOC( BMSallocMemoryArray(&lp->lb, MAX(ncols, 1)) );
+   SCIP_ALLOC( BMSallocMemoryArray(&lp->ub, MAX(ncols, 1)) );
+   SCIP_ALLOC( BMSallocMemoryArray(&lp->isint, MAX(ncols, 1)) );
+   SCIP_ALLOC( BMSallocMemoryArray(&colpos, ncols + 1) );
+
+   if( nnonz > 0 )
+   {
+      BMScopyMemoryArray(lp->rowcols, rowcols, nnonz);
+      BMScopyMemoryArray(lp->rowvals, rowvals, nnonz);
+   }
+   if( nrows > 0 )
+   {
+      BMScopyMemoryArray(lp->lhs, lhs, nrows);
+      BMScopyMemoryArray(lp->rhs, rhs, nrows);
+   }
+   if( ncols > 0 )
+      BMScopyMemoryArray(lp->isint, isint, ncols);
+
+   /* transpose the rows into the columns */
+   for( i = 0; i < nnonz; ++i )
+      ++lp->colbeg[rowcols[i] + 1];
+   for( c = 0; c < ncols; ++c )
+      lp->colbeg[c + 1] += lp->colbeg[c];
+   BMScopyMemoryArray(colpos, lp->colbeg, ncols + 1);
+
+   for( r = 0; r < nrows; ++r )
+   {
+      for( i = rowbeg[r]; i < rowbeg[r + 1]; ++i )
+      {
+         int pos = colpos[rowcols[i]]++;
+
+         lp->colrows[pos] = r;
+         lp->colvals[pos] = rowvals[i];
+      }
+   }
+
+   BMSfreeMemoryArray(&colpos);
+
+   SCIPlinpropSetBounds(lp, lb, ub);
+
+   return SCIP_OKAY;
+}
+
+/** frees the shared copy of linear rows */
+void SCIPlinpropFree(
+   SCIP_LINPROP**        linprop             /**< pointer to the shared rows */
+   )
+{
+   SCIP_LINPROP* lp;
+
+   assert(linprop != NULL);
+
+   if( *linprop == NULL )
+      return;
+   lp = *linprop;
+
+   BMSfreeMemoryArrayNull(&lp->isint);
+   BMSfreeMemoryArrayNull(&lp->ub);
+   BMSfreeMemoryArrayNull(&lp->lb);
+   BMSfreeMemoryArrayNull(&lp->actmag);
+   BMSfreeMemoryArrayNull(&lp->nmaxinf);
+   BMSfreeMemoryArrayNull(&lp->nmininf);
+   BMSfreeMemoryArrayNull(&lp->maxact);
+   BMSfreeMemoryArrayNull(&lp->minact);
+   BMSfreeMemoryArrayNull(&lp->rhs);
+   BMSfreeMemoryArrayNull(&lp->lhs);
+   BMSfreeMemoryArrayNull(&lp->colvals);
+   BMSfreeMemoryArrayNull(&lp->colrows);
+   BMSfreeMemoryArrayNull(&lp->colbeg);
+   BMSfreeMemoryArrayNull(&lp->rowvals);
+   BMSfreeMemoryArrayNull(&lp->rowcols);
+   BMSfreeMemoryArrayNull(&lp->rowbeg);
+
+   BMSfreeMemory(linprop);
+}
+
+/** replaces the bounds of the columns that the workers start from and recomputes the activities of the rows and their
+ *  magnitudes; must not be called while workers are in use
+ */
+void SCIPlinpropSetBounds(
+   SCIP_LINPROP*         linprop,            /**< shared rows */
+   const SCIP_Real*      lb,                 /**< lower bounds of the columns, or -infinity */
+   const SCIP_Real*      ub                  /**< upper bounds of the columns, or infinity */
+   )
+{
+   int r;
+   int i;
+
+   assert(linprop != NULL);
+
+   if( linprop->ncols > 0 )
+   {
+      BMScopyMemoryArray(linprop->lb, lb, linprop->ncols);
+      BMScopyMemoryArray(linprop->ub, ub, linprop->ncols);
+   }
+
+   for( r = 0; r < linprop->nrows; ++r )
+   {
+      linprop->minact[r] = 0.0;
+      linprop->maxact[r] = 0.0;
+      linprop->nmininf[r] = 0;
+      linprop->nmaxinf[r] = 0;
+      linprop->actmag[r] = 0.0;
+
+      for( i = linprop->rowbeg[r]; i < linprop->rowbeg[r + 1]; ++i )
+      {
+         int c = linprop->rowcols[i];
+         SCIP_Real val = linprop->rowvals[i];
+
+         linpropUpdateActivity(val, linprop->lb[c], linprop->ub[c], linprop->infinity, +1,
+            &linprop->minact[r], &linprop->maxact[r], &linprop->nmininf[r], &linprop->nmaxinf[r]);
+
+         /* the bounds of the workers only get tighter, so this bounds all contributions they compute */
+         if( REALABS(linprop->lb[c]) < linprop->infinity )
+            linprop->actmag[r] += REALABS(val * linprop->lb[c]);
+         if( REALABS(linprop->ub[c]) < linprop->infinity )
+            linprop->actmag[r] += REALABS(val * linprop->ub[c]);
+      }
+   }
+}
+
+/** creates a worker with the bounds and activities of the shared rows */
+SCIP_RETCODE SCIPlinpropWorkerCreate(
+   SCIP_LINPROPWORKER**  worker,             /**< pointer to store the worker */
+   SCIP_LINPROP*         linprop             /**< shared rows */
+   )
+{
+   SCIP_LINPROPWORKER* w;
+   int nrows;
+   int ncols;
+
+   assert(worker != NULL);
+   assert(linprop != NULL);
+
+   nrows = MAX(linprop->nrows, 1);
+   ncols = MAX(linprop->ncols, 1);
+
+   SCIP_ALLOC( BMSallocClearMemory(worker) );
+   w = *worker;
+   w->linprop = linprop;
+
+   /* workers are created within parallel jobs, so a failing allocation frees the arrays allocated so far */
+   if( BMSallocMemoryArray(&w->lb, ncols) == NULL
+      || BMSallocMemoryArray(&w->ub, ncols) == NULL
+      || BMSallocMemoryArray(&w->minact, nrows) == NULL
+      || BMSallocMemoryArray(&w->maxact, nrows) == NULL
+      || BMSallocMemoryArray(&w->nmininf, nrows) == NULL
+      || BMSallocMemoryArray(&w->nmaxinf, nrows) == NULL
+      || BMSallocMemoryArray(&w->nactupdates, nrows) == NULL
+      || BMSallocMemoryArray(&w->colstamp, ncols) == NULL
+      || BMSallocMemoryArray(&w->rowstamp, nrows) == NULL
+      || BMSallocMemoryArray(&w->rowqueued, nrows) == NULL
+      || BMSallocMemoryArray(&w->coltrail, ncols) == NULL
+      || BMSallocMemoryArray(&w->coltraillb, ncols) == NULL
+      || BMSallocMemoryArray(&w->coltrailub, ncols) == NULL
+      || BMSallocMemoryArray(&w->rowtrail, nrows) == NULL
+      || BMSallocMemoryArray(&w->rowtrailminact, nrows) == NULL
+      || BMSallocMemoryArray(&w->rowtrailmaxact, nrows) == NULL
+      || BMSallocMemoryArray(&w->rowtrailnmininf, nrows) == NULL
+      || BMSallocMemoryArray(&w->rowtrailnmaxinf, nrows) == NULL
+      || BMSallocMemoryArray(&w->queue, nrows) == NULL )
+   {
+      SCIPerrorMessage("No memory in function call\n");
+      SCIPlinpropWorkerFree(worker);
+      return SCIP_NOMEMORY;
+   }
+
+   /* stamps of -1 never match a fixing number */
+   memset(w->colstamp, -1, ncols * sizeof(int));
+   memset(w->rowstamp, -1, nrows * sizeof(int));
+   memset(w->rowqueued, -1, nrows * sizeof(int));
+
+   SCIPlinpropWorkerReset(w);
+
+   return SCIP_OKAY;
+}
+
+/** frees a worker */
+void SCIPlinpropWorkerFree(
+   SCIP_LINPROPWORKER**  worker              /**< pointer to the worker */
+   )
+{
+   SCIP_LINPROPWORKER* w;
+
+   assert(worker != NULL);
+
+   if( *worker == NULL )
+      return;
+   w = *worker;
+
+   BMSfreeMemoryArrayNull(&w->queue);
+   BMSfreeMemoryArrayNull(&w->rowtrailnmaxinf);
+   BMSfreeMemoryArrayNull(&w->rowtrailnmininf);
+   BMSfreeMemoryArrayNull(&w->rowtrailmaxact);
+   BMSfreeMemoryArrayNull(&w->rowtrailminact);
+   BMSfreeMemoryArrayNull(&w->rowtrail);
+   BMSfreeMemoryArrayNull(&w->coltrailub);
+   BMSfreeMemoryArrayNull(&w->coltraillb);
+   BMSfreeMemoryArrayNull(&w->coltrail);
+   BMSfreeMemoryArrayNull(&w->rowqueued);
+   BMSfreeMemoryArrayNull(&w->rowstamp);
+   BMSfreeMemoryArrayNull(&w->colstamp);
+   BMSfreeMemoryArrayNull(&w->nactupdates);
+   BMSfreeMemoryArrayNull(&w->nmaxinf);
+   BMSfreeMemoryArrayNull(&w->nmininf);
+   BMSfreeMemoryArrayNull(&w->maxact);
+   BMSfreeMemoryArrayNull(&w->minact);
+   BMSfreeMemoryArrayNull(&w->ub);
+   BMSfreeMemoryArrayNull(&w->lb);
+
+   BMSfreeMemory(worker);
+}
+
+/** resets the bounds and activities of a worker to those of the shared rows */
+void SCIPlinpropWorkerReset(
+   SCIP_LINPROPWORKER*   worker              /**< worker */
+   )
+{
+   SCIP_LINPROP* linprop;
+
+   assert(worker != NULL);
+
+   linprop = worker->linprop;
+
+   if( linprop->ncols > 0 )
+   {
+      BMScopyMemoryArray(worker->lb, linprop->lb, linprop->ncols);
+      BMScopyMemoryArray(worker->ub, linprop->ub, linprop->ncols);
+   }
+   if( linprop->nrows > 0 )
+   {
+      BMScopyMemoryArray(worker->minact, linprop->minact, linprop->nrows);
+      BMScopyMemoryArray(worker->maxact, linprop->maxact, linprop->nrows);
+      BMScopyMemoryArray(worker->nmininf, linprop->nmininf, linprop->nrows);
+      BMScopyMemoryArray(worker->nmaxinf, linprop->nmaxinf, linprop->nrows);
+      BMSclearMemoryArray(worker->nactupdates, linprop->nrows);
+   }
+
+   worker->ncoltrail = 0;
+   worker->nrowtrail = 0;
+   worker->nqueued = 0;
+   worker->queuefirst = 0;
+}
+
+/** changes the bounds of a column in the current fixing, updates the activities of its rows, and queues them */
+static
+void linpropWorkerChgBounds(
+   SCIP_LINPROPWORKER*   worker,             /**< worker */
+   int                   col,                /**< column */
+   SCIP_Real             newlb,              /**< new lower bound */
+   SCIP_Real             newub               /**< new upper bound */
+   )
+{
+   SCIP_LINPROP* linprop = worker->linprop;
+   int i;
+
+   if( worker->colstamp[col] != worker->fixing )
+   {
+      worker->colstamp[col] = worker->fixing;
+      worker->coltrail[worker->ncoltrail] = col;
+      worker->coltraillb[worker->ncoltrail] = worker->lb[col];
+      worker->coltrailub[worker->ncoltrail] = worker->ub[col];
+      ++worker->ncoltrail;
+   }
+
+   for( i = linprop->colbeg[col]; i < linprop->colbeg[col + 1]; ++i )
+   {
+      int r = linprop->colrows[i];
+      SCIP_Real val = linprop->colvals[i];
+
+      if( worker->rowstamp[r] != worker->fixing )
+      {
+         worker->rowstamp[r] = worker->fixing;
+         worker->rowtrail[worker->nrowtrail] = r;
+         worker->rowtrailminact[worker->nrowtrail] = worker->minact[r];
+         worker->rowtrailmaxact[worker->nrowtrail] = worker->maxact[r];
+         worker->rowtrailnmininf[worker->nrowtrail] = worker->nmininf[r];
+         worker->rowtrailnmaxinf[worker->nrowtrail] = worker->nmaxinf[r];
+         ++worker->nrowtrail;
+      }
+
+      linpropUpdateActivity(val, worker->lb[col], worker->ub[col], linprop->infinity, -1,
+         &worker->minact[r], &worker->maxact[r], &worker->nmininf[r], &worker->nmaxinf[r]);
+      linpropUpdateActivity(val, newlb, newub, linprop->infinity, +1,
+         &worker->minact[r], &worker->maxact[r], &worker->nmininf[r], &worker->nmaxinf[r]);
+      ++worker->nactupdates[r];
+
+      if( worker->rowqueued[r] != worker->fixing )
+      {
+         worker->rowqueued[r] = worker->fixing;
+         worker->queue[(worker->queuefirst + worker->nqueued) % linprop->nrows] = r;
+         ++worker->nqueued;
+      }
+   }
+
+   worker->lb[col] = newlb;
+   worker->ub[col] = newub;
+}
+
+/** recomputes the activities of a row from the current bounds of a worker, which removes the round-off error
+ *  accumulated by the incremental updates; the row must have been changed in the current fixing, such that its
+ *  previous activities are on the trail
+ */
+static
+void linpropWorkerRecomputeActivity(
+   SCIP_LINPROPWORKER*   worker,             /**< worker */
+   int                   r                   /**< row */
+   )
+{
+   SCIP_LINPROP* linprop = worker->linprop;
+   int i;
+
+   assert(worker->rowstamp[r] == worker->fixing);
+
+   worker->minact[r] = 0.0;
+   worker->maxact[r] = 0.0;
+   worker->nmininf[r] = 0;
+   worker->nmaxinf[r] = 0;
+   worker->nactupdates[r] = 0;
+
+   for( i = linprop->rowbeg[r]; i < linprop->rowbeg[r + 1]; ++i )
+   {
+      int c = linprop->rowcols[i];
+
+      linpropUpdateActivity(linprop->rowvals[i], worker->lb[c], worker->ub[c], linprop->infinity, +1,
+         &worker->minact[r], &worker->maxact[r], &worker->nmininf[r], &worker->nmaxinf[r]);
+   }
+
+   worker->work += linprop->rowbeg[r + 1] - linprop->rowbeg[r];
+}
+
+/** tightens the bounds of the columns of a row w.r.t. the activity of the rest of the row
+ *
+ *  The activities are recomputed from scratch after many incremental updates or if they are small compared to the
+ *  magnitude of the row. All comparisons and the rounding of integral bounds allow for a round-off error of the
+ *  activities relative to the magnitude of the row, such that big-M rows do not yield bounds that are too tight.
+ *
+ *  @return FALSE if the row or one of its columns turned out to be infeasible
+ */
+static
+SCIP_Bool linpropWorkerPropagateRow(
+   SCIP_LINPROPWORKER*   worker,             /**< worker */
+   int                   r                   /**< row */
+   )
+{
+   SCIP_LINPROP* linprop = worker->linprop;
+   SCIP_Real lhs = linprop->lhs[r];
+   SCIP_Real rhs = linprop->rhs[r];
+   SCIP_Bool lhsinf = (lhs <= -linprop->infinity);
+   SCIP_Bool rhsinf = (rhs >= linprop->infinity);
+   SCIP_Real acterr;
+   int i;
+
+   if( worker->nactupdates[r] >= LINPROP_RECOMPFREQ || (worker->nactupdates[r] > 0
+         && MAX(REALABS(worker->minact[r]), REALABS(worker->maxact[r])) < LINPROP_RECOMPCANCEL * linprop->actmag[r]) )
+      linpropWorkerRecomputeActivity(worker, r);
+
+   /* round-off error that the activities may contain */
+   acterr = linprop->epsilon * linprop->actmag[r];
+
+   if( !rhsinf && worker->nmininf[r] == 0
+      && worker->minact[r] - rhs > linprop->feastol * MAX(1.0, REALABS(rhs)) + acterr )
+      return FALSE;
+   if( !lhsinf && worker->nmaxinf[r] == 0
+      && lhs - worker->maxact[r] > linprop->feastol * MAX(1.0, REALABS(lhs)) + acterr )
+      return FALSE;
+
+   worker->work += linprop->rowbeg[r + 1] - linprop->rowbeg[r];
+
+   for( i = linprop->rowbeg[r]; i < linprop->rowbeg[r + 1]; ++i )
+   {
+      SCIP_Real val = linprop->rowvals[i];
+      int c = linprop->rowcols[i];
+      SCIP_Real lb = worker->lb[c];
+      SCIP_Real ub = worker->ub[c];
+      SCIP_Real newlb = lb;
+      SCIP_Real newub = ub;
+      SCIP_Real minbd;
+      SCIP_Real maxbd;
+      SCIP_Real bounderr;
+
+      if( REALABS(val) < linprop->epsilon || lb == ub ) /*lint !e777*/
+         continue;
+
+      /* round-off error of the bounds derived from the activities */
+      bounderr = acterr / REALABS(val);
+
+      minbd = val > 0.0 ? lb : ub;
+      maxbd = val > 0.0 ? ub : lb;
+
+      /* residual minimal activity yields a bound from the right hand side */
+      if( !rhsinf && (worker->nmininf[r] == 0 || (worker->nmininf[r] == 1 && REALABS(minbd) >= linprop->infinity)) )
+      {
+         SCIP_Real resact = worker->minact[r] - (REALABS(minbd) >= linprop->infinity ? 0.0 : val * minbd);
+         SCIP_Real bound = (rhs - resact) / val;
+
+         if( val > 0.0 )
+            newub = MIN(newub, bound);
+         else
+            newlb = MAX(newlb, bound);
+      }
+
+      /* residual maximal activity yields a bound from the left hand side */
+      if( !lhsinf && (worker->nmaxinf[r] == 0 || (worker->nmaxinf[r] == 1 && REALABS(maxbd) >= linprop->infinity)) )
+      {
+         SCIP_Real resact = worker->maxact[r] - (REALABS(maxbd) >= linprop->infinity ? 0.0 : val * maxbd);
+         SCIP_Real bound = (lhs - resact) / val;
+
+         if( val > 0.0 )
+            newlb = MAX(newlb, bound);
+         else
+            newub = MIN(newub, bound);
+      }
+
+      if( linprop->isint[c] )
+      {
+         newlb = ceil(newlb - linprop->feastol - bounderr);
+         newub = floor(newub + linprop->feastol + bounderr);
+      }
+      else
+      {
+         /* relax the bounds of continuous columns slightly and only accept considerable changes */
+         SCIP_Real minchg = 1e-3 * MAX(1.0, ub - lb);
+
+         newlb -= linprop->feastol * MAX(1.0, REALABS(newlb)) + bounderr;
+         newub += linprop->feastol * MAX(1.0, REALABS(newub)) + bounderr;
+         if( newlb < lb + minchg || REALABS(newlb) >= linprop->infinity )
+            newlb = lb;
+         if( newub > ub - minchg || REALABS(newub) >= linprop->infinity )
+            newub = ub;
+      }
+
+      newlb = MAX(newlb, lb);
+      newub = MIN(newub, ub);
+
+      if( newlb > newub + linprop->feastol * MAX(1.0, REALABS(newlb)) + bounderr )
+         return FALSE;
+
+      if( newlb > lb || newub < ub )
+      {
+         /* avoid slightly crossing bounds due to the tolerances */
+         if( newlb > newub )
+            newlb = newub;
+
+         linpropWorkerChgBounds(worker, c, newlb, newub);
+      }
+   }
+
+   return TRUE;
+}
+
+/** fixes a column to the given value and propagates the rows until a fixpoint or the work limit is reached; the
+ *  changes must be kept by SCIPlinpropWorkerCommit() or undone by SCIPlinpropWorkerUndo() before the next fixing
+ *
+ *  @return FALSE if the fixing turned out to be infeasible
+ */
+SCIP_Bool SCIPlinpropWorkerFix(
+   SCIP_LINPROPWORKER*   worker,             /**< worker */
+   int                   col,                /**< column to fix */
+   SCIP_Real             val                 /**< value to fix the column to */
+   )
+{
+   assert(worker != NULL);
+   assert(0 <= col && col < worker->linprop->ncols);
+   assert(worker->ncoltrail == 0 && worker->nrowtrail == 0);
+
+   ++worker->fixing;
+   worker->work = 0;
+
+   linpropWorkerChgBounds(worker, col, val, val);
+
+   while( worker->nqueued > 0 && worker->work < LINPROP_MAXWORK )
+   {
+      int r = worker->queue[worker->queuefirst];
+
+      worker->queuefirst = (worker->queuefirst + 1) % worker->linprop->nrows;
+      --worker->nqueued;
+      worker->rowqueued[r] = -1;
+
+      if( !linpropWorkerPropagateRow(worker, r) )
+         return FALSE;
+   }
+
+   return TRUE;
+}
+
+/** undoes all changes of the last fixing */
+void SCIPlinpropWorkerUndo(
+   SCIP_LINPROPWORKER*   worker              /**< worker */
+   )
+{
+   int i;
+
+   assert(worker != NULL);
+
+   for( i = worker->ncoltrail - 1; i >= 0; --i )
+   {
+      worker->lb[worker->coltrail[i]] = worker->coltraillb[i];
+      worker->ub[worker->coltrail[i]] = worker->coltrailub[i];
+   }
+
+   for( i = worker->nrowtrail - 1; i >= 0; --i )
+   {
+      int r = worker->rowtrail[i];
+
+      worker->minact[r] = worker->rowtrailminact[i];
+      worker->maxact[r] = worker->rowtrailmaxact[i];
+      worker->nmininf[r] = worker->rowtrailnmininf[i];
+      worker->nmaxinf[r] = worker->rowtrailnmaxinf[i];
+   }
+
+   SCIPlinpropWorkerCommit(worker);
+}
+
+/** keeps all changes of the last fixing; rows that are still queued because of the work limit are dropped */
+void SCIPlinpropWorkerCommit(
+   SCIP_LINPROPWORKER*   worker              /**< worker */
+   )
+{
+   assert(worker != NULL);
+
+   /* the marks of the dropped rows refer to the last fixing and do not prevent queueing them in the next fixing */
+   worker->ncoltrail = 0;
+   worker->nrowtrail = 0;
+   worker->nqueued = 0;
+   worker->queuefirst = 0;
+}
+
+/** returns the current lower bounds of the columns of a worker */
+const SCIP_Real* SCIPlinpropWorkerGetLbs(
+   SCIP_LINPROPWORKER*   worker              /**< worker */
+   )
+{
+   assert(worker != NULL);
+
+   return worker->lb;
+}
+
+/** returns the current upper bounds of the columns of a worker */
+const SCIP_Real* SCIPlinpropWorkerGetUbs(
+   SCIP_LINPROPWORKER*   worker              /**< worker */
+   )
+{
+   assert(worker != NULL);
+
+   return worker->ub;
+}
+
+/** returns the columns changed by the last fixing, including the fixed column, in the order of their first change */
+const int* SCIPlinpropWorkerGetChgCols(
+   SCIP_LINPROPWORKER*   worker              /**< worker */
+   )
+{
+   assert(worker != NULL);
+
+   return worker->coltrail;
+}
+
+/** returns the number of columns changed by the last fixing */
+int SCIPlinpropWorkerGetNChgCols(
+   SCIP_LINPROPWORKER*   worker              /**< worker */
+   )
+{
+   assert(worker != NULL);
+
+   return worker->ncoltrail;
+}
+
+/** returns whether a column was changed by the last fixing */
+SCIP_Bool SCIPlinpropWorkerIsColChanged(
+   SCIP_LINPROPWORKER*   worker,             /**< worker */
+   int                   col                 /**< column */
+   )
+{
+   assert(worker != NULL);
+   assert(0 <= col && col < worker->linprop->ncols);
+
+   return worker->colstamp[col] == worker->fixing;
+}
+
+/** returns whether the current activities of all rows of a worker satisfy their sides; rows may not be propagated
+ *  completely because of the work limit, so this should be checked once all columns are fixed
+ */
+SCIP_Bool SCIPlinpropWorkerIsFeasible(
+   SCIP_LINPROPWORKER*   worker              /**< worker */
+   )
+{
+   SCIP_LINPROP* linprop;
+   int r;
+
+   assert(worker != NULL);
+
+   linprop = worker->linprop;
+
+   for( r = 0; r < linprop->nrows; ++r )
+   {
+      SCIP_Real acterr = linprop->epsilon * linprop->actmag[r];
+
+      if( linprop->rhs[r] < linprop->infinity && (worker->nmininf[r] > 0
+            || worker->minact[r] - linprop->rhs[r] > linprop->feastol * MAX(1.0, REALABS(linprop->rhs[r])) + acterr) )
+         return FALSE;
+      if( linprop->lhs[r] > -linprop->infinity && (worker->nmaxinf[r] > 0
+            || linprop->lhs[r] - worker->maxact[r] > linprop->feastol * MAX(1.0, REALABS(linprop->lhs[r])) + acterr) )
+         return FALSE;
+   }
+
+   return TRUE;
+}
@@ -0,0 +1,324 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   misc_regforest.c
+ * @ingroup OTHER_CFILES
+ * @brief  methods for regression forests in RFCSV format
+ * @author Gregor Hendel
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "blockmemshell/memory.h"
+#include "scip/pub_fileio.h"
+#include "scip/pub_message.h"
+#include "scip/pub_misc.h"
+#include "scip/pub_misc_regforest.h"
+#include "scip/struct_misc.h"
+#include <stdio.h>
+
+#define MAX_REGFORESTSIZE 10000000               /**< size limit (number of nodes) for regression forest */
+
+
+/** checks that the trees of a regression forest are well-formed, i.e., that the children of each inner node come after
+ *  their parent in the same tree, which also excludes cycles, and that the split features exist
+ */
+static
+SCIP_Bool regForestIsValid(
+   SCIP_REGFOREST*       regforest           /**< regression forest */
+   )
+{
+   int t;
+
+   assert(regforest != NULL);
+
+   for( t = 0; t < regforest->ntrees; ++t )
+   {
+      int begin = regforest->nbegin[t];
+      int end = (t < regforest->ntrees - 1) ? regforest->nbegin[t + 1] : regforest->size;
+      int pos;
+
+      if( end <= begin )
+         return FALSE;
+
+      for( pos = begin; pos < end; ++pos )
+      {
+         int left = regforest->child[2 * pos];
+         int right = regforest->child[2 * pos + 1];
+
+         if( regforest->splitidx[pos] == -1 )
+            continue;
+
+         if( regforest->splitidx[pos] < 0 || regforest->splitidx[pos] >= regforest->dim
+            || left <= pos - begin || left >= end - begin || right <= pos - begin || right >= end - begin )
+            return FALSE;
+      }
+   }
+
+   return TRUE;
+}
+
+/** frees a regression forest */
+void SCIPregForestFree(
+   SCIP_REGFOREST**      regforest           /**< pointer to the regression forest */
+   )
+{
+   SCIP_REGFOREST* regforestptr;
+
+   assert(regforest != NULL);
+
+   if( *regforest == NULL )
+      return;
+   regforestptr = *regforest;
+
+   BMSfreeMemoryArrayNull(&regforestptr->nbegin);
+   BMSfreeMemoryArrayNull(&regforestptr->child);
+   BMSfreeMemoryArrayNull(&regforestptr->splitidx);
+   BMSfreeMemoryArrayNull(&regforestptr->value);
+
+   BMSfreeMemory(regforest);
+}
+
+/** returns the feature dimension of a regression forest */
+int SCIPregForestGetDim(
+   SCIP_REGFOREST*       regforest           /**< regression forest */
+   )
+{
+   assert(regforest != NULL);
+
+   return regforest->dim;
+}
+
+/** makes a prediction with a regression forest */
+SCIP_Real SCIPregForestPredict(
+   SCIP_REGFOREST*       regforest,          /**< regression forest */
+   SCIP_Real*            datapoint           /**< a data point that matches the dimension of this regression forest */
+   )
+{
+   SCIP_Real prediction;
+
+   assert(regforest != NULL);
+   assert(datapoint != NULL);
+
+   SCIPregForestPredictBatch(regforest, datapoint, 1, 1, &prediction);
+
+   return prediction;
+}
+
+/** makes predictions for several data points at once; the data is stored feature by feature, i.e., feature f of data
+ *  point i at position f * stride + i, such that the innermost loop runs over contiguous data
+ */
+void SCIPregForestPredictBatch(
+   SCIP_REGFOREST*       regforest,          /**< regression forest */
+   const SCIP_Real*      data,               /**< data points, stored feature by feature */
+   int                   stride,             /**< distance between two features of the same data point */
+   int                   ndatapoints,        /**< number of data points */
+   SCIP_Real*            predictions         /**< array to store the predictions of all data points */
+   )
+{
+   int treeidx;
+   int i;
+
+   assert(regforest != NULL);
+   assert(data != NULL || ndatapoints == 0);
+   assert(predictions != NULL || ndatapoints == 0);
+   assert(stride >= ndatapoints);
+
+   for( i = 0; i < ndatapoints; ++i )
+      predictions[i] = 0.0;
+
+   /* loop through the trees */
+   for( treeidx = 0; treeidx < regforest->ntrees; ++treeidx )
+   {
+      int treepos = regforest->nbegin[treeidx];
+      const int* childtree = &regforest->child[2 * treepos];
+      const int* splitidxtree = &regforest->splitidx[treepos];
+      const SCIP_Real* valuetree = &regforest->value[treepos];
+
+      for( i = 0; i < ndatapoints; ++i )
+      {
+         int pos = 0;
+
+         /* find the correct leaf */
+         while( splitidxtree[pos] != -1 )
+         {
+            int goright;
+
+            assert(splitidxtree[pos] < regforest->dim);
+
+            goright = (data[splitidxtree[pos] * stride + i] > valuetree[pos]) ? 1 : 0;
+            pos = childtree[2 * pos + goright];
+         }
+
+         predictions[i] += valuetree[pos];
+      }
+   }
+
+   /* return the average value that the trees predict */
+   for( i = 0; i < ndatapoints; ++i )
+      predictions[i] /= (SCIP_Real)regforest->ntrees;
+}
+
+/** reads a regression forest from a file in RFCSV format
+ *
+ *  The first line reads "### NTREES=<ntrees> FEATURE_DIM=<dim> LENGTH=<size>", followed by one line
+ *  "<node>,<left>,<right>,<splitidx>,<value>" per node. The nodes of a tree are numbered from 0 relative to its root,
+ *  the children of an inner node must come after it in the same tree, and leaves have split index -1.
+ */
+SCIP_RETCODE SCIPregForestFromFile(
+   SCIP_REGFOREST**      regforest,          /**< pointer to store the regression forest */
+   const char*           filename            /**< name of file with the regression forest data */
+   )
+{
+   SCIP_RETCODE retcode = SCIP_OKAY;
+   SCIP_FILE* file;
+   SCIP_REGFOREST* regforestptr;
+   char buffer[SCIP_MAXSTRLEN];
+   char valuestr[SCIP_MAXSTRLEN];
+   SCIP_Bool error = FALSE;
+   int ntrees;
+   int dim;
+   int size;
+   int pos;
+   int treepos;
+
+   assert(regforest != NULL);
+   assert(filename != NULL);
+
+   *regforest = NULL;
+
+   /* try to open file */
+   file = SCIPfopen(filename, "r");
+
+   if( file == NULL )
+   {
+      SCIPerrorMessage("Could not open regression forest file <%s>\n", filename);
+      return SCIP_NOFILE;
+   }
+
+   /* read the first line that contains the number of trees, feature dimension, and total number of nodes */
+   if( SCIPfgets(buffer, (int) sizeof(buffer), file) == NULL )
+   {
+      SCIPerrorMessage("Could not read first line of regression forest file <%s>\n", filename);
+      error = TRUE;
+      goto CLOSEFILE;
+   }
+
+   /* coverity[secure_coding] */
+   if( sscanf(buffer, "### NTREES=%10d FEATURE_DIM=%10d LENGTH=%10d", &ntrees, &dim, &size) != 3 )
+   {
+      SCIPerrorMessage("Could not extract tree information from first line [%s] of regression forest file <%s>\n",
+         buffer, filename);
+      error = TRUE;
+      goto CLOSEFILE;
+   }
+
+   SCIPdebugMessage("Read ntrees=%d, dim=%d, size=%d\n", ntrees, dim, size);
+
+   /* check if the forest is too big, or numbers are not positive */
+   if( size > MAX_REGFORESTSIZE )
+   {
+      SCIPerrorMessage("Requested size %d exceeds size limit %d for regression forests\n", size, MAX_REGFORESTSIZE);
+      error = TRUE;
+      goto CLOSEFILE;
+   }
+
+   if( dim <= 0 || ntrees <= 0 || size < ntrees )
+   {
+      SCIPerrorMessage("Cannot create regression forest with dimension %d, %d trees, and %d nodes\n", dim, ntrees, size);
+      error = TRUE;
+      goto CLOSEFILE;
+   }
+
+   /* allocate memory in regression forest data structure */
+   SCIP_ALLOC_TERMINATE( retcode, BMSallocClearMemory(regforest), FREEFOREST );
+   regforestptr = *regforest;
+
+   /* coverity[tainted_data] */
+   SCIP_ALLOC_TERMINATE( retcode, BMSallocMemoryArray(&regforestptr->nbegin, ntrees), FREEFOREST );
+   SCIP_ALLOC_TERMINATE( retcode, BMSallocMemoryArray(&regforestptr->child, 2 * size), FREEFOREST ); /*lint !e647*/
+   SCIP_ALLOC_TERMINATE( retcode, BMSallocMemoryArray(&regforestptr->splitidx, size), FREEFOREST );
+   SCIP_ALLOC_TERMINATE( retcode, BMSallocMemoryArray(&regforestptr->value, size), FREEFOREST );
+
+   regforestptr->dim = dim;
+   regforestptr->size = size;
+   regforestptr->ntrees = ntrees;
+
+   /* read the comma separated node data, one line per node */
+   treepos = 0;
+   for( pos = 0; pos < size && !error; ++pos )
+   {
+      char* endptr;
+      int node;
+
+      /* coverity[secure_coding] */
+      if( SCIPfgets(buffer, (int) sizeof(buffer), file) == NULL
+         || sscanf(buffer, "%10d,%10d,%10d,%10d,%s", &node, &regforestptr->child[2 * pos],
+            &regforestptr->child[2 * pos + 1], &regforestptr->splitidx[pos], valuestr) != 5
+         || !SCIPstrToRealValue(valuestr, &regforestptr->value[pos], &endptr) )
+      {
+         SCIPerrorMessage("Could not read node %d of regression forest file <%s>\n", pos, filename);
+         error = TRUE;
+      }
+      /* new root node - increase the tree index position */
+      else if( node == 0 )
+      {
+         if( treepos >= ntrees )
+         {
+            SCIPerrorMessage("Regression forest file <%s> contains more than %d trees\n", filename, ntrees);
+            error = TRUE;
+         }
+         else
+            regforestptr->nbegin[treepos++] = pos;
+      }
+      else if( pos == 0 )
+      {
+         SCIPerrorMessage("First node of regression forest file <%s> is not a root\n", filename);
+         error = TRUE;
+      }
+   }
+
+   if( !error && (treepos != ntrees || !regForestIsValid(regforestptr)) )
+   {
+      SCIPerrorMessage("Trees of regression forest file <%s> are not well-formed\n", filename);
+      error = TRUE;
+   }
+
+   goto CLOSEFILE;
+
+/* insufficient memory for allocating regression forest */
+FREEFOREST:
+   assert(retcode == SCIP_NOMEMORY);
+
+CLOSEFILE:
+   SCIPfclose(file);
+
+   if( error )
+      retcode = SCIP_READERROR;
+
+   if( retcode != SCIP_OKAY )
+      SCIPregForestFree(regforest);
+
+   return retcode;
+}
@@ -43,12 +43,16 @@
 #include "scip/pricestore.h"
 #include "scip/scip.h"
 #include "scip/pricer.h"
+#include "scip/tree.h"
 #include "scip/pub_message.h"
 #include "scip/pub_misc.h"
 
 #include "scip/struct_pricer.h"
+#include "tpi/tpi.h"
 
 
+#define SCIP_DEFAULT_SMOOTHING      0.0 /**< default smoothing factor of the stabilized dual values */
+
 
 /** compares two pricers w. r. to their activity and their priority */
 SCIP_DECL_SORTPTRCOMP(SCIPpricerComp)
@@ -153,7 +157,11 @@ SCIP_RETCODE doPricerCreate(
    SCIP_CALL( SCIPclockCreate(&(*pricer)->pricerclock, SCIP_CLOCKTYPE_DEFAULT) );
    (*pricer)->ncalls = 0;
    (*pricer)->nvarsfound = 0;
+   (*pricer)->jobstart = 0;
+   (*pricer)->centerbound = -SCIPsetInfinity(set);
+   (*pricer)->centernode = -1;
    (*pricer)->delay = delay;
+   (*pricer)->lagrangianbound = FALSE;
    (*pricer)->active = FALSE;
    (*pricer)->initialized = FALSE;
 
@@ -164,6 +172,11 @@ SCIP_RETCODE doPricerCreate(
                   &(*pricer)->priority, FALSE, priority, INT_MIN/4, INT_MAX/4,
                   paramChgdPricerPriority, (SCIP_PARAMDATA*)(*pricer)) ); /*lint !e740*/
 
+   (void) SCIPsnprintf(paramname, SCIP_MAXSTRLEN, "pricers/%s/smoothing", name);
+   (void) SCIPsnprintf(paramdesc, SCIP_MAXSTRLEN, "smoothing factor of the stabilized dual values of pricer <%s> (0.0: no stabilization)", name);
+   SCIP_CALL( SCIPsetAddRealParam(set, messagehdlr, blkmem, paramname, paramdesc,
+                  &(*pricer)->smoothing, TRUE, SCIP_DEFAULT_SMOOTHING, 0.0, 0.99, NULL, NULL) );
+
    return SCIP_OKAY;
 }
 
@@ -221,6 +234,9 @@ SCIP_RETCODE SCIPpricerFree(
       SCIP_CALL( (*pricer)->pricerfree(set->scip, *pricer) );
    }
 
+   BMSfreeMemoryArrayNull(&(*pricer)->stabduals);
+   BMSfreeMemoryArrayNull(&(*pricer)->centerrowidx);
+   BMSfreeMemoryArrayNull(&(*pricer)->centerduals);
    SCIPclockFree(&(*pricer)->pricerclock);
    SCIPclockFree(&(*pricer)->setuptime);
    BMSfreeMemoryArrayNull(&(*pricer)->name);
@@ -253,6 +269,8 @@ SCIP_RETCODE SCIPpricerInit(
 
       pricer->ncalls = 0;
       pricer->nvarsfound = 0;
+      pricer->jobstart = 0;
+      pricer->nmisprices = 0;
    }
 
    if( pricer->pricerinit != NULL )
@@ -391,16 +409,129 @@ SCIP_RETCODE SCIPpricerDeactivate(
    return SCIP_OKAY;
 }
 
+/** ensures that the arrays for the stabilized and center dual values can store at least num entries */
+static
+SCIP_RETCODE pricerEnsureDualsSize(
+   SCIP_PRICER*          pricer,             /**< variable pricer */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   int                   num                 /**< minimum number of entries to store */
+   )
+{
+   assert(pricer != NULL);
+
+   if( num > pricer->dualssize )
+   {
+      int newsize;
+
+      newsize = SCIPsetCalcMemGrowSize(set, num);
+      SCIP_ALLOC( BMSreallocMemoryArray(&pricer->centerduals, newsize) );
+      SCIP_ALLOC( BMSreallocMemoryArray(&pricer->centerrowidx, newsize) );
+      SCIP_ALLOC( BMSreallocMemoryArray(&pricer->stabduals, newsize) );
+      pricer->dualssize = newsize;
+   }
+   assert(num <= pricer->dualssize);
+
+   return SCIP_OKAY;
+}
+
+/** computes the stabilized dual values of the current LP rows as convex combination of the dual values of the
+ *  stabilization center and the current LP dual values (Wentges smoothing)
+ *
+ *  Rows that did not exist when the center was stored keep their LP dual value. If the given smoothing factor is zero
+ *  or there is no center, no stabilized dual values are stored and the raw LP dual values are used.
+ */
+static
+SCIP_RETCODE pricerComputeStabDuals(
+   SCIP_PRICER*          pricer,             /**< variable pricer */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_LP*              lp,                 /**< current LP data */
+   SCIP_Real             alpha               /**< smoothing factor to use */
+   )
+{
+   SCIP_ROW** rows;
+   int nrows;
+   int r;
+
+   assert(pricer != NULL);
+   assert(lp != NULL);
+
+   pricer->nstabduals = 0;
+
+   if( alpha <= 0.0 || pricer->ncenterduals == 0 )
+      return SCIP_OKAY;
+
+   rows = SCIPlpGetRows(lp);
+   nrows = SCIPlpGetNRows(lp);
+
+   SCIP_CALL( pricerEnsureDualsSize(pricer, set, nrows) );
+
+   for( r = 0; r < nrows; ++r )
+   {
+      if( r < pricer->ncenterduals && pricer->centerrowidx[r] == SCIProwGetIndex(rows[r]) )
+         pricer->stabduals[r] = alpha * pricer->centerduals[r] + (1.0 - alpha) * SCIProwGetDualsol(rows[r]);
+      else
+         pricer->stabduals[r] = SCIProwGetDualsol(rows[r]);
+   }
+   pricer->nstabduals = nrows;
+
+   return SCIP_OKAY;
+}
+
+/** stores the dual values that were used in the last pricing call as new stabilization center, if there is no center
+ *  yet or the Lagrangian bound computed by the pricer for them improves on the bound of the current center
+ *
+ *  In the first pricing call at a node, the raw LP dual values are used and become the initial center.
+ */
+static
+SCIP_RETCODE pricerUpdateStabCenter(
+   SCIP_PRICER*          pricer,             /**< variable pricer */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_LP*              lp,                 /**< current LP data */
+   SCIP_Real             lowerbound          /**< Lagrangian bound computed by the pricer */
+   )
+{
+   SCIP_ROW** rows;
+   int nrows;
+   int r;
+
+   assert(pricer != NULL);
+   assert(lp != NULL);
+
+   if( pricer->ncenterduals > 0
+      && (SCIPsetIsInfinity(set, -lowerbound) || !SCIPsetIsGT(set, lowerbound, pricer->centerbound)) )
+      return SCIP_OKAY;
+
+   rows = SCIPlpGetRows(lp);
+   nrows = SCIPlpGetNRows(lp);
+
+   SCIP_CALL( pricerEnsureDualsSize(pricer, set, nrows) );
+
+   for( r = 0; r < nrows; ++r )
+   {
+      pricer->centerduals[r] = (r < pricer->nstabduals ? pricer->stabduals[r] : SCIProwGetDualsol(rows[r]));
+      pricer->centerrowidx[r] = SCIProwGetIndex(rows[r]);
+   }
+   pricer->ncenterduals = nrows;
+   pricer->centerbound = lowerbound;
+
+   return SCIP_OKAY;
+}
+
 /** calls reduced cost pricing method of variable pricer */
 SCIP_RETCODE SCIPpricerRedcost(
    SCIP_PRICER*          pricer,             /**< variable pricer */
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_PROB*            prob,               /**< transformed problem */
+   SCIP_LP*              lp,                 /**< LP data */
+   SCIP_TREE*            tree,               /**< branch and bound tree */
    SCIP_Real*            lowerbound,         /**< local lower bound computed by the pricer */
    SCIP_Bool*            stopearly,          /**< should pricing be stopped, although new variables were added? */
    SCIP_RESULT*          result              /**< result of the pricing process */    
    )
 {
+   SCIP_Real alpha;
+   SCIP_Real bestlowerbound;
+   int nmisprices;
    int oldnvars;
 
    assert(pricer != NULL);
@@ -408,6 +539,8 @@ SCIP_RETCODE SCIPpricerRedcost(
    assert(pricer->pricerredcost != NULL);
    assert(set != NULL);
    assert(prob != NULL);
+   assert(lp != NULL);
+   assert(tree != NULL);
    assert(lowerbound != NULL);
    assert(result != NULL);
 
@@ -418,14 +551,63 @@ SCIP_RETCODE SCIPpricerRedcost(
    /* start timing */
    SCIPclockStart(pricer->pricerclock, set);
 
-   /* call external method */
-   SCIP_CALL( pricer->pricerredcost(set->scip, pricer, lowerbound, stopearly, result) );
+   /* the stabilization center is only valid for the node it was computed at */
+   if( pricer->smoothing > 0.0 )
+   {
+      SCIP_Longint nodenumber;
+
+      nodenumber = SCIPnodeGetNumber(SCIPtreeGetCurrentNode(tree));
+      if( nodenumber != pricer->centernode )
+      {
+         pricer->ncenterduals = 0;
+         pricer->centerbound = -SCIPsetInfinity(set);
+         pricer->centernode = nodenumber;
+      }
+   }
+
+   /* call external method; if no column was found for the stabilized dual values, this is a misprice and pricing is
+    * repeated with a smaller smoothing factor, until the raw LP dual values are used; the lower bound of a call with
+    * stabilized dual values is only valid if the pricer declared its lower bounds to be Lagrangian bounds for the dual
+    * values it used, the best valid bound of all calls is returned
+    */
+   nmisprices = 0;
+   alpha = pricer->smoothing;
+   bestlowerbound = -SCIPsetInfinity(set);
+   for( ;; )
+   {
+      SCIP_CALL( pricerComputeStabDuals(pricer, set, lp, alpha) );
+
+      SCIP_CALL( pricer->pricerredcost(set->scip, pricer, lowerbound, stopearly, result) );
+
+      if( pricer->nstabduals > 0 && !pricer->lagrangianbound )
+         *lowerbound = -SCIPsetInfinity(set);
+      bestlowerbound = MAX(bestlowerbound, *lowerbound);
+
+      if( pricer->smoothing > 0.0 )
+      {
+         SCIP_CALL( pricerUpdateStabCenter(pricer, set, lp, *lowerbound) );
+      }
+
+      if( pricer->nstabduals == 0 || prob->nvars > oldnvars || *result != SCIP_SUCCESS )
+         break;
+
+      /* the k-th repetition uses the smoothing factor 1 - (k+1)(1 - smoothing), and 0 once this gets nonpositive */
+      ++nmisprices;
+      ++pricer->nmisprices;
+      alpha = MAX(1.0 - (nmisprices + 1) * (1.0 - pricer->smoothing), 0.0);
+
+      SCIPsetDebugMsg(set, "misprice of pricer <%s>, reducing smoothing factor to %g\n", pricer->name, alpha);
+
+      *stopearly = FALSE;
+   }
+   *lowerbound = bestlowerbound;
+   pricer->ncalls++;
+   pricer->nstabduals = 0;
 
    /* stop timing */
    SCIPclockStop(pricer->pricerclock, set);
 
    /* evaluate result */
-   pricer->ncalls++;
    pricer->nvarsfound += prob->nvars - oldnvars;
 
    return SCIP_OKAY;
@@ -476,6 +658,7 @@ SCIP_RETCODE SCIPpricerExec(
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_PROB*            prob,               /**< transformed problem */
    SCIP_LP*              lp,                 /**< LP data */
+   SCIP_TREE*            tree,               /**< branch and bound tree */
    SCIP_PRICESTORE*      pricestore,         /**< pricing storage */
    SCIP_Real*            lowerbound,         /**< local lower bound computed by the pricer */
    SCIP_Bool*            stopearly,          /**< should pricing be stopped, although new variables were added? */
@@ -503,12 +686,297 @@ SCIP_RETCODE SCIPpricerExec(
    else
    {
       *result = SCIP_DIDNOTRUN;
-      SCIP_CALL( SCIPpricerRedcost(pricer, set, prob, lowerbound, stopearly, result) );
+      SCIP_CALL( SCIPpricerRedcost(pricer, set, prob, lp, tree, lowerbound, stopearly, result) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** executes a parallel pricing job on its buffer, unless enough columns were already found by other jobs */
+static
+SCIP_DECL_PARALLELJOB(execPricingJob)
+{
+   SCIP_PRICINGBUFFER* buffer;
+
+   buffer = (SCIP_PRICINGBUFFER*)jobarg;
+   assert(buffer != NULL);
+   assert(buffer->pricingjob != NULL);
+
+   if( SCIPpricingbufferIsStopped(buffer) )
+      return SCIP_OKAY;
+
+   buffer->executed = TRUE;
+   SCIP_CALL( buffer->pricingjob(buffer->jobdata, buffer) );
+
+   return SCIP_OKAY;
+}
+
+/** executes the given pricing jobs of the pricer, in parallel if possible, and adds the best found columns
+ *
+ *  The jobs are started in a round-robin order that begins with a different job in each call (partial pricing), and
+ *  jobs that did not start before maxcols improving columns were found are skipped. The columns of all buffers are
+ *  merged, sorted by increasing reduced cost, and the at most maxcols improving ones are added by the addcol method in
+ *  the calling thread.
+ */
+SCIP_RETCODE SCIPpricerExecJobs(
+   SCIP_PRICER*          pricer,             /**< variable pricer */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_DECL_PRICINGJOB  ((*pricingjob)),    /**< pricing job that is executed for each job data */
+   SCIP_DECL_PRICINGADDCOL((*pricingaddcol)),/**< method to add a found column to the problem */
+   void**                jobdata,            /**< array with the data of the pricing jobs */
+   int                   njobs,              /**< number of pricing jobs */
+   int                   maxcols,            /**< maximal number of columns to add, or -1 for no limit */
+   int*                  naddedcols,         /**< pointer to store the number of added columns */
+   SCIP_Bool*            complete            /**< pointer to store whether all jobs were executed, or NULL */
+   )
+{
+   SCIP_PRICINGBUFFER* buffers;
+   SCIP_PRICINGCOL** cols;
+   SCIP_Real* redcosts;
+   SCIP_LOCK* lock;
+   SCIP_RETCODE retcode;
+   void** jobargs;
+   int nfound;
+   int ncols;
+   int nexecuted;
+   int i;
+   int j;
+
+   assert(pricer != NULL);
+   assert(set != NULL);
+   assert(pricingjob != NULL);
+   assert(pricingaddcol != NULL);
+   assert(jobdata != NULL || njobs == 0);
+   assert(naddedcols != NULL);
+
+   *naddedcols = 0;
+   if( complete != NULL )
+      *complete = TRUE;
+
+   if( njobs == 0 )
+      return SCIP_OKAY;
+
+   if( maxcols < 0 )
+      maxcols = INT_MAX;
+
+   /* the buffers are filled by the jobs in other threads, so they must not use SCIP's memory */
+   SCIP_ALLOC( BMSallocClearMemoryArray(&buffers, njobs) );
+   SCIP_ALLOC( BMSallocMemoryArray(&jobargs, njobs) );
+   SCIP_CALL( SCIPtpiInitLock(&lock) );
+   nfound = 0;
+
+   /* start with a different job in each call, such that all subproblems are considered when pricing partially */
+   if( pricer->jobstart >= njobs )
+      pricer->jobstart = 0;
+
+   for( i = 0; i < njobs; ++i )
+   {
+      j = (pricer->jobstart + i) % njobs;
+      buffers[i].jobdata = jobdata[j];
+      buffers[i].pricingjob = pricingjob;
+      buffers[i].lock = lock;
+      buffers[i].nfound = &nfound;
+      buffers[i].redcosttol = SCIPsetDualfeastol(set);
+      buffers[i].maxcols = maxcols;
+      jobargs[i] = (void*)&buffers[i];
+   }
+
+   retcode = SCIPexecParallelJobs(set->scip, -1, execPricingJob, jobargs, njobs);
+
+   /* merge the buffers; the next call starts with the first job that was skipped, or with the successor of the start */
+   ncols = 0;
+   nexecuted = 0;
+   for( i = 0; i < njobs; ++i )
+   {
+      ncols += buffers[i].ncols;
+      if( buffers[i].executed )
+         ++nexecuted;
+   }
+   pricer->jobstart = (pricer->jobstart + MAX(nexecuted, 1)) % njobs;
+
+   if( complete != NULL )
+      *complete = (nexecuted == njobs);
+
+   cols = NULL;
+   redcosts = NULL;
+   if( retcode == SCIP_OKAY && ncols > 0 )
+   {
+      SCIP_ALLOC( BMSallocMemoryArray(&cols, ncols) );
+      SCIP_ALLOC( BMSallocMemoryArray(&redcosts, ncols) );
+
+      ncols = 0;
+      for( i = 0; i < njobs; ++i )
+      {
+         for( j = 0; j < buffers[i].ncols; ++j )
+         {
+            cols[ncols] = &buffers[i].cols[j];
+            redcosts[ncols] = buffers[i].cols[j].redcost;
+            ++ncols;
+         }
+      }
+
+      SCIPsortRealPtr(redcosts, (void**)cols, ncols);
+
+      for( i = 0; i < ncols && *naddedcols < maxcols && SCIPsetIsDualfeasNegative(set, redcosts[i]); ++i )
+      {
+         retcode = pricingaddcol(set->scip, pricer, cols[i]->data, redcosts[i]);
+         if( retcode != SCIP_OKAY )
+            break;
+         ++(*naddedcols);
+      }
+
+      BMSfreeMemoryArray(&redcosts);
+      BMSfreeMemoryArray(&cols);
+   }
+
+   /* free the column data of all buffers */
+   for( i = 0; i < njobs; ++i )
+   {
+      for( j = 0; j < buffers[i].ncols; ++j )
+         BMSfreeMemoryNull(&buffers[i].cols[j].data);
+      BMSfreeMemoryArrayNull(&buffers[i].cols);
+   }
+
+   SCIPtpiDestroyLock(&lock);
+   BMSfreeMemoryArray(&jobargs);
+   BMSfreeMemoryArray(&buffers);
+
+   SCIPsetDebugMsg(set, "pricer <%s>: executed %d of %d pricing jobs, found %d columns, added %d\n", pricer->name,
+      nexecuted, njobs, ncols, *naddedcols);
+
+   return retcode;
+}
+
+/** stores a column that was found by a pricing job in the job's buffer
+ *
+ *  The column data is copied, such that the job can reuse or free its own memory. This method is thread-safe for
+ *  different buffers and may be called from within SCIP_DECL_PRICINGJOB only.
+ */
+SCIP_RETCODE SCIPpricingbufferAddCol(
+   SCIP_PRICINGBUFFER*   buffer,             /**< buffer of the pricing job */
+   void*                 coldata,            /**< data describing the column, which is passed to the addcol method */
+   size_t                coldatasize,        /**< size of the column data in bytes */
+   SCIP_Real             redcost             /**< reduced cost of the column */
+   )
+{
+   assert(buffer != NULL);
+   assert(coldata != NULL || coldatasize == 0);
+
+   if( buffer->ncols == buffer->colssize )
+   {
+      buffer->colssize = MAX(2 * buffer->colssize, 8);
+      SCIP_ALLOC( BMSreallocMemoryArray(&buffer->cols, buffer->colssize) );
+   }
+   assert(buffer->ncols < buffer->colssize);
+
+   buffer->cols[buffer->ncols].data = NULL;
+   if( coldatasize > 0 )
+   {
+      SCIP_ALLOC( BMSduplicateMemorySize(&buffer->cols[buffer->ncols].data, coldata, coldatasize) );
+   }
+   buffer->cols[buffer->ncols].redcost = redcost;
+   ++buffer->ncols;
+
+   /* only improving columns count towards the early termination of all jobs */
+   if( redcost < -buffer->redcosttol )
+   {
+      SCIP_CALL( SCIPtpiAcquireLock(buffer->lock) );
+      ++(*buffer->nfound);
+      SCIP_CALL( SCIPtpiReleaseLock(buffer->lock) );
    }
 
    return SCIP_OKAY;
 }
 
+/** returns whether the pricing jobs found enough columns with negative reduced costs, such that the calling job
+ *  can stop
+ */
+SCIP_Bool SCIPpricingbufferIsStopped(
+   SCIP_PRICINGBUFFER*   buffer              /**< buffer of the pricing job */
+   )
+{
+   SCIP_Bool stopped;
+
+   assert(buffer != NULL);
+
+   if( SCIPtpiAcquireLock(buffer->lock) != SCIP_OKAY )
+      return FALSE;
+   stopped = (*buffer->nfound >= buffer->maxcols);
+   if( SCIPtpiReleaseLock(buffer->lock) != SCIP_OKAY )
+      return FALSE;
+
+   return stopped;
+}
+
+/** returns the number of columns stored in the buffer of the pricing job */
+int SCIPpricingbufferGetNCols(
+   SCIP_PRICINGBUFFER*   buffer              /**< buffer of the pricing job */
+   )
+{
+   assert(buffer != NULL);
+
+   return buffer->ncols;
+}
+
+/** returns the dual value of the given LP row that the pricer should use in its reduced cost pricing callback
+ *
+ *  If dual stabilization is enabled by the parameter pricers/<name>/smoothing, this is the convex combination of the
+ *  dual value at the stabilization center and the current LP dual value; otherwise, it is the LP dual value.
+ */
+SCIP_Real SCIPpricerGetStabilizedDualsol(
+   SCIP_PRICER*          pricer,             /**< variable pricer */
+   SCIP_ROW*             row                 /**< LP row */
+   )
+{
+   int pos;
+
+   assert(pricer != NULL);
+   assert(row != NULL);
+
+   pos = SCIProwGetLPPos(row);
+   if( pos >= 0 && pos < pricer->nstabduals )
+      return pricer->stabduals[pos];
+
+   return SCIProwGetDualsol(row);
+}
+
+/** declares whether the lower bound returned by the reduced cost pricing callback of the pricer is a Lagrangian bound
+ *  for the dual values it used
+ */
+void SCIPpricerSetLagrangianBound(
+   SCIP_PRICER*          pricer,             /**< variable pricer */
+   SCIP_Bool             lagrangianbound     /**< is the lower bound a Lagrangian bound for the used dual values? */
+   )
+{
+   assert(pricer != NULL);
+
+   pricer->lagrangianbound = lagrangianbound;
+}
+
+/** is the lower bound returned by the reduced cost pricing callback of the pricer a Lagrangian bound for the dual values
+ *  it used?
+ */
+SCIP_Bool SCIPpricerHasLagrangianBound(
+   SCIP_PRICER*          pricer              /**< variable pricer */
+   )
+{
+   assert(pricer != NULL);
+
+   return pricer->lagrangianbound;
+}
+
+/** gets the number of misprices of the pricer, i.e., the number of pricing calls with stabilized dual values that did
+ *  not find a column and had to be repeated with a smaller smoothing factor
+ */
+int SCIPpricerGetNMisprices(
+   SCIP_PRICER*          pricer              /**< variable pricer */
+   )
+{
+   assert(pricer != NULL);
+
+   return pricer->nmisprices;
+}
+
 /** gets user data of variable pricer */
 SCIP_PRICERDATA* SCIPpricerGetData(
    SCIP_PRICER*          pricer              /**< variable pricer */
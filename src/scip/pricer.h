@@ -44,6 +44,7 @@
 #include "scip/type_prob.h"
 #include "scip/type_pricestore.h"
 #include "scip/type_pricer.h"
+#include "scip/type_tree.h"
 #include "scip/pub_pricer.h"
 
 #ifdef __cplusplus
@@ -133,6 +134,8 @@ SCIP_RETCODE SCIPpricerRedcost(
    SCIP_PRICER*          pricer,             /**< variable pricer */
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_PROB*            prob,               /**< transformed problem */
+   SCIP_LP*              lp,                 /**< LP data */
+   SCIP_TREE*            tree,               /**< branch and bound tree */
    SCIP_Real*            lowerbound,         /**< local lower bound computed by the pricer */
    SCIP_Bool*            stopearly,          /**< should pricing be stopped, although new variables were added? */
    SCIP_RESULT*          result              /**< result of the pricing process */    
@@ -146,12 +149,26 @@ SCIP_RETCODE SCIPpricerFarkas(
    SCIP_RESULT*          result              /**< result of the pricing process */
    );
 
+/** executes the given pricing jobs of the pricer, in parallel if possible, and adds the best found columns */
+SCIP_RETCODE SCIPpricerExecJobs(
+   SCIP_PRICER*          pricer,             /**< variable pricer */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_DECL_PRICINGJOB  ((*pricingjob)),    /**< pricing job that is executed for each job data */
+   SCIP_DECL_PRICINGADDCOL((*pricingaddcol)),/**< method to add a found column to the problem */
+   void**                jobdata,            /**< array with the data of the pricing jobs */
+   int                   njobs,              /**< number of pricing jobs */
+   int                   maxcols,            /**< maximal number of columns to add, or -1 for no limit */
+   int*                  naddedcols,         /**< pointer to store the number of added columns */
+   SCIP_Bool*            complete            /**< pointer to store whether all jobs were executed, or NULL */
+   );
+
 /** depending on the LP's solution status, calls reduced cost or Farkas pricing method of variable pricer */
 SCIP_RETCODE SCIPpricerExec(
    SCIP_PRICER*          pricer,             /**< variable pricer */
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_PROB*            prob,               /**< transformed problem */
    SCIP_LP*              lp,                 /**< LP data */
+   SCIP_TREE*            tree,               /**< branch and bound tree */
    SCIP_PRICESTORE*      pricestore,         /**< pricing storage */
    SCIP_Real*            lowerbound,         /**< local lower bound computed by the pricer */
    SCIP_Bool*            stopearly,          /**< should pricing be stopped, although new variables were added? */
@@ -149,6 +149,23 @@ struct SCIP_PropData
                                               *   propagation of an improved primal bound, should start */
    int*                  gstartcomponents;   /**< components corresponding to indices stored in gstartindices array */
    int                   gstartindicessize;  /**< size of gstartindices and gstartcomponents arrays */
+   SCIP_VAR**            packedvars;         /**< variables occurring in the sorted genvbounds */
+   int*                  packedbeg;          /**< start of the right-hand side of each sorted genvbound in the packed
+                                              *   arrays; the entry packedbeg[npackedgenvbounds] is the number of
+                                              *   nonzeros */
+   int*                  packedvaridx;       /**< indices in packedvars of the right-hand side variables */
+   SCIP_Real*            packedcoefs;        /**< coefficients of the right-hand side variables */
+   SCIP_Real*            packedconstants;    /**< constants of the sorted genvbounds */
+   SCIP_Real*            packedcutoffcoefs;  /**< cutoff coefficients of the sorted genvbounds */
+   int*                  packedlhsidx;       /**< index in packedvars of the left-hand side variable of each sorted
+                                              *   genvbound */
+   SCIP_Real*            snapshotlbs;        /**< lower bounds of packedvars taken in the current propagation sweep */
+   SCIP_Real*            snapshotubs;        /**< upper bounds of packedvars taken in the current propagation sweep */
+   int*                  snapshottags;       /**< sweep tag at which the bounds of a packed variable were taken */
+   int                   snapshottag;        /**< tag of the current propagation sweep */
+   int                   npackedvars;        /**< number of variables in packedvars */
+   int                   npackedgenvbounds;  /**< number of genvbounds in the packed arrays */
+   int                   npackednnz;         /**< number of nonzeros in the packed arrays */
    SCIP_Real             lastcutoff;         /**< cutoff bound's value last time genvbounds propagator was called */
    int                   genvboundstoresize; /**< size of genvboundstore array */
    int                   ngenvbounds;        /**< number of genvbounds stored in genvboundstore array */
@@ -627,7 +644,26 @@ SCIP_RETCODE freeComponentsData(
       propdata->ncomponents = -1;
    }
 
+   /* the packed genvbounds are only valid for the sorted genvboundstore */
+   if( propdata->packedbeg != NULL )
+   {
+      SCIPfreeBlockMemoryArray(scip, &(propdata->snapshottags), propdata->npackedvars);
+      SCIPfreeBlockMemoryArray(scip, &(propdata->snapshotubs), propdata->npackedvars);
+      SCIPfreeBlockMemoryArray(scip, &(propdata->snapshotlbs), propdata->npackedvars);
+      SCIPfreeBlockMemoryArray(scip, &(propdata->packedlhsidx), propdata->npackedgenvbounds);
+      SCIPfreeBlockMemoryArray(scip, &(propdata->packedcutoffcoefs), propdata->npackedgenvbounds);
+      SCIPfreeBlockMemoryArray(scip, &(propdata->packedconstants), propdata->npackedgenvbounds);
+      SCIPfreeBlockMemoryArrayNull(scip, &(propdata->packedcoefs), propdata->npackednnz);
+      SCIPfreeBlockMemoryArrayNull(scip, &(propdata->packedvaridx), propdata->npackednnz);
+      SCIPfreeBlockMemoryArray(scip, &(propdata->packedbeg), propdata->npackedgenvbounds + 1);
+      SCIPfreeBlockMemoryArray(scip, &(propdata->packedvars), propdata->npackedvars);
+      propdata->npackedvars = 0;
+      propdata->npackedgenvbounds = 0;
+      propdata->npackednnz = 0;
+   }
+
    assert(propdata->componentsstart == NULL);
+   assert(propdata->packedbeg == NULL);
    assert(propdata->ncomponents == -1);
 
    return SCIP_OKAY;
@@ -1113,20 +1149,20 @@ SCIP_RETCODE analyzeGenVBoundConflict(
    return SCIP_OKAY;
 }
 
-/** apply propagation for one generalized variable bound; also if the left-hand side variable is locally fixed, we
- *  compute the right-hand side minactivity to possibly detect infeasibility
+/** tightens the bound of the left-hand side variable of a generalized variable bound to the given bound value and
+ *  starts conflict analysis in case of infeasibility
  */
 static
-SCIP_RETCODE applyGenVBound(
+SCIP_RETCODE tightenGenVBound(
    SCIP*                 scip,               /**< SCIP data structure */
    SCIP_PROP*            prop,               /**< genvbounds propagator */
    GENVBOUND*            genvbound,          /**< genvbound data structure */
+   SCIP_Real             boundval,           /**< bound value provided by the genvbound */
    SCIP_Bool             global,             /**< apply global bound changes? (global: true, local: false)*/
    SCIP_RESULT*          result,             /**< result pointer */
    int*                  nchgbds             /**< counter to increment if bound was tightened */
    )
 {
-   SCIP_Real boundval;
    SCIP_Bool infeas;
    SCIP_Bool tightened;
 
@@ -1137,9 +1173,6 @@ SCIP_RETCODE applyGenVBound(
    assert(result != NULL);
    assert(*result != SCIP_DIDNOTRUN);
 
-   /* get bound value provided by genvbound */
-   boundval = getGenVBoundsBound(scip, genvbound, global);
-
    if( SCIPisInfinity(scip, REALABS(boundval)) )
       return SCIP_OKAY;
 
@@ -1225,6 +1258,103 @@ SCIP_RETCODE applyGenVBound(
    return SCIP_OKAY;
 }
 
+/** apply propagation for one generalized variable bound; also if the left-hand side variable is locally fixed, we
+ *  compute the right-hand side minactivity to possibly detect infeasibility
+ */
+static
+SCIP_RETCODE applyGenVBound(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PROP*            prop,               /**< genvbounds propagator */
+   GENVBOUND*            genvbound,          /**< genvbound data structure */
+   SCIP_Bool             global,             /**< apply global bound changes? (global: true, local: false)*/
+   SCIP_RESULT*          result,             /**< result pointer */
+   int*                  nchgbds             /**< counter to increment if bound was tightened */
+   )
+{
+   assert(genvbound != NULL);
+
+   /* get bound value provided by genvbound and apply it */
+   SCIP_CALL( tightenGenVBound(scip, prop, genvbound, getGenVBoundsBound(scip, genvbound, global), global, result,
+         nchgbds) );
+
+   return SCIP_OKAY;
+}
+
+/** returns the bound given by the sorted genvbound at position idx of genvboundstore, evaluated on the packed arrays;
+ *  the bounds of the right-hand side variables are taken from the snapshot of the current sweep, which is filled
+ *  lazily on first access of a variable
+ */
+static
+SCIP_Real getPackedGenVBoundsBound(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PROPDATA*        propdata,           /**< data of the genvbounds propagator */
+   int                   idx,                /**< index of the genvbound in genvboundstore */
+   SCIP_Bool             global,             /**< use global variable bounds? */
+   SCIP_Real             cutoffbound         /**< cutoff bound of the current sweep */
+   )
+{
+   SCIP_Real* snapshotlbs;
+   SCIP_Real* snapshotubs;
+   SCIP_Real* coefs;
+   int* varidx;
+   SCIP_Real infinity;
+   SCIP_Real boundval;
+   int tag;
+   int beg;
+   int end;
+   int k;
+
+   assert(propdata != NULL);
+   assert(propdata->packedbeg != NULL);
+   assert(0 <= idx && idx < propdata->npackedgenvbounds);
+
+   snapshotlbs = propdata->snapshotlbs;
+   snapshotubs = propdata->snapshotubs;
+   coefs = propdata->packedcoefs;
+   varidx = propdata->packedvaridx;
+   tag = propdata->snapshottag;
+   beg = propdata->packedbeg[idx];
+   end = propdata->packedbeg[idx + 1];
+
+   /* take the bounds of variables that are accessed for the first time in this sweep */
+   for( k = beg; k < end; ++k )
+   {
+      int v = varidx[k];
+
+      if( propdata->snapshottags[v] != tag )
+      {
+         SCIP_VAR* var = propdata->packedvars[v];
+
+         snapshotlbs[v] = global ? SCIPvarGetLbGlobal(var) : SCIPvarGetLbLocal(var);
+         snapshotubs[v] = global ? SCIPvarGetUbGlobal(var) : SCIPvarGetUbLocal(var);
+         propdata->snapshottags[v] = tag;
+      }
+   }
+
+   /* compute the minactivity on the contiguous arrays; with infinite bounds it is minus infinity */
+   infinity = SCIPinfinity(scip);
+   boundval = 0.0;
+   for( k = beg; k < end; ++k )
+   {
+      SCIP_Real bound = coefs[k] > 0.0 ? snapshotlbs[varidx[k]] : snapshotubs[varidx[k]];
+
+      if( REALABS(bound) >= infinity )
+         return (propdata->genvboundstore[idx]->boundtype == SCIP_BOUNDTYPE_LOWER) ? -infinity : infinity;
+
+      boundval += coefs[k] * bound;
+   }
+
+   if( propdata->packedcutoffcoefs[idx] != 0.0 )
+      boundval += propdata->packedcutoffcoefs[idx] * cutoffbound;
+
+   boundval += propdata->packedconstants[idx];
+
+   if( propdata->genvboundstore[idx]->boundtype == SCIP_BOUNDTYPE_UPPER )
+      boundval *= -1.0;
+
+   return boundval;
+}
+
 #ifdef SCIP_DEBUG
 /** prints event data as debug message */
 static
@@ -1589,6 +1719,111 @@ SCIP_RETCODE setUpEvents(
    return SCIP_OKAY;
 }
 
+/** stores the right-hand sides of the sorted genvbounds in contiguous arrays, such that propagation of a component is
+ *  a sweep over consecutive memory that accesses the variable structs only once per variable and sweep
+ */
+static
+SCIP_RETCODE packGenVBounds(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PROPDATA*        propdata            /**< data of the genvbounds propagator */
+   )
+{
+   SCIP_HASHMAP* varmap;
+   int ngenvbounds;
+   int nnz;
+   int i;
+
+   assert(scip != NULL);
+   assert(propdata != NULL);
+   assert(propdata->issorted);
+   assert(propdata->packedbeg == NULL);
+
+   ngenvbounds = propdata->ngenvbounds;
+   if( ngenvbounds <= 0 )
+      return SCIP_OKAY;
+
+   nnz = 0;
+   for( i = 0; i < ngenvbounds; ++i )
+      nnz += propdata->genvboundstore[i]->ncoefs;
+
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(propdata->packedvars), nnz + ngenvbounds) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(propdata->packedbeg), ngenvbounds + 1) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(propdata->packedconstants), ngenvbounds) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(propdata->packedcutoffcoefs), ngenvbounds) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(propdata->packedlhsidx), ngenvbounds) );
+   if( nnz > 0 )
+   {
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(propdata->packedvaridx), nnz) );
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(propdata->packedcoefs), nnz) );
+   }
+
+   SCIP_CALL( SCIPhashmapCreate(&varmap, SCIPblkmem(scip), nnz + ngenvbounds) );
+
+   /* collect the variables and fill the packed arrays in the order of genvboundstore */
+   propdata->npackedvars = 0;
+   nnz = 0;
+   for( i = 0; i < ngenvbounds; ++i )
+   {
+      GENVBOUND* genvbound;
+      int j;
+
+      genvbound = propdata->genvboundstore[i];
+      assert(genvbound->index == i);
+
+      propdata->packedbeg[i] = nnz;
+      propdata->packedconstants[i] = genvbound->constant;
+      propdata->packedcutoffcoefs[i] = genvbound->cutoffcoef;
+
+      for( j = 0; j <= genvbound->ncoefs; ++j )
+      {
+         SCIP_VAR* var;
+         int v;
+
+         /* the left-hand side variable is treated last */
+         var = j < genvbound->ncoefs ? genvbound->vars[j] : genvbound->var;
+
+         v = SCIPhashmapGetImageInt(varmap, (void*)var);
+         if( v == INT_MAX )
+         {
+            v = propdata->npackedvars++;
+            propdata->packedvars[v] = var;
+            SCIP_CALL( SCIPhashmapInsertInt(varmap, (void*)var, v) );
+         }
+
+         if( j < genvbound->ncoefs )
+         {
+            propdata->packedvaridx[nnz] = v;
+            propdata->packedcoefs[nnz] = genvbound->coefs[j];
+            ++nnz;
+         }
+         else
+            propdata->packedlhsidx[i] = v;
+      }
+   }
+   propdata->packedbeg[ngenvbounds] = nnz;
+
+   SCIPhashmapFree(&varmap);
+
+   /* shrink the variable array to the number of distinct variables */
+   SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &(propdata->packedvars), nnz + ngenvbounds, propdata->npackedvars) );
+
+   /* all snapshot entries are initially outdated */
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(propdata->snapshotlbs), propdata->npackedvars) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(propdata->snapshotubs), propdata->npackedvars) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(propdata->snapshottags), propdata->npackedvars) );
+   for( i = 0; i < propdata->npackedvars; ++i )
+      propdata->snapshottags[i] = -1;
+   propdata->snapshottag = 0;
+
+   propdata->npackedgenvbounds = ngenvbounds;
+   propdata->npackednnz = nnz;
+
+   SCIPdebugMsg(scip, "packed %d genvbounds with %d nonzeros in %d variables\n", ngenvbounds, nnz,
+      propdata->npackedvars);
+
+   return SCIP_OKAY;
+}
+
 /** performs a topological sort on genvboundstore array
  *
  *  The genvbounds graph is defined as follows: Given two genvbounds
@@ -1735,6 +1970,9 @@ SCIP_RETCODE sortGenVBounds(
    /* remember genvboundstore as sorted */
    propdata->issorted = TRUE;
 
+   /* store the sorted genvbounds in packed arrays */
+   SCIP_CALL( packGenVBounds(scip, propdata) );
+
 #ifdef SCIP_DEBUG
    SCIPdebugMsg(scip, "genvbounds got: %d\n", propdata->ngenvbounds);
    for( i = 0; i < propdata->ncomponents; i++ )
@@ -1767,6 +2005,7 @@ SCIP_RETCODE applyGenVBounds(
    )
 {
    SCIP_PROPDATA* propdata;
+   SCIP_Real cutoffbound;
    int* startingcomponents;
    int* startingindices;
    int nindices;
@@ -1816,6 +2055,23 @@ SCIP_RETCODE applyGenVBounds(
    startingindices = global ? propdata->gstartindices : propdata->startindices;
    nindices = global ? propdata->ngindices : propdata->nindices;
 
+   /* start a new sweep on the packed genvbounds: the bound snapshot of the previous sweep is outdated */
+   cutoffbound = SCIPinfinity(scip);
+   if( propdata->packedbeg != NULL && nindices > 0 )
+   {
+      assert(propdata->npackedgenvbounds == propdata->ngenvbounds);
+
+      if( propdata->snapshottag == INT_MAX )
+      {
+         for( i = 0; i < propdata->npackedvars; ++i )
+            propdata->snapshottags[i] = -1;
+         propdata->snapshottag = 0;
+      }
+      ++propdata->snapshottag;
+
+      cutoffbound = getCutoffboundGenVBound(scip);
+   }
+
    for( i = 0; i < nindices && *result != SCIP_CUTOFF; i++ )
    {
       int j;
@@ -1833,7 +2089,19 @@ SCIP_RETCODE applyGenVBounds(
          else
          {
             SCIPdebugMsg(scip, "applying genvbound with index %d, component %d\n", j, startingcomponents[i]);
-            SCIP_CALL( applyGenVBound(scip, prop, propdata->genvboundstore[j], global, result, nchgbds) );
+
+            if( propdata->packedbeg != NULL )
+            {
+               SCIP_CALL( tightenGenVBound(scip, prop, propdata->genvboundstore[j],
+                     getPackedGenVBoundsBound(scip, propdata, j, global, cutoffbound), global, result, nchgbds) );
+
+               /* the bounds of the left-hand side variable may have changed; take them again on next access */
+               propdata->snapshottags[propdata->packedlhsidx[j]] = -1;
+            }
+            else
+            {
+               SCIP_CALL( applyGenVBound(scip, prop, propdata->genvboundstore[j], global, result, nchgbds) );
+            }
          }
       }
    }
@@ -2356,6 +2624,20 @@ SCIP_DECL_PROPINIT(propInitGenvbounds)
    propdata->startcomponents = NULL;
    propdata->gstartindices = NULL;
    propdata->gstartcomponents = NULL;
+   propdata->packedvars = NULL;
+   propdata->packedbeg = NULL;
+   propdata->packedvaridx = NULL;
+   propdata->packedcoefs = NULL;
+   propdata->packedconstants = NULL;
+   propdata->packedcutoffcoefs = NULL;
+   propdata->packedlhsidx = NULL;
+   propdata->snapshotlbs = NULL;
+   propdata->snapshotubs = NULL;
+   propdata->snapshottags = NULL;
+   propdata->snapshottag = 0;
+   propdata->npackedvars = 0;
+   propdata->npackedgenvbounds = 0;
+   propdata->npackednnz = 0;
    propdata->lastcutoff = SCIPinfinity(scip);
    propdata->lastnodecaught = NULL;
    propdata->cutoffboundvar = NULL;
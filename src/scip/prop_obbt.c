@@ -47,6 +47,7 @@
 #include <assert.h>
 #include <string.h>
 
+#include "lpi/lpi.h"
 #include "scip/cons_indicator.h"
 #include "scip/cons_linear.h"
 #include "scip/cons_nonlinear.h"
@@ -62,6 +63,7 @@
 #include "scip/pub_prop.h"
 #include "scip/pub_tree.h"
 #include "scip/pub_var.h"
+#include "scip/scip_concurrent.h"
 #include "scip/scip_cons.h"
 #include "scip/scip_copy.h"
 #include "scip/scip_cut.h"
@@ -79,6 +81,7 @@
 #include "scip/scip_solvingstats.h"
 #include "scip/scip_tree.h"
 #include "scip/scip_var.h"
+#include "tpi/tpi.h"
 
 #define PROP_NAME                       "obbt"
 #define PROP_DESC                       "optimization-based bound tightening propagator"
@@ -129,7 +132,12 @@
 #define DEFAULT_CREATE_LINCONS         FALSE /**< create linear constraints from inequalities for bilinear terms? */
 #define DEFAULT_ITLIMITFAC_BILININEQS    3.0 /**< multiple of OBBT LP limit used as total LP iteration limit for solving bilinear inequality LPs (< 0 for no limit) */
 #define DEFAULT_MINNONCONVEXITY         1e-1 /**< minimum nonconvexity for choosing a bilinear term */
+#define DEFAULT_MAXBILINCOEF             1e+3 /**< maximal absolute value of the y-coefficient of an inequality for a
+                                              *   bilinear term with normalized x-coefficient; its inverse is the
+                                              *   minimal absolute value */
 #define DEFAULT_RANDSEED                 149 /**< initial random seed */
+#define DEFAULT_PARALLEL               FALSE /**< should the LPs be solved in parallel on clones of the LP relaxation
+                                              *   if threads are available? */
 
 /*
  * Data structures
@@ -195,6 +203,8 @@ struct SCIP_PropData
                                               *   iterations in root node */
    SCIP_Real             itlimitfactorbilin; /**< multiple of OBBT LP limit used as total LP iteration limit for solving bilinear inequality LPs (< 0 for no limit) */
    SCIP_Real             minnonconvexity;    /**< lower bound on minimum absolute value of nonconvex eigenvalues for a bilinear term */
+   SCIP_Real             maxbilincoef;       /**< maximal absolute value of the y-coefficient of an inequality for a
+                                              *   bilinear term with normalized x-coefficient */
    SCIP_Real             indicatorthreshold; /**< threshold whether upper bounds of vars of indicator conss are considered or tightened */
    SCIP_Bool             applyfilterrounds;  /**< apply filter rounds? */
    SCIP_Bool             applytrivialfilter; /**< should obbt try to use the LP solution to filter some bounds? */
@@ -215,6 +225,8 @@ struct SCIP_PropData
                                               *   immediatly */
    SCIP_Bool             createbilinineqs;   /**< solve auxiliary LPs in order to find valid inequalities for bilinear terms? */
    SCIP_Bool             createlincons;      /**< create linear constraints from inequalities for bilinear terms? */
+   SCIP_Bool             parallel;           /**< should the LPs be solved in parallel on clones of the LP relaxation
+                                              *   if threads are available? */
    int                   orderingalgo;       /**< which type of ordering algorithm should we use?
                                               *   (0: no, 1: greedy, 2: greedy reverse) */
    int                   nbounds;            /**< length of interesting bounds array */
@@ -2042,6 +2054,385 @@ SCIP_RETCODE findNewBounds(
 }
 
 
+/** solves the LP of an LP clone with the given iteration limit; called by the jobs of parallel OBBT, so no SCIP
+ *  methods may be used
+ *
+ *  @return TRUE if the LP was solved to optimality
+ */
+static
+SCIP_Bool solveLPClone(
+   SCIP_LPI*             lpi,                /**< LP interface of the clone */
+   SCIP_Longint          itlimit,            /**< iteration limit, or -1 for no limit */
+   int*                  niterations         /**< pointer to store the number of iterations */
+   )
+{
+   *niterations = 0;
+
+   if( SCIPlpiSetIntpar(lpi, SCIP_LPPAR_LPITLIM, itlimit < 0 || itlimit > INT_MAX ? INT_MAX : (int) itlimit) != SCIP_OKAY )
+      return FALSE;
+
+   /* an error should not kill the overall solving process */
+   if( SCIPlpiSolvePrimal(lpi) != SCIP_OKAY )
+      return FALSE;
+
+   if( SCIPlpiGetIterations(lpi, niterations) != SCIP_OKAY )
+      *niterations = 0;
+
+   return SCIPlpiIsOptimal(lpi);
+}
+
+/** data that is shared by the jobs of parallel OBBT */
+struct ObbtShared
+{
+   SCIP_LOCK*            lock;               /**< lock for the next task, the filtered flags, and the iterations */
+   SCIP_Real*            lbs;                /**< lower bounds of the LP columns */
+   SCIP_Real*            ubs;                /**< upper bounds of the LP columns */
+   int*                  lbtask;             /**< task of the lower bound of each LP column, or -1 */
+   int*                  ubtask;             /**< task of the upper bound of each LP column, or -1 */
+   SCIP_Bool*            filtered;           /**< is the task filtered because a solution attained its bound? */
+   SCIP_Real             feastol;            /**< feasibility tolerance for filtering */
+   SCIP_Longint          nleftiterations;    /**< number of iterations that are neither used nor reserved by a job, or -1
+                                              *   for no limit */
+   SCIP_Longint          niterations;        /**< number of iterations used by all jobs */
+   int                   njobs;              /**< number of jobs */
+   int                   nexttask;           /**< next task that is not assigned to a job */
+   int                   ntasks;             /**< number of tasks */
+   int                   nlpcols;            /**< number of LP columns */
+};
+typedef struct ObbtShared OBBTSHARED;
+
+/** reserves the iteration limit for the next LP of a job of parallel OBBT; the jobs share the left iterations, such
+ *  that the LPs that are solved at the same time never use more iterations than are left in total
+ *
+ *  @note must be called while the lock of the shared data is held
+ *
+ *  @return the iteration limit for the LP, 0 if no iterations are left, or -1 for no limit
+ */
+static
+SCIP_Longint obbtReserveIterations(
+   OBBTSHARED*           shared              /**< shared data */
+   )
+{
+   SCIP_Longint itlimit;
+
+   assert(shared != NULL);
+   assert(shared->njobs > 0);
+
+   if( shared->nleftiterations < 0 )
+      return -1;
+
+   itlimit = (shared->nleftiterations + shared->njobs - 1) / shared->njobs;
+   shared->nleftiterations -= itlimit;
+
+   return itlimit;
+}
+
+/** returns the iterations that were reserved for an LP of a job of parallel OBBT but not used
+ *
+ *  @note must be called while the lock of the shared data is held
+ */
+static
+void obbtReleaseIterations(
+   OBBTSHARED*           shared,             /**< shared data */
+   SCIP_Longint          itlimit,            /**< iteration limit that was reserved for the LP */
+   int                   niterations         /**< number of iterations used by the LP */
+   )
+{
+   assert(shared != NULL);
+
+   shared->niterations += niterations;
+   if( itlimit > 0 )
+      shared->nleftiterations += MAX(itlimit - niterations, 0);
+}
+
+/** bound LP task of parallel OBBT */
+struct ObbtTask
+{
+   SCIP_Real             newval;             /**< new bound value if found */
+   int                   lppos;              /**< LP position of the column of the bound */
+   SCIP_BOUNDTYPE        boundtype;          /**< type of the bound */
+   SCIP_Bool             solved;             /**< was the LP of the task solved? */
+   SCIP_Bool             found;              /**< was the LP of the task solved to optimality? */
+};
+typedef struct ObbtTask OBBTTASK;
+
+/** job of parallel OBBT that solves bound LP tasks on its own LP clone */
+struct ObbtJob
+{
+   OBBTSHARED*           shared;             /**< shared data */
+   OBBTTASK*             tasks;              /**< all tasks */
+   SCIP_LPI*             lpi;                /**< LP clone of the job */
+   SCIP_Real*            primsol;            /**< buffer for the primal solution */
+};
+typedef struct ObbtJob OBBTJOB;
+
+/** job of parallel OBBT: repeatedly takes the next unfiltered task, minimizes or maximizes the variable of the bound on
+ *  the LP clone, and filters the bounds of all tasks that are attained by the LP solution
+ */
+static
+SCIP_DECL_PARALLELJOB(obbtExecBoundJob)
+{
+   OBBTJOB* job = (OBBTJOB*)jobarg;
+   OBBTSHARED* shared = job->shared;
+
+   for( ;; )
+   {
+      OBBTTASK* task;
+      SCIP_Longint itlimit;
+      SCIP_Real obj;
+      SCIP_Bool optimal;
+      SCIP_Bool valid;
+      int niterations;
+      int t;
+      int c;
+
+      /* get the next task that is not filtered yet */
+      SCIP_CALL( SCIPtpiAcquireLock(shared->lock) );
+      while( shared->nexttask < shared->ntasks && shared->filtered[shared->nexttask] )
+         ++shared->nexttask;
+      t = shared->nexttask;
+      itlimit = 0;
+      if( t < shared->ntasks )
+      {
+         itlimit = obbtReserveIterations(shared);
+         if( itlimit != 0 )
+            ++shared->nexttask;
+      }
+      SCIP_CALL( SCIPtpiReleaseLock(shared->lock) );
+
+      if( t >= shared->ntasks || itlimit == 0 )
+         break;
+
+      task = &job->tasks[t];
+
+      /* minimize the variable for a lower bound, maximize it for an upper bound */
+      obj = task->boundtype == SCIP_BOUNDTYPE_LOWER ? 1.0 : -1.0;
+      niterations = 0;
+      optimal = SCIPlpiChgObj(job->lpi, 1, &task->lppos, &obj) == SCIP_OKAY;
+      optimal = optimal && solveLPClone(job->lpi, itlimit, &niterations);
+      optimal = optimal && SCIPlpiGetSol(job->lpi, NULL, job->primsol, NULL, NULL, NULL) == SCIP_OKAY;
+
+      /* the LP clone cannot be used for further tasks if its objective could not be reset */
+      obj = 0.0;
+      valid = SCIPlpiChgObj(job->lpi, 1, &task->lppos, &obj) == SCIP_OKAY;
+      optimal = optimal && valid;
+
+      task->solved = TRUE;
+      if( optimal )
+      {
+         task->newval = job->primsol[task->lppos];
+         task->found = TRUE;
+      }
+
+      SCIP_CALL( SCIPtpiAcquireLock(shared->lock) );
+      obbtReleaseIterations(shared, itlimit, niterations);
+
+      /* bounds that are attained by the LP solution cannot be improved */
+      if( optimal )
+      {
+         for( c = 0; c < shared->nlpcols; ++c )
+         {
+            if( shared->lbtask[c] >= 0 && job->primsol[c] <= shared->lbs[c] + shared->feastol )
+               shared->filtered[shared->lbtask[c]] = TRUE;
+            if( shared->ubtask[c] >= 0 && job->primsol[c] >= shared->ubs[c] - shared->feastol )
+               shared->filtered[shared->ubtask[c]] = TRUE;
+         }
+      }
+      SCIP_CALL( SCIPtpiReleaseLock(shared->lock) );
+
+      if( !valid )
+         break;
+   }
+
+   return SCIP_OKAY;
+}
+
+/** finds new variable bounds by solving the bound LPs in parallel on clones of the current LP
+ *
+ *  The unprocessed and unfiltered bounds are solved in the order of their scores by as many jobs as threads are
+ *  available. Each job solves the next unfiltered bound LP on its own LP clone and marks all bounds as filtered that
+ *  are attained by its LP solution, which is seen by the other jobs when they take their next bound. The LP clones
+ *  contain the cutoff row but are not changed otherwise, so in contrast to findNewBounds() no genvbounds are created,
+ *  and the bounds are neither tightened nor propagated during the solves.
+ */
+static
+SCIP_RETCODE findNewBoundsParallel(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PROPDATA*        propdata,           /**< data of the obbt propagator */
+   SCIP_Longint*         nleftiterations,    /**< pointer to store the number of left iterations */
+   int                   nthreads            /**< number of threads to use */
+   )
+{
+   SCIP_COL** cols;
+   OBBTSHARED shared;
+   OBBTTASK* tasks;
+   OBBTJOB* jobs;
+   BOUND** taskbounds;
+   void** jobargs;
+   SCIP_RETCODE retcode;
+   int ncols;
+   int ntasks;
+   int nfiltered;
+   int i;
+   int k;
+
+   assert(scip != NULL);
+   assert(propdata != NULL);
+   assert(nleftiterations != NULL);
+   assert(nthreads > 1);
+
+   SCIP_CALL( sortBounds(scip, propdata) );
+
+   SCIP_CALL( SCIPgetLPColsData(scip, &cols, &ncols) );
+
+   if( ncols == 0 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &tasks, propdata->nbounds) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &taskbounds, propdata->nbounds) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &shared.filtered, propdata->nbounds) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &shared.lbs, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &shared.ubs, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &shared.lbtask, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &shared.ubtask, ncols) );
+
+   for( i = 0; i < ncols; ++i )
+   {
+      shared.lbs[i] = SCIPcolGetLb(cols[i]);
+      shared.ubs[i] = SCIPcolGetUb(cols[i]);
+      shared.lbtask[i] = -1;
+      shared.ubtask[i] = -1;
+   }
+
+   /* create a task for each bound of a column variable that is still to be processed, in the order of the scores;
+    * as in the sequential version, the bounds of nonconvex variables and of variables of indicator constraints are
+    * processed first
+    */
+   ntasks = 0;
+   for( k = 0; k < 2; ++k )
+   {
+      for( i = 0; i < propdata->nbounds; ++i )
+      {
+         BOUND* bound = propdata->bounds[i];
+         int lppos;
+
+         if( bound->done || bound->filtered || (k == 0) != (bound->nonconvex || bound->indicator)
+            || SCIPvarGetStatus(bound->var) != SCIP_VARSTATUS_COLUMN )
+            continue;
+
+         lppos = SCIPcolGetLPPos(SCIPvarGetCol(bound->var));
+         if( lppos < 0 )
+            continue;
+
+         tasks[ntasks].lppos = lppos;
+         tasks[ntasks].boundtype = bound->boundtype;
+         tasks[ntasks].solved = FALSE;
+         tasks[ntasks].found = FALSE;
+         tasks[ntasks].newval = SCIP_INVALID;
+         taskbounds[ntasks] = bound;
+         shared.filtered[ntasks] = FALSE;
+
+         if( bound->boundtype == SCIP_BOUNDTYPE_LOWER )
+            shared.lbtask[lppos] = ntasks;
+         else
+            shared.ubtask[lppos] = ntasks;
+         ++ntasks;
+      }
+   }
+
+   nthreads = MIN(nthreads, ntasks);
+   retcode = SCIP_OKAY;
+
+   if( nthreads > 0 )
+   {
+      SCIP_CALL( SCIPallocClearBufferArray(scip, &jobs, nthreads) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &jobargs, nthreads) );
+
+      shared.feastol = SCIPfeastol(scip);
+      shared.nleftiterations = *nleftiterations;
+      shared.niterations = 0;
+      shared.njobs = nthreads;
+      shared.nexttask = 0;
+      shared.ntasks = ntasks;
+      shared.nlpcols = ncols;
+      SCIP_CALL( SCIPtpiInitLock(&shared.lock) );
+
+      /* the LP clones are freed on every exit path, since they are not part of SCIP's memory */
+      for( i = 0; i < nthreads; ++i )
+      {
+         jobs[i].shared = &shared;
+         jobs[i].tasks = tasks;
+         SCIP_CALL_TERMINATE( retcode, SCIPcreateLPICopy(scip, "obbtclone", FALSE, NULL, NULL, &jobs[i].lpi), TERMINATE );
+         SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &jobs[i].primsol, ncols), TERMINATE );
+         jobargs[i] = (void*)&jobs[i];
+      }
+
+      SCIP_CALL_TERMINATE( retcode, SCIPexecParallelJobs(scip, nthreads, obbtExecBoundJob, jobargs, nthreads), TERMINATE );
+
+   TERMINATE:
+      for( i = nthreads - 1; i >= 0; --i )
+      {
+         SCIPfreeBufferArrayNull(scip, &jobs[i].primsol);
+         if( jobs[i].lpi != NULL )
+         {
+            SCIP_CALL( SCIPlpiFree(&jobs[i].lpi) );
+         }
+      }
+      SCIPtpiDestroyLock(&shared.lock);
+   }
+
+   if( nthreads > 0 && retcode == SCIP_OKAY )
+   {
+      /* transfer the results to the bounds */
+      nfiltered = 0;
+      for( i = 0; i < ntasks; ++i )
+      {
+         BOUND* bound = taskbounds[i];
+
+         if( tasks[i].solved )
+         {
+            bound->done = TRUE;
+            ++propdata->nsolvedbounds;
+
+            if( tasks[i].found )
+            {
+               bound->newval = tasks[i].newval;
+               bound->found = TRUE;
+            }
+         }
+         else if( shared.filtered[i] )
+         {
+            bound->filtered = TRUE;
+            ++nfiltered;
+         }
+      }
+
+      SCIPdebugMsg(scip, "parallel obbt: %d tasks, %d filtered, %" SCIP_LONGINT_FORMAT " LP iterations\n", ntasks,
+         nfiltered, shared.niterations);
+
+      propdata->ntrivialfiltered += nfiltered;
+      propdata->nprobingiterations += shared.niterations;
+      *nleftiterations = shared.nleftiterations;
+   }
+
+   if( nthreads > 0 )
+   {
+      SCIPfreeBufferArray(scip, &jobargs);
+      SCIPfreeBufferArray(scip, &jobs);
+   }
+
+   SCIPfreeBufferArray(scip, &shared.ubtask);
+   SCIPfreeBufferArray(scip, &shared.lbtask);
+   SCIPfreeBufferArray(scip, &shared.ubs);
+   SCIPfreeBufferArray(scip, &shared.lbs);
+   SCIPfreeBufferArray(scip, &shared.filtered);
+   SCIPfreeBufferArray(scip, &taskbounds);
+   SCIPfreeBufferArray(scip, &tasks);
+
+   return retcode;
+}
+
+
 /** main function of obbt */
 static
 SCIP_RETCODE applyObbt(
@@ -2064,6 +2455,7 @@ SCIP_RETCODE applyObbt(
    SCIP_Bool boundleft;
    int oldpolishing;
    int nfiltered;
+   int nthreads;
    int nvars;
    int i;
 
@@ -2187,12 +2579,22 @@ SCIP_RETCODE applyObbt(
       }
    }
 
-   /* find new bounds for the variables */
-   SCIP_CALL( findNewBounds(scip, propdata, &nleftiterations, FALSE) );
+   /* find new bounds for the variables, in parallel on LP clones if requested */
+   nthreads = propdata->parallel ? SCIPgetNParallelJobThreads(scip) : 1;
+   if( nthreads > 1 )
+   {
+      SCIP_CALL( findNewBoundsParallel(scip, propdata, &nleftiterations, nthreads) );
+   }
 
-   if( nleftiterations > 0 || itlimit < 0 )
+   /* the sequential version also handles the bounds of variables that are not in the LP */
+   if( nthreads <= 1 || nleftiterations != 0 )
    {
-      SCIP_CALL( findNewBounds(scip, propdata, &nleftiterations, TRUE) );
+      SCIP_CALL( findNewBounds(scip, propdata, &nleftiterations, FALSE) );
+
+      if( nleftiterations > 0 || itlimit < 0 )
+      {
+         SCIP_CALL( findNewBounds(scip, propdata, &nleftiterations, TRUE) );
+      }
    }
 
    /* reset dual feastol and condition limit */
@@ -2272,6 +2674,124 @@ TERMINATE:
    return SCIP_OKAY;
 }
 
+/** computes the inequality xcoef * x <= ycoef * y + constant for a bilinear term from the optimal primal and dual
+ *  solution of the LP that is solved in solveBilinearLP()
+ *
+ *  @return TRUE if both coefficients are different from zero; otherwise, the inequality is not useful and all values
+ *          are set to SCIP_INVALID
+ */
+static
+SCIP_Bool computeBilinearIneq(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_Real             signx,              /**< objective coefficient of x */
+   SCIP_Real             scale,              /**< scaling factor of the additional linear constraint */
+   SCIP_Real             xs,                 /**< x-coordinate of the first point */
+   SCIP_Real             ys,                 /**< y-coordinate of the first point */
+   SCIP_Real             xt,                 /**< x-coordinate of the second point */
+   SCIP_Real             yt,                 /**< y-coordinate of the second point */
+   SCIP_Real             xval,               /**< value of x in the optimal LP solution */
+   SCIP_Real             yval,               /**< value of y in the optimal LP solution */
+   SCIP_Real             mu,                 /**< negated dual value of the additional linear constraint */
+   SCIP_Real*            xcoef,              /**< pointer to store the coefficient of x */
+   SCIP_Real*            ycoef,              /**< pointer to store the coefficient of y */
+   SCIP_Real*            constant            /**< pointer to store the constant */
+   )
+{
+   assert(xcoef != NULL);
+   assert(ycoef != NULL);
+   assert(constant != NULL);
+
+   /* xcoef x + ycoef y <= constant */
+   *xcoef  = -signx - (mu * scale) / (xt - xs);
+   *ycoef = (mu * scale) / (yt - ys);
+   *constant = (*xcoef) * xval + (*ycoef) * yval;
+
+   /* xcoef x <= -ycoef y + constant */
+   *ycoef = -(*ycoef);
+
+   /* inequality is only useful when both coefficients are different from zero; normalize inequality if possible */
+   if( !SCIPisFeasZero(scip, *xcoef) && !SCIPisFeasZero(scip, *ycoef) )
+   {
+      SCIP_Real val = REALABS(*xcoef);
+
+      *xcoef /= val;
+      *ycoef /= val;
+      *constant /= val;
+
+      if( SCIPisZero(scip, *constant) )
+         *constant = 0.0;
+
+      return TRUE;
+   }
+
+   *xcoef = SCIP_INVALID;
+   *ycoef = SCIP_INVALID;
+   *constant = SCIP_INVALID;
+
+   return FALSE;
+}
+
+/** adds the inequality xcoef * x <= ycoef * y + constant to the product expression of a bilinear term if it separates
+ *  the target corner point (xt,yt), and creates a linear constraint from it if requested
+ */
+static
+SCIP_RETCODE addBilinearIneq(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PROPDATA*        propdata,           /**< data of the obbt propagator */
+   SCIP_NLHDLR*          bilinearnlhdlr,     /**< nonlinear handler for bilinear terms */
+   BILINBOUND*           bilinbound,         /**< bilinear term */
+   SCIP_Real             xt,                 /**< x-coordinate of the target corner point */
+   SCIP_Real             yt,                 /**< y-coordinate of the target corner point */
+   SCIP_Real             xcoef,              /**< coefficient of x */
+   SCIP_Real             ycoef,              /**< coefficient of y */
+   SCIP_Real             constant,           /**< constant */
+   int                   nnonzduals,         /**< number of non-zero dual multipliers except for the auxiliary row */
+   SCIP_RESULT*          result              /**< result pointer */
+   )
+{
+   SCIP_VAR* x = bilinboundGetX(bilinbound);
+   SCIP_VAR* y = bilinboundGetY(bilinbound);
+
+   /* add inequality to quadratic constraint handler if it separates (xt,yt) */
+   if( !SCIPisHugeValue(scip, xcoef)  && !SCIPisFeasZero(scip, xcoef)
+      && REALABS(ycoef) < propdata->maxbilincoef && REALABS(ycoef) > 1.0 / propdata->maxbilincoef
+      && SCIPisFeasGT(scip, (xcoef*xt - ycoef*yt - constant) / sqrt(SQR(xcoef) + SQR(ycoef) + SQR(constant)), 1e-2) )
+   {
+      SCIP_Bool success;
+
+      /* add inequality to the associated product expression */
+      SCIP_CALL( SCIPaddIneqBilinear(scip, bilinearnlhdlr, bilinbound->expr, xcoef, ycoef,
+         constant, &success) );
+
+      /* check whether the inequality has been accepted */
+      if( success )
+      {
+         *result = SCIP_REDUCEDDOM;
+         SCIPdebugMsg(scip, "   found %g x <= %g y + %g with violation %g\n", xcoef, ycoef, constant,
+            (xcoef*xt - ycoef*yt - constant) / sqrt(SQR(xcoef) + SQR(ycoef) + SQR(constant)));
+
+         /* create a linear constraint that is only used for propagation */
+         if( propdata->createlincons && nnonzduals > 1 )
+         {
+            SCIP_CONS* cons;
+            char name[SCIP_MAXSTRLEN];
+            SCIP_VAR* linvars[2] = {x, y};
+            SCIP_Real linvals[2] = {xcoef, -ycoef};
+            SCIP_Real rhs = constant;
+
+            (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "bilincons_%s_%s", SCIPvarGetName(x), SCIPvarGetName(y));
+            SCIP_CALL( SCIPcreateConsLinear(scip, &cons, name, 2, linvars, linvals, -SCIPinfinity(scip), rhs,
+               FALSE, FALSE, FALSE, FALSE, TRUE, FALSE, TRUE, FALSE, TRUE, FALSE) );
+
+            SCIP_CALL( SCIPaddCons(scip, cons) );
+            SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+         }
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
 /** computes a valid inequality from the current LP relaxation for a bilinear term xy only involving x and y; the
  *  inequality is found by optimizing along the line connecting the points (xs,ys) and (xt,yt) over the currently given
  *  linear relaxation of the problem; this optimization problem is an LP
@@ -2386,53 +2906,344 @@ SCIP_RETCODE solveBilinearLP(
 
       SCIPdebugMsg(scip, "   primal=(%g,%g) dual=%g\n", xval, yval, mu);
 
-      /* xcoef x + ycoef y <= constant */
-      *xcoef  = -signx - (mu * scale) / (xt - xs);
-      *ycoef = (mu * scale) / (yt - ys);
-      *constant = (*xcoef) * xval + (*ycoef) * yval;
+      if( computeBilinearIneq(scip, signx, scale, xs, ys, xt, yt, xval, yval, mu, xcoef, ycoef, constant)
+         && nnonzduals != NULL )
+      {
+         int r;
+
+         /* count the number of non-zero dual multipliers except for the added row */
+         for( r = 0; r < SCIPgetNLPRows(scip); ++r )
+         {
+            if( SCIPgetLPRows(scip)[r] != row && !SCIPisFeasZero(scip, SCIProwGetDualsol(SCIPgetLPRows(scip)[r])) )
+               ++(*nnonzduals);
+         }
+      }
+   }
 
-      /* xcoef x <= -ycoef y + constant */
-      *ycoef = -(*ycoef);
+   /* release row and backtrack probing node */
+   SCIP_CALL( SCIPreleaseRow(scip, &row) );
+   SCIP_CALL( SCIPbacktrackProbing(scip, 0) );
 
-      /* inequality is only useful when both coefficients are different from zero; normalize inequality if possible */
-      if( !SCIPisFeasZero(scip, *xcoef) && !SCIPisFeasZero(scip, *ycoef) )
+   /* reset objective function */
+   SCIP_CALL( SCIPchgVarObjProbing(scip, x, 0.0) );
+
+   return SCIP_OKAY;
+}
+
+/** bilinear LP task of parallel OBBT */
+struct ObbtBilinTask
+{
+   SCIP_Real             xs;                 /**< x-coordinate of the first point */
+   SCIP_Real             ys;                 /**< y-coordinate of the first point */
+   SCIP_Real             xt;                 /**< x-coordinate of the second point */
+   SCIP_Real             yt;                 /**< y-coordinate of the second point */
+   SCIP_Real             signx;              /**< objective coefficient of x */
+   SCIP_Real             scale;              /**< scaling factor of the additional row */
+   SCIP_Real             xval;               /**< value of x in the optimal LP solution */
+   SCIP_Real             yval;               /**< value of y in the optimal LP solution */
+   SCIP_Real             mu;                 /**< negated dual value of the additional row */
+   int                   xpos;               /**< LP position of x */
+   int                   ypos;               /**< LP position of y */
+   int                   bilinidx;           /**< index of the bilinear term in propdata->bilinbounds */
+   int                   nnonzduals;         /**< number of non-zero dual multipliers except for the additional row */
+   SCIP_Bool             solved;             /**< was the LP of the task solved? */
+   SCIP_Bool             optimal;            /**< was the LP of the task solved to optimality? */
+};
+typedef struct ObbtBilinTask OBBTBILINTASK;
+
+/** job of parallel OBBT that solves bilinear LP tasks on its own LP clone */
+struct ObbtBilinJob
+{
+   OBBTSHARED*           shared;             /**< shared data; only the lock, next task, and iterations are used */
+   OBBTBILINTASK*        tasks;              /**< all tasks */
+   SCIP_LPI*             lpi;                /**< LP clone of the job */
+   SCIP_Real*            primsol;            /**< buffer for the primal solution */
+   SCIP_Real*            dualsol;            /**< buffer for the dual solution */
+   int                   nrows;              /**< number of rows of the LP clone without the additional row */
+};
+typedef struct ObbtBilinJob OBBTBILINJOB;
+
+/** job of parallel OBBT for bilinear terms: repeatedly takes the next task, adds the row connecting the two corner
+ *  points to the LP clone, optimizes along it, and removes the row again; this is the same LP as in solveBilinearLP()
+ */
+static
+SCIP_DECL_PARALLELJOB(obbtExecBilinJob)
+{
+   OBBTBILINJOB* job = (OBBTBILINJOB*)jobarg;
+   OBBTSHARED* shared = job->shared;
+
+   for( ;; )
+   {
+      OBBTBILINTASK* task;
+      SCIP_Longint itlimit;
+      SCIP_Real side;
+      SCIP_Real obj;
+      SCIP_Real vals[2];
+      SCIP_Bool optimal;
+      SCIP_Bool valid;
+      int inds[2];
+      int beg = 0;
+      int niterations = 0;
+      int t;
+      int r;
+
+      SCIP_CALL( SCIPtpiAcquireLock(shared->lock) );
+      t = shared->nexttask;
+      itlimit = 0;
+      if( t < shared->ntasks )
       {
-         SCIP_Real val = REALABS(*xcoef);
-         int r;
+         itlimit = obbtReserveIterations(shared);
+         if( itlimit != 0 )
+            ++shared->nexttask;
+      }
+      SCIP_CALL( SCIPtpiReleaseLock(shared->lock) );
+
+      if( t >= shared->ntasks || itlimit == 0 )
+         break;
 
-         *xcoef /= val;
-         *ycoef /= val;
-         *constant /= val;
+      task = &job->tasks[t];
 
-         if( SCIPisZero(scip, *constant) )
-            *constant = 0.0;
+      side = task->scale * (task->xs/(task->xt-task->xs) - task->ys/(task->yt-task->ys));
+      inds[0] = task->xpos;
+      inds[1] = task->ypos;
+      vals[0] = task->scale/(task->xt-task->xs);
+      vals[1] = -task->scale/(task->yt-task->ys);
+
+      valid = SCIPlpiAddRows(job->lpi, 1, &side, &side, NULL, 2, &beg, inds, vals) == SCIP_OKAY;
+
+      if( valid )
+      {
+         optimal = SCIPlpiChgObj(job->lpi, 1, &task->xpos, &task->signx) == SCIP_OKAY;
+         optimal = optimal && solveLPClone(job->lpi, itlimit, &niterations);
+         optimal = optimal && SCIPlpiGetSol(job->lpi, NULL, job->primsol, job->dualsol, NULL, NULL) == SCIP_OKAY;
 
-         if( nnonzduals != NULL )
+         task->solved = TRUE;
+         if( optimal )
          {
-            /* count the number of non-zero dual multipliers except for the added row */
-            for( r = 0; r < SCIPgetNLPRows(scip); ++r )
+            task->optimal = TRUE;
+            task->xval = job->primsol[task->xpos];
+            task->yval = job->primsol[task->ypos];
+            task->mu = -job->dualsol[job->nrows];
+            task->nnonzduals = 0;
+            for( r = 0; r < job->nrows; ++r )
             {
-               if( SCIPgetLPRows(scip)[r] != row && !SCIPisFeasZero(scip, SCIProwGetDualsol(SCIPgetLPRows(scip)[r])) )
-                  ++(*nnonzduals);
+               if( REALABS(job->dualsol[r]) > shared->feastol )
+                  ++task->nnonzduals;
             }
          }
+
+         /* the LP clone cannot be used for further tasks if it could not be restored */
+         obj = 0.0;
+         valid = SCIPlpiChgObj(job->lpi, 1, &task->xpos, &obj) == SCIP_OKAY
+            && SCIPlpiDelRows(job->lpi, job->nrows, job->nrows) == SCIP_OKAY;
       }
-      else
+
+      SCIP_CALL( SCIPtpiAcquireLock(shared->lock) );
+      obbtReleaseIterations(shared, itlimit, niterations);
+      SCIP_CALL( SCIPtpiReleaseLock(shared->lock) );
+
+      if( !valid )
+         break;
+   }
+
+   return SCIP_OKAY;
+}
+
+/** solves the bilinear LPs of all unprocessed bilinear terms in parallel on clones of the current LP and adds the
+ *  resulting inequalities; bilinear terms whose LPs were all solved are marked as done, the remaining ones are left to
+ *  the sequential loop of applyObbtBilinear()
+ */
+static
+SCIP_RETCODE applyObbtBilinearParallel(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PROPDATA*        propdata,           /**< data of the obbt propagator */
+   SCIP_NLHDLR*          bilinearnlhdlr,     /**< nonlinear handler for bilinear terms */
+   SCIP_Longint          nleftiterations,    /**< number of LP iterations left (-1: no limit) */
+   int                   nthreads,           /**< number of threads to use */
+   SCIP_Longint*         nusediterations,    /**< pointer to store the number of used LP iterations */
+   SCIP_RESULT*          result              /**< result pointer */
+   )
+{
+   OBBTSHARED shared;
+   OBBTBILINTASK* tasks;
+   OBBTBILINJOB* jobs;
+   void** jobargs;
+   SCIP_RETCODE retcode;
+   int* nunsolved;
+   int ncols;
+   int nrows;
+   int ntasks;
+   int i;
+
+   assert(scip != NULL);
+   assert(propdata != NULL);
+   assert(nusediterations != NULL);
+   assert(nthreads > 1);
+
+   *nusediterations = 0;
+
+   ncols = SCIPgetNLPCols(scip);
+   nrows = SCIPgetNLPRows(scip);
+
+   if( ncols == 0 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &tasks, 4 * (propdata->nbilinbounds - propdata->lastbilinidx)) );
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &nunsolved, propdata->nbilinbounds) );
+
+   /* create a task for each corner that is needed, skipping the same corners as the sequential loop */
+   ntasks = 0;
+   for( i = propdata->lastbilinidx; i < propdata->nbilinbounds; ++i )
+   {
+      CORNER corners[4] = {LEFTBOTTOM, LEFTTOP, RIGHTTOP, RIGHTBOTTOM};
+      BILINBOUND* bilinbound = propdata->bilinbounds[i];
+      SCIP_VAR* x = bilinboundGetX(bilinbound);
+      SCIP_VAR* y = bilinboundGetY(bilinbound);
+      int k;
+
+      if( bilinbound->done || bilinbound->filtered == (int)FILTERED )
+         continue;
+
+      /* terms with variables that are not in the LP are left to the sequential loop */
+      if( SCIPvarGetStatus(x) != SCIP_VARSTATUS_COLUMN || SCIPvarGetStatus(y) != SCIP_VARSTATUS_COLUMN
+         || SCIPcolGetLPPos(SCIPvarGetCol(x)) < 0 || SCIPcolGetLPPos(SCIPvarGetCol(y)) < 0 )
+      {
+         nunsolved[i] = -1;
+         continue;
+      }
+
+      for( k = 0; k < 4; ++k )
       {
-         *xcoef = SCIP_INVALID;
-         *ycoef = SCIP_INVALID;
-         *constant = SCIP_INVALID;
+         OBBTBILINTASK* task;
+         CORNER corner = corners[k];
+         SCIP_Real xs = SCIP_INVALID;
+         SCIP_Real ys = SCIP_INVALID;
+         SCIP_Real xt = SCIP_INVALID;
+         SCIP_Real yt = SCIP_INVALID;
+
+         if( ((corner == LEFTTOP || corner == RIGHTBOTTOM) && bilinboundGetLocksPos(bilinbound) == 0)
+            || ((corner == LEFTBOTTOM || corner == RIGHTTOP) && bilinboundGetLocksNeg(bilinbound) == 0) )
+            continue;
+
+         if( (bilinbound->filtered & corner) != 0 ) /*lint !e641*/
+            continue;
+
+         getCorners(x, y, corner, &xs, &ys, &xt, &yt);
+
+         if( SCIPisHugeValue(scip, REALABS(xt)) || SCIPisHugeValue(scip, REALABS(yt)) )
+            continue;
+
+         /* see solveBilinearLP() */
+         if( SCIPisFeasEQ(scip, xs, xt) || SCIPisFeasEQ(scip, ys, yt)
+            || SCIPisHugeValue(scip, REALABS(xs)) || SCIPisHugeValue(scip, REALABS(ys)) )
+            continue;
+
+         task = &tasks[ntasks++];
+         task->xs = xs;
+         task->ys = ys;
+         task->xt = xt;
+         task->yt = yt;
+         task->signx = (xs > xt) ? 1.0 : -1.0;
+         task->scale = MIN(MAX3(1.0, REALABS(xt-xs), REALABS(yt-ys)), 100.0); /*lint !e666*/
+         task->xpos = SCIPcolGetLPPos(SCIPvarGetCol(x));
+         task->ypos = SCIPcolGetLPPos(SCIPvarGetCol(y));
+         task->bilinidx = i;
+         task->solved = FALSE;
+         task->optimal = FALSE;
+         ++nunsolved[i];
       }
    }
 
-   /* release row and backtrack probing node */
-   SCIP_CALL( SCIPreleaseRow(scip, &row) );
-   SCIP_CALL( SCIPbacktrackProbing(scip, 0) );
+   nthreads = MIN(nthreads, ntasks);
+   retcode = SCIP_OKAY;
 
-   /* reset objective function */
-   SCIP_CALL( SCIPchgVarObjProbing(scip, x, 0.0) );
+   if( nthreads > 0 )
+   {
+      SCIP_CALL( SCIPallocClearBufferArray(scip, &jobs, nthreads) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &jobargs, nthreads) );
+
+      BMSclearMemory(&shared);
+      shared.feastol = SCIPfeastol(scip);
+      shared.nleftiterations = nleftiterations;
+      shared.njobs = nthreads;
+      shared.ntasks = ntasks;
+      SCIP_CALL( SCIPtpiInitLock(&shared.lock) );
+
+      /* the LP clones are freed on every exit path, since they are not part of SCIP's memory */
+      for( i = 0; i < nthreads; ++i )
+      {
+         jobs[i].shared = &shared;
+         jobs[i].tasks = tasks;
+         jobs[i].nrows = nrows;
+         SCIP_CALL_TERMINATE( retcode, SCIPcreateLPICopy(scip, "obbtclone", FALSE, NULL, NULL, &jobs[i].lpi), TERMINATE );
+         SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &jobs[i].primsol, ncols), TERMINATE );
+         SCIP_CALL_TERMINATE( retcode, SCIPallocBufferArray(scip, &jobs[i].dualsol, nrows + 1), TERMINATE );
+         jobargs[i] = (void*)&jobs[i];
+      }
 
-   return SCIP_OKAY;
+      SCIP_CALL_TERMINATE( retcode, SCIPexecParallelJobs(scip, nthreads, obbtExecBilinJob, jobargs, nthreads), TERMINATE );
+
+   TERMINATE:
+      for( i = nthreads - 1; i >= 0; --i )
+      {
+         SCIPfreeBufferArrayNull(scip, &jobs[i].dualsol);
+         SCIPfreeBufferArrayNull(scip, &jobs[i].primsol);
+         if( jobs[i].lpi != NULL )
+         {
+            SCIP_CALL( SCIPlpiFree(&jobs[i].lpi) );
+         }
+      }
+      SCIPtpiDestroyLock(&shared.lock);
+   }
+
+   if( nthreads > 0 && retcode == SCIP_OKAY )
+   {
+      /* add the inequalities in the order of the tasks to stay deterministic */
+      for( i = 0; i < ntasks; ++i )
+      {
+         OBBTBILINTASK* task = &tasks[i];
+         BILINBOUND* bilinbound = propdata->bilinbounds[task->bilinidx];
+         SCIP_Real xcoef;
+         SCIP_Real ycoef;
+         SCIP_Real constant;
+
+         if( !task->solved )
+            continue;
+
+         --nunsolved[task->bilinidx];
+
+         if( task->optimal && computeBilinearIneq(scip, task->signx, task->scale, task->xs, task->ys, task->xt,
+               task->yt, task->xval, task->yval, task->mu, &xcoef, &ycoef, &constant) )
+         {
+            SCIP_CALL( addBilinearIneq(scip, propdata, bilinearnlhdlr, bilinbound, task->xt, task->yt, xcoef, ycoef,
+                  constant, task->nnonzduals, result) );
+         }
+      }
+
+      *nusediterations = shared.niterations;
+      propdata->itusedbilin += shared.niterations;
+
+      SCIPdebugMsg(scip, "parallel obbt for bilinear terms: %d tasks, %" SCIP_LONGINT_FORMAT " LP iterations\n", ntasks,
+         shared.niterations);
+   }
+
+   if( nthreads > 0 )
+   {
+      SCIPfreeBufferArray(scip, &jobargs);
+      SCIPfreeBufferArray(scip, &jobs);
+   }
+
+   /* mark the bilinear terms as processed whose LPs were all solved */
+   for( i = propdata->lastbilinidx; i < propdata->nbilinbounds; ++i )
+   {
+      if( nunsolved[i] == 0 )
+         propdata->bilinbounds[i]->done = TRUE;
+   }
+
+   SCIPfreeBufferArray(scip, &nunsolved);
+   SCIPfreeBufferArray(scip, &tasks);
+
+   return retcode;
 }
 
 /* applies obbt for finding valid inequalities for bilinear terms; function works as follows:
@@ -2460,6 +3271,7 @@ SCIP_RETCODE applyObbtBilinear(
    SCIP_Longint nleftiterations;
    SCIP_CONSHDLR* conshdlr;
    SCIP_NLHDLR* bilinearnlhdlr;
+   int nthreads;
    int nvars;
    int i;
 
@@ -2509,6 +3321,31 @@ SCIP_RETCODE applyObbtBilinear(
    if( lperror )
       goto TERMINATE;
 
+   /* solve the LPs in parallel on LP clones if requested; the main loop handles the bilinear terms that are left */
+   nthreads = propdata->parallel ? SCIPgetNParallelJobThreads(scip) : 1;
+   if( nthreads > 1 )
+   {
+      SCIP_Longint budget = nleftiterations;
+      SCIP_Longint nusediterations;
+
+      if( propdata->itlimitbilin >= 0 )
+      {
+         SCIP_Longint nbilinleft = MAX(propdata->itlimitbilin - propdata->itusedbilin, 0);
+
+         budget = budget == -1 ? nbilinleft : MIN(budget, nbilinleft);
+      }
+
+      SCIP_CALL( applyObbtBilinearParallel(scip, propdata, bilinearnlhdlr, budget, nthreads, &nusediterations,
+            result) );
+
+      /* the iterations of the LP clones are not counted by SCIP */
+      if( itlimit >= 0 )
+      {
+         itlimit = MAX(itlimit - nusediterations, 0);
+         nleftiterations = getIterationsLeft(scip, nolditerations, itlimit);
+      }
+   }
+
    /* 5. main loop */
    for( i = propdata->lastbilinidx; i < propdata->nbilinbounds
       && (nleftiterations > 0 || nleftiterations == -1)
@@ -2577,42 +3414,8 @@ SCIP_RETCODE applyObbtBilinear(
          nleftiterations = getIterationsLeft(scip, nolditerations, itlimit);
          SCIPdebugMsg(scip, "LP iterations left: %lld\n", nleftiterations);
 
-         /* add inequality to quadratic constraint handler if it separates (xt,yt) */
-         if( !SCIPisHugeValue(scip, xcoef)  && !SCIPisFeasZero(scip, xcoef)
-            && REALABS(ycoef) < 1e+3 && REALABS(ycoef) > 1e-3 /* TODO add a parameter for this */
-            && SCIPisFeasGT(scip, (xcoef*xt - ycoef*yt - constant) / sqrt(SQR(xcoef) + SQR(ycoef) + SQR(constant)), 1e-2) )
-         {
-            SCIP_Bool success;
-
-            /* add inequality to the associated product expression */
-            SCIP_CALL( SCIPaddIneqBilinear(scip, bilinearnlhdlr, bilinbound->expr, xcoef, ycoef,
-               constant, &success) );
-
-            /* check whether the inequality has been accepted */
-            if( success )
-            {
-               *result = SCIP_REDUCEDDOM;
-               SCIPdebugMsg(scip, "   found %g x <= %g y + %g with violation %g\n", xcoef, ycoef, constant,
-                  (xcoef*xt - ycoef*yt - constant) / sqrt(SQR(xcoef) + SQR(ycoef) + SQR(constant)));
-
-               /* create a linear constraint that is only used for propagation */
-               if( propdata->createlincons && nnonzduals > 1 )
-               {
-                  SCIP_CONS* cons;
-                  char name[SCIP_MAXSTRLEN];
-                  SCIP_VAR* linvars[2] = {x, y};
-                  SCIP_Real linvals[2] = {xcoef, -ycoef};
-                  SCIP_Real rhs = constant;
-
-                  (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "bilincons_%s_%s", SCIPvarGetName(x), SCIPvarGetName(y));
-                  SCIP_CALL( SCIPcreateConsLinear(scip, &cons, name, 2, linvars, linvals, -SCIPinfinity(scip), rhs,
-                     FALSE, FALSE, FALSE, FALSE, TRUE, FALSE, TRUE, FALSE, TRUE, FALSE) );
-
-                  SCIP_CALL( SCIPaddCons(scip, cons) );
-                  SCIP_CALL( SCIPreleaseCons(scip, &cons) );
-               }
-            }
-         }
+         SCIP_CALL( addBilinearIneq(scip, propdata, bilinearnlhdlr, bilinbound, xt, yt, xcoef, ycoef, constant,
+               nnonzduals, result) );
       }
 
       /* mark the bound as processed */
@@ -3391,6 +4194,10 @@ SCIP_RETCODE SCIPincludePropObbt(
          "minimum absolute value of nonconvex eigenvalues for a bilinear term",
          &propdata->minnonconvexity, FALSE, DEFAULT_MINNONCONVEXITY, 0.0, SCIP_REAL_MAX, NULL, NULL) );
 
+   SCIP_CALL( SCIPaddRealParam(scip, "propagating/" PROP_NAME "/maxbilincoef",
+         "maximal absolute value of the y-coefficient of an inequality for a bilinear term with normalized x-coefficient; its inverse is the minimal absolute value",
+         &propdata->maxbilincoef, TRUE, DEFAULT_MAXBILINCOEF, 1.0, SCIP_REAL_MAX, NULL, NULL) );
+
    SCIP_CALL( SCIPaddLongintParam(scip, "propagating/" PROP_NAME "/minitlimit",
          "minimum LP iteration limit",
          &propdata->minitlimit, FALSE, DEFAULT_MINITLIMIT, 0L, SCIP_LONGINT_MAX, NULL, NULL) );
@@ -3435,6 +4242,10 @@ SCIP_RETCODE SCIPincludePropObbt(
          "create linear constraints from inequalities for bilinear terms?",
          &propdata->createlincons, TRUE, DEFAULT_CREATE_LINCONS, NULL, NULL) );
 
+  SCIP_CALL( SCIPaddBoolParam(scip, "propagating/" PROP_NAME "/parallel",
+         "should the LPs be solved in parallel on clones of the LP relaxation if threads are available? (no genvbounds, separation, or propagation during solving)",
+         &propdata->parallel, TRUE, DEFAULT_PARALLEL, NULL, NULL) );
+
   SCIP_CALL( SCIPaddIntParam(scip, "propagating/" PROP_NAME "/orderingalgo",
         "select the type of ordering algorithm which should be used (0: no special ordering, 1: greedy, 2: greedy reverse)",
         &propdata->orderingalgo, TRUE, DEFAULT_ORDERINGALGO, 0, 2, NULL, NULL) );
@@ -34,6 +34,7 @@
 
 #include "blockmemshell/memory.h"
 #include "scip/prop_probing.h"
+#include "scip/pub_matrix.h"
 #include "scip/pub_message.h"
 #include "scip/pub_misc.h"
 #include "scip/pub_misc_sort.h"
@@ -41,6 +42,7 @@
 #include "scip/pub_tree.h"
 #include "scip/pub_var.h"
 #include "scip/scip_branch.h"
+#include "scip/scip_concurrent.h"
 #include "scip/scip_general.h"
 #include "scip/scip_lp.h"
 #include "scip/scip_mem.h"
@@ -93,6 +95,10 @@
                                          *   (0: don't abort) */
 #define DEFAULT_MAXDEPTH            -1  /**< maximal depth until propagation is executed(-1: no limit) */
 #define DEFAULT_RANDSEED            59  /**< random initial seed */
+#define DEFAULT_PARALLEL         FALSE  /**< should probing in presolving start with a parallel probing pass on the
+                                         *   linear constraint matrix? */
+#define DEFAULT_PARALLELBATCHSIZE  100  /**< number of candidates that each thread probes on in parallel probing before
+                                         *   the deductions are applied */
 
 /*
  * Data structures
@@ -126,6 +132,11 @@ struct SCIP_PropData
    int                   ntotaluseless;      /**< current number of successive totally useless probings */
    int                   nsumuseless;        /**< current number of useless probings */
    int                   maxdepth;           /**< maximal depth until propagation is executed */
+   int                   parallelbatchsize;  /**< number of candidates that each thread probes on in parallel probing
+                                              *   before the deductions are applied */
+   SCIP_Bool             parallel;           /**< should probing in presolving start with a parallel probing pass on the
+                                              *   linear constraint matrix? */
+   SCIP_Bool             parallelapplied;    /**< was parallel probing applied in the current presolving? */
    SCIP_Longint          lastnode;           /**< last node where probing was applied, or -1 for presolving, and -2 for not applied yet */
    SCIP_RANDNUMGEN*      randnumgen;         /**< random number generator */
 };
@@ -158,6 +169,7 @@ SCIP_RETCODE initPropdata(
    propdata->nsumuseless = 0;
    propdata->lastnode = -2;
    propdata->randnumgen = NULL;
+   propdata->parallelapplied = FALSE;
 
    return SCIP_OKAY;
 }
@@ -725,6 +737,576 @@ SCIP_RETCODE applyProbing(
 }
 
 
+/*
+ * Parallel probing on the linear constraint matrix
+ */
+
+/** type of a deduction found by parallel probing */
+enum ParprobType
+{
+   PARPROB_CUTOFF = 0,                       /**< both values of the probing variable are infeasible */
+   PARPROB_FIX    = 1,                       /**< column is fixed to val */
+   PARPROB_AGGR   = 2,                       /**< column equals the probing column col2 (val = 1) or its complement (val = -1) */
+   PARPROB_IMPL   = 3,                       /**< probing column col2 at value val2 implies column to be fixed to val */
+   PARPROB_LB     = 4,                       /**< lower bound of column is increased to val */
+   PARPROB_UB     = 5                        /**< upper bound of column is decreased to val */
+};
+typedef enum ParprobType PARPROBTYPE;
+
+/** deduction found by parallel probing */
+struct ParprobResult
+{
+   SCIP_Real             val;                /**< value of the deduction, see PARPROBTYPE */
+   SCIP_Real             val2;               /**< value of the probing column for implications */
+   int                   col;                /**< column of the deduction */
+   int                   col2;               /**< probing column for aggregations and implications */
+   PARPROBTYPE           type;               /**< type of the deduction */
+};
+typedef struct ParprobResult PARPROBRESULT;
+
+/** linear constraint matrix with the domains and activities that all probing jobs of a batch start from; the data is
+ *  only read by the jobs and updated in the main thread between the batches
+ */
+struct ParprobMatrix
+{
+   SCIP_LINPROP*         linprop;            /**< rows of the matrix for the propagation on thread-local domains */
+   SCIP_Real*            lb;                 /**< global lower bounds of the columns */
+   SCIP_Real*            ub;                 /**< global upper bounds of the columns */
+   SCIP_Bool*            isint;              /**< is the column of integral type? */
+   SCIP_Bool*            isbin;              /**< is the column binary? */
+   int                   ncols;              /**< number of columns */
+};
+typedef struct ParprobMatrix PARPROBMATRIX;
+
+/** probing job working on a batch of candidates */
+struct ParprobJob
+{
+   PARPROBMATRIX*        matrix;             /**< shared constraint matrix */
+   int*                  cands;              /**< columns to probe on */
+   PARPROBRESULT*        results;            /**< deductions found */
+   int                   ncands;             /**< number of columns to probe on */
+   int                   nresults;           /**< number of deductions found */
+   int                   resultssize;        /**< size of results array */
+};
+typedef struct ParprobJob PARPROBJOB;
+
+/** stores a deduction in the results of a probing job */
+static
+SCIP_RETCODE parprobJobAddResult(
+   PARPROBJOB*           job,                /**< probing job */
+   PARPROBTYPE           type,               /**< type of the deduction */
+   int                   col,                /**< column of the deduction */
+   SCIP_Real             val,                /**< value of the deduction */
+   int                   col2,               /**< probing column, or -1 */
+   SCIP_Real             val2                /**< value of the probing column for implications */
+   )
+{
+   if( job->nresults == job->resultssize )
+   {
+      job->resultssize = MAX(2 * job->resultssize, 64);
+      SCIP_ALLOC( BMSreallocMemoryArray(&job->results, job->resultssize) );
+   }
+
+   job->results[job->nresults].type = type;
+   job->results[job->nresults].col = col;
+   job->results[job->nresults].val = val;
+   job->results[job->nresults].col2 = col2;
+   job->results[job->nresults].val2 = val2;
+   ++job->nresults;
+
+   return SCIP_OKAY;
+}
+
+/** probing job: probes both values of each candidate column on thread-local domains and collects the fixings,
+ *  aggregations, implications, and bound changes that follow
+ */
+static
+SCIP_DECL_PARALLELJOB(parprobExecJob)
+{
+   PARPROBJOB* job = (PARPROBJOB*)jobarg;
+   PARPROBMATRIX* matrix = job->matrix;
+   SCIP_LINPROPWORKER* worker;
+   const SCIP_Real* lb;
+   const SCIP_Real* ub;
+   SCIP_Real* zerolb;
+   SCIP_Real* zeroub;
+   int* zerocols;
+   int* zeromark;
+   int nzerocols;
+   int k;
+   int i;
+
+   SCIP_CALL( SCIPlinpropWorkerCreate(&worker, matrix->linprop) );
+   SCIP_ALLOC( BMSallocMemoryArray(&zerolb, MAX(matrix->ncols, 1)) );
+   SCIP_ALLOC( BMSallocMemoryArray(&zeroub, MAX(matrix->ncols, 1)) );
+   SCIP_ALLOC( BMSallocMemoryArray(&zerocols, MAX(matrix->ncols, 1)) );
+   SCIP_ALLOC( BMSallocMemoryArray(&zeromark, MAX(matrix->ncols, 1)) );
+   memset(zeromark, -1, MAX(matrix->ncols, 1) * sizeof(int));
+
+   lb = SCIPlinpropWorkerGetLbs(worker);
+   ub = SCIPlinpropWorkerGetUbs(worker);
+
+   for( k = 0; k < job->ncands; ++k )
+   {
+      const int* chgcols;
+      SCIP_Bool zerofeas;
+      SCIP_Bool onefeas;
+      int nchgcols;
+      int col = job->cands[k];
+
+      if( lb[col] > 0.5 || ub[col] < 0.5 )
+         continue;
+
+      /* probe on zero and remember the changed bounds, marked with the index of the candidate */
+      zerofeas = SCIPlinpropWorkerFix(worker, col, 0.0);
+      nzerocols = 0;
+      if( zerofeas )
+      {
+         chgcols = SCIPlinpropWorkerGetChgCols(worker);
+         nchgcols = SCIPlinpropWorkerGetNChgCols(worker);
+
+         for( i = 0; i < nchgcols; ++i )
+         {
+            int c = chgcols[i];
+
+            if( c == col )
+               continue;
+            zerocols[nzerocols++] = c;
+            zeromark[c] = k;
+            zerolb[c] = lb[c];
+            zeroub[c] = ub[c];
+         }
+      }
+      SCIPlinpropWorkerUndo(worker);
+
+      /* probe on one */
+      onefeas = SCIPlinpropWorkerFix(worker, col, 1.0);
+
+      if( !zerofeas && !onefeas )
+      {
+         SCIP_CALL( parprobJobAddResult(job, PARPROB_CUTOFF, col, 0.0, -1, 0.0) );
+         SCIPlinpropWorkerUndo(worker);
+         break;
+      }
+      else if( !zerofeas || !onefeas )
+      {
+         SCIP_CALL( parprobJobAddResult(job, PARPROB_FIX, col, zerofeas ? 0.0 : 1.0, -1, 0.0) );
+      }
+      else
+      {
+         chgcols = SCIPlinpropWorkerGetChgCols(worker);
+         nchgcols = SCIPlinpropWorkerGetNChgCols(worker);
+
+         /* columns changed in the one-probe, possibly also in the zero-probe */
+         for( i = 0; i < nchgcols; ++i )
+         {
+            int c = chgcols[i];
+            SCIP_Bool onefixed;
+            SCIP_Bool inzero;
+
+            if( c == col )
+               continue;
+
+            onefixed = (lb[c] == ub[c]); /*lint !e777*/
+            inzero = (zeromark[c] == k);
+
+            if( matrix->isbin[c] )
+            {
+               SCIP_Bool zerofixed = inzero && (zerolb[c] == zeroub[c]); /*lint !e777*/
+
+               if( onefixed && zerofixed )
+               {
+                  if( lb[c] == zerolb[c] ) /*lint !e777*/
+                  {
+                     SCIP_CALL( parprobJobAddResult(job, PARPROB_FIX, c, lb[c], -1, 0.0) );
+                  }
+                  else
+                  {
+                     /* c = col if c is one in the one-probe, c = 1 - col otherwise */
+                     SCIP_CALL( parprobJobAddResult(job, PARPROB_AGGR, c, lb[c] > 0.5 ? 1.0 : -1.0, col, 0.0) );
+                  }
+               }
+               else if( onefixed )
+               {
+                  SCIP_CALL( parprobJobAddResult(job, PARPROB_IMPL, c, lb[c], col, 1.0) );
+               }
+            }
+            else if( matrix->isint[c] && inzero )
+            {
+               /* bounds valid in both probes are valid globally */
+               SCIP_Real newlb = MIN(lb[c], zerolb[c]);
+               SCIP_Real newub = MAX(ub[c], zeroub[c]);
+
+               if( newlb > matrix->lb[c] + 0.5 )
+               {
+                  SCIP_CALL( parprobJobAddResult(job, PARPROB_LB, c, newlb, -1, 0.0) );
+               }
+               if( newub < matrix->ub[c] - 0.5 )
+               {
+                  SCIP_CALL( parprobJobAddResult(job, PARPROB_UB, c, newub, -1, 0.0) );
+               }
+            }
+         }
+
+         /* binary columns fixed in the zero-probe only */
+         for( i = 0; i < nzerocols; ++i )
+         {
+            int c = zerocols[i];
+
+            if( matrix->isbin[c] && zerolb[c] == zeroub[c] /*lint !e777*/
+               && (!SCIPlinpropWorkerIsColChanged(worker, c) || lb[c] != ub[c]) ) /*lint !e777*/
+            {
+               SCIP_CALL( parprobJobAddResult(job, PARPROB_IMPL, c, zerolb[c], col, 0.0) );
+            }
+         }
+      }
+      SCIPlinpropWorkerUndo(worker);
+   }
+
+   BMSfreeMemoryArray(&zeromark);
+   BMSfreeMemoryArray(&zerocols);
+   BMSfreeMemoryArray(&zeroub);
+   BMSfreeMemoryArray(&zerolb);
+   SCIPlinpropWorkerFree(&worker);
+
+   return SCIP_OKAY;
+}
+
+/** applies the deductions of a parallel probing job to the problem */
+static
+SCIP_RETCODE parprobApplyResults(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PROPDATA*        propdata,           /**< propagator data */
+   SCIP_MATRIX*          matrix,             /**< constraint matrix */
+   PARPROBJOB*           job,                /**< finished probing job */
+   int*                  nfixedvars,         /**< pointer to store number of fixed variables */
+   int*                  naggrvars,          /**< pointer to store number of aggregated variables */
+   int*                  nchgbds,            /**< pointer to store number of changed bounds */
+   SCIP_Bool*            success,            /**< pointer to update whether a deduction was applied */
+   SCIP_Bool*            cutoff              /**< pointer to store whether infeasibility was detected */
+   )
+{
+   int i;
+
+   for( i = 0; i < job->nresults && !(*cutoff); ++i )
+   {
+      PARPROBRESULT* res = &job->results[i];
+      SCIP_VAR* var = SCIPmatrixGetVar(matrix, res->col);
+      SCIP_VAR* var2 = res->col2 >= 0 ? SCIPmatrixGetVar(matrix, res->col2) : NULL;
+      SCIP_Bool infeasible = FALSE;
+
+      /* deductions of different jobs of a batch may overlap; skip those of already fixed or aggregated variables */
+      if( res->type != PARPROB_CUTOFF && (!SCIPvarIsActive(var) || (var2 != NULL && !SCIPvarIsActive(var2))) )
+         continue;
+
+      switch( res->type )
+      {
+      case PARPROB_CUTOFF:
+         SCIPdebugMsg(scip, "parallel probing: both values of <%s> are infeasible\n", SCIPvarGetName(var));
+         infeasible = TRUE;
+         break;
+
+      case PARPROB_FIX:
+      {
+         SCIP_Bool fixed;
+
+         SCIP_CALL( SCIPfixVar(scip, var, res->val, &infeasible, &fixed) );
+         if( fixed )
+         {
+            SCIPdebugMsg(scip, "parallel probing: fixed <%s> to %g\n", SCIPvarGetName(var), res->val);
+            ++(*nfixedvars);
+            ++propdata->nfixings;
+            *success = TRUE;
+         }
+         break;
+      }
+
+      case PARPROB_AGGR:
+      {
+         SCIP_Bool redundant;
+         SCIP_Bool aggregated;
+
+         assert(var2 != NULL);
+
+         /* var = var2 or var = 1 - var2 */
+         SCIP_CALL( SCIPaggregateVars(scip, var, var2, 1.0, -res->val, res->val > 0.0 ? 0.0 : 1.0,
+               &infeasible, &redundant, &aggregated) );
+         if( aggregated )
+         {
+            SCIPdebugMsg(scip, "parallel probing: aggregated <%s> == %s<%s>\n", SCIPvarGetName(var),
+               res->val > 0.0 ? "" : "1 - ", SCIPvarGetName(var2));
+            ++(*naggrvars);
+            ++propdata->naggregations;
+            *success = TRUE;
+         }
+         break;
+      }
+
+      case PARPROB_IMPL:
+      {
+         int nbdchgs = 0;
+
+         assert(var2 != NULL);
+
+         SCIP_CALL( SCIPaddVarImplication(scip, var2, res->val2 > 0.5, var,
+               res->val > 0.5 ? SCIP_BOUNDTYPE_LOWER : SCIP_BOUNDTYPE_UPPER, res->val, &infeasible, &nbdchgs) );
+         ++propdata->nimplications;
+         *nchgbds += nbdchgs;
+         break;
+      }
+
+      case PARPROB_LB:
+      case PARPROB_UB:
+      {
+         SCIP_Bool tightened;
+
+         if( res->type == PARPROB_LB )
+         {
+            SCIP_CALL( SCIPtightenVarLb(scip, var, res->val, FALSE, &infeasible, &tightened) );
+         }
+         else
+         {
+            SCIP_CALL( SCIPtightenVarUb(scip, var, res->val, FALSE, &infeasible, &tightened) );
+         }
+         if( tightened )
+         {
+            ++(*nchgbds);
+            ++propdata->nbdchgs;
+            *success = TRUE;
+         }
+         break;
+      }
+
+      default:
+         SCIPerrorMessage("unknown parallel probing deduction type %d\n", res->type);
+         return SCIP_INVALIDDATA;
+      }
+
+      if( infeasible )
+         *cutoff = TRUE;
+   }
+
+   return SCIP_OKAY;
+}
+
+/** probes on the binary variables in parallel; each thread probes on a batch of candidates on its own copy of the
+ *  domains, propagating only the linear constraint matrix, and the deductions of all batches are applied afterwards
+ *  in the main thread before the next round of batches starts
+ */
+static
+SCIP_RETCODE applyParallelProbing(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PROPDATA*        propdata,           /**< propagator data */
+   int*                  nfixedvars,         /**< pointer to store number of fixed variables */
+   int*                  naggrvars,          /**< pointer to store number of aggregated variables */
+   int*                  nchgbds,            /**< pointer to store number of changed bounds */
+   int*                  naddconss,          /**< pointer to store number of added constraints */
+   int*                  ndelconss,          /**< pointer to store number of deleted constraints */
+   int*                  nchgcoefs,          /**< pointer to store number of changed coefficients */
+   SCIP_Bool*            cutoff              /**< pointer to store whether infeasibility was detected */
+   )
+{
+   SCIP_MATRIX* matrix;
+   PARPROBMATRIX parmatrix;
+   PARPROBJOB* jobs;
+   void** jobargs;
+   SCIP_Real* rowvals;
+   SCIP_Real* lhs;
+   SCIP_Real* rhs;
+   SCIP_Real infinity;
+   int* rowbeg;
+   int* rowcols;
+   int* cands;
+   int* candlocks;
+   SCIP_Bool initialized;
+   SCIP_Bool complete;
+   int nthreads;
+   int ncands;
+   int candidx;
+   int nuseless;
+   int nnonz;
+   int nrows;
+   int ncols;
+   int r;
+   int c;
+   int j;
+
+   assert(cutoff != NULL);
+
+   *cutoff = FALSE;
+
+   SCIP_CALL( SCIPmatrixCreate(scip, &matrix, FALSE, &initialized, &complete, cutoff, naddconss, ndelconss, nchgcoefs,
+         nchgbds, nfixedvars) );
+
+   /* deductions on the linear rows are valid even if the matrix does not cover all constraints */
+   if( !initialized || *cutoff )
+   {
+      if( matrix != NULL )
+         SCIPmatrixFree(scip, &matrix);
+      return SCIP_OKAY;
+   }
+
+   nrows = SCIPmatrixGetNRows(matrix);
+   ncols = SCIPmatrixGetNColumns(matrix);
+
+   if( nrows == 0 || ncols == 0 )
+   {
+      SCIPmatrixFree(scip, &matrix);
+      return SCIP_OKAY;
+   }
+
+   parmatrix.linprop = NULL;
+   parmatrix.ncols = ncols;
+   infinity = SCIPinfinity(scip);
+   nnonz = SCIPmatrixGetNNonzs(matrix);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &rowbeg, nrows + 1) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &rowcols, MAX(nnonz, 1)) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &rowvals, MAX(nnonz, 1)) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &lhs, nrows) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &rhs, nrows) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &parmatrix.lb, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &parmatrix.ub, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &parmatrix.isint, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &parmatrix.isbin, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &cands, ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &candlocks, ncols) );
+
+   /* copy the rows in compressed sparse row format */
+   rowbeg[0] = 0;
+   for( r = 0; r < nrows; ++r )
+   {
+      int rowlen = SCIPmatrixGetRowNNonzs(matrix, r);
+
+      BMScopyMemoryArray(&rowcols[rowbeg[r]], SCIPmatrixGetRowIdxPtr(matrix, r), rowlen);
+      BMScopyMemoryArray(&rowvals[rowbeg[r]], SCIPmatrixGetRowValPtr(matrix, r), rowlen);
+      rowbeg[r + 1] = rowbeg[r] + rowlen;
+      lhs[r] = SCIPisInfinity(scip, -SCIPmatrixGetRowLhs(matrix, r)) ? -infinity : SCIPmatrixGetRowLhs(matrix, r);
+      rhs[r] = SCIPmatrixIsRowRhsInfinity(matrix, r) ? infinity : SCIPmatrixGetRowRhs(matrix, r);
+   }
+   assert(rowbeg[nrows] == nnonz);
+
+   /* collect the binary columns as candidates, sorted by decreasing number of locks */
+   ncands = 0;
+   for( c = 0; c < ncols; ++c )
+   {
+      SCIP_VAR* var = SCIPmatrixGetVar(matrix, c);
+
+      parmatrix.isint[c] = SCIPvarIsIntegral(var);
+      parmatrix.isbin[c] = SCIPvarIsBinary(var);
+      parmatrix.lb[c] = SCIPisInfinity(scip, -SCIPvarGetLbGlobal(var)) ? -infinity : SCIPvarGetLbGlobal(var);
+      parmatrix.ub[c] = SCIPisInfinity(scip, SCIPvarGetUbGlobal(var)) ? infinity : SCIPvarGetUbGlobal(var);
+
+      if( parmatrix.isbin[c] && SCIPmatrixGetColNNonzs(matrix, c) > 0 && SCIPvarGetLbGlobal(var) < 0.5
+         && SCIPvarGetUbGlobal(var) > 0.5 )
+      {
+         cands[ncands] = c;
+         candlocks[ncands] = SCIPvarGetNLocksDownType(var, SCIP_LOCKTYPE_MODEL)
+            + SCIPvarGetNLocksUpType(var, SCIP_LOCKTYPE_MODEL);
+         ++ncands;
+      }
+   }
+   SCIPsortDownIntInt(candlocks, cands, ncands);
+
+   nthreads = SCIPgetNParallelJobThreads(scip);
+   assert(nthreads >= 1);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &jobs, nthreads) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &jobargs, nthreads) );
+   BMSclearMemoryArray(jobs, nthreads);
+
+   SCIPdebugMsg(scip, "parallel probing on %d candidates with %d threads and batches of size %d\n", ncands, nthreads,
+      propdata->parallelbatchsize);
+
+   candidx = 0;
+   nuseless = 0;
+   while( candidx < ncands && !(*cutoff) && !SCIPisStopped(scip) )
+   {
+      SCIP_Bool success = FALSE;
+      int njobs = 0;
+
+      /* refresh the domains and activities that the batches start from */
+      if( parmatrix.linprop == NULL )
+      {
+         SCIP_CALL( SCIPlinpropCreate(&parmatrix.linprop, nrows, ncols, rowbeg, rowcols, rowvals, lhs, rhs,
+               parmatrix.lb, parmatrix.ub, parmatrix.isint, infinity, SCIPfeastol(scip), SCIPepsilon(scip)) );
+      }
+      else
+      {
+         for( c = 0; c < ncols; ++c )
+         {
+            SCIP_VAR* var = SCIPmatrixGetVar(matrix, c);
+
+            parmatrix.lb[c] = SCIPisInfinity(scip, -SCIPvarGetLbGlobal(var)) ? -infinity : SCIPvarGetLbGlobal(var);
+            parmatrix.ub[c] = SCIPisInfinity(scip, SCIPvarGetUbGlobal(var)) ? infinity : SCIPvarGetUbGlobal(var);
+         }
+         SCIPlinpropSetBounds(parmatrix.linprop, parmatrix.lb, parmatrix.ub);
+      }
+
+      /* distribute the next candidates to the jobs */
+      while( njobs < nthreads && candidx < ncands )
+      {
+         PARPROBJOB* job = &jobs[njobs];
+         int nbatch = MIN(propdata->parallelbatchsize, ncands - candidx);
+
+         job->matrix = &parmatrix;
+         job->cands = &cands[candidx];
+         job->ncands = nbatch;
+         job->nresults = 0;
+         jobargs[njobs] = (void*)job;
+
+         for( j = 0; j < nbatch; ++j )
+            ++propdata->nprobed[SCIPvarGetIndex(SCIPmatrixGetVar(matrix, cands[candidx + j]))];
+
+         candidx += nbatch;
+         ++njobs;
+      }
+
+      SCIP_CALL( SCIPexecParallelJobs(scip, nthreads, parprobExecJob, jobargs, njobs) );
+
+      /* apply the deductions in the main thread, in the order of the jobs to stay deterministic */
+      for( j = 0; j < njobs && !(*cutoff); ++j )
+      {
+         SCIP_CALL( parprobApplyResults(scip, propdata, matrix, &jobs[j], nfixedvars, naggrvars, nchgbds, &success,
+               cutoff) );
+      }
+
+      if( success )
+         nuseless = 0;
+      else
+      {
+         for( j = 0; j < njobs; ++j )
+            nuseless += jobs[j].ncands;
+         if( propdata->maxuseless > 0 && nuseless >= propdata->maxuseless )
+            break;
+      }
+   }
+
+   for( j = nthreads - 1; j >= 0; --j )
+      BMSfreeMemoryArrayNull(&jobs[j].results);
+
+   SCIPfreeBufferArray(scip, &jobargs);
+   SCIPfreeBufferArray(scip, &jobs);
+   SCIPfreeBufferArray(scip, &candlocks);
+   SCIPfreeBufferArray(scip, &cands);
+   SCIPlinpropFree(&parmatrix.linprop);
+
+   SCIPfreeBufferArray(scip, &parmatrix.isbin);
+   SCIPfreeBufferArray(scip, &parmatrix.isint);
+   SCIPfreeBufferArray(scip, &parmatrix.ub);
+   SCIPfreeBufferArray(scip, &parmatrix.lb);
+   SCIPfreeBufferArray(scip, &rhs);
+   SCIPfreeBufferArray(scip, &lhs);
+   SCIPfreeBufferArray(scip, &rowvals);
+   SCIPfreeBufferArray(scip, &rowcols);
+   SCIPfreeBufferArray(scip, &rowbeg);
+
+   SCIPmatrixFree(scip, &matrix);
+
+   return SCIP_OKAY;
+}
+
+
 /*
  * Callback methods of propagator
  */
@@ -813,6 +1395,7 @@ SCIP_DECL_PROPINITPRE(propInitpreProbing)
    assert(propdata != NULL);
 
    propdata->lastnode = -2;
+   propdata->parallelapplied = FALSE;
 
    return SCIP_OKAY;
 }
@@ -957,6 +1540,26 @@ SCIP_DECL_PROPPRESOL(propPresolProbing)
 
    propdata->lastnode = -1;
 
+   oldnfixedvars = *nfixedvars;
+   oldnaggrvars = *naggrvars;
+   oldnchgbds = *nchgbds;
+   oldnimplications = propdata->nimplications;
+
+   /* run the parallel probing pass once per presolving, before the sequential probing with full propagation */
+   if( propdata->parallel && !propdata->parallelapplied )
+   {
+      propdata->parallelapplied = TRUE;
+
+      SCIP_CALL( applyParallelProbing(scip, propdata, nfixedvars, naggrvars, nchgbds, naddconss, ndelconss, nchgcoefs,
+            &cutoff) );
+
+      if( cutoff )
+      {
+         *result = SCIP_CUTOFF;
+         return SCIP_OKAY;
+      }
+   }
+
    /* sort the binary variables by number of rounding locks, if at least 100 variables were probed since last sort */
    if( propdata->lastsortstartidx < 0 || propdata->startidx - propdata->lastsortstartidx >= 100 )
    {
@@ -964,11 +1567,6 @@ SCIP_DECL_PROPPRESOL(propPresolProbing)
       propdata->lastsortstartidx = propdata->startidx;
    }
 
-   oldnfixedvars = *nfixedvars;
-   oldnaggrvars = *naggrvars;
-   oldnchgbds = *nchgbds;
-   oldnimplications = propdata->nimplications;
-
    /* start probing on variables */
    SCIP_CALL( applyProbing(scip, propdata, propdata->sortedvars, propdata->nsortedvars, propdata->nsortedbinvars,
          &(propdata->startidx), nfixedvars, naggrvars, nchgbds, oldnfixedvars, oldnaggrvars, &delay, &cutoff) );
@@ -1193,6 +1791,14 @@ SCIP_RETCODE SCIPincludePropProbing(
          "propagating/" PROP_NAME "/maxdepth",
          "maximal depth until propagation is executed(-1: no limit)",
          &propdata->maxdepth, TRUE, DEFAULT_MAXDEPTH, -1, INT_MAX, NULL, NULL) );
+   SCIP_CALL( SCIPaddBoolParam(scip,
+         "propagating/" PROP_NAME "/parallel",
+         "should probing in presolving start with a parallel probing pass on the linear constraint matrix?",
+         &propdata->parallel, TRUE, DEFAULT_PARALLEL, NULL, NULL) );
+   SCIP_CALL( SCIPaddIntParam(scip,
+         "propagating/" PROP_NAME "/parallelbatchsize",
+         "number of candidates that each thread probes on in parallel probing before the deductions are applied",
+         &propdata->parallelbatchsize, TRUE, DEFAULT_PARALLELBATCHSIZE, 1, INT_MAX, NULL, NULL) );
 
    return SCIP_OKAY;
 }
@@ -34,6 +34,14 @@
  *
  * The propagate is performed during the search any time a new cutoff bound (primal solution) is found.
  *
+ * For binary variables, the best root reduced cost combination stored at the variable already yields the largest cutoff
+ * bound which fixes the variable. For non-binary variables, the reduced costs of different root LP solutions lead to
+ * bounds that are best for different cutoff bounds. Therefore, the propagator collects reduced cost certificates, i.e.,
+ * combinations of root LP solution value, reduced cost, and root LP objective value, for the non-binary variables from
+ * all LP solutions of the root node. The certificates are kept in a priority queue keyed by the cutoff bound below which
+ * they tighten the current global bound of their variable, such that a new cutoff bound only visits the certificates
+ * which actually lead to a bound change.
+ *
  * @todo do not sort the variables; just store the cutoff bound which leads to a fixing. If that appears loop over all
  *       variables and fix and store the next cutoff bound which leads to an fixing
  * @todo resolve the root LP in case of repropagation and update root reduced costs use root LP counter to check if new
@@ -43,10 +51,14 @@
 /*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
 
 #include "scip/prop_rootredcost.h"
+#include "scip/pub_event.h"
+#include "scip/pub_lp.h"
 #include "scip/pub_message.h"
+#include "scip/pub_misc.h"
 #include "scip/pub_misc_sort.h"
 #include "scip/pub_prop.h"
 #include "scip/pub_var.h"
+#include "scip/scip_event.h"
 #include "scip/scip_general.h"
 #include "scip/scip_lp.h"
 #include "scip/scip_mem.h"
@@ -74,6 +86,9 @@
 #define PROP_FREQ                     1 /**< propagator frequency */
 #define PROP_DELAY                FALSE /**< should propagation method be delayed, if other propagators found reductions? */
 
+#define EVENTHDLR_NAME         "rootredcost"
+#define EVENTHDLR_DESC         "event handler collecting reduced cost certificates from root LP solutions"
+
 /**@} */
 
 /**@name Default parameter values
@@ -85,6 +100,7 @@
                                          *   the reductions are always valid, but installing an upper bound on priced
                                          *   variables may lead to problems in pricing (existing variables at their upper
                                          *   bound may be priced again since they may have negative reduced costs) */
+#define DEFAULT_MAXCERTSPERVAR       10 /**< maximal number of reduced cost certificates stored per non-binary variable */
 
 /**@} */
 
@@ -93,14 +109,33 @@
  * Data structures
  */
 
+/** reduced cost certificate of a non-binary variable from a root LP solution */
+struct RedcostCert
+{
+   SCIP_VAR*             var;                /**< variable */
+   SCIP_Real             sol;                /**< solution value of the variable in the root LP */
+   SCIP_Real             redcost;            /**< reduced cost of the variable in the root LP */
+   SCIP_Real             lpobjval;           /**< objective value of the root LP */
+   SCIP_Real             threshold;          /**< cutoff bound below which the certificate may tighten the variable's bound */
+   int                   nvarcerts;          /**< number of certificates of the variable stored up to this one */
+};
+typedef struct RedcostCert REDCOSTCERT;
+
 /** propagator data */
 struct SCIP_PropData
 {
    SCIP_VAR**            redcostvars;        /**< variables with non-zero root reduced cost */
+   SCIP_EVENTHDLR*       eventhdlr;          /**< event handler for collecting certificates from root LP solutions */
+   REDCOSTCERT**         certs;              /**< reduced cost certificates of non-binary variables */
+   SCIP_PQUEUE*          certqueue;          /**< certificates ordered by non-increasing threshold */
+   SCIP_HASHMAP*         lastcert;           /**< maps variables to their last stored certificate */
    SCIP_Real             lastcutoffbound;    /**< cutoff bound for which the root reduced costs were already processed */
    int                   nredcostvars;       /**< number of variables with non-zero root reduced cost */
    int                   nredcostbinvars;    /**< number of binary variables with non-zero root reduced cost */
    int                   glbfirstnonfixed;   /**< index of first globally non-fixed binary variable */
+   int                   ncerts;             /**< number of stored certificates */
+   int                   certssize;          /**< size of certs array */
+   int                   maxcertspervar;     /**< maximal number of reduced cost certificates stored per non-binary variable */
    SCIP_Bool             initialized;        /**< is the propagator data initialized */
    SCIP_Bool             onlybinary;         /**< should only binary variables be propagated? */
    SCIP_Bool             force;              /**< should the propagator be forced even if active pricer are present? */
@@ -123,6 +158,11 @@ void propdataReset(
    propdata->nredcostvars = 0;
    propdata->nredcostbinvars = 0;
    propdata->glbfirstnonfixed = 0;
+   propdata->certs = NULL;
+   propdata->certqueue = NULL;
+   propdata->lastcert = NULL;
+   propdata->ncerts = 0;
+   propdata->certssize = 0;
    propdata->initialized = FALSE;
 }
 
@@ -160,6 +200,177 @@ SCIP_DECL_SORTPTRCOMP(varCompRedcost)
    return SCIPvarCompare(var1, var2);
 }
 
+/** compare reduced cost certificates w.r.t. their threshold, such that the certificate with the largest threshold is
+ *  the first element of the priority queue
+ */
+static
+SCIP_DECL_SORTPTRCOMP(certCompThreshold)
+{
+   SCIP_Real key1 = ((REDCOSTCERT*)elem1)->threshold;
+   SCIP_Real key2 = ((REDCOSTCERT*)elem2)->threshold;
+
+   if( key1 > key2 )
+      return -1;
+   else if( key1 < key2 )
+      return +1;
+
+   return SCIPvarCompare(((REDCOSTCERT*)elem1)->var, ((REDCOSTCERT*)elem2)->var);
+}
+
+/** computes the cutoff bound below which the given reduced cost certificate tightens the current global bound of its
+ *  variable
+ */
+static
+SCIP_Real certGetThreshold(
+   SCIP*                 scip,               /**< SCIP data structure */
+   REDCOSTCERT*          cert                /**< reduced cost certificate */
+   )
+{
+   SCIP_Real bound;
+
+   /* positive reduced costs strengthen the upper bound, negative ones the lower bound */
+   bound = cert->redcost > 0.0 ? SCIPvarGetUbGlobal(cert->var) : SCIPvarGetLbGlobal(cert->var);
+
+   if( SCIPisInfinity(scip, REALABS(bound)) )
+      return SCIPinfinity(scip);
+
+   return cert->lpobjval + (bound - cert->sol) * cert->redcost;
+}
+
+/** checks whether the first certificate implies at least as tight bounds as the second one for all cutoff bounds at
+ *  which the second one is of any use, i.e., above the larger of both root LP objective values
+ */
+static
+SCIP_Bool certDominates(
+   SCIP*                 scip,               /**< SCIP data structure */
+   REDCOSTCERT*          cert1,              /**< first certificate */
+   REDCOSTCERT*          cert2               /**< second certificate */
+   )
+{
+   SCIP_Real cutoffbound;
+
+   assert(cert1->var == cert2->var);
+
+   if( (cert1->redcost > 0.0) != (cert2->redcost > 0.0) )
+      return FALSE;
+
+   /* the implied bound is linear in the cutoff bound with slope 1/redcost, so comparing the bounds at the smallest
+    * relevant cutoff bound and the slopes suffices
+    */
+   cutoffbound = MAX(cert1->lpobjval, cert2->lpobjval);
+
+   if( cert1->redcost > 0.0 )
+   {
+      return SCIPisLE(scip, cert1->sol + (cutoffbound - cert1->lpobjval) / cert1->redcost,
+            cert2->sol + (cutoffbound - cert2->lpobjval) / cert2->redcost)
+         && SCIPisGE(scip, cert1->redcost, cert2->redcost);
+   }
+   else
+   {
+      return SCIPisGE(scip, cert1->sol + (cutoffbound - cert1->lpobjval) / cert1->redcost,
+            cert2->sol + (cutoffbound - cert2->lpobjval) / cert2->redcost)
+         && SCIPisLE(scip, cert1->redcost, cert2->redcost);
+   }
+}
+
+/** stores a reduced cost certificate for a non-binary variable, unless it is dominated by the last certificate of the
+ *  variable; if the new certificate dominates the last one, it replaces it
+ */
+static
+SCIP_RETCODE propdataAddCert(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PROPDATA*        propdata,           /**< propagator data */
+   SCIP_VAR*             var,                /**< variable */
+   SCIP_Real             sol,                /**< solution value of the variable in the root LP */
+   SCIP_Real             redcost,            /**< reduced cost of the variable in the root LP */
+   SCIP_Real             lpobjval            /**< objective value of the root LP */
+   )
+{
+   REDCOSTCERT newcert;
+   REDCOSTCERT* cert;
+   REDCOSTCERT* lastcert;
+
+   assert(propdata != NULL);
+   assert(!SCIPvarIsBinary(var));
+   assert(!SCIPisDualfeasZero(scip, redcost));
+
+   if( propdata->lastcert == NULL )
+   {
+      SCIP_CALL( SCIPhashmapCreate(&propdata->lastcert, SCIPblkmem(scip), SCIPgetNVars(scip)) );
+   }
+
+   newcert.var = var;
+   newcert.sol = sol;
+   newcert.redcost = redcost;
+   newcert.lpobjval = lpobjval;
+   newcert.threshold = SCIP_INVALID;
+   newcert.nvarcerts = 1;
+
+   lastcert = (REDCOSTCERT*)SCIPhashmapGetImage(propdata->lastcert, (void*)var);
+   if( lastcert != NULL )
+   {
+      if( certDominates(scip, lastcert, &newcert) )
+         return SCIP_OKAY;
+
+      if( certDominates(scip, &newcert, lastcert) )
+      {
+         newcert.nvarcerts = lastcert->nvarcerts;
+         *lastcert = newcert;
+         return SCIP_OKAY;
+      }
+
+      if( lastcert->nvarcerts >= propdata->maxcertspervar )
+         return SCIP_OKAY;
+
+      newcert.nvarcerts = lastcert->nvarcerts + 1;
+   }
+
+   if( propdata->ncerts == propdata->certssize )
+   {
+      int newsize;
+
+      newsize = SCIPcalcMemGrowSize(scip, propdata->ncerts + 1);
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &propdata->certs, propdata->certssize, newsize) );
+      propdata->certssize = newsize;
+   }
+
+   SCIP_CALL( SCIPallocBlockMemory(scip, &cert) );
+   *cert = newcert;
+   SCIP_CALL( SCIPcaptureVar(scip, var) );
+   propdata->certs[propdata->ncerts++] = cert;
+
+   SCIP_CALL( SCIPhashmapSetImage(propdata->lastcert, (void*)var, (void*)cert) );
+
+   return SCIP_OKAY;
+}
+
+/** frees all reduced cost certificates */
+static
+SCIP_RETCODE propdataFreeCerts(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PROPDATA*        propdata            /**< propagator data */
+   )
+{
+   int c;
+
+   if( propdata->certqueue != NULL )
+      SCIPpqueueFree(&propdata->certqueue);
+
+   if( propdata->lastcert != NULL )
+      SCIPhashmapFree(&propdata->lastcert);
+
+   for( c = 0; c < propdata->ncerts; ++c )
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &propdata->certs[c]->var) );
+      SCIPfreeBlockMemory(scip, &propdata->certs[c]);
+   }
+   SCIPfreeBlockMemoryArrayNull(scip, &propdata->certs, propdata->certssize);
+   propdata->ncerts = 0;
+   propdata->certssize = 0;
+
+   return SCIP_OKAY;
+}
+
 /** create propagator data structure */
 static
 SCIP_RETCODE propdataCreate(
@@ -220,6 +431,8 @@ SCIP_RETCODE propdataExit(
    /* free memory for non-zero reduced cost variables */
    SCIPfreeBlockMemoryArrayNull(scip, &propdata->redcostvars, propdata->nredcostvars);
 
+   SCIP_CALL( propdataFreeCerts(scip, propdata) );
+
    propdataReset(propdata);
 
    return SCIP_OKAY;
@@ -319,6 +532,34 @@ SCIP_RETCODE propdataInit(
    propdata->nredcostvars = nredcostvars;
    propdata->nredcostbinvars = nredcostbinvars;
    propdata->glbfirstnonfixed = 0;
+
+   /* add the best root reduced cost combinations of the non-binary variables to the certificates collected from the
+    * root LP solutions, and set up the priority queue of all certificates
+    */
+   if( !propdata->onlybinary )
+   {
+      int c;
+
+      for( v = nredcostbinvars; v < nredcostvars; ++v )
+      {
+         SCIP_VAR* var;
+
+         var = propdata->redcostvars[v];
+         SCIP_CALL( propdataAddCert(scip, propdata, var, SCIPvarGetBestRootSol(var), SCIPvarGetBestRootRedcost(var),
+               SCIPvarGetBestRootLPObjval(var)) );
+      }
+
+      SCIP_CALL( SCIPpqueueCreate(&propdata->certqueue, MAX(propdata->ncerts, 1), 2.0, certCompThreshold, NULL) );
+
+      for( c = 0; c < propdata->ncerts; ++c )
+      {
+         propdata->certs[c]->threshold = certGetThreshold(scip, propdata->certs[c]);
+         SCIP_CALL( SCIPpqueueInsert(propdata->certqueue, (void*)propdata->certs[c]) );
+      }
+
+      SCIPdebugMsg(scip, "stored %d reduced cost certificates of non-binary variables\n", propdata->ncerts);
+   }
+
    propdata->lastcutoffbound = SCIPinfinity(scip);
    propdata->initialized = TRUE;
 
@@ -514,6 +755,76 @@ SCIP_RETCODE propagateBinaryBestRootRedcost(
    return SCIP_OKAY;
 }
 
+/** propagates the reduced cost certificates of non-binary variables against the cutoff bound
+ *
+ *  Only the certificates whose threshold exceeds the cutoff bound are visited. Afterwards, their threshold is updated
+ *  w.r.t. the new global bound of the variable and they are reinserted into the priority queue, unless the variable is
+ *  globally fixed.
+ */
+static
+SCIP_RETCODE propagateCerts(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PROPDATA*        propdata,           /**< propagator data structure */
+   SCIP_Real             cutoffbound,        /**< cutoff bound to use */
+   int*                  nchgbds,            /**< pointer to store the number of bound changes */
+   SCIP_Bool*            cutoff              /**< pointer to store if a cutoff was detected */
+   )
+{
+   REDCOSTCERT* cert;
+
+   assert(!(*cutoff));
+
+   if( propdata->certqueue == NULL )
+      return SCIP_OKAY;
+
+   while( SCIPpqueueNElems(propdata->certqueue) > 0 )
+   {
+      SCIP_Real newbd;
+      SCIP_Bool tightened;
+
+      cert = (REDCOSTCERT*)SCIPpqueueFirst(propdata->certqueue);
+      assert(cert != NULL);
+
+      if( cert->threshold <= cutoffbound )
+         break;
+
+      (void) SCIPpqueueRemove(propdata->certqueue);
+
+      /* drop certificates of globally fixed variables */
+      if( SCIPisFeasEQ(scip, SCIPvarGetLbGlobal(cert->var), SCIPvarGetUbGlobal(cert->var)) )
+         continue;
+
+      /* calculate reduced cost based bound */
+      newbd = cert->sol + (cutoffbound - cert->lpobjval) / cert->redcost;
+
+      if( cert->redcost > 0.0 )
+      {
+         SCIP_CALL( SCIPtightenVarUbGlobal(scip, cert->var, newbd, FALSE, cutoff, &tightened) );
+      }
+      else
+      {
+         SCIP_CALL( SCIPtightenVarLbGlobal(scip, cert->var, newbd, FALSE, cutoff, &tightened) );
+      }
+
+      if( *cutoff )
+      {
+         SCIPdebugMsg(scip, "detected cutoff: variable <%s> [%g,%g], redcost <%g>, rootsol <%g>, rootlpobjval <%g>\n",
+            SCIPvarGetName(cert->var), SCIPvarGetLbGlobal(cert->var), SCIPvarGetUbGlobal(cert->var), cert->redcost,
+            cert->sol, cert->lpobjval);
+         break;
+      }
+
+      if( tightened )
+         (*nchgbds)++;
+
+      /* the bound change may be pending, so the threshold is at most the current cutoff bound */
+      cert->threshold = MIN(certGetThreshold(scip, cert), cutoffbound);
+      SCIP_CALL( SCIPpqueueInsert(propdata->certqueue, (void*)cert) );
+   }
+
+   return SCIP_OKAY;
+}
+
 /**@} */
 
 
@@ -522,6 +833,69 @@ SCIP_RETCODE propagateBinaryBestRootRedcost(
  * @{
  */
 
+/** execution method of event handler: collects reduced cost certificates of non-binary variables from root LP
+ *  solutions
+ */
+static
+SCIP_DECL_EVENTEXEC(eventExecRootredcost)
+{  /*lint --e{715}*/
+   SCIP_PROPDATA* propdata;
+   SCIP_COL** cols;
+   SCIP_Real lpobjval;
+   int ncols;
+   int c;
+
+   assert(SCIPeventGetType(event) & SCIP_EVENTTYPE_LPEVENT);
+
+   propdata = (SCIP_PROPDATA*)eventdata;
+   assert(propdata != NULL);
+
+   /* only LP solutions of the root node with global bounds yield globally valid certificates */
+   if( propdata->initialized || propdata->onlybinary || SCIPgetDepth(scip) != 0 || SCIPinProbing(scip) || SCIPinDive(scip) )
+      return SCIP_OKAY;
+
+   if( SCIPgetLPSolstat(scip) != SCIP_LPSOLSTAT_OPTIMAL || !SCIPisLPDualReliable(scip) )
+      return SCIP_OKAY;
+
+   if( !propdata->force && SCIPgetNActivePricers(scip) > 0 )
+      return SCIP_OKAY;
+
+   if( SCIPgetNObjVars(scip) == 0 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPgetLPColsData(scip, &cols, &ncols) );
+   lpobjval = SCIPgetLPObjval(scip);
+
+   if( SCIPisInfinity(scip, REALABS(lpobjval)) )
+      return SCIP_OKAY;
+
+   for( c = 0; c < ncols; ++c )
+   {
+      SCIP_VAR* var;
+      SCIP_Real redcost;
+      SCIP_Real sol;
+
+      var = SCIPcolGetVar(cols[c]);
+
+      if( SCIPvarIsBinary(var) )
+         continue;
+
+      redcost = SCIPgetColRedcost(scip, cols[c]);
+      if( SCIPisDualfeasZero(scip, redcost) )
+         continue;
+
+      /* only columns at the bound that the reduced cost refers to are certificates */
+      sol = SCIPcolGetPrimsol(cols[c]);
+      if( redcost > 0.0 ? !SCIPisFeasEQ(scip, sol, SCIPvarGetLbGlobal(var))
+         : !SCIPisFeasEQ(scip, sol, SCIPvarGetUbGlobal(var)) )
+         continue;
+
+      SCIP_CALL( propdataAddCert(scip, propdata, var, sol, redcost, lpobjval) );
+   }
+
+   return SCIP_OKAY;
+}
+
 /** copy method for propagator plugins (called when SCIP copies plugins) */
 static
 SCIP_DECL_PROPCOPY(propCopyRootredcost)
@@ -553,6 +927,21 @@ SCIP_DECL_PROPFREE(propFreeRootredcost)
    return SCIP_OKAY;
 }
 
+/** solving process initialization method of propagator (called when branch and bound process is about to begin) */
+static
+SCIP_DECL_PROPINITSOL(propInitsolRootredcost)
+{  /*lint --e{715}*/
+   SCIP_PROPDATA* propdata;
+
+   propdata = SCIPpropGetData(prop);
+   assert(propdata != NULL);
+
+   /* collect reduced cost certificates from all LP solutions of the root node */
+   SCIP_CALL( SCIPcatchEvent(scip, SCIP_EVENTTYPE_LPEVENT, propdata->eventhdlr, (SCIP_EVENTDATA*)propdata, NULL) );
+
+   return SCIP_OKAY;
+}
+
 /** solving process deinitialization method of propagator (called before branch and bound process data is freed) */
 static
 SCIP_DECL_PROPEXITSOL(propExitsolRootredcost)
@@ -562,6 +951,8 @@ SCIP_DECL_PROPEXITSOL(propExitsolRootredcost)
    propdata = SCIPpropGetData(prop);
    assert(propdata != NULL);
 
+   SCIP_CALL( SCIPdropEvent(scip, SCIP_EVENTTYPE_LPEVENT, propdata->eventhdlr, (SCIP_EVENTDATA*)propdata, -1) );
+
    /* reset propagator data structure */
    SCIP_CALL( propdataExit(scip, propdata) );
 
@@ -573,13 +964,11 @@ static
 SCIP_DECL_PROPEXEC(propExecRootredcost)
 {  /*lint --e{715}*/
    SCIP_PROPDATA* propdata;
-   SCIP_VAR** redcostvars;
    SCIP_Real cutoffbound;
    SCIP_Real lpobjval;
    SCIP_Bool cutoff;
    int nredcostvars;
    int nchgbds;
-   int v;
 
    *result = SCIP_DIDNOTRUN;
 
@@ -632,12 +1021,10 @@ SCIP_DECL_PROPEXEC(propExecRootredcost)
    if( cutoffbound == propdata->lastcutoffbound ) /*lint !e777*/
       return SCIP_OKAY;
 
-   /* get variables */
-   redcostvars = propdata->redcostvars;
    nredcostvars = propdata->nredcostvars;
 
    /* since no variables has non-zero reduced cost do nothing */
-   if( nredcostvars == 0 )
+   if( nredcostvars == 0 && propdata->ncerts == 0 )
       return SCIP_OKAY;
 
    /* store cutoff bound to remember later that for that particular cutoff bound the propagation was already
@@ -656,23 +1043,10 @@ SCIP_DECL_PROPEXEC(propExecRootredcost)
    /* propagate the binary variables with non-zero root reduced cost */
    SCIP_CALL( propagateBinaryBestRootRedcost(scip, propdata, cutoffbound, &nchgbds, &cutoff) );
 
-   if( !propdata->onlybinary )
+   /* propagate the reduced cost certificates of the non-binary variables whose threshold exceeds the cutoff bound */
+   if( !propdata->onlybinary && !cutoff )
    {
-      /* check reduced costs for non-binary variables that were columns of the root LP */
-      for( v = propdata->nredcostbinvars; v < nredcostvars && !cutoff; ++v )
-      {
-         SCIP_VAR* var;
-         SCIP_Bool tightened;
-
-         var = redcostvars[v];
-         assert(var != NULL);
-
-         /* try to tighten the variable bound */
-         SCIP_CALL( propagateRootRedcostVar(scip, var, cutoffbound, &cutoff, &tightened) );
-
-         if( tightened )
-            nchgbds++;
-      }
+      SCIP_CALL( propagateCerts(scip, propdata, cutoffbound, &nchgbds, &cutoff) );
    }
 
    /* evaluate propagation results */
@@ -713,8 +1087,14 @@ SCIP_RETCODE SCIPincludePropRootredcost(
    /* set optional callbacks via setter functions */
    SCIP_CALL( SCIPsetPropCopy(scip, prop, propCopyRootredcost) );
    SCIP_CALL( SCIPsetPropFree(scip, prop, propFreeRootredcost) );
+   SCIP_CALL( SCIPsetPropInitsol(scip, prop, propInitsolRootredcost) );
    SCIP_CALL( SCIPsetPropExitsol(scip, prop, propExitsolRootredcost) );
 
+   /* include event handler for collecting reduced cost certificates */
+   SCIP_CALL( SCIPincludeEventhdlrBasic(scip, &propdata->eventhdlr, EVENTHDLR_NAME, EVENTHDLR_DESC,
+         eventExecRootredcost, NULL) );
+   assert(propdata->eventhdlr != NULL);
+
    SCIP_CALL( SCIPaddBoolParam(scip,
          "propagating/" PROP_NAME "/onlybinary",
          "should only binary variables be propagated?",
@@ -723,6 +1103,10 @@ SCIP_RETCODE SCIPincludePropRootredcost(
          "propagating/" PROP_NAME "/force",
          "should the propagator be forced even if active pricer are present?",
          &propdata->force, TRUE, DEFAULT_FORCE, NULL, NULL) );
+   SCIP_CALL( SCIPaddIntParam(scip,
+         "propagating/" PROP_NAME "/maxcertspervar",
+         "maximal number of reduced cost certificates from root LP solutions stored per non-binary variable",
+         &propdata->maxcertspervar, TRUE, DEFAULT_MAXCERTSPERVAR, 1, INT_MAX, NULL, NULL) );
 
    return SCIP_OKAY;
 }
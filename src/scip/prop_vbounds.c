@@ -58,6 +58,11 @@
  *    exists a directed edge from one node to another, if the bound corresponding to the former node influences the
  *    bound corresponding to the latter node. This is done by iteratively running a DFS until all nodes were visited.
  *    Note that there might be cycles in the graph, which are randomly broken, so the order is only almost topological.
+ *    The vbounds are stored consecutively for all bounds, together with the reverse direction. Variable bounds that are
+ *    added during the solving process are detected by events on the variables; they are appended to the graph and the
+ *    order is updated incrementally by the dynamic topological sort of Pearce and Kelly, which only reorders the bounds
+ *    affected by the new vbound. If cycles should be detected, the cycles closed by new vbounds are analyzed in the same
+ *    way as the cycles found by the DFS.
  *
  * 3) Collecting bound changes
  *
@@ -185,22 +190,42 @@ struct SCIP_PropData
    SCIP_VAR**            vars;               /**< array containing all variable which are considered within the propagator */
    SCIP_HASHMAP*         varhashmap;         /**< hashmap mapping from variable to index in the vars array */
    int*                  topoorder;          /**< array mapping on the bounds of variables in topological order;
-                                              *   or -1, if the bound that should be at that position has no outgoing
-                                              *   implications, cliques, or vbounds;
-                                              *   i.e., for i < j and topoorder[i] != -1 != topoorder[j], the variable
-                                              *   and boundtype represented by index topoorder[i] are earlier in the
-                                              *   topological order than those represented by index topoorder[j]
+                                              *   i.e., for i < j, the variable and boundtype represented by index
+                                              *   topoorder[i] are earlier in the topological order than those
+                                              *   represented by index topoorder[j]
                                               */
-   int**                 vboundboundedidx;   /**< array storing for each bound index the bound indices of all bounds
-                                              *   influenced by this bound through variable bounds */
-   SCIP_Real**           vboundcoefs;        /**< array storing for each bound index the coefficients in the variable
-                                              *   bounds influencing the corresponding bound index stored in
-                                              *   vboundboundedidx */
-   SCIP_Real**           vboundconstants;    /**< array storing for each bound index the constants in the variable
-                                              *   bounds influencing the corresponding bound index stored in
-                                              *   vboundboundedidx */
+   int*                  topopos;            /**< position of each bound index in the topoorder array */
+   SCIP_Bool*            boundevents;        /**< are changes of the bound caught, i.e., does the bound have outgoing
+                                              *   implications, cliques, or vbounds? */
+   int*                  vboundbeg;          /**< array storing for each bound index the start of its vbounds in the
+                                              *   vbound arrays */
+   int*                  vboundboundedidx;   /**< array storing consecutively for each bound index the bound indices of
+                                              *   all bounds influenced by this bound through variable bounds */
+   SCIP_Real*            vboundcoefs;        /**< array storing the coefficients in the variable bounds influencing the
+                                              *   corresponding bound index stored in vboundboundedidx */
+   SCIP_Real*            vboundconstants;    /**< array storing the constants in the variable bounds influencing the
+                                              *   corresponding bound index stored in vboundboundedidx */
    int*                  nvbounds;           /**< array storing for each bound index the number of vbounds stored */
-   int*                  vboundsize;         /**< array with sizes of vbound arrays for the nodes */
+   int*                  vboundsize;         /**< array storing for each bound index the number of reserved slots in
+                                              *   the vbound arrays */
+   int                   nvboundslots;       /**< number of used slots in the vbound arrays */
+   int                   vboundslotssize;    /**< size of the vbound arrays */
+   int*                  vboundinbeg;        /**< array storing for each bound index the start of the bound indices
+                                              *   influencing it in vboundinidx */
+   int*                  vboundinidx;        /**< array storing consecutively for each bound index the bound indices of
+                                              *   all bounds influencing this bound through variable bounds */
+   int*                  nvboundsin;         /**< array storing for each bound index the number of influencing bounds */
+   int*                  vboundinsize;       /**< array storing for each bound index the number of reserved slots in
+                                              *   vboundinidx */
+   int                   nvboundinslots;     /**< number of used slots in vboundinidx */
+   int                   vboundinslotssize;  /**< size of vboundinidx */
+   int*                  nvarvbounds;        /**< array storing for each bound index the number of variable bounds of
+                                              *   the variable that were regarded when the vbounds were collected */
+   int*                  searchmark;         /**< marks of the bounds visited by the incremental topological sort */
+   int*                  changedvars;        /**< indices of variables whose implications or variable bounds were
+                                              *   extended since the last propagation call */
+   SCIP_Bool*            varchanged;         /**< array storing for each variable whether it is in changedvars */
+   int                   nchangedvars;       /**< number of variables in changedvars */
    int                   nbounds;            /**< number of bounds of variables regarded (two times number of active variables) */
    int                   lastpresolncliques; /**< number of cliques created until the last call to the presolver */
    SCIP_PQUEUE*          propqueue;          /**< priority queue to handle the bounds of variables that were changed and have to be propagated */
@@ -340,15 +365,75 @@ void resetPropdata(
    propdata->vars = NULL;
    propdata->varhashmap = NULL;
    propdata->topoorder = NULL;
+   propdata->topopos = NULL;
+   propdata->boundevents = NULL;
+   propdata->vboundbeg = NULL;
    propdata->vboundboundedidx = NULL;
    propdata->vboundcoefs = NULL;
    propdata->vboundconstants = NULL;
    propdata->nvbounds = NULL;
    propdata->vboundsize = NULL;
+   propdata->nvboundslots = 0;
+   propdata->vboundslotssize = 0;
+   propdata->vboundinbeg = NULL;
+   propdata->vboundinidx = NULL;
+   propdata->nvboundsin = NULL;
+   propdata->vboundinsize = NULL;
+   propdata->nvboundinslots = 0;
+   propdata->vboundinslotssize = 0;
+   propdata->nvarvbounds = NULL;
+   propdata->searchmark = NULL;
+   propdata->changedvars = NULL;
+   propdata->varchanged = NULL;
+   propdata->nchangedvars = 0;
    propdata->nbounds = 0;
    propdata->initialized = FALSE;
 }
 
+/** returns the eventtype that is caught for the given bound index */
+static
+SCIP_EVENTTYPE getBoundEventtype(
+   int                   idx                 /**< bound index */
+   )
+{
+   if( isIndexLowerbound(idx) )
+      return SCIP_EVENTTYPE_LBTIGHTENED | SCIP_EVENTTYPE_GLBCHANGED;
+   else
+      return SCIP_EVENTTYPE_UBTIGHTENED | SCIP_EVENTTYPE_GUBCHANGED;
+}
+
+/** catches the bound change events of a bound, if it influences other bounds by implications, cliques, or vbounds */
+static
+SCIP_RETCODE catchBoundEvents(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PROPDATA*        propdata,           /**< propagator data */
+   int                   idx                 /**< bound index */
+   )
+{
+   SCIP_VAR* var;
+   SCIP_Bool lower;
+
+   assert(idx >= 0 && idx < propdata->nbounds);
+
+   if( propdata->boundevents[idx] )
+      return SCIP_OKAY;
+
+   var = propdata->vars[getVarIndex(idx)];
+   lower = isIndexLowerbound(idx);
+
+   /* if the bound does not influence another bound by implications, cliques, or vbounds,
+    * we do not create an event and do not catch changes of the bound
+    */
+   if( propdata->nvbounds[idx] == 0 && SCIPvarGetNImpls(var, lower) == 0 && SCIPvarGetNCliques(var, lower) == 0 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPcatchVarEvent(scip, var, getBoundEventtype(idx), propdata->eventhdlr,
+         (SCIP_EVENTDATA*) (uintptr_t) idx, NULL) ); /*lint !e571*/
+   propdata->boundevents[idx] = TRUE;
+
+   return SCIP_OKAY;
+}
+
 /** catches events for variables */
 static
 SCIP_RETCODE catchEvents(
@@ -356,53 +441,29 @@ SCIP_RETCODE catchEvents(
    SCIP_PROPDATA*        propdata            /**< propagator data */
    )
 {
-   SCIP_EVENTHDLR* eventhdlr;
-   SCIP_EVENTTYPE eventtype;
-   SCIP_VAR** vars;
-   SCIP_VAR* var;
-   SCIP_Bool lower;
-   int nbounds;
+   int nvars;
    int v;
-   int idx;
 
    assert(scip != NULL);
    assert(propdata != NULL);
    assert(propdata->vars != NULL);
-   assert(propdata->topoorder != NULL);
+   assert(propdata->boundevents != NULL);
+   assert(propdata->eventhdlr != NULL);
 
-   /* catch variable events according to computed eventtypes */
-   eventhdlr = propdata->eventhdlr;
-   assert(eventhdlr != NULL);
-
-   vars = propdata->vars;
-   nbounds = propdata->nbounds;
-
-   /* setup events */
-   for( v = 0; v < nbounds; ++v )
+   /* setup bound change events */
+   for( v = 0; v < propdata->nbounds; ++v )
    {
-      idx = propdata->topoorder[v];
-      assert(idx >= 0 && idx < nbounds);
-
-      var = vars[getVarIndex(idx)];
-      lower = isIndexLowerbound(idx);
-
-      /* if the bound does not influence another bound by implications, cliques, or vbounds,
-       * we do not create an event and do not catch changes of the bound;
-       * we mark this by setting the value in topoorder to -1
-       */
-      if( propdata->nvbounds[idx] == 0 && SCIPvarGetNImpls(var, lower) == 0 && SCIPvarGetNCliques(var, lower) == 0 )
-      {
-         propdata->topoorder[v] = -1;
-         continue;
-      }
-
-      /* determine eventtype that we want to catch depending on boundtype of variable */
-      if( lower )
-         eventtype = SCIP_EVENTTYPE_LBTIGHTENED | SCIP_EVENTTYPE_GLBCHANGED;
-      else
-         eventtype = SCIP_EVENTTYPE_UBTIGHTENED | SCIP_EVENTTYPE_GUBCHANGED;
+      SCIP_CALL( catchBoundEvents(scip, propdata, v) );
+   }
 
-      SCIP_CALL( SCIPcatchVarEvent(scip, var, eventtype, eventhdlr, (SCIP_EVENTDATA*) (uintptr_t) v, NULL) ); /*lint !e571*/
+   /* catch extensions of the implications and variable bounds of all variables, such that vbounds added during the
+    * solving process are added to the graph and bounds that get outgoing implications or cliques are watched
+    */
+   nvars = propdata->nbounds / 2;
+   for( v = 0; v < nvars; ++v )
+   {
+      SCIP_CALL( SCIPcatchVarEvent(scip, propdata->vars[v], SCIP_EVENTTYPE_IMPLADDED, propdata->eventhdlr,
+            (SCIP_EVENTDATA*) (uintptr_t) v, NULL) ); /*lint !e571*/
    }
 
    return SCIP_OKAY;
@@ -415,49 +476,96 @@ SCIP_RETCODE dropEvents(
    SCIP_PROPDATA*        propdata            /**< propagator data */
    )
 {
-   SCIP_EVENTHDLR* eventhdlr;
-   SCIP_EVENTTYPE eventtype;
-   SCIP_VAR** vars;
-   SCIP_VAR* var;
-   SCIP_Bool lower;
-   int nbounds;
+   int nvars;
    int v;
-   int idx;
 
    assert(propdata != NULL);
+   assert(propdata->eventhdlr != NULL);
 
-   eventhdlr = propdata->eventhdlr;
-   assert(eventhdlr != NULL);
+   for( v = 0; v < propdata->nbounds; ++v )
+   {
+      if( !propdata->boundevents[v] )
+         continue;
 
-   vars = propdata->vars;
-   nbounds = propdata->nbounds;
+      SCIP_CALL( SCIPdropVarEvent(scip, propdata->vars[getVarIndex(v)], getBoundEventtype(v), propdata->eventhdlr,
+            (SCIP_EVENTDATA*) (uintptr_t) v, -1) ); /*lint !e571*/
+      propdata->boundevents[v] = FALSE;
+   }
 
-   for( v = 0; v < nbounds; ++v )
+   nvars = propdata->nbounds / 2;
+   for( v = 0; v < nvars; ++v )
    {
-      idx = propdata->topoorder[v];
+      SCIP_CALL( SCIPdropVarEvent(scip, propdata->vars[v], SCIP_EVENTTYPE_IMPLADDED, propdata->eventhdlr,
+            (SCIP_EVENTDATA*) (uintptr_t) v, -1) ); /*lint !e571*/
+   }
 
-      if( idx == -1 )
-         continue;
+   return SCIP_OKAY;
+}
 
-      assert(idx >= 0 && idx < nbounds);
+#define INITMEMSIZE 5
 
-      var = vars[getVarIndex(idx)];
-      lower = isIndexLowerbound(idx);
+/** ensures that there is a free slot behind the entries of a bound in a list that is stored consecutively for all bounds;
+ *  if the slots of the bound are used up, its entries are moved to the end of the list, the slots left behind are
+ *  reclaimed when the data is initialized for the next solve
+ */
+static
+SCIP_RETCODE ensureSlot(
+   SCIP*                 scip,               /**< SCIP data structure */
+   int*                  beg,                /**< pointer to the start of the entries of the bound */
+   int*                  size,               /**< pointer to the number of reserved slots of the bound */
+   int                   nentries,           /**< number of entries of the bound */
+   int*                  nslots,             /**< pointer to the number of used slots of the list */
+   int*                  slotssize,          /**< pointer to the size of the list arrays */
+   int**                 idxs,               /**< pointer to the array of bound indices of the list */
+   SCIP_Real**           coefs,              /**< pointer to the coefficient array of the list, or NULL */
+   SCIP_Real**           constants           /**< pointer to the constant array of the list, or NULL */
+   )
+{
+   int newbeg;
+   int newsize;
 
-      /* determine eventtype that we catch and now want to drop depending on boundtype of variable */
-      if( lower )
-         eventtype = SCIP_EVENTTYPE_LBTIGHTENED | SCIP_EVENTTYPE_GLBCHANGED;
-      else
-         eventtype = SCIP_EVENTTYPE_UBTIGHTENED | SCIP_EVENTTYPE_GUBCHANGED;
+   assert((coefs == NULL) == (constants == NULL));
+
+   if( nentries < *size )
+      return SCIP_OKAY;
 
-      SCIP_CALL( SCIPdropVarEvent(scip, var, eventtype, eventhdlr, (SCIP_EVENTDATA*) (uintptr_t) v, -1) ); /*lint !e571*/
+   newsize = MAX(INITMEMSIZE, 2 * nentries);
+
+   /* the entries of the bound are the last ones in the list, so they can be extended in place */
+   if( *beg + *size == *nslots )
+      newbeg = *beg;
+   else
+      newbeg = *nslots;
+
+   if( newbeg + newsize > *slotssize )
+   {
+      *slotssize = SCIPcalcMemGrowSize(scip, newbeg + newsize);
+
+      SCIP_CALL( SCIPreallocMemoryArray(scip, idxs, *slotssize) );
+      if( coefs != NULL )
+      {
+         SCIP_CALL( SCIPreallocMemoryArray(scip, coefs, *slotssize) );
+         SCIP_CALL( SCIPreallocMemoryArray(scip, constants, *slotssize) );
+      }
    }
 
+   if( newbeg != *beg )
+   {
+      BMScopyMemoryArray(&(*idxs)[newbeg], &(*idxs)[*beg], nentries);
+      if( coefs != NULL )
+      {
+         BMScopyMemoryArray(&(*coefs)[newbeg], &(*coefs)[*beg], nentries);
+         BMScopyMemoryArray(&(*constants)[newbeg], &(*constants)[*beg], nentries);
+      }
+      *beg = newbeg;
+   }
+
+   *size = newsize;
+   *nslots = newbeg + newsize;
+
    return SCIP_OKAY;
 }
 
-#define INITMEMSIZE 5
-
 /* adds a vbound to the propagator data to store it internally and allow forward propagation */
 static
 SCIP_RETCODE addVbound(
@@ -469,36 +577,27 @@ SCIP_RETCODE addVbound(
    SCIP_Real             constant            /**< constant in the variable bound */
    )
 {
-   int nvbounds;
+   int pos;
 
    assert(scip != NULL);
    assert(propdata != NULL);
 
-   if( propdata->vboundsize[startidx] == 0 )
-   {
-      /* allocate memory for storing vbounds */
-      propdata->vboundsize[startidx] = INITMEMSIZE;
+   SCIP_CALL( ensureSlot(scip, &propdata->vboundbeg[startidx], &propdata->vboundsize[startidx],
+         propdata->nvbounds[startidx], &propdata->nvboundslots, &propdata->vboundslotssize,
+         &propdata->vboundboundedidx, &propdata->vboundcoefs, &propdata->vboundconstants) );
 
-      SCIP_CALL( SCIPreallocMemoryArray(scip, &propdata->vboundboundedidx[startidx], propdata->vboundsize[startidx]) ); /*lint !e866*/
-      SCIP_CALL( SCIPreallocMemoryArray(scip, &propdata->vboundcoefs[startidx], propdata->vboundsize[startidx]) ); /*lint !e866*/
-      SCIP_CALL( SCIPreallocMemoryArray(scip, &propdata->vboundconstants[startidx], propdata->vboundsize[startidx]) ); /*lint !e866*/
-   }
-   else if( propdata->nvbounds[startidx] >= propdata->vboundsize[startidx] )
-   {
-      /* reallocate memory for storing vbounds */
-      propdata->vboundsize[startidx] = SCIPcalcMemGrowSize(scip, propdata->nvbounds[startidx] + 1);
-      assert(propdata->nvbounds[startidx] < propdata->vboundsize[startidx]);
+   pos = propdata->vboundbeg[startidx] + propdata->nvbounds[startidx];
+   propdata->vboundboundedidx[pos] = endidx;
+   propdata->vboundcoefs[pos] = coef;
+   propdata->vboundconstants[pos] = constant;
+   (propdata->nvbounds[startidx])++;
 
-      SCIP_CALL( SCIPreallocMemoryArray(scip, &propdata->vboundboundedidx[startidx], propdata->vboundsize[startidx]) ); /*lint !e866*/
-      SCIP_CALL( SCIPreallocMemoryArray(scip, &propdata->vboundcoefs[startidx], propdata->vboundsize[startidx]) ); /*lint !e866*/
-      SCIP_CALL( SCIPreallocMemoryArray(scip, &propdata->vboundconstants[startidx], propdata->vboundsize[startidx]) ); /*lint !e866*/
-   }
+   SCIP_CALL( ensureSlot(scip, &propdata->vboundinbeg[endidx], &propdata->vboundinsize[endidx],
+         propdata->nvboundsin[endidx], &propdata->nvboundinslots, &propdata->vboundinslotssize,
+         &propdata->vboundinidx, NULL, NULL) );
 
-   nvbounds = propdata->nvbounds[startidx];
-   propdata->vboundboundedidx[startidx][nvbounds] = endidx;
-   propdata->vboundcoefs[startidx][nvbounds] = coef;
-   propdata->vboundconstants[startidx][nvbounds] = constant;
-   (propdata->nvbounds[startidx])++;
+   propdata->vboundinidx[propdata->vboundinbeg[endidx] + propdata->nvboundsin[endidx]] = startidx;
+   (propdata->nvboundsin[endidx])++;
 
    return SCIP_OKAY;
 }
@@ -515,6 +614,85 @@ SCIP_DECL_SORTPTRCOMP(compVarboundIndices)
    return idx2 - idx1;
 }
 
+/** derives bound changes or infeasibility from the aggregated relation of a cycle in the variable bound graph
+ *
+ *  The relation states that the bound of the variable with index cycleidx is at least (lower bound) or at most (upper
+ *  bound) coef times the bound itself plus constant.
+ */
+static
+SCIP_RETCODE analyzeCycleRelation(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PROPDATA*        propdata,           /**< propagator data */
+   int                   cycleidx,           /**< index of the bound at the end-point of the cycle */
+   SCIP_Real             coef,               /**< aggregated coefficient of the cycle */
+   SCIP_Real             constant,           /**< aggregated constant of the cycle */
+   SCIP_Bool*            infeasible          /**< pointer to store whether an infeasibility was detected */
+   )
+{
+   SCIP_VAR** vars;
+   SCIP_Bool islower;
+   SCIP_Real newbound;
+
+   assert(scip != NULL);
+   assert(propdata != NULL);
+   assert(infeasible != NULL);
+
+   vars = propdata->vars;
+   islower = isIndexLowerbound(cycleidx);
+
+   /* we have a relation x <=/>= coef * x + constant now
+    * (the relation depends on islower, i.e., whether the last node in the cycle is a lower or upper bound)
+    * case 1) coef is 1.0 --> x cancels out and we have a statement 0 <=/>= constant.
+    *         if we have a >= relation and constant is positive, we have a contradiction 0 >= constant
+    *         if we have a <= relation and constant is negative, we have a contradiction 0 <= constant
+    * case 2) coef != 1.0 --> we have a relation x - coef * x <=/>= constant
+    *                                      <=> (1 - coef) * x <=/>= constant
+    *         if coef < 1.0 this gives us x >= constant / (1 - coef) (if islower=TRUE)
+    *                                  or x <= constant / (1 - coef) (if islower=FALSE)
+    *         if coef > 1.0, the relation signs need to be switched.
+    */
+   if( SCIPisEQ(scip, coef, 1.0) )
+   {
+      if( islower && SCIPisFeasPositive(scip, constant) )
+      {
+         SCIPdebugMsg(scip, "-> infeasible aggregated variable bound relation 0 >= %g\n", constant);
+         *infeasible = TRUE;
+      }
+      else if( !islower && SCIPisFeasNegative(scip, constant) )
+      {
+         SCIPdebugMsg(scip, "-> infeasible aggregated variable bound relation 0 <= %g\n", constant);
+         *infeasible = TRUE;
+      }
+   }
+   else
+   {
+      SCIP_Bool tightened;
+
+      newbound = constant / (1.0 - coef);
+
+      if( SCIPisGT(scip, coef, 1.0) )
+         islower = !islower;
+
+      if( islower )
+      {
+         SCIPdebugMsg(scip, "-> found new lower bound: <%s>[%g,%g] >= %g\n", SCIPvarGetName(vars[getVarIndex(cycleidx)]),
+            SCIPvarGetLbLocal(vars[getVarIndex(cycleidx)]), SCIPvarGetUbLocal(vars[getVarIndex(cycleidx)]), newbound);
+         SCIP_CALL( SCIPtightenVarLb(scip, vars[getVarIndex(cycleidx)], newbound, FALSE, infeasible, &tightened) );
+      }
+      else
+      {
+         SCIPdebugMsg(scip, "-> found new upper bound: <%s>[%g,%g] <= %g\n", SCIPvarGetName(vars[getVarIndex(cycleidx)]),
+            SCIPvarGetLbLocal(vars[getVarIndex(cycleidx)]), SCIPvarGetUbLocal(vars[getVarIndex(cycleidx)]), newbound);
+         SCIP_CALL( SCIPtightenVarUb(scip, vars[getVarIndex(cycleidx)], newbound, FALSE, infeasible, &tightened) );
+      }
+
+      if( tightened )
+         SCIPdebugMsg(scip, "---> applied new bound\n");
+   }
+
+   return SCIP_OKAY;
+}
+
 /* extract bound changes or infeasibility information from a cycle in the variable bound graph detected during
  * depth-first search
  */
@@ -539,8 +717,6 @@ SCIP_RETCODE extractCycle(
 
    SCIP_Real coef = 1.0;
    SCIP_Real constant = 0.0;
-   SCIP_Bool islower;
-   SCIP_Real newbound;
    int cycleidx;
    int startidx;
    int ntmpimpls;
@@ -727,15 +903,16 @@ SCIP_RETCODE extractCycle(
 
          k = stacknextedge[j] - ntmpimpls - 1;
          assert(k < propdata->nvbounds[dfsstack[j]]);
-         assert(propdata->vboundboundedidx[dfsstack[j]][k] == dfsstack[j+1]);
+         k += propdata->vboundbeg[dfsstack[j]];
+         assert(propdata->vboundboundedidx[k] == dfsstack[j+1]);
 
          SCIPdebugMsg(scip, "%s(%s) -- (*%g + %g) --> %s(%s)\n",
             indexGetBoundString(dfsstack[j]), SCIPvarGetName(vars[getVarIndex(dfsstack[j])]),
-            propdata->vboundcoefs[dfsstack[j]][k], propdata->vboundconstants[dfsstack[j]][k],
+            propdata->vboundcoefs[k], propdata->vboundconstants[k],
             indexGetBoundString(dfsstack[j+1]), SCIPvarGetName(vars[getVarIndex(dfsstack[j+1])]));
 
-         coef = coef * propdata->vboundcoefs[dfsstack[j]][k];
-         constant = constant * propdata->vboundcoefs[dfsstack[j]][k] + propdata->vboundconstants[dfsstack[j]][k];
+         coef = coef * propdata->vboundcoefs[k];
+         constant = constant * propdata->vboundcoefs[k] + propdata->vboundconstants[k];
       }
    }
 
@@ -744,57 +921,7 @@ SCIP_RETCODE extractCycle(
       coef, constant,
       indexGetBoundString(cycleidx), SCIPvarGetName(vars[getVarIndex(cycleidx)]));
 
-   islower = isIndexLowerbound(cycleidx);
-
-   /* we have a relation x <=/>= coef * x + constant now
-    * (the relation depends on islower, i.e., whether the last node in the cycle is a lower or upper bound)
-    * case 1) coef is 1.0 --> x cancels out and we have a statement 0 <=/>= constant.
-    *         if we have a >= relation and constant is positive, we have a contradiction 0 >= constant
-    *         if we have a <= relation and constant is negative, we have a contradiction 0 <= constant
-    * case 2) coef != 1.0 --> we have a relation x - coef * x <=/>= constant
-    *                                      <=> (1 - coef) * x <=/>= constant
-    *         if coef < 1.0 this gives us x >= constant / (1 - coef) (if islower=TRUE)
-    *                                  or x <= constant / (1 - coef) (if islower=FALSE)
-    *         if coef > 1.0, the relation signs need to be switched.
-    */
-   if( SCIPisEQ(scip, coef, 1.0) )
-   {
-      if( islower && SCIPisFeasPositive(scip, constant) )
-      {
-         SCIPdebugMsg(scip, "-> infeasible aggregated variable bound relation 0 >= %g\n", constant);
-         *infeasible = TRUE;
-      }
-      else if( !islower && SCIPisFeasNegative(scip, constant) )
-      {
-         SCIPdebugMsg(scip, "-> infeasible aggregated variable bound relation 0 <= %g\n", constant);
-         *infeasible = TRUE;
-      }
-   }
-   else
-   {
-      SCIP_Bool tightened;
-
-      newbound = constant / (1.0 - coef);
-
-      if( SCIPisGT(scip, coef, 1.0) )
-         islower = !islower;
-
-      if( islower )
-      {
-         SCIPdebugMsg(scip, "-> found new lower bound: <%s>[%g,%g] >= %g\n", SCIPvarGetName(vars[getVarIndex(cycleidx)]),
-            SCIPvarGetLbLocal(vars[getVarIndex(cycleidx)]), SCIPvarGetUbLocal(vars[getVarIndex(cycleidx)]), newbound);
-         SCIP_CALL( SCIPtightenVarLb(scip, vars[getVarIndex(cycleidx)], newbound, FALSE, infeasible, &tightened) );
-      }
-      else
-      {
-         SCIPdebugMsg(scip, "-> found new upper bound: <%s>[%g,%g] <= %g\n", SCIPvarGetName(vars[getVarIndex(cycleidx)]),
-            SCIPvarGetLbLocal(vars[getVarIndex(cycleidx)]), SCIPvarGetUbLocal(vars[getVarIndex(cycleidx)]), newbound);
-         SCIP_CALL( SCIPtightenVarUb(scip, vars[getVarIndex(cycleidx)], newbound, FALSE, infeasible, &tightened) );
-      }
-
-      if( tightened )
-         SCIPdebugMsg(scip, "---> applied new bound\n");
-   }
+   SCIP_CALL( analyzeCycleRelation(scip, propdata, cycleidx, coef, constant, infeasible) );
 
    return SCIP_OKAY;
 }
@@ -1056,7 +1183,7 @@ SCIP_RETCODE dfs(
          int i;
 
          nvbounds = propdata->nvbounds[curridx];
-         vboundidx = propdata->vboundboundedidx[curridx];
+         vboundidx = &propdata->vboundboundedidx[propdata->vboundbeg[curridx]];
 
          /* iterate over all vbounds for the given bound */
          for( i = stacknextedge[stacksize - 1] - nimpls; i < nvbounds; ++i )
@@ -1172,6 +1299,499 @@ SCIP_RETCODE topologicalSort(
    return SCIP_OKAY;
 }
 
+/** collects the variable bounds of the given bound as vbounds starting at the bounds of the bounding variables */
+static
+SCIP_RETCODE collectVarVbounds(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PROPDATA*        propdata,           /**< propagator data */
+   int                   idx,                /**< index of the bound whose variable bounds are collected */
+   int*                  startidxs,          /**< array to store the bound indices influencing the bound */
+   SCIP_Real*            coefs,              /**< array to store the coefficients of the vbounds */
+   SCIP_Real*            constants,          /**< array to store the constants of the vbounds */
+   int*                  nvbounds            /**< pointer to store the number of collected vbounds */
+   )
+{
+   SCIP_VAR** vbvars;
+   SCIP_VAR* var;
+   SCIP_Real* vbcoefs;
+   SCIP_Real* vbconstants;
+   SCIP_Bool lower;
+   int nvbvars;
+   int startidx;
+   int n;
+
+   var = propdata->vars[getVarIndex(idx)];
+   lower = isIndexLowerbound(idx);
+
+   /* get the variable bound informations for the current variable */
+   if( lower )
+   {
+      vbvars = SCIPvarGetVlbVars(var);
+      vbcoefs = SCIPvarGetVlbCoefs(var);
+      vbconstants = SCIPvarGetVlbConstants(var);
+      nvbvars = SCIPvarGetNVlbs(var);
+   }
+   else
+   {
+      vbvars = SCIPvarGetVubVars(var);
+      vbcoefs = SCIPvarGetVubCoefs(var);
+      vbconstants = SCIPvarGetVubConstants(var);
+      nvbvars = SCIPvarGetNVubs(var);
+   }
+
+   *nvbounds = 0;
+
+   /* loop over all variable bounds; a variable lower bound has the form: x >= b*y + d,
+    * a variable upper bound the form x <= b*y + d */
+   for( n = 0; n < nvbvars; ++n )
+   {
+      SCIP_VAR* vbvar;
+      SCIP_Real coef;
+      SCIP_Real constant;
+
+      vbvar = vbvars[n];
+      coef = vbcoefs[n];
+      constant = vbconstants[n];
+      assert(vbvar != NULL);
+
+      /* transform variable bound variable to an active variable, if possible */
+      SCIP_CALL( SCIPgetProbvarSum(scip, &vbvar, &coef, &constant) );
+      assert(vbvar != NULL);
+
+      if( !SCIPvarIsActive(vbvar) )
+         continue;
+
+      /* if the coefficient is positive, the type of bound is the same for the bounded and the bounding variable */
+      if( SCIPisPositive(scip, coef) )
+         startidx = (lower ? varGetLbIndex(propdata, vbvar) : varGetUbIndex(propdata, vbvar));
+      else
+         startidx = (lower ? varGetUbIndex(propdata, vbvar) : varGetLbIndex(propdata, vbvar));
+
+      /* variables that were created after the initialization are not regarded */
+      if( startidx < 0 )
+         continue;
+
+      /* If the vbvar is binary, the vbound should be stored as an implication already.
+       * However, it might happen that vbvar was integer when the variable bound was added, but was converted
+       * to a binary variable later during presolving when its upper bound was changed to 1. In this case,
+       * the implication might not have been created.
+       */
+      if( SCIPvarGetType(vbvar) == SCIP_VARTYPE_BINARY
+         && SCIPvarHasImplic(vbvar, isIndexLowerbound(startidx), var, getBoundtype(idx)) )
+      {
+         SCIPdebugMsg(scip, "varbound <%s> %s %g * <%s> + %g not added to propagator data due to reverse implication\n",
+            SCIPvarGetName(var), (lower ? ">=" : "<="), coef,
+            SCIPvarGetName(vbvar), constant);
+      }
+      else
+      {
+         startidxs[*nvbounds] = startidx;
+         coefs[*nvbounds] = coef;
+         constants[*nvbounds] = constant;
+         (*nvbounds)++;
+
+         SCIPdebugMsg(scip, "varbound <%s> %s %g * <%s> + %g added to propagator data\n",
+            SCIPvarGetName(var), (lower ? ">=" : "<="), coef,
+            SCIPvarGetName(vbvar), constant);
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** returns the position of the vbound from bound startidx to bound endidx in the vbound arrays, or -1 if there is none */
+static
+int findVbound(
+   SCIP_PROPDATA*        propdata,           /**< propagator data */
+   int                   startidx,           /**< index of the bound influencing the other bound */
+   int                   endidx              /**< index of the bound which is influenced */
+   )
+{
+   int beg = propdata->vboundbeg[startidx];
+   int n;
+
+   for( n = 0; n < propdata->nvbounds[startidx]; ++n )
+   {
+      if( propdata->vboundboundedidx[beg + n] == endidx )
+         return beg + n;
+   }
+
+   return -1;
+}
+
+/** updates the topological order after the vbound from bound startidx to bound endidx was added
+ *
+ *  This is the dynamic topological sort of Pearce and Kelly: only the bounds whose positions lie between the positions
+ *  of the two bounds are searched, namely those reachable from endidx and those from which startidx can be reached. Then,
+ *  the bounds of the latter set are moved in front of the bounds of the former set, using the positions of both sets.
+ *  If startidx can be reached from endidx, the new vbound closes a cycle; as in the initial sort, the cycle is broken by
+ *  ignoring the vbound for the order. In this case, the vbounds along the cycle are aggregated to a relation between
+ *  the bound startidx and itself, from which the caller can derive bound changes or infeasibility.
+ */
+static
+SCIP_RETCODE updateTopoorder(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PROPDATA*        propdata,           /**< propagator data */
+   int                   startidx,           /**< index of the bound influencing the other bound */
+   int                   endidx,             /**< index of the bound which is influenced */
+   int*                  stack,              /**< buffer array of size nbounds for the search stack */
+   int*                  fwdnodes,           /**< buffer array of size nbounds for the bounds reached from endidx */
+   int*                  bwdnodes,           /**< buffer array of size nbounds for the bounds reaching startidx */
+   int*                  fwdpreds,           /**< buffer array of size nbounds for the predecessors in the forward search */
+   SCIP_Bool*            cycle,              /**< pointer to store whether the vbound closes a cycle */
+   SCIP_Real*            cyclecoef,          /**< pointer to store the aggregated coefficient of the cycle */
+   SCIP_Real*            cycleconstant       /**< pointer to store the aggregated constant of the cycle */
+   )
+{
+   int* topoorder;
+   int* topopos;
+   int* searchmark;
+   int* fwdpos;
+   int* bwdpos;
+   int* positions;
+   int startpos;
+   int endpos;
+   int nstack;
+   int nfwd;
+   int nbwd;
+   int i;
+   int k;
+
+   topoorder = propdata->topoorder;
+   topopos = propdata->topopos;
+   searchmark = propdata->searchmark;
+
+   assert(cycle != NULL);
+   assert(cyclecoef != NULL);
+   assert(cycleconstant != NULL);
+
+   *cycle = FALSE;
+
+   /* the order is reverse topological, i.e., the influencing bound has to be at the higher position */
+   startpos = topopos[startidx];
+   endpos = topopos[endidx];
+   if( startpos > endpos )
+      return SCIP_OKAY;
+
+   /* forward search from endidx over the bounds at positions between the ones of startidx and endidx; vbounds that
+    * closed a cycle earlier are not respected by the order and may lead out of this range, these are not followed
+    */
+   nfwd = 0;
+   stack[0] = endidx;
+   nstack = 1;
+   searchmark[endidx] = VISITED;
+   fwdpreds[endidx] = startidx;
+   while( nstack > 0 && !(*cycle) )
+   {
+      int curridx = stack[--nstack];
+      int* succs = &propdata->vboundboundedidx[propdata->vboundbeg[curridx]];
+
+      fwdnodes[nfwd++] = curridx;
+
+      for( i = 0; i < propdata->nvbounds[curridx]; ++i )
+      {
+         if( succs[i] == startidx )
+         {
+            fwdpreds[startidx] = curridx;
+            *cycle = TRUE;
+            break;
+         }
+
+         if( searchmark[succs[i]] == 0 && topopos[succs[i]] > startpos && topopos[succs[i]] < endpos )
+         {
+            searchmark[succs[i]] = VISITED;
+            fwdpreds[succs[i]] = curridx;
+            stack[nstack++] = succs[i];
+         }
+      }
+   }
+
+   if( *cycle )
+   {
+      int curridx;
+
+      SCIPdebugMsg(scip, "vbound %s(%s) -> %s(%s) closes a cycle, keep order\n",
+         indexGetBoundString(startidx), SCIPvarGetName(propdata->vars[getVarIndex(startidx)]),
+         indexGetBoundString(endidx), SCIPvarGetName(propdata->vars[getVarIndex(endidx)]));
+
+      for( i = 0; i < nfwd; ++i )
+         searchmark[fwdnodes[i]] = 0;
+      for( i = 0; i < nstack; ++i )
+         searchmark[stack[i]] = 0;
+
+      /* aggregate the vbounds along the cycle backwards, starting with the one that leads back to startidx; each vbound
+       * maps the bound of its start-point to the bound of its end-point, so the aggregated relation of the cycle is the
+       * concatenation of these maps
+       */
+      *cyclecoef = 1.0;
+      *cycleconstant = 0.0;
+      curridx = startidx;
+      do
+      {
+         int pos = findVbound(propdata, fwdpreds[curridx], curridx);
+
+         assert(pos >= 0);
+
+         *cycleconstant += *cyclecoef * propdata->vboundconstants[pos];
+         *cyclecoef *= propdata->vboundcoefs[pos];
+         curridx = fwdpreds[curridx];
+      }
+      while( curridx != startidx );
+
+      return SCIP_OKAY;
+   }
+
+   /* backward search from startidx over the bounds at positions between the ones of startidx and endidx */
+   nbwd = 0;
+   stack[0] = startidx;
+   nstack = 1;
+   searchmark[startidx] = ACTIVE;
+   while( nstack > 0 )
+   {
+      int curridx = stack[--nstack];
+      int* preds = &propdata->vboundinidx[propdata->vboundinbeg[curridx]];
+
+      bwdnodes[nbwd++] = curridx;
+
+      for( i = 0; i < propdata->nvboundsin[curridx]; ++i )
+      {
+         if( searchmark[preds[i]] == 0 && topopos[preds[i]] < endpos && topopos[preds[i]] > startpos )
+         {
+            searchmark[preds[i]] = ACTIVE;
+            stack[nstack++] = preds[i];
+         }
+      }
+   }
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &fwdpos, nfwd) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &bwdpos, nbwd) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &positions, nfwd + nbwd) );
+
+   /* sort both sets by their current positions and collect the positions that are reassigned */
+   for( i = 0; i < nfwd; ++i )
+   {
+      searchmark[fwdnodes[i]] = 0;
+      fwdpos[i] = topopos[fwdnodes[i]];
+      positions[i] = fwdpos[i];
+   }
+   for( i = 0; i < nbwd; ++i )
+   {
+      searchmark[bwdnodes[i]] = 0;
+      bwdpos[i] = topopos[bwdnodes[i]];
+      positions[nfwd + i] = bwdpos[i];
+   }
+   SCIPsortDownIntInt(fwdpos, fwdnodes, nfwd);
+   SCIPsortDownIntInt(bwdpos, bwdnodes, nbwd);
+   SCIPsortDownInt(positions, nfwd + nbwd);
+
+   /* the bounds reaching startidx get the highest positions, keeping their relative order */
+   k = 0;
+   for( i = 0; i < nbwd; ++i, ++k )
+   {
+      topoorder[positions[k]] = bwdnodes[i];
+      topopos[bwdnodes[i]] = positions[k];
+   }
+   for( i = 0; i < nfwd; ++i, ++k )
+   {
+      topoorder[positions[k]] = fwdnodes[i];
+      topopos[fwdnodes[i]] = positions[k];
+   }
+   assert(topopos[startidx] > topopos[endidx]);
+
+   SCIPfreeBufferArray(scip, &positions);
+   SCIPfreeBufferArray(scip, &bwdpos);
+   SCIPfreeBufferArray(scip, &fwdpos);
+
+   return SCIP_OKAY;
+}
+
+/** adds the variable bounds that were added to the changed variables since the last call to the propagator data
+ *
+ *  The topological order is updated incrementally for each new vbound, such that the work only depends on the part of
+ *  the order that is affected. Bounds that get outgoing vbounds, implications, or cliques are watched from now on. If
+ *  cycles should be detected, the cycles closed by new vbounds are analyzed after the order was updated.
+ */
+static
+SCIP_RETCODE addChangedVarsVbounds(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PROPDATA*        propdata,           /**< propagator data */
+   SCIP_Bool*            infeasible          /**< pointer to store whether an infeasibility was detected */
+   )
+{
+   int* startidxs;
+   SCIP_Real* coefs;
+   SCIP_Real* constants;
+   int* queued = NULL;
+   int* stack = NULL;
+   int* fwdnodes = NULL;
+   int* bwdnodes = NULL;
+   int* fwdpreds = NULL;
+   int* cycleidxs = NULL;
+   SCIP_Real* cyclecoefs = NULL;
+   SCIP_Real* cycleconstants = NULL;
+   int nqueued = 0;
+   int ncycles = 0;
+   int cyclessize = 0;
+   int maxnvbounds;
+   int c;
+   int i;
+
+   assert(infeasible != NULL);
+
+   *infeasible = FALSE;
+
+   if( propdata->nchangedvars == 0 )
+      return SCIP_OKAY;
+
+   maxnvbounds = 0;
+   for( c = 0; c < propdata->nchangedvars; ++c )
+   {
+      SCIP_VAR* var = propdata->vars[propdata->changedvars[c]];
+
+      maxnvbounds = MAX3(maxnvbounds, SCIPvarGetNVlbs(var), SCIPvarGetNVubs(var));
+   }
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &startidxs, maxnvbounds) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &coefs, maxnvbounds) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &constants, maxnvbounds) );
+
+   for( c = 0; c < propdata->nchangedvars; ++c )
+   {
+      SCIP_VAR* var;
+      int v;
+      int b;
+
+      v = propdata->changedvars[c];
+      var = propdata->vars[v];
+      propdata->varchanged[v] = FALSE;
+
+      for( b = 0; b < 2; ++b )
+      {
+         int idx;
+         int nvarvbounds;
+         int nvbounds;
+
+         idx = (b == 0 ? getLbIndex(v) : getUbIndex(v));
+         nvarvbounds = (b == 0 ? SCIPvarGetNVlbs(var) : SCIPvarGetNVubs(var));
+
+         /* only the implications or cliques of the bound were extended */
+         if( nvarvbounds == propdata->nvarvbounds[idx] )
+         {
+            SCIP_CALL( catchBoundEvents(scip, propdata, idx) );
+            continue;
+         }
+         propdata->nvarvbounds[idx] = nvarvbounds;
+
+         SCIP_CALL( collectVarVbounds(scip, propdata, idx, startidxs, coefs, constants, &nvbounds) );
+
+         for( i = 0; i < nvbounds; ++i )
+         {
+            int startidx = startidxs[i];
+            SCIP_Real cyclecoef;
+            SCIP_Real cycleconstant;
+            SCIP_Bool cycle;
+            int vbpos;
+
+            /* a known vbound might have been tightened */
+            vbpos = findVbound(propdata, startidx, idx);
+            if( vbpos >= 0 )
+            {
+               propdata->vboundcoefs[vbpos] = coefs[i];
+               propdata->vboundconstants[vbpos] = constants[i];
+               continue;
+            }
+
+            SCIP_CALL( addVbound(scip, propdata, startidx, idx, coefs[i], constants[i]) );
+            SCIP_CALL( catchBoundEvents(scip, propdata, startidx) );
+
+            if( !propdata->dotoposort || propdata->topopos[startidx] > propdata->topopos[idx] )
+               continue;
+
+            /* the keys of the priority queue are positions in the order, so the queue is emptied before the first
+             * reordering and filled again afterwards
+             */
+            if( stack == NULL )
+            {
+               SCIP_CALL( SCIPallocBufferArray(scip, &stack, propdata->nbounds) );
+               SCIP_CALL( SCIPallocBufferArray(scip, &fwdnodes, propdata->nbounds) );
+               SCIP_CALL( SCIPallocBufferArray(scip, &bwdnodes, propdata->nbounds) );
+               SCIP_CALL( SCIPallocBufferArray(scip, &fwdpreds, propdata->nbounds) );
+               SCIP_CALL( SCIPallocBufferArray(scip, &queued, SCIPpqueueNElems(propdata->propqueue) + 1) );
+
+               while( SCIPpqueueNElems(propdata->propqueue) > 0 )
+               {
+                  /* coverity[pointer_conversion_loses_bits] */
+                  int pos = ((int)(size_t)SCIPpqueueRemove(propdata->propqueue)) - 1;
+
+                  assert(propdata->inqueue[pos]);
+                  propdata->inqueue[pos] = FALSE;
+                  queued[nqueued++] = propdata->topoorder[pos];
+               }
+            }
+
+            SCIP_CALL( updateTopoorder(scip, propdata, startidx, idx, stack, fwdnodes, bwdnodes, fwdpreds, &cycle,
+                  &cyclecoef, &cycleconstant) );
+
+            /* the bound changes derived from the cycle would be added to the propagation queue, so they are applied
+             * after the queue was restored
+             */
+            if( cycle && propdata->detectcycles )
+            {
+               if( ncycles == cyclessize )
+               {
+                  cyclessize = SCIPcalcMemGrowSize(scip, ncycles + 1);
+                  SCIP_CALL( SCIPreallocBufferArray(scip, &cycleidxs, cyclessize) );
+                  SCIP_CALL( SCIPreallocBufferArray(scip, &cyclecoefs, cyclessize) );
+                  SCIP_CALL( SCIPreallocBufferArray(scip, &cycleconstants, cyclessize) );
+               }
+
+               cycleidxs[ncycles] = startidx;
+               cyclecoefs[ncycles] = cyclecoef;
+               cycleconstants[ncycles] = cycleconstant;
+               ++ncycles;
+            }
+         }
+      }
+
+      /* the bounds might have gotten implications or cliques, too */
+      SCIP_CALL( catchBoundEvents(scip, propdata, getLbIndex(v)) );
+      SCIP_CALL( catchBoundEvents(scip, propdata, getUbIndex(v)) );
+   }
+   propdata->nchangedvars = 0;
+
+   if( stack != NULL )
+   {
+      for( i = 0; i < nqueued; ++i )
+      {
+         int pos = propdata->topopos[queued[i]];
+
+         SCIP_CALL( SCIPpqueueInsert(propdata->propqueue, (void*)(size_t)(pos + 1)) ); /*lint !e571 !e776*/
+         propdata->inqueue[pos] = TRUE;
+      }
+
+   }
+
+   /* extract bound changes or infeasibility from the cycles closed by the new vbounds */
+   for( i = 0; i < ncycles && !(*infeasible); ++i )
+   {
+      SCIP_CALL( analyzeCycleRelation(scip, propdata, cycleidxs[i], cyclecoefs[i], cycleconstants[i], infeasible) );
+   }
+
+   SCIPfreeBufferArrayNull(scip, &cycleconstants);
+   SCIPfreeBufferArrayNull(scip, &cyclecoefs);
+   SCIPfreeBufferArrayNull(scip, &cycleidxs);
+   SCIPfreeBufferArrayNull(scip, &queued);
+   SCIPfreeBufferArrayNull(scip, &fwdpreds);
+   SCIPfreeBufferArrayNull(scip, &bwdnodes);
+   SCIPfreeBufferArrayNull(scip, &fwdnodes);
+   SCIPfreeBufferArrayNull(scip, &stack);
+   SCIPfreeBufferArray(scip, &constants);
+   SCIPfreeBufferArray(scip, &coefs);
+   SCIPfreeBufferArray(scip, &startidxs);
+
+   return SCIP_OKAY;
+}
+
 /** initializes the internal data for the variable bounds propagator */
 static
 SCIP_RETCODE initData(
@@ -1182,11 +1802,16 @@ SCIP_RETCODE initData(
 {
    SCIP_PROPDATA* propdata;
    SCIP_VAR** vars;
+   int* edgestart;
+   int* edgeend;
+   SCIP_Real* edgecoefs;
+   SCIP_Real* edgeconstants;
    int nvars;
    int nbounds;
-   int startidx;
+   int nedges;
+   int maxnedges;
    int v;
-   int n;
+   int e;
 
    assert(scip != NULL);
    assert(prop != NULL);
@@ -1231,112 +1856,98 @@ SCIP_RETCODE initData(
 
    /* allocate memory for the arrays of the propdata */
    SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->topoorder, nbounds) );
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->vboundboundedidx, nbounds) );
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->vboundcoefs, nbounds) );
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->vboundconstants, nbounds) );
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->nvbounds, nbounds) );
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->vboundsize, nbounds) );
-   BMSclearMemoryArray(propdata->vboundboundedidx, nbounds);
-   BMSclearMemoryArray(propdata->vboundcoefs, nbounds);
-   BMSclearMemoryArray(propdata->vboundconstants, nbounds);
-   BMSclearMemoryArray(propdata->nvbounds, nbounds);
-   BMSclearMemoryArray(propdata->vboundsize, nbounds);
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->topopos, nbounds) );
+   SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &propdata->boundevents, nbounds) );
+   SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &propdata->vboundbeg, nbounds) );
+   SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &propdata->nvbounds, nbounds) );
+   SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &propdata->vboundsize, nbounds) );
+   SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &propdata->vboundinbeg, nbounds) );
+   SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &propdata->nvboundsin, nbounds) );
+   SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &propdata->vboundinsize, nbounds) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->nvarvbounds, nbounds) );
+   SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &propdata->searchmark, nbounds) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->changedvars, nvars) );
+   SCIP_CALL( SCIPallocClearBlockMemoryArray(scip, &propdata->varchanged, nvars) );
+   propdata->nchangedvars = 0;
 
    for( v = 0; v < nbounds; ++v )
-   {
       propdata->topoorder[v] = v;
-      propdata->vboundboundedidx[v] = NULL;
-      propdata->vboundcoefs[v] = NULL;
-      propdata->vboundconstants[v] = NULL;
-      propdata->nvbounds[v] = 0;
-      propdata->vboundsize[v] = 0;
-   }
 
-   /* collect information about varbounds */
+   /* collect information about varbounds as list of edges */
+   maxnedges = 0;
+   for( v = 0; v < nvars; ++v )
+      maxnedges += SCIPvarGetNVlbs(vars[v]) + SCIPvarGetNVubs(vars[v]);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &edgestart, maxnedges + 1) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &edgeend, maxnedges + 1) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &edgecoefs, maxnedges + 1) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &edgeconstants, maxnedges + 1) );
+
+   nedges = 0;
    for( v = 0; v < nbounds; ++v )
    {
-      SCIP_VAR** vbvars;
-      SCIP_VAR* var;
-      SCIP_Real* coefs;
-      SCIP_Real* constants;
-      SCIP_Bool lower;
-      int nvbvars;
+      int nvbounds;
 
-      var = vars[getVarIndex(v)];
-      lower = isIndexLowerbound(v);
+      propdata->nvarvbounds[v] = isIndexLowerbound(v) ? SCIPvarGetNVlbs(vars[getVarIndex(v)])
+         : SCIPvarGetNVubs(vars[getVarIndex(v)]);
 
-      /* get the variable bound informations for the current variable */
-      if( lower )
-      {
-         vbvars = SCIPvarGetVlbVars(var);
-         coefs = SCIPvarGetVlbCoefs(var);
-         constants = SCIPvarGetVlbConstants(var);
-         nvbvars = SCIPvarGetNVlbs(var);
-      }
-      else
-      {
-         vbvars = SCIPvarGetVubVars(var);
-         coefs = SCIPvarGetVubCoefs(var);
-         constants = SCIPvarGetVubConstants(var);
-         nvbvars = SCIPvarGetNVubs(var);
-      }
-
-      /* loop over all variable bounds; a variable lower bound has the form: x >= b*y + d,
-       * a variable upper bound the form x <= b*y + d */
-      for( n = 0; n < nvbvars; ++n )
-      {
-         SCIP_VAR* vbvar;
-         SCIP_Real coef;
-         SCIP_Real constant;
+      SCIP_CALL( collectVarVbounds(scip, propdata, v, &edgestart[nedges], &edgecoefs[nedges], &edgeconstants[nedges],
+            &nvbounds) );
 
-         vbvar = vbvars[n];
-         coef = coefs[n];
-         constant = constants[n];
-         assert(vbvar != NULL);
+      for( e = nedges; e < nedges + nvbounds; ++e )
+         edgeend[e] = v;
+      nedges += nvbounds;
+   }
+   assert(nedges <= maxnedges);
 
-         /* transform variable bound variable to an active variable, if possible */
-         SCIP_CALL( SCIPgetProbvarSum(scip, &vbvar, &coef, &constant) );
-         assert(vbvar != NULL);
+   /* store the vbounds of each bound consecutively, in both directions */
+   for( e = 0; e < nedges; ++e )
+   {
+      ++propdata->vboundsize[edgestart[e]];
+      ++propdata->vboundinsize[edgeend[e]];
+   }
+   for( v = 1; v < nbounds; ++v )
+   {
+      propdata->vboundbeg[v] = propdata->vboundbeg[v-1] + propdata->vboundsize[v-1];
+      propdata->vboundinbeg[v] = propdata->vboundinbeg[v-1] + propdata->vboundinsize[v-1];
+   }
 
-         if( !SCIPvarIsActive(vbvar) )
-            continue;
+   propdata->nvboundslots = nedges;
+   propdata->vboundslotssize = MAX(nedges, 1);
+   propdata->nvboundinslots = nedges;
+   propdata->vboundinslotssize = MAX(nedges, 1);
+   SCIP_CALL( SCIPallocMemoryArray(scip, &propdata->vboundboundedidx, propdata->vboundslotssize) );
+   SCIP_CALL( SCIPallocMemoryArray(scip, &propdata->vboundcoefs, propdata->vboundslotssize) );
+   SCIP_CALL( SCIPallocMemoryArray(scip, &propdata->vboundconstants, propdata->vboundslotssize) );
+   SCIP_CALL( SCIPallocMemoryArray(scip, &propdata->vboundinidx, propdata->vboundinslotssize) );
 
-         /* if the coefficient is positive, the type of bound is the same for the bounded and the bounding variable */
-         if( SCIPisPositive(scip, coef) )
-            startidx = (lower ? varGetLbIndex(propdata, vbvar) : varGetUbIndex(propdata, vbvar));
-         else
-            startidx = (lower ? varGetUbIndex(propdata, vbvar) : varGetLbIndex(propdata, vbvar));
-         assert(startidx >= 0);
+   for( e = 0; e < nedges; ++e )
+   {
+      int pos;
 
-         /* If the vbvar is binary, the vbound should be stored as an implication already.
-          * However, it might happen that vbvar was integer when the variable bound was added, but was converted
-          * to a binary variable later during presolving when its upper bound was changed to 1. In this case,
-          * the implication might not have been created.
-          */
-         if( SCIPvarGetType(vbvar) == SCIP_VARTYPE_BINARY
-            && SCIPvarHasImplic(vbvar, isIndexLowerbound(startidx), var, getBoundtype(v)) )
-         {
-            SCIPdebugMsg(scip, "varbound <%s> %s %g * <%s> + %g not added to propagator data due to reverse implication\n",
-               SCIPvarGetName(var), (lower ? ">=" : "<="), coef,
-               SCIPvarGetName(vbvar), constant);
-         }
-         else
-         {
-            SCIP_CALL( addVbound(scip, propdata, startidx, v, coef, constant) );
+      pos = propdata->vboundbeg[edgestart[e]] + propdata->nvbounds[edgestart[e]]++;
+      propdata->vboundboundedidx[pos] = edgeend[e];
+      propdata->vboundcoefs[pos] = edgecoefs[e];
+      propdata->vboundconstants[pos] = edgeconstants[e];
 
-            SCIPdebugMsg(scip, "varbound <%s> %s %g * <%s> + %g added to propagator data\n",
-               SCIPvarGetName(var), (lower ? ">=" : "<="), coef,
-               SCIPvarGetName(vbvar), constant);
-         }
-      }
+      pos = propdata->vboundinbeg[edgeend[e]] + propdata->nvboundsin[edgeend[e]]++;
+      propdata->vboundinidx[pos] = edgestart[e];
    }
 
+   SCIPfreeBufferArray(scip, &edgeconstants);
+   SCIPfreeBufferArray(scip, &edgecoefs);
+   SCIPfreeBufferArray(scip, &edgeend);
+   SCIPfreeBufferArray(scip, &edgestart);
+
    /* sort the bounds topologically */
    if( propdata->dotoposort )
    {
       SCIP_CALL( topologicalSort(scip, propdata, infeasible) );
    }
 
+   for( v = 0; v < nbounds; ++v )
+      propdata->topopos[propdata->topoorder[v]] = v;
+
    /* catch variable events */
    SCIP_CALL( catchEvents(scip, propdata) );
 
@@ -1825,6 +2436,7 @@ SCIP_RETCODE propagateVbounds(
    int nbounds;
    SCIP_Bool lower;
    SCIP_Bool global;
+   SCIP_Bool infeasible;
 
    assert(scip != NULL);
    assert(prop != NULL);
@@ -1842,8 +2454,6 @@ SCIP_RETCODE propagateVbounds(
    /* initialize propagator data needed for propagation, if not done yet */
    if( !propdata->initialized )
    {
-      SCIP_Bool infeasible;
-
       SCIP_CALL( initData(scip, prop, &infeasible) );
 
       if( infeasible )
@@ -1860,6 +2470,15 @@ SCIP_RETCODE propagateVbounds(
    if( nbounds == 0 )
       return SCIP_OKAY;
 
+   /* add the vbounds that were created since the last call */
+   SCIP_CALL( addChangedVarsVbounds(scip, propdata, &infeasible) );
+
+   if( infeasible )
+   {
+      *result = SCIP_CUTOFF;
+      return SCIP_OKAY;
+   }
+
    /* propagate all variables if we are in repropagation */
    if( SCIPinRepropagation(scip) )
    {
@@ -1869,7 +2488,7 @@ SCIP_RETCODE propagateVbounds(
       for( v = nbounds - 1; v >= 0; --v )
       {
          idx = propdata->topoorder[v];
-         if( idx != -1 && !propdata->inqueue[v] )
+         if( propdata->boundevents[idx] && !propdata->inqueue[v] )
          {
             var = vars[getVarIndex(idx)];
             lower = isIndexLowerbound(idx);
@@ -2055,17 +2674,17 @@ SCIP_RETCODE propagateVbounds(
          SCIP_Real constant;
 
          /* iterate over all vbounds for the given bound */
-         for( n = 0; n < propdata->nvbounds[startpos]; ++n )
+         for( n = propdata->vboundbeg[startpos]; n < propdata->vboundbeg[startpos] + propdata->nvbounds[startpos]; ++n )
          {
-            boundedvar = vars[getVarIndex(propdata->vboundboundedidx[startpos][n])];
-            coef = propdata->vboundcoefs[startpos][n];
-            constant = propdata->vboundconstants[startpos][n];
+            boundedvar = vars[getVarIndex(propdata->vboundboundedidx[n])];
+            coef = propdata->vboundcoefs[n];
+            constant = propdata->vboundconstants[n];
 
             /* compute new bound */
             newbound = startbound * coef + constant;
 
             /* try to tighten the bound */
-            if( isIndexLowerbound(propdata->vboundboundedidx[startpos][n]) )
+            if( isIndexLowerbound(propdata->vboundboundedidx[n]) )
             {
                SCIP_CALL( tightenVarLb(scip, prop, propdata, boundedvar, newbound, global, startvar, starttype, force,
                      coef, constant, TRUE, &nchgbds, result) );
@@ -2165,7 +2784,6 @@ static
 SCIP_DECL_PROPEXITSOL(propExitsolVbounds)
 {  /*lint --e{715}*/
    SCIP_PROPDATA* propdata;
-   int v;
 
    propdata = SCIPpropGetData(prop);
    assert(propdata != NULL);
@@ -2176,28 +2794,29 @@ SCIP_DECL_PROPEXITSOL(propExitsolVbounds)
       /* drop all variable events */
       SCIP_CALL( dropEvents(scip, propdata) );
 
-      /* release all variables */
-      for( v = 0; v < propdata->nbounds; ++v )
-      {
-         /* free vbound data */
-         if( propdata->vboundsize[v] > 0 )
-         {
-            SCIPfreeMemoryArray(scip, &propdata->vboundboundedidx[v]);
-            SCIPfreeMemoryArray(scip, &propdata->vboundcoefs[v]);
-            SCIPfreeMemoryArray(scip, &propdata->vboundconstants[v]);
-         }
-      }
-
       /* free priority queue */
       SCIPpqueueFree(&propdata->propqueue);
 
+      /* free vbound data */
+      SCIPfreeMemoryArray(scip, &propdata->vboundinidx);
+      SCIPfreeMemoryArray(scip, &propdata->vboundconstants);
+      SCIPfreeMemoryArray(scip, &propdata->vboundcoefs);
+      SCIPfreeMemoryArray(scip, &propdata->vboundboundedidx);
+
       /* free arrays */
+      SCIPfreeBlockMemoryArray(scip, &propdata->varchanged, propdata->nbounds / 2);
+      SCIPfreeBlockMemoryArray(scip, &propdata->changedvars, propdata->nbounds / 2);
+      SCIPfreeBlockMemoryArray(scip, &propdata->searchmark, propdata->nbounds);
+      SCIPfreeBlockMemoryArray(scip, &propdata->nvarvbounds, propdata->nbounds);
+      SCIPfreeBlockMemoryArray(scip, &propdata->vboundinsize, propdata->nbounds);
+      SCIPfreeBlockMemoryArray(scip, &propdata->nvboundsin, propdata->nbounds);
+      SCIPfreeBlockMemoryArray(scip, &propdata->vboundinbeg, propdata->nbounds);
       SCIPfreeBlockMemoryArray(scip, &propdata->vboundsize, propdata->nbounds);
       SCIPfreeBlockMemoryArray(scip, &propdata->nvbounds, propdata->nbounds);
-      SCIPfreeBlockMemoryArray(scip, &propdata->vboundconstants, propdata->nbounds);
-      SCIPfreeBlockMemoryArray(scip, &propdata->vboundcoefs, propdata->nbounds);
-      SCIPfreeBlockMemoryArray(scip, &propdata->vboundboundedidx, propdata->nbounds);
+      SCIPfreeBlockMemoryArray(scip, &propdata->vboundbeg, propdata->nbounds);
+      SCIPfreeBlockMemoryArray(scip, &propdata->boundevents, propdata->nbounds);
       SCIPfreeBlockMemoryArray(scip, &propdata->inqueue, propdata->nbounds);
+      SCIPfreeBlockMemoryArray(scip, &propdata->topopos, propdata->nbounds);
       SCIPfreeBlockMemoryArray(scip, &propdata->topoorder, propdata->nbounds);
 
       /* free variable array and hashmap */
@@ -3031,7 +3650,7 @@ SCIP_DECL_PROPRESPROP(propRespropVbounds)
       int b;
 
       nvbounds = propdata->nvbounds[pos];
-      vboundboundedidx = propdata->vboundboundedidx[pos];
+      vboundboundedidx = &propdata->vboundboundedidx[propdata->vboundbeg[pos]];
 
       inferidx = boundtype == SCIP_BOUNDTYPE_LOWER ? varGetLbIndex(propdata, infervar) : varGetUbIndex(propdata, infervar);
       assert(inferidx >= 0);
@@ -3043,8 +3662,8 @@ SCIP_DECL_PROPRESPROP(propRespropVbounds)
       }
       assert(b < nvbounds);
 
-      coef = propdata->vboundcoefs[pos][b];
-      constant = propdata->vboundconstants[pos][b];
+      coef = propdata->vboundcoefs[propdata->vboundbeg[pos] + b];
+      constant = propdata->vboundconstants[propdata->vboundbeg[pos] + b];
       assert(!SCIPisZero(scip, coef));
 
       /* compute the relaxed bound which is sufficient to propagate the inference bound of given variable */
@@ -3089,9 +3708,27 @@ SCIP_DECL_EVENTEXEC(eventExecVbound)
    idx = (int) (size_t) eventdata;
    assert(idx >= 0);
 
+   /* remember variables whose implications or variable bounds were extended; they are handled in the next propagation
+    * call
+    */
+   if( SCIPeventGetType(event) == SCIP_EVENTTYPE_IMPLADDED )
+   {
+      assert(idx < propdata->nbounds / 2);
+
+      if( !propdata->varchanged[idx] )
+      {
+         propdata->changedvars[propdata->nchangedvars++] = idx;
+         propdata->varchanged[idx] = TRUE;
+      }
+
+      return SCIP_OKAY;
+   }
+
+   assert(idx < propdata->nbounds);
+   assert(propdata->boundevents[idx]);
+
    SCIPdebugMsg(scip, "eventexec (type=%" SCIP_EVENTTYPE_FORMAT "): try to add sort index %d: %s(%s) to priority queue\n", SCIPeventGetType(event),
-      idx, indexGetBoundString(propdata->topoorder[idx]),
-      SCIPvarGetName(propdata->vars[getVarIndex(propdata->topoorder[idx])]));
+      propdata->topopos[idx], indexGetBoundString(idx), SCIPvarGetName(propdata->vars[getVarIndex(idx)]));
 
    if( SCIPeventGetType(event) == SCIP_EVENTTYPE_GUBCHANGED && SCIPvarIsBinary(SCIPeventGetVar(event))
       && SCIPeventGetNewbound(event) > 0.5 )
@@ -3101,9 +3738,12 @@ SCIP_DECL_EVENTEXEC(eventExecVbound)
       && SCIPeventGetNewbound(event) < 0.5 )
       return SCIP_OKAY;
 
-   assert(getVarIndex(propdata->topoorder[idx]) < SCIPgetNVars(scip));
-   assert(SCIPvarGetType(propdata->vars[getVarIndex(propdata->topoorder[idx])]) != SCIP_VARTYPE_BINARY
-      || (isIndexLowerbound(propdata->topoorder[idx]) == (SCIPeventGetNewbound(event) > 0.5)));
+   assert(getVarIndex(idx) < SCIPgetNVars(scip));
+   assert(SCIPvarGetType(propdata->vars[getVarIndex(idx)]) != SCIP_VARTYPE_BINARY
+      || (isIndexLowerbound(idx) == (SCIPeventGetNewbound(event) > 0.5)));
+
+   /* the queue is ordered by the positions of the bounds in the topological order */
+   idx = propdata->topopos[idx];
 
    /* add the bound change to the propagation queue, if it is not already contained */
    if( !propdata->inqueue[idx] )
@@ -59,6 +59,8 @@
 #include "scip/pub_misc_sort.h"
 #include "scip/pub_misc_linear.h"
 #include "scip/pub_misc_rowprep.h"
+#include "scip/pub_misc_regforest.h"
+#include "scip/pub_misc_linprop.h"
 
 /* in optimized mode some of the function are handled via defines, for that the structs are needed */
 #ifdef NDEBUG
@@ -1288,6 +1290,20 @@ SCIP_RETCODE SCIPprofileInsertCore(
    SCIP_Bool*            infeasible          /**< pointer to store if the core does not fit due to capacity */
    );
 
+/** inserts the given cores into an empty resource profile at once in O(n log n) time; the resulting profile is the same
+ *  as for inserting the cores one by one via SCIPprofileInsertCore(); if the cores exceed the capacity, the profile is
+ *  left empty and infeasible is set to TRUE
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPprofileInsertCores(
+   SCIP_PROFILE*         profile,            /**< empty resource profile */
+   int*                  lefts,              /**< left sides of the cores */
+   int*                  rights,             /**< right sides of the cores */
+   int*                  heights,            /**< heights of the cores */
+   int                   ncores,             /**< number of cores */
+   SCIP_Bool*            infeasible          /**< pointer to store if the cores do not fit due to capacity */
+   );
+
 /** subtracts the height from the resource profile during core time */
 SCIP_EXPORT
 SCIP_RETCODE SCIPprofileDeleteCore(
@@ -0,0 +1,177 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   pub_misc_linprop.h
+ * @ingroup PUBLICCOREAPI
+ * @brief  fast propagation of linear rows on thread-local bounds for parallel probing and fix-and-propagate
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#ifndef __SCIP_PUB_MISC_LINPROP_H__
+#define __SCIP_PUB_MISC_LINPROP_H__
+
+#include "scip/def.h"
+#include "scip/type_misc.h"
+#include "scip/type_retcode.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@defgroup LinearPropagation Linear Propagation
+ * @ingroup MiscellaneousMethods
+ * @brief methods for the propagation of linear rows on thread-local bounds
+ *
+ * The rows are copied once into a SCIP_LINPROP, which is only read afterwards. Each thread creates its own
+ * SCIP_LINPROPWORKER, fixes columns on it, propagates the rows until a fixpoint or a work limit is reached, and keeps
+ * or undoes the changes of the last fixing. The workers do not use SCIP's memory, so they can be used in parallel jobs.
+ *
+ * @{
+ */
+
+/** creates the shared copy of linear rows given in compressed sparse row format, with the given bounds of the columns */
+SCIP_EXPORT
+SCIP_RETCODE SCIPlinpropCreate(
+   SCIP_LINPROP**        linprop,            /**< pointer to store the shared rows */
+   int                   nrows,              /**< number of rows */
+   int                   ncols,              /**< number of columns */
+   const int*            rowbeg,             /**< start of the rows in rowcols and rowvals, with an entry for nrows */
+   const int*            rowcols,            /**< column indices of the rows */
+   const SCIP_Real*      rowvals,            /**< coefficients of the rows */
+   const SCIP_Real*      lhs,                /**< left hand sides, or -infinity */
+   const SCIP_Real*      rhs,                /**< right hand sides, or infinity */
+   const SCIP_Real*      lb,                 /**< lower bounds of the columns, or -infinity */
+   const SCIP_Real*      ub,                 /**< upper bounds of the columns, or infinity */
+   const SCIP_Bool*      isint,              /**< is the column of integral type? */
+   SCIP_Real             infinity,           /**< value for infinity */
+   SCIP_Real             feastol,            /**< feasibility tolerance */
+   SCIP_Real             epsilon             /**< absolute values smaller than this are considered zero */
+   );
+
+/** frees the shared copy of linear rows */
+SCIP_EXPORT
+void SCIPlinpropFree(
+   SCIP_LINPROP**        linprop             /**< pointer to the shared rows */
+   );
+
+/** replaces the bounds of the columns that the workers start from and recomputes the activities of the rows; must not
+ *  be called while workers are in use
+ */
+SCIP_EXPORT
+void SCIPlinpropSetBounds(
+   SCIP_LINPROP*         linprop,            /**< shared rows */
+   const SCIP_Real*      lb,                 /**< lower bounds of the columns, or -infinity */
+   const SCIP_Real*      ub                  /**< upper bounds of the columns, or infinity */
+   );
+
+/** creates a worker with the bounds and activities of the shared rows */
+SCIP_EXPORT
+SCIP_RETCODE SCIPlinpropWorkerCreate(
+   SCIP_LINPROPWORKER**  worker,             /**< pointer to store the worker */
+   SCIP_LINPROP*         linprop             /**< shared rows */
+   );
+
+/** frees a worker */
+SCIP_EXPORT
+void SCIPlinpropWorkerFree(
+   SCIP_LINPROPWORKER**  worker              /**< pointer to the worker */
+   );
+
+/** resets the bounds and activities of a worker to those of the shared rows */
+SCIP_EXPORT
+void SCIPlinpropWorkerReset(
+   SCIP_LINPROPWORKER*   worker              /**< worker */
+   );
+
+/** fixes a column to the given value and propagates the rows until a fixpoint or the work limit is reached; the
+ *  changes must be kept by SCIPlinpropWorkerCommit() or undone by SCIPlinpropWorkerUndo() before the next fixing
+ *
+ *  @return FALSE if the fixing turned out to be infeasible
+ */
+SCIP_EXPORT
+SCIP_Bool SCIPlinpropWorkerFix(
+   SCIP_LINPROPWORKER*   worker,             /**< worker */
+   int                   col,                /**< column to fix */
+   SCIP_Real             val                 /**< value to fix the column to */
+   );
+
+/** undoes all changes of the last fixing */
+SCIP_EXPORT
+void SCIPlinpropWorkerUndo(
+   SCIP_LINPROPWORKER*   worker              /**< worker */
+   );
+
+/** keeps all changes of the last fixing; rows that are still queued because of the work limit are dropped */
+SCIP_EXPORT
+void SCIPlinpropWorkerCommit(
+   SCIP_LINPROPWORKER*   worker              /**< worker */
+   );
+
+/** returns the current lower bounds of the columns of a worker */
+SCIP_EXPORT
+const SCIP_Real* SCIPlinpropWorkerGetLbs(
+   SCIP_LINPROPWORKER*   worker              /**< worker */
+   );
+
+/** returns the current upper bounds of the columns of a worker */
+SCIP_EXPORT
+const SCIP_Real* SCIPlinpropWorkerGetUbs(
+   SCIP_LINPROPWORKER*   worker              /**< worker */
+   );
+
+/** returns the columns changed by the last fixing, including the fixed column, in the order of their first change */
+SCIP_EXPORT
+const int* SCIPlinpropWorkerGetChgCols(
+   SCIP_LINPROPWORKER*   worker              /**< worker */
+   );
+
+/** returns the number of columns changed by the last fixing */
+SCIP_EXPORT
+int SCIPlinpropWorkerGetNChgCols(
+   SCIP_LINPROPWORKER*   worker              /**< worker */
+   );
+
+/** returns whether a column was changed by the last fixing */
+SCIP_EXPORT
+SCIP_Bool SCIPlinpropWorkerIsColChanged(
+   SCIP_LINPROPWORKER*   worker,             /**< worker */
+   int                   col                 /**< column */
+   );
+
+/** returns whether the current activities of all rows of a worker satisfy their sides; rows may not be propagated
+ *  completely because of the work limit, so this should be checked once all columns are fixed
+ */
+SCIP_EXPORT
+SCIP_Bool SCIPlinpropWorkerIsFeasible(
+   SCIP_LINPROPWORKER*   worker              /**< worker */
+   );
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SCIP_PUB_MISC_LINPROP_H__ */
@@ -0,0 +1,100 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   pub_misc_regforest.h
+ * @ingroup PUBLICCOREAPI
+ * @brief  methods for regression forests in RFCSV format
+ * @author Gregor Hendel
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#ifndef __SCIP_PUB_MISC_REGFOREST_H__
+#define __SCIP_PUB_MISC_REGFOREST_H__
+
+#include "scip/def.h"
+#include "scip/type_misc.h"
+#include "scip/type_retcode.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@defgroup RegressionForest Regression Forest
+ * @ingroup MiscellaneousMethods
+ * @brief methods for regression forests that are read from a file in RFCSV format
+ *
+ * @{
+ */
+
+/** reads a regression forest from a file in RFCSV format
+ *
+ *  The first line reads "### NTREES=<ntrees> FEATURE_DIM=<dim> LENGTH=<size>", followed by one line
+ *  "<node>,<left>,<right>,<splitidx>,<value>" per node. The nodes of a tree are numbered from 0 relative to its root,
+ *  the children of an inner node must come after it in the same tree, and leaves have split index -1.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPregForestFromFile(
+   SCIP_REGFOREST**      regforest,          /**< pointer to store the regression forest */
+   const char*           filename            /**< name of file with the regression forest data */
+   );
+
+/** frees a regression forest */
+SCIP_EXPORT
+void SCIPregForestFree(
+   SCIP_REGFOREST**      regforest           /**< pointer to the regression forest */
+   );
+
+/** returns the feature dimension of a regression forest */
+SCIP_EXPORT
+int SCIPregForestGetDim(
+   SCIP_REGFOREST*       regforest           /**< regression forest */
+   );
+
+/** makes a prediction with a regression forest */
+SCIP_EXPORT
+SCIP_Real SCIPregForestPredict(
+   SCIP_REGFOREST*       regforest,          /**< regression forest */
+   SCIP_Real*            datapoint           /**< a data point that matches the dimension of this regression forest */
+   );
+
+/** makes predictions for several data points at once; the data is stored feature by feature, i.e., feature f of data
+ *  point i at position f * stride + i, such that the innermost loop runs over contiguous data
+ */
+SCIP_EXPORT
+void SCIPregForestPredictBatch(
+   SCIP_REGFOREST*       regforest,          /**< regression forest */
+   const SCIP_Real*      data,               /**< data points, stored feature by feature */
+   int                   stride,             /**< distance between two features of the same data point */
+   int                   ndatapoints,        /**< number of data points */
+   SCIP_Real*            predictions         /**< array to store the predictions of all data points */
+   );
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SCIP_PUB_MISC_REGFOREST_H__ */
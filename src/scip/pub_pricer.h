@@ -35,6 +35,7 @@
 
 
 #include "scip/def.h"
+#include "scip/type_lp.h"
 #include "scip/type_misc.h"
 #include "scip/type_pricer.h"
 
@@ -128,6 +129,78 @@ SCIP_Bool SCIPpricerIsInitialized(
    SCIP_PRICER*          pricer              /**< variable pricer */
    );
 
+/** returns the dual value of the given LP row that the pricer should use in its reduced cost pricing callback
+ *
+ *  If dual stabilization is enabled by the parameter pricers/<name>/smoothing, this is the convex combination of the
+ *  dual value at the stabilization center and the current LP dual value (Wentges smoothing); otherwise, it is the LP
+ *  dual value. If no column is found for the stabilized dual values (misprice), SCIP calls the pricer again with a
+ *  smaller smoothing factor.
+ *
+ *  The lower bound returned by a pricing call with stabilized dual values is only used, both as bound of the node and
+ *  to move the stabilization center, if the pricer declared it a Lagrangian bound for the dual values it used with
+ *  SCIPpricerSetLagrangianBound(); otherwise, only the lower bounds of calls with the LP dual values are used.
+ */
+SCIP_EXPORT
+SCIP_Real SCIPpricerGetStabilizedDualsol(
+   SCIP_PRICER*          pricer,             /**< variable pricer */
+   SCIP_ROW*             row                 /**< LP row */
+   );
+
+/** declares whether the lower bound returned by the reduced cost pricing callback of the pricer is a Lagrangian bound
+ *  for the dual values it used
+ *
+ *  By default, this is FALSE, and lower bounds returned for stabilized dual values are ignored, since a bound computed
+ *  from the LP value, for instance, is not valid for dual values other than the LP dual values.
+ */
+SCIP_EXPORT
+void SCIPpricerSetLagrangianBound(
+   SCIP_PRICER*          pricer,             /**< variable pricer */
+   SCIP_Bool             lagrangianbound     /**< is the lower bound a Lagrangian bound for the used dual values? */
+   );
+
+/** is the lower bound returned by the reduced cost pricing callback of the pricer a Lagrangian bound for the dual values
+ *  it used?
+ */
+SCIP_EXPORT
+SCIP_Bool SCIPpricerHasLagrangianBound(
+   SCIP_PRICER*          pricer              /**< variable pricer */
+   );
+
+/** gets the number of misprices of the pricer, i.e., the number of pricing calls with stabilized dual values that did
+ *  not find a column and had to be repeated with a smaller smoothing factor
+ */
+SCIP_EXPORT
+int SCIPpricerGetNMisprices(
+   SCIP_PRICER*          pricer              /**< variable pricer */
+   );
+
+/** stores a column that was found by a pricing job in the job's buffer
+ *
+ *  The column data is copied, such that the job can reuse or free its own memory. This method is thread-safe for
+ *  different buffers and may be called from within SCIP_DECL_PRICINGJOB only.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPpricingbufferAddCol(
+   SCIP_PRICINGBUFFER*   buffer,             /**< buffer of the pricing job */
+   void*                 coldata,            /**< data describing the column, which is passed to the addcol method */
+   size_t                coldatasize,        /**< size of the column data in bytes */
+   SCIP_Real             redcost             /**< reduced cost of the column */
+   );
+
+/** returns whether the pricing jobs found enough columns with negative reduced costs, such that the calling job
+ *  can stop
+ */
+SCIP_EXPORT
+SCIP_Bool SCIPpricingbufferIsStopped(
+   SCIP_PRICINGBUFFER*   buffer              /**< buffer of the pricing job */
+   );
+
+/** returns the number of columns stored in the buffer of the pricing job */
+SCIP_EXPORT
+int SCIPpricingbufferGetNCols(
+   SCIP_PRICINGBUFFER*   buffer              /**< buffer of the pricing job */
+   );
+
 /** @} */
 
 #ifdef __cplusplus
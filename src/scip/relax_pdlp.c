@@ -0,0 +1,1127 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   relax_pdlp.c
+ * @ingroup DEFPLUGINS_RELAX
+ * @brief  first-order LP relaxator based on the restarted primal-dual hybrid gradient method (PDLP)
+ *
+ * The relaxator copies the LP relaxation of the current node
+ * \f[
+ *   \min\{ c^T x : \ell \leq Ax \leq r,\; l \leq x \leq u \}
+ * \f]
+ * into a row-wise sparse matrix, equilibrates it by Ruiz scaling, and applies the primal-dual hybrid gradient method
+ * to the saddle point problem
+ * \f[
+ *   \min_{l \leq x \leq u} \max_y\; c^T x - y^T A x + \sum_{i : y_i > 0} \ell_i y_i + \sum_{i : y_i < 0} r_i y_i,
+ * \f]
+ * with restarts to the average iterate and primal weight updates as in PDLP (Applegate et al., 2021). Only
+ * matrix-vector products with \f$A\f$ and \f$A^T\f$ are needed.
+ *
+ * For every dual iterate \f$y\f$ that is checked, the Lagrangian bound
+ * \f[
+ *   \sum_{i : y_i > 0} \ell_i y_i + \sum_{i : y_i < 0} r_i y_i + \sum_j \min\{ (c - A^T y)_j x_j : l_j \leq x_j \leq u_j \}
+ * \f]
+ * is a valid lower bound for the node, which is finite if the reduced costs of all columns with infinite bounds have
+ * the right sign. Since the iterates live in the scaled space and are computed in floating point, the bound of the best
+ * dual point of each run is recomputed on the unscaled rows and columns in interval arithmetic before it is returned to
+ * SCIP. The primal iterate with the smallest KKT error is stored as relaxation solution.
+ *
+ * No crossover to a basic solution is performed, so the relaxator provides neither a basis for warm starting the
+ * simplex nor LP solution values for separation.
+ *
+ * Several runs with different initial primal weights are executed, in parallel if a thread pool is available (see
+ * SCIPexecParallelJobs()). The runs only read the shared matrix and do not call any SCIP methods.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <assert.h>
+#include <math.h>
+#include <string.h>
+
+#include "blockmemshell/memory.h"
+#include "scip/intervalarith.h"
+#include "scip/pub_lp.h"
+#include "scip/pub_message.h"
+#include "scip/pub_relax.h"
+#include "scip/relax_pdlp.h"
+#include "scip/scip_concurrent.h"
+#include "scip/scip_lp.h"
+#include "scip/scip_mem.h"
+#include "scip/scip_message.h"
+#include "scip/scip_numerics.h"
+#include "scip/scip_param.h"
+#include "scip/scip_relax.h"
+#include "scip/scip_var.h"
+#include "scip/type_concurrent.h"
+
+
+#define RELAX_NAME             "pdlp"
+#define RELAX_DESC             "first-order LP relaxator based on the restarted primal-dual hybrid gradient method"
+#define RELAX_PRIORITY         0
+#define RELAX_FREQ             -1
+
+#define DEFAULT_MAXITER        2000          /**< maximal number of iterations of each run */
+#define DEFAULT_NRUNS          3             /**< number of runs with different initial primal weights */
+#define DEFAULT_RELTOL         1e-4          /**< relative KKT error at which a run is stopped */
+#define DEFAULT_STORESOL       TRUE          /**< should the primal point be stored as relaxation solution? */
+
+#define CHECKFREQ              64            /**< number of iterations between two checks for restarts and termination */
+#define NRUIZROUNDS            10            /**< number of rounds of Ruiz equilibration */
+#define STEPSIZEFACTOR         0.9           /**< factor applied to the inverse of the bound on ||A||_2 for the step size */
+#define RESTARTSUFFICIENT      0.2           /**< sufficient reduction of the KKT error since the last restart */
+#define RESTARTNECESSARY       0.8           /**< necessary reduction of the KKT error for a restart without progress */
+#define RESTARTARTIFICIAL      0.36          /**< fraction of all iterations after which a restart is enforced */
+#define PRIMALWEIGHTSMOOTHING  0.5           /**< weight of the old primal weight in primal weight updates */
+#define PRIMALWEIGHTSPREAD     4.0           /**< factor between the initial primal weights of different runs */
+#define PROJECTIONMARGIN       1e-9          /**< margin for the sign of projected reduced costs, relative to their terms */
+
+
+/*
+ * Data structures
+ */
+
+/** scaled LP relaxation in row-wise sparse format, which is shared by all runs */
+struct PdlpLp
+{
+   SCIP_Real*            vals;               /**< scaled nonzero coefficients of the rows */
+   int*                  colinds;            /**< column indices of the nonzero coefficients */
+   int*                  rowbegs;            /**< start index of each row in vals and colinds, nnonz at position nrows */
+   SCIP_Real*            obj;                /**< scaled objective coefficients of the columns */
+   SCIP_Real*            lbs;                /**< scaled lower bounds of the columns */
+   SCIP_Real*            ubs;                /**< scaled upper bounds of the columns */
+   SCIP_Real*            lhss;               /**< scaled left hand sides of the rows */
+   SCIP_Real*            rhss;               /**< scaled right hand sides of the rows */
+   SCIP_Real*            colscales;          /**< scaling factors of the columns */
+   SCIP_Real*            rowscales;          /**< scaling factors of the rows */
+   SCIP_Real             infinity;           /**< value for infinity */
+   SCIP_Real             stepsize;           /**< step size eta with eta * ||A||_2 < 1 */
+   SCIP_Real             objnorm;            /**< Euclidean norm of the scaled objective */
+   SCIP_Real             sidenorm;           /**< Euclidean norm of the finite scaled sides */
+   SCIP_Real             reltol;             /**< relative KKT error at which a run is stopped */
+   int                   maxiter;            /**< maximal number of iterations of each run */
+   int                   nrows;              /**< number of rows */
+   int                   ncols;              /**< number of columns */
+};
+typedef struct PdlpLp PDLPLP;
+
+/** data of one run of the restarted primal-dual hybrid gradient method */
+struct PdlpRun
+{
+   PDLPLP*               lp;                 /**< LP relaxation to solve */
+   SCIP_Real*            primsol;            /**< scaled primal point with the smallest KKT error of the last check */
+   SCIP_Real*            dualsol;            /**< scaled dual point with the best Lagrangian bound */
+   SCIP_Real             primalweight;       /**< initial primal weight */
+   SCIP_Real             dualbound;          /**< best Lagrangian bound */
+   SCIP_Real             kkterror;           /**< relative KKT error of the primal point */
+   int                   niterations;        /**< number of performed iterations */
+};
+typedef struct PdlpRun PDLPRUN;
+
+/** relaxator data */
+struct SCIP_RelaxData
+{
+   SCIP_Real             reltol;             /**< relative KKT error at which a run is stopped */
+   int                   maxiter;            /**< maximal number of iterations of each run */
+   int                   nruns;              /**< number of runs with different initial primal weights */
+   SCIP_Bool             storesol;           /**< should the primal point be stored as relaxation solution? */
+};
+
+
+/*
+ * Local methods
+ */
+
+/** computes the row activities Ax */
+static
+void pdlpComputeActivities(
+   PDLPLP*               lp,                 /**< LP relaxation */
+   const SCIP_Real*      x,                  /**< primal point */
+   SCIP_Real*            activities          /**< array to store the row activities */
+   )
+{
+   int r;
+   int k;
+
+   for( r = 0; r < lp->nrows; ++r )
+   {
+      SCIP_Real activity = 0.0;
+
+      for( k = lp->rowbegs[r]; k < lp->rowbegs[r+1]; ++k )
+         activity += lp->vals[k] * x[lp->colinds[k]];
+
+      activities[r] = activity;
+   }
+}
+
+/** computes the column activities A^T y */
+static
+void pdlpComputeColActivities(
+   PDLPLP*               lp,                 /**< LP relaxation */
+   const SCIP_Real*      y,                  /**< dual point */
+   SCIP_Real*            colactivities       /**< array to store the column activities */
+   )
+{
+   int r;
+   int k;
+
+   BMSclearMemoryArray(colactivities, lp->ncols);
+
+   for( r = 0; r < lp->nrows; ++r )
+   {
+      if( y[r] == 0.0 )
+         continue;
+
+      for( k = lp->rowbegs[r]; k < lp->rowbegs[r+1]; ++k )
+         colactivities[lp->colinds[k]] += lp->vals[k] * y[r];
+   }
+}
+
+/** returns the proximal step of the dual function of a row, which keeps the dual value nonnegative if the row has no
+ *  finite right hand side and nonpositive if the row has no finite left hand side
+ */
+static
+SCIP_Real pdlpProxDual(
+   PDLPLP*               lp,                 /**< LP relaxation */
+   int                   row,                /**< index of the row */
+   SCIP_Real             val,                /**< dual value after the gradient step */
+   SCIP_Real             stepsize            /**< dual step size */
+   )
+{
+   if( lp->lhss[row] > -lp->infinity && val + stepsize * lp->lhss[row] > 0.0 )
+      return val + stepsize * lp->lhss[row];
+   if( lp->rhss[row] < lp->infinity && val + stepsize * lp->rhss[row] < 0.0 )
+      return val + stepsize * lp->rhss[row];
+
+   return 0.0;
+}
+
+/** computes the Lagrangian bound of the dual point and the relative KKT error of the primal-dual point */
+static
+void pdlpEvaluate(
+   PDLPLP*               lp,                 /**< LP relaxation */
+   const SCIP_Real*      x,                  /**< primal point within the bounds */
+   const SCIP_Real*      y,                  /**< dual point */
+   SCIP_Real*            activities,         /**< working array for the row activities */
+   SCIP_Real*            colactivities,      /**< working array for the column activities */
+   SCIP_Real*            dualbound,          /**< pointer to store the Lagrangian bound, or -infinity */
+   SCIP_Real*            kkterror            /**< pointer to store the relative KKT error */
+   )
+{
+   SCIP_Real primalobj;
+   SCIP_Real dualobj;
+   SCIP_Real primalres;
+   SCIP_Real dualres;
+   SCIP_Real gap;
+   SCIP_Bool boundvalid;
+   int r;
+   int c;
+
+   pdlpComputeActivities(lp, x, activities);
+   pdlpComputeColActivities(lp, y, colactivities);
+
+   primalres = 0.0;
+   dualobj = 0.0;
+   for( r = 0; r < lp->nrows; ++r )
+   {
+      SCIP_Real viol = 0.0;
+
+      if( lp->lhss[r] > -lp->infinity && activities[r] < lp->lhss[r] )
+         viol = lp->lhss[r] - activities[r];
+      else if( lp->rhss[r] < lp->infinity && activities[r] > lp->rhss[r] )
+         viol = activities[r] - lp->rhss[r];
+      primalres += viol * viol;
+
+      if( y[r] > 0.0 )
+         dualobj += y[r] * lp->lhss[r];
+      else if( y[r] < 0.0 )
+         dualobj += y[r] * lp->rhss[r];
+   }
+
+   primalobj = 0.0;
+   dualres = 0.0;
+   boundvalid = TRUE;
+   for( c = 0; c < lp->ncols; ++c )
+   {
+      SCIP_Real redcost;
+
+      primalobj += lp->obj[c] * x[c];
+
+      /* the part of the reduced cost that cannot be compensated by a finite bound is dual infeasible */
+      redcost = lp->obj[c] - colactivities[c];
+      if( redcost > 0.0 )
+      {
+         if( lp->lbs[c] > -lp->infinity )
+            dualobj += redcost * lp->lbs[c];
+         else
+         {
+            dualres += redcost * redcost;
+            boundvalid = FALSE;
+         }
+      }
+      else if( redcost < 0.0 )
+      {
+         if( lp->ubs[c] < lp->infinity )
+            dualobj += redcost * lp->ubs[c];
+         else
+         {
+            dualres += redcost * redcost;
+            boundvalid = FALSE;
+         }
+      }
+   }
+
+   gap = REALABS(primalobj - dualobj);
+
+   *dualbound = boundvalid ? dualobj : -lp->infinity;
+   *kkterror = MAX3(sqrt(primalres) / (1.0 + lp->sidenorm), sqrt(dualres) / (1.0 + lp->objnorm),
+      gap / (1.0 + REALABS(primalobj) + REALABS(dualobj)));
+}
+
+/** returns the Euclidean distance between two vectors */
+static
+SCIP_Real pdlpDistance(
+   const SCIP_Real*      a,                  /**< first vector */
+   const SCIP_Real*      b,                  /**< second vector */
+   int                   n                   /**< length of the vectors */
+   )
+{
+   SCIP_Real dist = 0.0;
+   int i;
+
+   for( i = 0; i < n; ++i )
+      dist += (a[i] - b[i]) * (a[i] - b[i]);
+
+   return sqrt(dist);
+}
+
+/** job that runs the restarted primal-dual hybrid gradient method with one initial primal weight */
+static
+SCIP_DECL_PARALLELJOB(pdlpSolve)
+{
+   PDLPRUN* run;
+   PDLPLP* lp;
+   SCIP_Real* x;
+   SCIP_Real* xnew;
+   SCIP_Real* xbar;
+   SCIP_Real* y;
+   SCIP_Real* xavg;
+   SCIP_Real* yavg;
+   SCIP_Real* xrestart;
+   SCIP_Real* yrestart;
+   SCIP_Real* activities;
+   SCIP_Real* colactivities;
+   SCIP_RETCODE retcode;
+   SCIP_Real primalweight;
+   SCIP_Real primalstep;
+   SCIP_Real dualstep;
+   SCIP_Real kktrestart;
+   SCIP_Real kktlastcand;
+   int lastrestart;
+   int navg;
+   int iter;
+   int c;
+   int r;
+
+   run = (PDLPRUN*) jobarg;
+   assert(run != NULL);
+
+   lp = run->lp;
+   assert(lp != NULL);
+   assert(lp->nrows > 0);
+   assert(lp->ncols > 0);
+
+   retcode = SCIP_OKAY;
+   x = NULL;
+   xnew = NULL;
+   xbar = NULL;
+   xavg = NULL;
+   xrestart = NULL;
+   colactivities = NULL;
+   y = NULL;
+   yavg = NULL;
+   yrestart = NULL;
+   activities = NULL;
+
+   /* the job may run in a different thread, so we must not use SCIP's memory */
+   SCIP_ALLOC_TERMINATE( retcode, BMSallocMemoryArray(&x, lp->ncols), TERMINATE );
+   SCIP_ALLOC_TERMINATE( retcode, BMSallocMemoryArray(&xnew, lp->ncols), TERMINATE );
+   SCIP_ALLOC_TERMINATE( retcode, BMSallocMemoryArray(&xbar, lp->ncols), TERMINATE );
+   SCIP_ALLOC_TERMINATE( retcode, BMSallocMemoryArray(&xavg, lp->ncols), TERMINATE );
+   SCIP_ALLOC_TERMINATE( retcode, BMSallocMemoryArray(&xrestart, lp->ncols), TERMINATE );
+   SCIP_ALLOC_TERMINATE( retcode, BMSallocMemoryArray(&colactivities, lp->ncols), TERMINATE );
+   SCIP_ALLOC_TERMINATE( retcode, BMSallocMemoryArray(&y, lp->nrows), TERMINATE );
+   SCIP_ALLOC_TERMINATE( retcode, BMSallocMemoryArray(&yavg, lp->nrows), TERMINATE );
+   SCIP_ALLOC_TERMINATE( retcode, BMSallocMemoryArray(&yrestart, lp->nrows), TERMINATE );
+   SCIP_ALLOC_TERMINATE( retcode, BMSallocMemoryArray(&activities, lp->nrows), TERMINATE );
+
+   /* start in the projection of the origin */
+   for( c = 0; c < lp->ncols; ++c )
+      x[c] = MIN(MAX(0.0, lp->lbs[c]), lp->ubs[c]);
+   BMSclearMemoryArray(y, lp->nrows);
+
+   BMScopyMemoryArray(xavg, x, lp->ncols);
+   BMScopyMemoryArray(xrestart, x, lp->ncols);
+   BMScopyMemoryArray(run->primsol, x, lp->ncols);
+   BMScopyMemoryArray(yavg, y, lp->nrows);
+   BMScopyMemoryArray(yrestart, y, lp->nrows);
+   BMScopyMemoryArray(run->dualsol, y, lp->nrows);
+
+   pdlpEvaluate(lp, x, y, activities, colactivities, &run->dualbound, &kktrestart);
+   run->kkterror = kktrestart;
+   kktlastcand = kktrestart;
+
+   primalweight = run->primalweight;
+   primalstep = lp->stepsize / primalweight;
+   dualstep = lp->stepsize * primalweight;
+   lastrestart = 0;
+   navg = 0;
+
+   for( iter = 1; iter <= lp->maxiter; ++iter )
+   {
+      SCIP_Real* candx;
+      SCIP_Real* candy;
+      SCIP_Real boundcur;
+      SCIP_Real boundavg;
+      SCIP_Real kktcur;
+      SCIP_Real kktavg;
+      SCIP_Real kktcand;
+      SCIP_Real* tmp;
+
+      /* primal step: projected gradient step on the Lagrangian */
+      pdlpComputeColActivities(lp, y, colactivities);
+      for( c = 0; c < lp->ncols; ++c )
+      {
+         xnew[c] = x[c] - primalstep * (lp->obj[c] - colactivities[c]);
+         xnew[c] = MIN(MAX(xnew[c], lp->lbs[c]), lp->ubs[c]);
+         xbar[c] = 2.0 * xnew[c] - x[c];
+      }
+
+      /* dual step at the extrapolated primal point */
+      pdlpComputeActivities(lp, xbar, activities);
+      for( r = 0; r < lp->nrows; ++r )
+         y[r] = pdlpProxDual(lp, r, y[r] - dualstep * activities[r], dualstep);
+
+      tmp = x;
+      x = xnew;
+      xnew = tmp;
+
+      /* update the average iterate since the last restart */
+      ++navg;
+      for( c = 0; c < lp->ncols; ++c )
+         xavg[c] += (x[c] - xavg[c]) / navg;
+      for( r = 0; r < lp->nrows; ++r )
+         yavg[r] += (y[r] - yavg[r]) / navg;
+
+      if( iter % CHECKFREQ != 0 && iter < lp->maxiter )
+         continue;
+
+      /* keep the best Lagrangian bound of the current and the average dual point */
+      pdlpEvaluate(lp, x, y, activities, colactivities, &boundcur, &kktcur);
+      pdlpEvaluate(lp, xavg, yavg, activities, colactivities, &boundavg, &kktavg);
+
+      if( boundcur > run->dualbound )
+      {
+         run->dualbound = boundcur;
+         BMScopyMemoryArray(run->dualsol, y, lp->nrows);
+      }
+      if( boundavg > run->dualbound )
+      {
+         run->dualbound = boundavg;
+         BMScopyMemoryArray(run->dualsol, yavg, lp->nrows);
+      }
+
+      /* the restart candidate is the point with the smaller KKT error */
+      if( kktavg < kktcur )
+      {
+         candx = xavg;
+         candy = yavg;
+         kktcand = kktavg;
+      }
+      else
+      {
+         candx = x;
+         candy = y;
+         kktcand = kktcur;
+      }
+
+      BMScopyMemoryArray(run->primsol, candx, lp->ncols);
+      run->kkterror = kktcand;
+
+      if( kktcand <= lp->reltol )
+         break;
+
+      /* restart to the candidate, if the KKT error decreased sufficiently or stopped decreasing, or if the last restart
+       * lies back long enough
+       */
+      if( kktcand <= RESTARTSUFFICIENT * kktrestart
+         || (kktcand <= RESTARTNECESSARY * kktrestart && kktcand > kktlastcand)
+         || iter - lastrestart >= RESTARTARTIFICIAL * iter )
+      {
+         SCIP_Real primaldist;
+         SCIP_Real dualdist;
+
+         /* balance the primal and the dual distances moved since the last restart */
+         primaldist = pdlpDistance(candx, xrestart, lp->ncols);
+         dualdist = pdlpDistance(candy, yrestart, lp->nrows);
+         if( primaldist > 1e-10 && dualdist > 1e-10 )
+         {
+            primalweight = exp(PRIMALWEIGHTSMOOTHING * log(primalweight)
+               + (1.0 - PRIMALWEIGHTSMOOTHING) * log(dualdist / primaldist));
+            primalstep = lp->stepsize / primalweight;
+            dualstep = lp->stepsize * primalweight;
+         }
+
+         if( candx != x )
+         {
+            BMScopyMemoryArray(x, candx, lp->ncols);
+            BMScopyMemoryArray(y, candy, lp->nrows);
+         }
+         BMScopyMemoryArray(xrestart, x, lp->ncols);
+         BMScopyMemoryArray(yrestart, y, lp->nrows);
+         BMScopyMemoryArray(xavg, x, lp->ncols);
+         BMScopyMemoryArray(yavg, y, lp->nrows);
+
+         navg = 0;
+         lastrestart = iter;
+         kktrestart = kktcand;
+      }
+      kktlastcand = kktcand;
+   }
+   run->niterations = MIN(iter, lp->maxiter);
+
+TERMINATE:
+   BMSfreeMemoryArrayNull(&activities);
+   BMSfreeMemoryArrayNull(&yrestart);
+   BMSfreeMemoryArrayNull(&yavg);
+   BMSfreeMemoryArrayNull(&y);
+   BMSfreeMemoryArrayNull(&colactivities);
+   BMSfreeMemoryArrayNull(&xrestart);
+   BMSfreeMemoryArrayNull(&xavg);
+   BMSfreeMemoryArrayNull(&xbar);
+   BMSfreeMemoryArrayNull(&xnew);
+   BMSfreeMemoryArrayNull(&x);
+
+   return retcode;
+}
+
+/** computes a safe Lagrangian bound of a scaled dual point on the unscaled LP relaxation of SCIP
+ *
+ *  The bound computed in pdlpEvaluate() is subject to the rounding errors of the scaled floating point computation and
+ *  may therefore slightly overestimate the true Lagrangian bound. As in the proved LP bound of SCIP (see
+ *  SCIPlpGetProvedLowerbound()), the bound is recomputed here for the unscaled dual point \f$y = R y'\f$ on the rows
+ *  and columns of SCIP in interval arithmetic, which yields a rigorous bound for every dual point \f$y\f$.
+ *
+ *  Since a reduced cost of the wrong sign, or one that is only zero up to rounding, on a column with an infinite bound
+ *  makes the bound infinite, the dual point is projected first: the duals of rows whose side for their sign is
+ *  infinite are set to zero, and for each column with exactly one infinite bound whose reduced cost does not have the
+ *  right sign by a margin, the duals of its rows are moved towards zero until it does. The projection is computed in
+ *  floating point and does not need to be exact, because the bound is computed rigorously for the projected point.
+ *  Free columns are not repaired, since their reduced costs would have to vanish exactly.
+ */
+static
+SCIP_RETCODE pdlpComputeSafeBound(
+   SCIP*                 scip,               /**< SCIP data structure */
+   PDLPLP*               lp,                 /**< LP relaxation */
+   SCIP_COL**            cols,               /**< columns of the LP */
+   SCIP_ROW**            rows,               /**< rows of the LP */
+   const SCIP_Real*      y,                  /**< scaled dual point */
+   SCIP_Real*            bound               /**< pointer to store the safe Lagrangian bound, or -infinity */
+   )
+{
+   SCIP_INTERVAL* redcosts;
+   SCIP_INTERVAL ytb;
+   SCIP_INTERVAL yinter;
+   SCIP_INTERVAL prod;
+   SCIP_INTERVAL side;
+   SCIP_INTERVAL x;
+   SCIP_INTERVAL a;
+   SCIP_Real* yvals;
+   SCIP_Real* rcs;
+   SCIP_Real infinity;
+   int r;
+   int c;
+   int k;
+
+   infinity = SCIPinfinity(scip);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &redcosts, lp->ncols) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &yvals, lp->nrows) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &rcs, lp->ncols) );
+
+   /* unscale the dual point and project it onto the signs that are allowed by the sides */
+   for( r = 0; r < lp->nrows; ++r )
+   {
+      yvals[r] = lp->rowscales[r] * y[r];
+
+      if( (yvals[r] > 0.0 && lp->lhss[r] <= -lp->infinity) || (yvals[r] < 0.0 && lp->rhss[r] >= lp->infinity) )
+         yvals[r] = 0.0;
+   }
+
+   /* compute the reduced costs c - A^T y in floating point */
+   for( c = 0; c < lp->ncols; ++c )
+      rcs[c] = SCIPcolGetObj(cols[c]);
+
+   for( r = 0; r < lp->nrows; ++r )
+   {
+      SCIP_COL** rowcols;
+      SCIP_Real* rowvals;
+
+      if( yvals[r] == 0.0 )
+         continue;
+
+      rowcols = SCIProwGetCols(rows[r]);
+      rowvals = SCIProwGetVals(rows[r]);
+      for( k = 0; k < SCIProwGetNNonz(rows[r]); ++k )
+      {
+         int lppos = SCIPcolGetLPPos(rowcols[k]);
+
+         if( lppos >= 0 )
+            rcs[lppos] -= rowvals[k] * yvals[r];
+      }
+   }
+
+   /* move the duals of the rows of each column with one infinite bound towards zero until its reduced cost has the
+    * right sign with a margin for the rounding errors of the interval computation
+    */
+   for( c = 0; c < lp->ncols; ++c )
+   {
+      SCIP_ROW** colrows;
+      SCIP_Real* colvals;
+      SCIP_Real rcsign;
+      SCIP_Real margin;
+      int ncolrows;
+
+      if( SCIPisInfinity(scip, -SCIPcolGetLb(cols[c])) == SCIPisInfinity(scip, SCIPcolGetUb(cols[c])) )
+         continue;
+
+      /* the reduced cost must be positive if the upper bound is infinite and negative if the lower bound is infinite */
+      rcsign = SCIPisInfinity(scip, SCIPcolGetUb(cols[c])) ? 1.0 : -1.0;
+
+      colrows = SCIPcolGetRows(cols[c]);
+      colvals = SCIPcolGetVals(cols[c]);
+      ncolrows = SCIPcolGetNNonz(cols[c]);
+
+      margin = REALABS(SCIPcolGetObj(cols[c]));
+      for( k = 0; k < ncolrows; ++k )
+      {
+         if( SCIProwGetLPPos(colrows[k]) >= 0 )
+            margin += REALABS(colvals[k] * yvals[SCIProwGetLPPos(colrows[k])]);
+      }
+      margin *= PROJECTIONMARGIN;
+
+      for( k = 0; k < ncolrows && rcsign * rcs[c] < margin; ++k )
+      {
+         SCIP_COL** rowcols;
+         SCIP_Real* rowvals;
+         SCIP_Real delta;
+         SCIP_Real newy;
+         int l;
+
+         r = SCIProwGetLPPos(colrows[k]);
+         if( r < 0 )
+            continue;
+         assert(r < lp->nrows);
+
+         /* only a dual with rcsign * a_rc * y_r > 0 can be moved towards zero to increase rcsign * rc */
+         if( rcsign * colvals[k] * yvals[r] <= 0.0 )
+            continue;
+
+         delta = (margin - rcsign * rcs[c]) / (rcsign * colvals[k]);
+         newy = REALABS(delta) >= REALABS(yvals[r]) ? 0.0 : yvals[r] - delta;
+
+         rowcols = SCIProwGetCols(rows[r]);
+         rowvals = SCIProwGetVals(rows[r]);
+         for( l = 0; l < SCIProwGetNNonz(rows[r]); ++l )
+         {
+            int lppos = SCIPcolGetLPPos(rowcols[l]);
+
+            if( lppos >= 0 )
+               rcs[lppos] -= rowvals[l] * (newy - yvals[r]);
+         }
+         yvals[r] = newy;
+      }
+   }
+
+   for( c = 0; c < lp->ncols; ++c )
+      SCIPintervalSet(&redcosts[c], SCIPcolGetObj(cols[c]));
+
+   /* compute y^T b and c - A^T y, using the side that matches the sign of y_r */
+   SCIPintervalSet(&ytb, 0.0);
+   for( r = 0; r < lp->nrows; ++r )
+   {
+      SCIP_COL** rowcols;
+      SCIP_Real* rowvals;
+
+      if( yvals[r] > 0.0 )
+         SCIPintervalSet(&side, SCIProwGetLhs(rows[r]) - SCIProwGetConstant(rows[r]));
+      else if( yvals[r] < 0.0 )
+         SCIPintervalSet(&side, SCIProwGetRhs(rows[r]) - SCIProwGetConstant(rows[r]));
+      else
+         continue;
+
+      SCIPintervalSet(&yinter, yvals[r]);
+      SCIPintervalMul(infinity, &prod, yinter, side);
+      SCIPintervalAdd(infinity, &ytb, ytb, prod);
+
+      rowcols = SCIProwGetCols(rows[r]);
+      rowvals = SCIProwGetVals(rows[r]);
+      for( k = 0; k < SCIProwGetNNonz(rows[r]); ++k )
+      {
+         int lppos = SCIPcolGetLPPos(rowcols[k]);
+
+         if( lppos < 0 )
+            continue;
+
+         SCIPintervalSet(&a, rowvals[k]);
+         SCIPintervalMul(infinity, &prod, yinter, a);
+         SCIPintervalSub(infinity, &redcosts[lppos], redcosts[lppos], prod);
+      }
+   }
+
+   /* add min{(c - A^T y)^T x : l <= x <= u}, which is -infinity if a reduced cost may hit an infinite bound */
+   for( c = 0; c < lp->ncols; ++c )
+   {
+      SCIPintervalSetBounds(&x, SCIPcolGetLb(cols[c]), SCIPcolGetUb(cols[c]));
+      SCIPintervalMul(infinity, &prod, redcosts[c], x);
+      SCIPintervalAdd(infinity, &ytb, ytb, prod);
+   }
+
+   SCIPfreeBufferArray(scip, &rcs);
+   SCIPfreeBufferArray(scip, &yvals);
+   SCIPfreeBufferArray(scip, &redcosts);
+
+   *bound = SCIPintervalGetInf(ytb);
+   if( SCIPisInfinity(scip, -*bound) )
+      *bound = -infinity;
+
+   return SCIP_OKAY;
+}
+
+/** copies the LP relaxation of the current node into a scaled row-wise matrix */
+static
+SCIP_RETCODE pdlpCreateLp(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_RELAXDATA*       relaxdata,          /**< relaxator data */
+   PDLPLP*               lp,                 /**< LP relaxation to fill */
+   SCIP_COL**            cols,               /**< columns of the LP */
+   int                   ncols,              /**< number of columns of the LP */
+   SCIP_ROW**            rows,               /**< rows of the LP */
+   int                   nrows               /**< number of rows of the LP */
+   )
+{
+   SCIP_Real* rowmaxs;
+   SCIP_Real* colmaxs;
+   SCIP_Real* colsums;
+   SCIP_Real maxrowsum;
+   SCIP_Real maxcolsum;
+   int nnonz;
+   int round;
+   int r;
+   int c;
+   int k;
+
+   lp->nrows = nrows;
+   lp->ncols = ncols;
+   lp->infinity = SCIPinfinity(scip);
+   lp->reltol = relaxdata->reltol;
+   lp->maxiter = relaxdata->maxiter;
+
+   nnonz = 0;
+   for( r = 0; r < nrows; ++r )
+      nnonz += SCIProwGetNNonz(rows[r]);
+
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &lp->rowbegs, nrows + 1) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &lp->colinds, MAX(nnonz, 1)) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &lp->vals, MAX(nnonz, 1)) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &lp->lhss, nrows) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &lp->rhss, nrows) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &lp->rowscales, nrows) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &lp->obj, ncols) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &lp->lbs, ncols) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &lp->ubs, ncols) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &lp->colscales, ncols) );
+
+   /* copy the rows; the constant of a row is moved to its sides */
+   nnonz = 0;
+   for( r = 0; r < nrows; ++r )
+   {
+      SCIP_COL** rowcols;
+      SCIP_Real* rowvals;
+      SCIP_Real constant;
+      int rownnonz;
+
+      rowcols = SCIProwGetCols(rows[r]);
+      rowvals = SCIProwGetVals(rows[r]);
+      rownnonz = SCIProwGetNNonz(rows[r]);
+      constant = SCIProwGetConstant(rows[r]);
+
+      lp->rowbegs[r] = nnonz;
+      for( k = 0; k < rownnonz; ++k )
+      {
+         int lppos = SCIPcolGetLPPos(rowcols[k]);
+
+         if( lppos < 0 )
+            continue;
+
+         lp->colinds[nnonz] = lppos;
+         lp->vals[nnonz] = rowvals[k];
+         ++nnonz;
+      }
+
+      lp->lhss[r] = SCIPisInfinity(scip, -SCIProwGetLhs(rows[r])) ? -lp->infinity : SCIProwGetLhs(rows[r]) - constant;
+      lp->rhss[r] = SCIPisInfinity(scip, SCIProwGetRhs(rows[r])) ? lp->infinity : SCIProwGetRhs(rows[r]) - constant;
+      lp->rowscales[r] = 1.0;
+   }
+   lp->rowbegs[nrows] = nnonz;
+
+   for( c = 0; c < ncols; ++c )
+   {
+      lp->obj[c] = SCIPcolGetObj(cols[c]);
+      lp->lbs[c] = SCIPisInfinity(scip, -SCIPcolGetLb(cols[c])) ? -lp->infinity : SCIPcolGetLb(cols[c]);
+      lp->ubs[c] = SCIPisInfinity(scip, SCIPcolGetUb(cols[c])) ? lp->infinity : SCIPcolGetUb(cols[c]);
+      lp->colscales[c] = 1.0;
+   }
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &rowmaxs, nrows) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &colmaxs, ncols) );
+
+   /* Ruiz equilibration: divide each row and column by the square root of its maximal absolute coefficient */
+   for( round = 0; round < NRUIZROUNDS; ++round )
+   {
+      BMSclearMemoryArray(colmaxs, ncols);
+      for( r = 0; r < nrows; ++r )
+      {
+         rowmaxs[r] = 0.0;
+         for( k = lp->rowbegs[r]; k < lp->rowbegs[r+1]; ++k )
+         {
+            SCIP_Real absval = REALABS(lp->vals[k]);
+
+            rowmaxs[r] = MAX(rowmaxs[r], absval);
+            colmaxs[lp->colinds[k]] = MAX(colmaxs[lp->colinds[k]], absval);
+         }
+         rowmaxs[r] = (rowmaxs[r] > 0.0 ? 1.0 / sqrt(rowmaxs[r]) : 1.0);
+      }
+      for( c = 0; c < ncols; ++c )
+      {
+         colmaxs[c] = (colmaxs[c] > 0.0 ? 1.0 / sqrt(colmaxs[c]) : 1.0);
+         lp->colscales[c] *= colmaxs[c];
+      }
+      for( r = 0; r < nrows; ++r )
+      {
+         lp->rowscales[r] *= rowmaxs[r];
+         for( k = lp->rowbegs[r]; k < lp->rowbegs[r+1]; ++k )
+            lp->vals[k] *= rowmaxs[r] * colmaxs[lp->colinds[k]];
+      }
+   }
+
+   SCIPfreeBufferArray(scip, &colmaxs);
+   SCIPfreeBufferArray(scip, &rowmaxs);
+
+   /* scale the objective, bounds, and sides: x = S x' and y = R y' */
+   lp->objnorm = 0.0;
+   for( c = 0; c < ncols; ++c )
+   {
+      lp->obj[c] *= lp->colscales[c];
+      if( lp->lbs[c] > -lp->infinity )
+         lp->lbs[c] /= lp->colscales[c];
+      if( lp->ubs[c] < lp->infinity )
+         lp->ubs[c] /= lp->colscales[c];
+      lp->objnorm += lp->obj[c] * lp->obj[c];
+   }
+   lp->objnorm = sqrt(lp->objnorm);
+
+   lp->sidenorm = 0.0;
+   for( r = 0; r < nrows; ++r )
+   {
+      if( lp->lhss[r] > -lp->infinity )
+      {
+         lp->lhss[r] *= lp->rowscales[r];
+         lp->sidenorm += lp->lhss[r] * lp->lhss[r];
+      }
+      if( lp->rhss[r] < lp->infinity )
+      {
+         lp->rhss[r] *= lp->rowscales[r];
+         if( lp->rhss[r] != lp->lhss[r] ) /*lint !e777*/
+            lp->sidenorm += lp->rhss[r] * lp->rhss[r];
+      }
+   }
+   lp->sidenorm = sqrt(lp->sidenorm);
+
+   /* the step size uses the upper bound sqrt(||A||_1 ||A||_inf) on the spectral norm of the scaled matrix */
+   SCIP_CALL( SCIPallocCleanBufferArray(scip, &colsums, ncols) );
+   maxrowsum = 0.0;
+   for( r = 0; r < nrows; ++r )
+   {
+      SCIP_Real rowsum = 0.0;
+
+      for( k = lp->rowbegs[r]; k < lp->rowbegs[r+1]; ++k )
+      {
+         rowsum += REALABS(lp->vals[k]);
+         colsums[lp->colinds[k]] += REALABS(lp->vals[k]);
+      }
+      maxrowsum = MAX(maxrowsum, rowsum);
+   }
+   maxcolsum = 0.0;
+   for( c = 0; c < ncols; ++c )
+   {
+      maxcolsum = MAX(maxcolsum, colsums[c]);
+      colsums[c] = 0.0;
+   }
+   SCIPfreeCleanBufferArray(scip, &colsums);
+
+   lp->stepsize = (maxrowsum > 0.0 && maxcolsum > 0.0) ? STEPSIZEFACTOR / sqrt(maxrowsum * maxcolsum) : 1.0;
+
+   return SCIP_OKAY;
+}
+
+/** frees the copied LP relaxation */
+static
+void pdlpFreeLp(
+   SCIP*                 scip,               /**< SCIP data structure */
+   PDLPLP*               lp                  /**< LP relaxation */
+   )
+{
+   SCIPfreeBlockMemoryArray(scip, &lp->colscales, lp->ncols);
+   SCIPfreeBlockMemoryArray(scip, &lp->ubs, lp->ncols);
+   SCIPfreeBlockMemoryArray(scip, &lp->lbs, lp->ncols);
+   SCIPfreeBlockMemoryArray(scip, &lp->obj, lp->ncols);
+   SCIPfreeBlockMemoryArray(scip, &lp->rowscales, lp->nrows);
+   SCIPfreeBlockMemoryArray(scip, &lp->rhss, lp->nrows);
+   SCIPfreeBlockMemoryArray(scip, &lp->lhss, lp->nrows);
+   SCIPfreeBlockMemoryArray(scip, &lp->vals, MAX(lp->rowbegs[lp->nrows], 1));
+   SCIPfreeBlockMemoryArray(scip, &lp->colinds, MAX(lp->rowbegs[lp->nrows], 1));
+   SCIPfreeBlockMemoryArray(scip, &lp->rowbegs, lp->nrows + 1);
+}
+
+
+/*
+ * Callback methods of relaxator
+ */
+
+/** copy method for relaxator plugins (called when SCIP copies plugins) */
+static
+SCIP_DECL_RELAXCOPY(relaxCopyPdlp)
+{  /*lint --e{715}*/
+   assert(scip != NULL);
+   assert(relax != NULL);
+   assert(strcmp(SCIPrelaxGetName(relax), RELAX_NAME) == 0);
+
+   /* call inclusion method of relaxator */
+   SCIP_CALL( SCIPincludeRelaxPdlp(scip) );
+
+   return SCIP_OKAY;
+}
+
+/** destructor of relaxator to free user data (called when SCIP is exiting) */
+static
+SCIP_DECL_RELAXFREE(relaxFreePdlp)
+{  /*lint --e{715}*/
+   SCIP_RELAXDATA* relaxdata;
+
+   relaxdata = SCIPrelaxGetData(relax);
+   assert(relaxdata != NULL);
+
+   SCIPfreeBlockMemory(scip, &relaxdata);
+   SCIPrelaxSetData(relax, NULL);
+
+   return SCIP_OKAY;
+}
+
+/** execution method of relaxator */
+static
+SCIP_DECL_RELAXEXEC(relaxExecPdlp)
+{  /*lint --e{715}*/
+   SCIP_RELAXDATA* relaxdata;
+   PDLPLP lp;
+   PDLPRUN* runs;
+   void** jobargs;
+   SCIP_COL** cols;
+   SCIP_ROW** rows;
+   SCIP_Real initweight;
+   SCIP_Real safebound;
+   int bestsol;
+   int ncols;
+   int nrows;
+   int i;
+
+   relaxdata = SCIPrelaxGetData(relax);
+   assert(relaxdata != NULL);
+
+   *lowerbound = -SCIPinfinity(scip);
+   *result = SCIP_DIDNOTRUN;
+
+   if( !SCIPisLPConstructed(scip) )
+   {
+      SCIP_Bool cutoff;
+
+      SCIP_CALL( SCIPconstructLP(scip, &cutoff) );
+
+      if( cutoff )
+      {
+         *result = SCIP_CUTOFF;
+         return SCIP_OKAY;
+      }
+   }
+
+   /* the Lagrangian bound is only valid if the LP is a relaxation that contains all variables */
+   if( !SCIPallColsInLP(scip) || !SCIPisLPRelax(scip) )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPgetLPColsData(scip, &cols, &ncols) );
+   SCIP_CALL( SCIPgetLPRowsData(scip, &rows, &nrows) );
+
+   if( ncols == 0 || nrows == 0 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( pdlpCreateLp(scip, relaxdata, &lp, cols, ncols, rows, nrows) );
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &runs, relaxdata->nruns) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &jobargs, relaxdata->nruns) );
+
+   /* the runs start with primal weights spread around the ratio of the objective and the side norms */
+   initweight = (lp.objnorm > 0.0 && lp.sidenorm > 0.0) ? lp.objnorm / lp.sidenorm : 1.0;
+   for( i = 0; i < relaxdata->nruns; ++i )
+   {
+      runs[i].lp = &lp;
+      runs[i].primalweight = initweight * pow(PRIMALWEIGHTSPREAD, (i % 2 == 1 ? 1.0 : -1.0) * ((i + 1) / 2));
+      runs[i].dualbound = -lp.infinity;
+      runs[i].kkterror = SCIP_INVALID;
+      runs[i].niterations = 0;
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &runs[i].primsol, ncols) );
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &runs[i].dualsol, nrows) );
+      jobargs[i] = (void*) &runs[i];
+   }
+
+   SCIP_CALL( SCIPexecParallelJobs(scip, -1, pdlpSolve, jobargs, relaxdata->nruns) );
+
+   /* only the safe recomputation of the Lagrangian bounds of the runs is reported to SCIP */
+   bestsol = 0;
+   safebound = -SCIPinfinity(scip);
+   for( i = 0; i < relaxdata->nruns; ++i )
+   {
+      if( runs[i].kkterror < runs[bestsol].kkterror )
+         bestsol = i;
+
+      if( !SCIPisInfinity(scip, -runs[i].dualbound) )
+      {
+         SCIP_Real bound;
+
+         SCIP_CALL( pdlpComputeSafeBound(scip, &lp, cols, rows, runs[i].dualsol, &bound) );
+         safebound = MAX(safebound, bound);
+      }
+   }
+
+   SCIPverbMessage(scip, SCIP_VERBLEVEL_HIGH, NULL,
+      "PDLP relaxator: safe Lagrangian bound %g, KKT error %g of primal point after %d iterations\n",
+      safebound, runs[bestsol].kkterror, runs[bestsol].niterations);
+
+   *lowerbound = safebound;
+
+   /* store the unscaled primal point as relaxation solution, which does not satisfy the LP rows exactly */
+   if( relaxdata->storesol )
+   {
+      SCIP_VAR** vars;
+      SCIP_Real* vals;
+
+      SCIP_CALL( SCIPallocBufferArray(scip, &vars, ncols) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &vals, ncols) );
+
+      for( i = 0; i < ncols; ++i )
+      {
+         vars[i] = SCIPcolGetVar(cols[i]);
+         vals[i] = lp.colscales[i] * runs[bestsol].primsol[i];
+      }
+
+      SCIP_CALL( SCIPsetRelaxSolVals(scip, relax, ncols, vars, vals, FALSE) );
+
+      SCIPfreeBufferArray(scip, &vals);
+      SCIPfreeBufferArray(scip, &vars);
+   }
+
+   *result = SCIP_SUCCESS;
+
+   for( i = relaxdata->nruns - 1; i >= 0; --i )
+   {
+      SCIPfreeBlockMemoryArray(scip, &runs[i].dualsol, nrows);
+      SCIPfreeBlockMemoryArray(scip, &runs[i].primsol, ncols);
+   }
+   SCIPfreeBufferArray(scip, &jobargs);
+   SCIPfreeBufferArray(scip, &runs);
+
+   pdlpFreeLp(scip, &lp);
+
+   return SCIP_OKAY;
+}
+
+
+/*
+ * relaxator specific interface methods
+ */
+
+/** creates the PDLP relaxator and includes it in SCIP */
+SCIP_RETCODE SCIPincludeRelaxPdlp(
+   SCIP*                 scip                /**< SCIP data structure */
+   )
+{
+   SCIP_RELAXDATA* relaxdata;
+   SCIP_RELAX* relax;
+
+   /* create PDLP relaxator data */
+   SCIP_CALL( SCIPallocBlockMemory(scip, &relaxdata) );
+
+   relax = NULL;
+
+   /* include relaxator */
+   SCIP_CALL( SCIPincludeRelaxBasic(scip, &relax, RELAX_NAME, RELAX_DESC, RELAX_PRIORITY, RELAX_FREQ,
+         relaxExecPdlp, relaxdata) );
+   assert(relax != NULL);
+
+   /* set non fundamental callbacks via setter functions */
+   SCIP_CALL( SCIPsetRelaxCopy(scip, relax, relaxCopyPdlp) );
+   SCIP_CALL( SCIPsetRelaxFree(scip, relax, relaxFreePdlp) );
+
+   /* add PDLP relaxator parameters */
+   SCIP_CALL( SCIPaddIntParam(scip,
+         "relaxing/" RELAX_NAME "/maxiter",
+         "maximal number of iterations of each run of the primal-dual hybrid gradient method",
+         &relaxdata->maxiter, FALSE, DEFAULT_MAXITER, 1, INT_MAX, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddIntParam(scip,
+         "relaxing/" RELAX_NAME "/nruns",
+         "number of runs with different initial primal weights, which are executed in parallel if possible",
+         &relaxdata->nruns, FALSE, DEFAULT_NRUNS, 1, 64, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddRealParam(scip,
+         "relaxing/" RELAX_NAME "/reltol",
+         "relative KKT error at which a run is stopped",
+         &relaxdata->reltol, FALSE, DEFAULT_RELTOL, 0.0, 1.0, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddBoolParam(scip,
+         "relaxing/" RELAX_NAME "/storesol",
+         "should the primal point be stored as relaxation solution for primal heuristics?",
+         &relaxdata->storesol, FALSE, DEFAULT_STORESOL, NULL, NULL) );
+
+   return SCIP_OKAY;
+}
@@ -0,0 +1,65 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   relax_pdlp.h
+ * @ingroup RELAXATORS
+ * @brief  first-order LP relaxator based on the restarted primal-dual hybrid gradient method (PDLP)
+ *
+ * This relaxator approximately solves the LP relaxation of the current node by the restarted primal-dual hybrid
+ * gradient method, which only needs matrix-vector products with the constraint matrix and no factorization. It is
+ * meant for LP relaxations that are too large to be solved quickly by the simplex method. Several runs with different
+ * initial primal weights are executed in parallel, if a thread pool is available. The Lagrangian bound of the best dual
+ * iterate is a valid lower bound for the node, and the corresponding primal iterate is stored as relaxation solution
+ * that can be used by primal heuristics.
+ *
+ * The relaxator is disabled by default; set relaxing/pdlp/freq to 0 to call it in the root node.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#ifndef __SCIP_RELAX_PDLP_H__
+#define __SCIP_RELAX_PDLP_H__
+
+#include "scip/def.h"
+#include "scip/type_retcode.h"
+#include "scip/type_scip.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** creates the PDLP relaxator and includes it in SCIP
+ *
+ * @ingroup RelaxatorIncludes
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPincludeRelaxPdlp(
+   SCIP*                 scip                /**< SCIP data structure */
+   );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
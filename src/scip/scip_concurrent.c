@@ -43,6 +43,7 @@
 /*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
 
 #include "scip/concsolver.h"
+#include "scip/concurrent.h"
 #include "scip/debug.h"
 #include "scip/pub_message.h"
 #include "scip/scip_concurrent.h"
@@ -228,3 +229,46 @@ SCIP_SYNCSTORE* SCIPgetSyncstore(
 
    return scip->syncstore;
 }
+
+/** returns the number of threads that can be used by SCIPexecParallelJobs()
+ *
+ *  @return the value of parameter parallel/maxnthreads if a TPI is available that is not occupied by concurrent solvers,
+ *          and 1 otherwise
+ */
+int SCIPgetNParallelJobThreads(
+   SCIP*                 scip                /**< SCIP data structure */
+   )
+{
+   assert(scip != NULL);
+   assert(scip->set != NULL);
+
+   if( !SCIPconcurrentCanExecJobsParallel(scip->set->parallel_maxnthreads) )
+      return 1;
+
+   return scip->set->parallel_maxnthreads;
+}
+
+/** executes the given jobs, in parallel if a TPI is available that is not occupied by concurrent solvers, and one after
+ *  the other otherwise
+ *
+ *  The jobs may be executed in different threads than the calling one, see SCIP_DECL_PARALLELJOB for the restrictions
+ *  that apply to the job function. The method returns after all jobs have finished.
+ *
+ *  @return the smallest \ref SCIP_RETCODE "SCIP_RETCODE" returned by the jobs
+ */
+SCIP_RETCODE SCIPexecParallelJobs(
+   SCIP*                 scip,               /**< SCIP data structure */
+   int                   nthreads,           /**< maximal number of threads to use, or -1 to use parallel/maxnthreads */
+   SCIP_DECL_PARALLELJOB ((*jobfunc)),       /**< job function that is called for each job argument */
+   void**                jobargs,            /**< array with the arguments of the jobs */
+   int                   njobs               /**< number of jobs */
+   )
+{
+   assert(scip != NULL);
+   assert(scip->set != NULL);
+
+   if( nthreads < 0 )
+      nthreads = scip->set->parallel_maxnthreads;
+
+   return SCIPconcurrentExecJobs(nthreads, jobfunc, jobargs, njobs);
+}
@@ -43,6 +43,7 @@
 
 #include "scip/def.h"
 #include "scip/type_concsolver.h"
+#include "scip/type_concurrent.h"
 #include "scip/type_retcode.h"
 #include "scip/type_scip.h"
 #include "scip/type_syncstore.h"
@@ -186,6 +187,33 @@ SCIP_SYNCSTORE* SCIPgetSyncstore(
    SCIP*                 scip                /**< SCIP data structure */
    );
 
+/** returns the number of threads that can be used by SCIPexecParallelJobs()
+ *
+ *  @return the value of parameter parallel/maxnthreads if a TPI is available that is not occupied by concurrent solvers,
+ *          and 1 otherwise
+ */
+SCIP_EXPORT
+int SCIPgetNParallelJobThreads(
+   SCIP*                 scip                /**< SCIP data structure */
+   );
+
+/** executes the given jobs, in parallel if a TPI is available that is not occupied by concurrent solvers, and one after
+ *  the other otherwise
+ *
+ *  The jobs may be executed in different threads than the calling one, see SCIP_DECL_PARALLELJOB for the restrictions
+ *  that apply to the job function. The method returns after all jobs have finished.
+ *
+ *  @return the smallest \ref SCIP_RETCODE "SCIP_RETCODE" returned by the jobs
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPexecParallelJobs(
+   SCIP*                 scip,               /**< SCIP data structure */
+   int                   nthreads,           /**< maximal number of threads to use, or -1 to use parallel/maxnthreads */
+   SCIP_DECL_PARALLELJOB ((*jobfunc)),       /**< job function that is called for each job argument */
+   void**                jobargs,            /**< array with the arguments of the jobs */
+   int                   njobs               /**< number of jobs */
+   );
+
 /**@} */
 
 #ifdef __cplusplus
@@ -728,7 +728,7 @@ SCIP_RETCODE SCIPgetLPBInvRow(
       return SCIP_INVALIDCALL;
    }
 
-   SCIP_CALL( SCIPlpGetBInvRow(scip->lp, r, coefs, inds, ninds) );
+   SCIP_CALL( SCIPlpGetBInvRow(scip->lp, scip->mem->probmem, scip->set, scip->stat, r, coefs, inds, ninds) );
 
    /* debug check if the coef is the r-th line of the inverse matrix B^-1 */
    SCIP_CALL( SCIPdebugCheckBInvRow(scip, r, coefs) ); /*lint !e506 !e774*/
@@ -800,7 +800,46 @@ SCIP_RETCODE SCIPgetLPBInvARow(
       return SCIP_INVALIDCALL;
    }
 
-   SCIP_CALL( SCIPlpGetBInvARow(scip->lp, r, binvrow, coefs, inds, ninds) );
+   SCIP_CALL( SCIPlpGetBInvARow(scip->lp, scip->mem->probmem, scip->set, scip->stat, r, binvrow, coefs, inds, ninds) );
+
+   return SCIP_OKAY;
+}
+
+/** gets several rows of the product of inverse basis matrix B^-1 and coefficient matrix A (i.e. from B^-1 * A) at once
+ *
+ *  All rows are returned densely. The rows of B^-1 and B^-1 * A that were requested for the current LP solution are
+ *  kept in a cache, which is shared by all callers, e.g., by all tableau-based separators of a separation round, and
+ *  emptied when the state of the LP solver changes; rows that are requested again are copied from the cache instead of
+ *  being recomputed by the LP solver. Since the LP interface has no method to solve for several right hand sides at
+ *  once, the rows that are not cached are computed one after the other.
+ *
+ *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
+ *          SCIP_Retcode "SCIP_RETCODE" for a complete list of error codes.
+ *
+ *  @pre This method can be called if @p scip is in one of the following stages:
+ *       - \ref SCIP_STAGE_SOLVING
+ *
+ *  See \ref SCIP_Stage "SCIP_STAGE" for a complete list of all possible solving stages.
+ */
+SCIP_RETCODE SCIPgetLPBInvARows(
+   SCIP*                 scip,               /**< SCIP data structure */
+   int*                  rows,               /**< basis row numbers of the requested rows */
+   int                   nrows,              /**< number of requested rows */
+   SCIP_Real**           binvrows,           /**< array of nrows arrays of length SCIPgetNLPRows() to store the rows of
+                                              *   B^-1, or NULL */
+   SCIP_Real**           binvarows           /**< array of nrows arrays of length SCIPgetNLPCols() to store the rows of
+                                              *   B^-1 * A */
+   )
+{
+   SCIP_CALL( SCIPcheckStage(scip, "SCIPgetLPBInvARows", FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, TRUE, FALSE, FALSE, FALSE, FALSE) );
+
+   if( !SCIPlpIsSolBasic(scip->lp) )
+   {
+      SCIPerrorMessage("current LP solution is not basic\n");
+      return SCIP_INVALIDCALL;
+   }
+
+   SCIP_CALL( SCIPlpGetBInvARows(scip->lp, scip->mem->probmem, scip->set, scip->stat, rows, nrows, binvrows, binvarows) );
 
    return SCIP_OKAY;
 }
@@ -996,6 +1035,56 @@ SCIP_RETCODE SCIPgetLPI(
    return SCIP_OKAY;
 }
 
+/** creates a copy of the current LP in a new LP interface that can be solved independently of SCIP's LP, e.g., by
+ *  another thread
+ *
+ *  The columns and rows of the copy have the LP positions of SCIP's columns and rows; the constants of the rows are
+ *  moved to their sides. The LP is flushed before it is copied, and the copy uses the tolerances, scaling, and
+ *  presolving settings of the LP solver of SCIP's LP and only one thread.
+ *
+ *  @note the copy has to be freed with SCIPlpiFree() by the caller
+ *
+ *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
+ *          SCIP_Retcode "SCIP_RETCODE" for a complete list of error codes.
+ *
+ *  @pre This method can be called if @p scip is in one of the following stages:
+ *       - \ref SCIP_STAGE_SOLVING
+ *
+ *  See \ref SCIP_Stage "SCIP_STAGE" for a complete list of all possible solving stages.
+ */
+SCIP_RETCODE SCIPcreateLPICopy(
+   SCIP*                 scip,               /**< SCIP data structure */
+   const char*           name,               /**< name of the LP copy */
+   SCIP_Bool             copyobj,            /**< should the objective of the columns be copied? otherwise, the
+                                              *   objective of the copy is zero */
+   int*                  cstat,              /**< basis status of the LP columns to load into the copy, or NULL */
+   int*                  rstat,              /**< basis status of the LP rows to load into the copy, or NULL */
+   SCIP_LPI**            lpi                 /**< pointer to store the LP interface of the copy */
+   )
+{
+   SCIP_RETCODE retcode;
+
+   assert(lpi != NULL);
+   assert((cstat == NULL) == (rstat == NULL));
+
+   SCIP_CALL( SCIPcheckStage(scip, "SCIPcreateLPICopy", FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, TRUE, FALSE, FALSE, FALSE, FALSE) );
+
+   SCIP_CALL( SCIPlpFlush(scip->lp, scip->mem->probmem, scip->set, scip->transprob, scip->eventqueue) );
+   SCIP_CALL( SCIPlpCreateLPICopy(scip->lp, scip->set, scip->messagehdlr, name, copyobj, lpi) );
+
+   if( cstat != NULL )
+   {
+      retcode = SCIPlpiSetBase(*lpi, cstat, rstat);
+      if( retcode != SCIP_OKAY )
+      {
+         (void) SCIPlpiFree(lpi);
+         SCIP_CALL( retcode );
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
 /** displays quality information about the current LP solution. An LP solution need to be available; information printed
  *  is subject to what the LP solver supports
  *
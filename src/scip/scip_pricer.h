@@ -288,6 +288,38 @@ SCIP_RETCODE SCIPdeactivatePricer(
    SCIP_PRICER*          pricer              /**< variable pricer */
    );
 
+/** executes pricing jobs of a pricer, in parallel if a TPI is available, and adds the best found columns
+ *
+ *  This method is meant to be called from the reduced cost or Farkas pricing callback of a pricer whose pricing problem
+ *  decomposes into independent subproblems, e.g., one per resource. Each entry of jobdata is passed to one call of the
+ *  pricing job, which usually solves one subproblem w.r.t. a copy of the current dual values and stores the found
+ *  columns by SCIPpricingbufferAddCol() in its own buffer. Afterwards, the columns of all jobs are merged and the at
+ *  most maxcols columns with the most negative reduced costs are added by calling pricingaddcol in the calling thread.
+ *
+ *  Once maxcols columns with negative reduced costs were found, the remaining jobs are not started anymore, and
+ *  running jobs can stop early by checking SCIPpricingbufferIsStopped(). Each call starts with a different job, such
+ *  that all subproblems are considered in turn (partial pricing). If no column was added and complete is TRUE, then
+ *  all subproblems were solved without finding an improving column.
+ *
+ *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
+ *          SCIP_Retcode "SCIP_RETCODE" for a complete list of error codes.
+ *
+ *  @pre This method can be called if SCIP is in one of the following stages:
+ *       - \ref SCIP_STAGE_SOLVING
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPexecPricingJobs(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PRICER*          pricer,             /**< variable pricer */
+   SCIP_DECL_PRICINGJOB  ((*pricingjob)),    /**< pricing job that is executed for each job data */
+   SCIP_DECL_PRICINGADDCOL((*pricingaddcol)),/**< method to add a found column to the problem */
+   void**                jobdata,            /**< array with the data of the pricing jobs */
+   int                   njobs,              /**< number of pricing jobs */
+   int                   maxcols,            /**< maximal number of columns to add, or -1 for no limit */
+   int*                  naddedcols,         /**< pointer to store the number of added columns */
+   SCIP_Bool*            complete            /**< pointer to store whether all jobs were executed, or NULL */
+   );
+
 /** @} */
 
 #ifdef __cplusplus
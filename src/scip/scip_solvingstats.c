@@ -3150,8 +3150,8 @@ void SCIPprintPricerStatistics(
 
    SCIP_CALL_ABORT( SCIPcheckStage(scip, "SCIPprintPricerStatistics", FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, TRUE, TRUE, FALSE, FALSE, FALSE) );
 
-   SCIPmessageFPrintInfo(scip->messagehdlr, file, "Pricers            :   ExecTime  SetupTime      Calls       Vars\n");
-   SCIPmessageFPrintInfo(scip->messagehdlr, file, "  problem variables: %10.2f          - %10d %10d\n",
+   SCIPmessageFPrintInfo(scip->messagehdlr, file, "Pricers            :   ExecTime  SetupTime      Calls       Vars  Misprices\n");
+   SCIPmessageFPrintInfo(scip->messagehdlr, file, "  problem variables: %10.2f          - %10d %10d          -\n",
       SCIPpricestoreGetProbPricingTime(scip->pricestore),
       SCIPpricestoreGetNProbPricings(scip->pricestore),
       SCIPpricestoreGetNProbvarsFound(scip->pricestore));
@@ -3161,12 +3161,13 @@ void SCIPprintPricerStatistics(
 
    for( i = 0; i < scip->set->nactivepricers; ++i )
    {
-      SCIPmessageFPrintInfo(scip->messagehdlr, file, "  %-17.17s: %10.2f %10.2f %10d %10d\n",
+      SCIPmessageFPrintInfo(scip->messagehdlr, file, "  %-17.17s: %10.2f %10.2f %10d %10d %10d\n",
          SCIPpricerGetName(scip->set->pricers[i]),
          SCIPpricerGetTime(scip->set->pricers[i]),
          SCIPpricerGetSetupTime(scip->set->pricers[i]),
          SCIPpricerGetNCalls(scip->set->pricers[i]),
-         SCIPpricerGetNVarsFound(scip->set->pricers[i]));
+         SCIPpricerGetNVarsFound(scip->set->pricers[i]),
+         SCIPpricerGetNMisprices(scip->set->pricers[i]));
    }
 }
 
@@ -3438,6 +3439,19 @@ void SCIPprintLPStatistics(
       scip->stat->barrierzeroittime,
       scip->stat->nbarrierzeroitlps);
 
+   if( scip->stat->nconcurrentlps > 0 )
+   {
+      SCIPmessageFPrintInfo(scip->messagehdlr, file, "  concurrent root  : %10.2f %10" SCIP_LONGINT_FORMAT " %10" SCIP_LONGINT_FORMAT " %10.2f",
+         SCIPclockGetTime(scip->stat->concurrentlptime),
+         scip->stat->nconcurrentlps,
+         scip->stat->nconcurrentlpiterations,
+         (SCIP_Real)scip->stat->nconcurrentlpiterations/(SCIP_Real)scip->stat->nconcurrentlps);
+      if( SCIPclockGetTime(scip->stat->concurrentlptime) >= 0.01 )
+         SCIPmessageFPrintInfo(scip->messagehdlr, file, " %10.2f\n", (SCIP_Real)scip->stat->nconcurrentlpiterations/SCIPclockGetTime(scip->stat->concurrentlptime));
+      else
+         SCIPmessageFPrintInfo(scip->messagehdlr, file, "          -\n");
+   }
+
    SCIPmessageFPrintInfo(scip->messagehdlr, file, "  resolve instable : %10.2f %10" SCIP_LONGINT_FORMAT " %10" SCIP_LONGINT_FORMAT " %10.2f",
       SCIPclockGetTime(scip->stat->resolveinstablelptime),
       scip->stat->nresolveinstablelps,
@@ -3484,6 +3498,21 @@ void SCIPprintLPStatistics(
       SCIPmessageFPrintInfo(scip->messagehdlr, file, " %10.2f\n", (SCIP_Real)scip->stat->nconflictlpiterations/SCIPclockGetTime(scip->stat->conflictlptime));
    else
       SCIPmessageFPrintInfo(scip->messagehdlr, file, "          -\n");
+
+   if( scip->set->lp_deferrowcleanup )
+   {
+      SCIPmessageFPrintInfo(scip->messagehdlr, file, "LP Row Removal     :   Deferred  Performed  Rows Rem.  Avoid.Ref.\n");
+      SCIPmessageFPrintInfo(scip->messagehdlr, file, "  obsolete rows    : %10" SCIP_LONGINT_FORMAT " %10" SCIP_LONGINT_FORMAT " %10" SCIP_LONGINT_FORMAT " %10" SCIP_LONGINT_FORMAT "\n",
+         scip->stat->nrowremovalsdeferred, scip->stat->ndeferredrowremovals, scip->stat->ndeferredrowsdel,
+         scip->stat->navoidedrowrefactors);
+   }
+
+   if( scip->set->sepa_maxdegenstall >= 0.0 )
+   {
+      SCIPmessageFPrintInfo(scip->messagehdlr, file, "LP Degeneracy      :      Stops Est. Saved Its\n");
+      SCIPmessageFPrintInfo(scip->messagehdlr, file, "  separation stalls: %10" SCIP_LONGINT_FORMAT " %14" SCIP_LONGINT_FORMAT "\n",
+         scip->stat->ndegenstallstops, scip->stat->ndegenstallestsavedits);
+   }
 }
 
 /** outputs NLP statistics
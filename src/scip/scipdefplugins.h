@@ -44,6 +44,7 @@
 #include "scip/branch_fullstrong.h"
 #include "scip/branch_gomory.h"
 #include "scip/branch_inference.h"
+#include "scip/branch_learned.h"
 #include "scip/branch_leastinf.h"
 #include "scip/branch_lookahead.h"
 #include "scip/branch_mostinf.h"
@@ -114,6 +115,7 @@
 #include "scip/heur_farkasdiving.h"
 #include "scip/heur_feaspump.h"
 #include "scip/heur_fixandinfer.h"
+#include "scip/heur_fixandpropagate.h"
 #include "scip/heur_fracdiving.h"
 #include "scip/heur_gins.h"
 #include "scip/heur_guideddiving.h"
@@ -135,6 +137,7 @@
 #include "scip/heur_ofins.h"
 #include "scip/heur_oneopt.h"
 #include "scip/heur_padm.h"
+#include "scip/heur_paralleldiving.h"
 #include "scip/heur_pscostdiving.h"
 #include "scip/heur_proximity.h"
 #include "scip/heur_randrounding.h"
@@ -202,6 +205,7 @@
 #include "scip/prop_rootredcost.h"
 #include "scip/prop_symmetry.h"
 #include "scip/prop_vbounds.h"
+#include "scip/relax_pdlp.h"
 #include "scip/reader_bnd.h"
 #include "scip/reader_ccg.h"
 #include "scip/reader_cip.h"
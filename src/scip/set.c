@@ -241,6 +241,7 @@
 #define SCIP_DEFAULT_LP_CLEANUPCOLS       FALSE /**< should new non-basic columns be removed after LP solving? */
 #define SCIP_DEFAULT_LP_CLEANUPCOLSROOT   FALSE /**< should new non-basic columns be removed after root LP solving? */
 #define SCIP_DEFAULT_LP_CLEANUPROWS        TRUE /**< should new basic rows be removed after LP solving? */
+#define SCIP_DEFAULT_LP_DEFERROWCLEANUP   FALSE /**< should the removal of obsolete rows be deferred to the next node switch? */
 #define SCIP_DEFAULT_LP_CLEANUPROWSROOT    TRUE /**< should new basic rows be removed after root LP solving? */
 #define SCIP_DEFAULT_LP_CHECKSTABILITY     TRUE /**< should LP solver's return status be checked for stability? */
 #define SCIP_DEFAULT_LP_CONDITIONLIMIT     -1.0 /**< maximum condition number of LP basis counted as stable (-1.0: no limit) */
@@ -266,6 +267,9 @@
 #define SCIP_DEFAULT_LP_SOLUTIONPOLISHING     3 /**< LP solution polishing method (0: disabled, 1: only root, 2: always, 3: auto) */
 #define SCIP_DEFAULT_LP_REFACTORINTERVAL      0 /**< LP refactorization interval (0: automatic) */
 #define SCIP_DEFAULT_LP_ALWAYSGETDUALS    FALSE /**< should the dual solution always be collected */
+#define SCIP_DEFAULT_LP_CONCURRENTROOT    FALSE /**< should the initial root LP be solved concurrently by several LP algorithms? */
+#define SCIP_DEFAULT_LP_CONCURRENTALGOS   "dpc" /**< LP algorithms that are raced in the concurrent root LP solve ('p'rimal
+                                                 *   simplex, 'd'ual simplex, barrier with 'c'rossover) */
 
 /* NLP */
 
@@ -452,6 +456,8 @@
                                                  *   or integrality improvement in the root node (-1: no additional restriction) */
 #define SCIP_DEFAULT_SEPA_MAXSTALLROUNDS      1 /**< maximal number of consecutive separation rounds without objective
                                                  *   or integrality improvement in local nodes (-1: no additional restriction) */
+#define SCIP_DEFAULT_SEPA_MAXDEGENSTALL   -1.0 /**< minimal dual degeneracy rate of a stalling LP solution at which the
+                                                 *   separation loop is stopped (-1.0: never stop due to degeneracy) */
 #define SCIP_DEFAULT_SEPA_MAXCUTSGENFACTOR  2.0 /**< factor w.r.t. maxcuts for maximal number of cuts generated per separation round */
 #define SCIP_DEFAULT_SEPA_MAXCUTSROOTGENFACTOR 2.0 /**< factor w.r.t. maxcutsroot for maximal generated cuts at the root node */
 #define SCIP_DEFAULT_SEPA_MAXCUTS           100 /**< maximal number of cuts separated per separation round */
@@ -1239,6 +1245,7 @@ SCIP_RETCODE SCIPsetCreate(
    (*set)->extcodessize = 0;
    (*set)->visual_vbcfilename = NULL;
    (*set)->visual_bakfilename = NULL;
+   (*set)->lp_concurrentalgos = NULL;
    (*set)->nlp_solver = NULL;
    (*set)->nlp_disable = FALSE;
    (*set)->num_relaxfeastol = SCIP_INVALID;
@@ -1781,6 +1788,11 @@ SCIP_RETCODE SCIPsetCreate(
          "should new basic rows be removed after root LP solving?",
          &(*set)->lp_cleanuprowsroot, TRUE, SCIP_DEFAULT_LP_CLEANUPROWSROOT,
          NULL, NULL) );
+   SCIP_CALL( SCIPsetAddBoolParam(*set, messagehdlr, blkmem,
+         "lp/deferrowcleanup",
+         "should the removal of obsolete rows during node processing be deferred to the next node switch, where the LP is resolved anyway (the rows are removed if the node becomes a fork or pseudofork)?",
+         &(*set)->lp_deferrowcleanup, TRUE, SCIP_DEFAULT_LP_DEFERROWCLEANUP,
+         NULL, NULL) );
    SCIP_CALL( SCIPsetAddBoolParam(*set, messagehdlr, blkmem,
          "lp/checkstability",
          "should LP solver's return status be checked for stability?",
@@ -1893,6 +1905,16 @@ SCIP_RETCODE SCIPsetCreate(
          "should the Farkas duals always be collected when an LP is found to be infeasible?",
          &(*set)->lp_alwaysgetduals, FALSE, SCIP_DEFAULT_LP_ALWAYSGETDUALS,
          NULL, NULL) );
+   SCIP_CALL( SCIPsetAddBoolParam(*set, messagehdlr, blkmem,
+         "lp/concurrentroot",
+         "should the initial root LP be solved concurrently by several LP algorithms on copies of the LP (needs a TPI and parallel/maxnthreads > 1)?",
+         &(*set)->lp_concurrentroot, TRUE, SCIP_DEFAULT_LP_CONCURRENTROOT,
+         NULL, NULL) );
+   SCIP_CALL( SCIPsetAddStringParam(*set, messagehdlr, blkmem,
+         "lp/concurrentalgos",
+         "LP algorithms that are raced in the concurrent root LP solve, at most parallel/maxnthreads are used ('p'rimal simplex, 'd'ual simplex, barrier with 'c'rossover), each at most once",
+         &(*set)->lp_concurrentalgos, TRUE, SCIP_DEFAULT_LP_CONCURRENTALGOS,
+         NULL, NULL) );
 
    /* NLP parameters */
    SCIP_CALL( SCIPsetAddStringParam(*set, messagehdlr, blkmem,
@@ -2537,6 +2559,11 @@ SCIP_RETCODE SCIPsetCreate(
          "maximal number of consecutive separation rounds without objective or integrality improvement in the root node (-1: no additional restriction)",
          &(*set)->sepa_maxstallroundsroot, FALSE, SCIP_DEFAULT_SEPA_MAXSTALLROUNDSROOT, -1, INT_MAX,
          NULL, NULL) );
+   SCIP_CALL( SCIPsetAddRealParam(*set, messagehdlr, blkmem,
+         "separating/maxdegenstall",
+         "minimal dual degeneracy rate of the LP solution at which the first stalling separation round stops the separation loop (-1.0: never stop due to degeneracy)",
+         &(*set)->sepa_maxdegenstall, TRUE, SCIP_DEFAULT_SEPA_MAXDEGENSTALL, -1.0, 1.0,
+         NULL, NULL) );
    SCIP_CALL( SCIPsetAddIntParam(*set, messagehdlr, blkmem,
          "separating/maxcuts",
          "maximal number of cuts separated per separation round (0: disable local separation)",
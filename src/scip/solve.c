@@ -2316,7 +2316,7 @@ SCIP_RETCODE SCIPpriceLoop(
       stoppricing = FALSE;
       for( p = 0; p < set->nactivepricers && !enoughvars; ++p )
       {
-         SCIP_CALL( SCIPpricerExec(set->pricers[p], set, transprob, lp, pricestore, &lb, &stopearly, &result) );
+         SCIP_CALL( SCIPpricerExec(set->pricers[p], set, transprob, lp, tree, pricestore, &lb, &stopearly, &result) );
          assert(result == SCIP_DIDNOTRUN || result == SCIP_SUCCESS);
          SCIPsetDebugMsg(set, "pricing: pricer %s returned result = %s, lowerbound = %f\n",
             SCIPpricerGetName(set->pricers[p]), (result == SCIP_DIDNOTRUN ? "didnotrun" : "success"), lb);
@@ -2907,10 +2907,12 @@ SCIP_RETCODE priceAndCutLoop(
 
                if( !(*cutoff) )
                {
+                  SCIP_Longint oldnlpiterations;
                   SCIP_Real lpobjval;
 
                   /* solve LP (with dual simplex) */
                   SCIPsetDebugMsg(set, "separation: solve LP\n");
+                  oldnlpiterations = stat->nlpiterations;
                   SCIP_CALL( SCIPlpSolveAndEval(lp, set, messagehdlr, blkmem, stat, eventqueue, eventfilter, transprob,
                         set->lp_iterlim, FALSE, TRUE, FALSE, lperror) );
                   assert(lp->flushed);
@@ -2965,6 +2967,39 @@ SCIP_RETCODE priceAndCutLoop(
                             objreldiff <= 1e-04 &&
                             nfracs >= (0.9 - 0.1 * nsepastallrounds) * stallnfracs);
 
+                        /* on a dual degenerate LP, the following stalling rounds are likely to spend their iterations in
+                         * degenerate pivots, such that we already stop separation at the first stalling round
+                         */
+                        if( stalling && set->sepa_maxdegenstall >= 0.0 && nsepastallrounds < maxnsepastallrounds - 1 )
+                        {
+                           SCIP_Real degeneracy;
+                           SCIP_Real varconsratio;
+
+                           SCIP_CALL( SCIPlpGetDualDegeneracy(lp, set, stat, &degeneracy, &varconsratio) );
+
+                           if( degeneracy >= set->sepa_maxdegenstall )
+                           {
+                              int nskippedrounds;
+
+                              /* estimate the saved iterations by the iterations of the current round */
+                              nskippedrounds = (maxnsepastallrounds == INT_MAX ? 1 : maxnsepastallrounds - nsepastallrounds - 1);
+                              nskippedrounds = MIN(nskippedrounds, maxseparounds - stat->nseparounds - 1);
+
+                              SCIPsetDebugMsg(set, " -> LP stalls with dual degeneracy %g: stop separation\n", degeneracy);
+
+                              /* the saved iterations are only estimated by assuming that each skipped round would have
+                               * needed as many iterations as the last one
+                               */
+                              if( nskippedrounds > 0 )
+                              {
+                                 SCIPstatIncrement(stat, set, ndegenstallstops);
+                                 SCIPstatAdd(stat, set, ndegenstallestsavedits,
+                                    nskippedrounds * (stat->nlpiterations - oldnlpiterations));
+                              }
+                              nsepastallrounds = maxnsepastallrounds - 1;
+                           }
+                        }
+
                         stalllpobjval = lpobjval;
                         stallnfracs = nfracs;
                      }  /*lint !e438*/
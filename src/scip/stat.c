@@ -74,6 +74,7 @@ SCIP_RETCODE SCIPstatCreate(
    SCIP_CALL( SCIPclockCreate(&(*stat)->duallptime, SCIP_CLOCKTYPE_DEFAULT) );
    SCIP_CALL( SCIPclockCreate(&(*stat)->lexduallptime, SCIP_CLOCKTYPE_DEFAULT) );
    SCIP_CALL( SCIPclockCreate(&(*stat)->barrierlptime, SCIP_CLOCKTYPE_DEFAULT) );
+   SCIP_CALL( SCIPclockCreate(&(*stat)->concurrentlptime, SCIP_CLOCKTYPE_DEFAULT) );
    SCIP_CALL( SCIPclockCreate(&(*stat)->resolveinstablelptime, SCIP_CLOCKTYPE_DEFAULT) );
    SCIP_CALL( SCIPclockCreate(&(*stat)->divinglptime, SCIP_CLOCKTYPE_DEFAULT) );
    SCIP_CALL( SCIPclockCreate(&(*stat)->strongbranchtime, SCIP_CLOCKTYPE_DEFAULT) );
@@ -127,6 +128,7 @@ SCIP_RETCODE SCIPstatFree(
    SCIPclockFree(&(*stat)->duallptime);
    SCIPclockFree(&(*stat)->lexduallptime);
    SCIPclockFree(&(*stat)->barrierlptime);
+   SCIPclockFree(&(*stat)->concurrentlptime);
    SCIPclockFree(&(*stat)->resolveinstablelptime);
    SCIPclockFree(&(*stat)->divinglptime);
    SCIPclockFree(&(*stat)->strongbranchtime);
@@ -203,6 +205,7 @@ void SCIPstatReset(
    SCIPclockReset(stat->duallptime);
    SCIPclockReset(stat->lexduallptime);
    SCIPclockReset(stat->barrierlptime);
+   SCIPclockReset(stat->concurrentlptime);
    SCIPclockReset(stat->resolveinstablelptime);
    SCIPclockReset(stat->divinglptime);
    SCIPclockReset(stat->strongbranchtime);
@@ -228,6 +231,7 @@ void SCIPstatReset(
    stat->nduallpiterations = 0;
    stat->nlexduallpiterations = 0;
    stat->nbarrierlpiterations = 0;
+   stat->nconcurrentlpiterations = 0;
    stat->nprimalresolvelpiterations = 0;
    stat->ndualresolvelpiterations = 0;
    stat->nlexdualresolvelpiterations = 0;
@@ -281,6 +285,13 @@ void SCIPstatReset(
    stat->ndualzeroitlps = 0;
    stat->nlexduallps = 0;
    stat->nbarrierlps = 0;
+   stat->nconcurrentlps = 0;
+   stat->nrowremovalsdeferred = 0;
+   stat->ndeferredrowremovals = 0;
+   stat->ndeferredrowsdel = 0;
+   stat->navoidedrowrefactors = 0;
+   stat->ndegenstallstops = 0;
+   stat->ndegenstallestsavedits = 0;
    stat->nbarrierzeroitlps = 0;
    stat->nprimalresolvelps = 0;
    stat->ndualresolvelps = 0;
@@ -758,6 +769,7 @@ void SCIPstatEnableOrDisableStatClocks(
    SCIPclockEnableOrDisable(stat->duallptime, enable);
    SCIPclockEnableOrDisable(stat->lexduallptime, enable);
    SCIPclockEnableOrDisable(stat->barrierlptime, enable);
+   SCIPclockEnableOrDisable(stat->concurrentlptime, enable);
    SCIPclockEnableOrDisable(stat->resolveinstablelptime, enable);
    SCIPclockEnableOrDisable(stat->divinglptime, enable);
    SCIPclockEnableOrDisable(stat->strongbranchtime, enable);
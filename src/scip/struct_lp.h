@@ -298,6 +298,10 @@ struct SCIP_Lp
    SCIP_ROW**            lpirows;            /**< array with rows currently stored in the LP solver */
    SCIP_COL**            chgcols;            /**< array of changed columns not yet applied to the LP solver */
    SCIP_ROW**            chgrows;            /**< array of changed rows not yet applied to the LP solver */
+   SCIP_Real**           tabcachebinvrows;   /**< cached dense rows of B^-1 of the current LP solution, indexed by basis row,
+                                              *   or NULL for rows that were not requested yet */
+   SCIP_Real**           tabcachebinvarows;  /**< cached dense rows of B^-1 * A of the current LP solution, indexed by basis
+                                              *   row, or NULL for rows that were not requested yet */
    SCIP_COL**            cols;               /**< array with current LP columns in correct order */
    SCIP_COL**            lazycols;           /**< array with current LP lazy columns */
    SCIP_ROW**            rows;               /**< array with current LP rows in correct order */
@@ -313,6 +317,10 @@ struct SCIP_Lp
    SCIP_Longint          validsoldirlp;      /**< LP number for which the currently stored solution direction vector is valid */
    SCIP_Longint          validdegeneracylp;  /**< LP number for which the currently stored degeneracy information is valid */
    SCIP_Longint          divenolddomchgs;    /**< number of domain changes before diving has started */
+   SCIP_Longint          tabcachestamp;      /**< value of lpistamp for which the cached tableau rows are valid, or -1 */
+   SCIP_Longint          lpistamp;           /**< counter that is increased whenever the state of the LP solver changes */
+   SCIP_Longint          tabcachememsize;    /**< number of values stored in the tableau row cache */
+   SCIP_Longint          deferredcleanupnode;/**< node number at which the removal of obsolete rows was deferred, or -1 */
    int                   lpicolssize;        /**< available slots in lpicols vector */
    int                   nlpicols;           /**< number of columns in the LP solver */
    int                   lpifirstchgcol;     /**< first column of the LP which differs from the column in the LP solver */
@@ -320,9 +328,13 @@ struct SCIP_Lp
    int                   nlpirows;           /**< number of rows in the LP solver */
    int                   lpifirstchgrow;     /**< first row of the LP which differs from the row in the LP solver */
    int                   chgcolssize;        /**< available slots in chgcols vector */
+   int                   tabcachenrows;      /**< number of LP rows the tableau row cache was set up for */
+   int                   tabcachencols;      /**< number of LP columns the tableau row cache was set up for */
    int                   nchgcols;           /**< current number of chgcols (number of used slots in chgcols vector) */
    int                   chgrowssize;        /**< available slots in chgrows vector */
    int                   nchgrows;           /**< current number of chgrows (number of used slots in chgrows vector) */
+   int                   ndeferredobsoletes; /**< number of obsolete rows seen at the last deferral of their removal at the
+                                              *   node stored in deferredcleanupnode */
    int                   colssize;           /**< available slots in cols vector */
    int                   soldirectionsize;   /**< available slots in soldirection vector */
    int                   ncols;              /**< current number of LP columns (number of used slots in cols vector) */
@@ -301,6 +301,80 @@ struct SCIP_RowPrep
    SCIP_Bool             modifiedside;       /**< whether the side was modified (relaxed) by cleanup */
 };
 
+/** regression forest; the nodes of all trees are stored consecutively, children lie in the same tree as their parent */
+struct SCIP_RegForest
+{
+   int                   ntrees;             /**< number of trees in this forest */
+   int                   dim;                /**< feature dimension */
+   int*                  nbegin;             /**< array of root node indices of each tree */
+   int*                  child;              /**< child index pair of each internal node relative to the root of its
+                                              *   tree, or (-1, -1) for leaves */
+   int*                  splitidx;           /**< data index for split at node, or -1 at a leaf */
+   SCIP_Real*            value;              /**< split position at internal nodes, prediction at leaves */
+   int                   size;               /**< length of node arrays */
+};
+
+/** compressed sparse row and column copy of linear rows with the bounds and activities that all workers start from;
+ *  the data is only read by the workers
+ */
+struct SCIP_LinProp
+{
+   int*                  rowbeg;             /**< start of the rows in rowcols and rowvals, with an entry for nrows */
+   int*                  rowcols;            /**< column indices of the rows */
+   SCIP_Real*            rowvals;            /**< coefficients of the rows */
+   int*                  colbeg;             /**< start of the columns in colrows and colvals, with an entry for ncols */
+   int*                  colrows;            /**< row indices of the columns */
+   SCIP_Real*            colvals;            /**< coefficients of the columns */
+   SCIP_Real*            lhs;                /**< left hand sides, or -infinity */
+   SCIP_Real*            rhs;                /**< right hand sides, or infinity */
+   SCIP_Real*            lb;                 /**< lower bounds of the columns */
+   SCIP_Real*            ub;                 /**< upper bounds of the columns */
+   SCIP_Real*            minact;             /**< finite part of the minimal activities of the rows */
+   SCIP_Real*            maxact;             /**< finite part of the maximal activities of the rows */
+   int*                  nmininf;            /**< number of infinite contributions to the minimal activities */
+   int*                  nmaxinf;            /**< number of infinite contributions to the maximal activities */
+   SCIP_Real*            actmag;             /**< sum of the largest absolute finite contributions of the columns to the
+                                              *   activities of the rows, which bounds the magnitude of all activities */
+   SCIP_Bool*            isint;              /**< is the column of integral type? */
+   SCIP_Real             infinity;           /**< value for infinity */
+   SCIP_Real             feastol;            /**< feasibility tolerance */
+   SCIP_Real             epsilon;            /**< absolute values smaller than this are considered zero */
+   int                   nrows;              /**< number of rows */
+   int                   ncols;              /**< number of columns */
+};
+
+/** thread-local bounds and activities of a worker, with a trail to undo the changes of the last fixing */
+struct SCIP_LinPropWorker
+{
+   SCIP_LINPROP*         linprop;            /**< shared rows */
+   SCIP_Real*            lb;                 /**< current lower bounds */
+   SCIP_Real*            ub;                 /**< current upper bounds */
+   SCIP_Real*            minact;             /**< finite part of the current minimal activities */
+   SCIP_Real*            maxact;             /**< finite part of the current maximal activities */
+   int*                  nmininf;            /**< number of infinite contributions to the minimal activities */
+   int*                  nmaxinf;            /**< number of infinite contributions to the maximal activities */
+   int*                  nactupdates;        /**< number of incremental updates of the activities since they were last
+                                              *   computed from scratch */
+   int*                  colstamp;           /**< last fixing in which the column was changed */
+   int*                  rowstamp;           /**< last fixing in which the row was changed */
+   int*                  rowqueued;          /**< last fixing in which the row was queued and not yet processed */
+   int*                  coltrail;           /**< columns changed by the last fixing */
+   SCIP_Real*            coltraillb;         /**< lower bounds of the changed columns before the fixing */
+   SCIP_Real*            coltrailub;         /**< upper bounds of the changed columns before the fixing */
+   int*                  rowtrail;           /**< rows changed by the last fixing */
+   SCIP_Real*            rowtrailminact;     /**< minimal activities of the changed rows before the fixing */
+   SCIP_Real*            rowtrailmaxact;     /**< maximal activities of the changed rows before the fixing */
+   int*                  rowtrailnmininf;    /**< infinite contributions to the minimal activities before the fixing */
+   int*                  rowtrailnmaxinf;    /**< infinite contributions to the maximal activities before the fixing */
+   int*                  queue;              /**< queue of rows to propagate */
+   int                   ncoltrail;          /**< number of changed columns */
+   int                   nrowtrail;          /**< number of changed rows */
+   int                   queuefirst;         /**< first queued row */
+   int                   nqueued;            /**< number of queued rows */
+   int                   fixing;             /**< number of the current fixing */
+   int                   work;               /**< number of nonzeros processed in the current fixing */
+};
+
 #ifdef __cplusplus
 }
 #endif
@@ -37,6 +37,7 @@
 #include "scip/def.h"
 #include "scip/type_clock.h"
 #include "scip/type_pricer.h"
+#include "tpi/type_tpi.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -61,12 +62,53 @@ struct SCIP_Pricer
    int                   priority;           /**< priority of the variable pricer */
    int                   ncalls;             /**< number of times, this pricer was called */
    int                   nvarsfound;         /**< number of variables priced in found so far by this pricer */
+   SCIP_Real*            centerduals;        /**< dual values of the stabilization center, indexed by LP position */
+   int*                  centerrowidx;       /**< indices of the rows the center dual values belong to */
+   SCIP_Real*            stabduals;          /**< stabilized dual values of the current pricing call, indexed by LP position */
+   SCIP_Real             smoothing;          /**< smoothing factor for the dual values (0.0: no stabilization) */
+   SCIP_Real             centerbound;        /**< Lagrangian bound of the stabilization center */
+   SCIP_Longint          centernode;         /**< number of the node the stabilization center belongs to */
+   int                   ncenterduals;       /**< number of center dual values */
+   int                   nstabduals;         /**< number of stabilized dual values, or 0 if raw dual values are used */
+   int                   dualssize;          /**< size of the centerduals, centerrowidx, and stabduals arrays */
+   int                   nmisprices;         /**< number of misprices, i.e., pricing calls with stabilized dual values that
+                                              *   did not find a column, such that the smoothing had to be reduced */
+   int                   jobstart;           /**< index of the pricing job to start with in the next call of
+                                              *   SCIPexecPricingJobs() (partial pricing) */
    SCIP_Bool             delay;              /**< should the pricer be delayed until no other pricers or already existing
                                               *   problem variables with negative reduced costs are found */
+   SCIP_Bool             lagrangianbound;    /**< is the lower bound returned by the pricer a Lagrangian bound for the
+                                              *   (stabilized) dual values it used? */
    SCIP_Bool             active;             /**< is variable pricer in use for the current problem? */
    SCIP_Bool             initialized;        /**< is variable pricer initialized? */
 };
 
+/** column found by a parallel pricing job */
+struct SCIP_PricingCol
+{
+   void*                 data;               /**< copy of the column data given by the pricing job */
+   SCIP_Real             redcost;            /**< reduced cost of the column */
+};
+
+/** thread-local column buffer of a parallel pricing job
+ *
+ *  The columns are only accessed by the thread that executes the job; the counter of columns with negative reduced
+ *  costs is shared by all buffers of one SCIPexecPricingJobs() call and protected by the lock.
+ */
+struct SCIP_PricingBuffer
+{
+   SCIP_PRICINGCOL*      cols;               /**< columns found by the job */
+   void*                 jobdata;            /**< data of the pricing job */
+   SCIP_DECL_PRICINGJOB  ((*pricingjob));    /**< pricing job */
+   SCIP_LOCK*            lock;               /**< lock protecting the shared counter */
+   int*                  nfound;             /**< shared number of columns with negative reduced costs in all buffers */
+   SCIP_Real             redcosttol;         /**< columns with reduced cost below -redcosttol count as improving */
+   int                   ncols;              /**< number of columns found by the job */
+   int                   colssize;           /**< size of cols array */
+   int                   maxcols;            /**< number of improving columns after which all jobs should stop */
+   SCIP_Bool             executed;           /**< was the job executed, i.e., not skipped because of early termination? */
+};
+
 #ifdef __cplusplus
 }
 #endif
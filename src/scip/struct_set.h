@@ -350,6 +350,8 @@ struct SCIP_Set
    SCIP_Bool             lp_cleanupcolsroot; /**< should new non-basic columns be removed after root LP solving? */
    SCIP_Bool             lp_cleanuprows;     /**< should new basic rows be removed after LP solving? */
    SCIP_Bool             lp_cleanuprowsroot; /**< should new basic rows be removed after root LP solving? */
+   SCIP_Bool             lp_deferrowcleanup; /**< should the removal of obsolete rows during node processing be deferred to
+                                              *   the next node switch? */
    SCIP_Bool             lp_checkstability;  /**< should LP solver's return status be checked for stability? */
    SCIP_Real             lp_conditionlimit;  /**< maximum condition number of LP basis counted as stable (-1.0: no check) */
    SCIP_Real             lp_markowitz;       /**< minimal Markowitz threshold to control sparsity/stability in LU factorization */
@@ -374,6 +376,9 @@ struct SCIP_Set
    int                   lp_solutionpolishing;/**< LP solution polishing method (0: disabled, 1: only root, 2: always, 3: auto) */
    int                   lp_refactorinterval;/**< LP refactorization interval (0: automatic) */
    SCIP_Bool             lp_alwaysgetduals;  /**< should the dual solution always be collected for LP solutions. */
+   SCIP_Bool             lp_concurrentroot;  /**< should the initial root LP be solved concurrently by several LP algorithms? */
+   char*                 lp_concurrentalgos; /**< LP algorithms that are raced in the concurrent root LP solve ('p'rimal simplex,
+                                              *   'd'ual simplex, barrier with 'c'rossover) */
 
    /* NLP settings */
    SCIP_Bool             nlp_disable;        /**< should the NLP be disabled even if a constraint handler enabled it? */
@@ -564,6 +569,8 @@ struct SCIP_Set
                                               *   or integrality improvement (-1: no additional restriction) */
    int                   sepa_maxstallroundsroot;/**< maximal number of consecutive separation rounds without objective
                                               *   or integrality improvement (-1: no additional restriction) */
+   SCIP_Real             sepa_maxdegenstall; /**< minimal dual degeneracy rate of a stalling LP solution at which the
+                                              *   separation loop is stopped (-1.0: never stop due to degeneracy) */
    SCIP_Real             sepa_maxcutsgenfactor; /**< factor w.r.t. maxcuts for maximal number of cuts generated per
                                                  * separation round (-1.0: no limit, >= 0.0: valid finite limit) */
    SCIP_Real             sepa_maxcutsrootgenfactor; /**< factor w.r.t. maxcutsroot for maximal number of generated cuts
@@ -66,6 +66,7 @@ struct SCIP_Stat
    SCIP_Longint          nduallpiterations;  /**< number of iterations in dual simplex */
    SCIP_Longint          nlexduallpiterations;/**< number of iterations in lexicographic dual simplex */
    SCIP_Longint          nbarrierlpiterations;/**< number of iterations in barrier algorithm */
+   SCIP_Longint          nconcurrentlpiterations;/**< number of iterations of the winners of concurrent root LP solves */
    SCIP_Longint          nprimalresolvelpiterations;  /**< number of primal LP iterations with advanced start basis */
    SCIP_Longint          ndualresolvelpiterations;    /**< number of dual LP iterations with advanced start basis */
    SCIP_Longint          nlexdualresolvelpiterations; /**< number of lexicographic dual LP iterations with advanced start basis */
@@ -165,6 +166,7 @@ struct SCIP_Stat
    SCIP_CLOCK*           duallptime;         /**< dual LP solution time */
    SCIP_CLOCK*           lexduallptime;      /**< lexicographic dual LP solution time */
    SCIP_CLOCK*           barrierlptime;      /**< barrier LP solution time */
+   SCIP_CLOCK*           concurrentlptime;   /**< concurrent root LP solution time */
    SCIP_CLOCK*           resolveinstablelptime;/**< LP solution time for taking care of instable LPs */
    SCIP_CLOCK*           divinglptime;       /**< diving and probing LP solution time */
    SCIP_CLOCK*           strongbranchtime;   /**< strong branching time */
@@ -197,6 +199,19 @@ struct SCIP_Stat
    SCIP_Longint          ndualzeroitlps;     /**< number of dual LPs with 0 iterations */
    SCIP_Longint          nlexduallps;        /**< number of lexicographic dual LPs solved */
    SCIP_Longint          nbarrierlps;        /**< number of barrier LPs solved with at least 1 iteration */
+   SCIP_Longint          nconcurrentlps;     /**< number of concurrent root LP solves that provided a starting basis */
+   SCIP_Longint          nrowremovalsdeferred;/**< number of times the removal of obsolete rows during node processing was
+                                              *   deferred; this does not count avoided refactorizations */
+   SCIP_Longint          ndeferredrowremovals;/**< number of deferred removals of obsolete rows performed when the focus node
+                                              *   was converted into a fork or pseudofork */
+   SCIP_Longint          ndeferredrowsdel;   /**< number of obsolete rows removed by deferred row removals */
+   SCIP_Longint          navoidedrowrefactors;/**< number of LP refactorizations avoided by deferring the removal of obsolete
+                                              *   rows, i.e., removals during node processing that were merged into a
+                                              *   pending one or that were dropped together with the rows of the node */
+   SCIP_Longint          ndegenstallstops;   /**< number of separation loops stopped due to stalling on a dual degenerate LP */
+   SCIP_Longint          ndegenstallestsavedits;/**< estimated number of LP iterations saved by stopping separation loops on
+                                              *   dual degenerate LPs: the skipped rounds times the iterations of the
+                                              *   last round; no LP is solved to verify this */
    SCIP_Longint          nbarrierzeroitlps;  /**< number of barrier LPs with 1 iteration */
    SCIP_Longint          nprimalresolvelps;  /**< number of primal LPs solved with advanced start basis and at least 1 iteration */
    SCIP_Longint          ndualresolvelps;    /**< number of dual LPs solved with advanced start basis and at least 1 iteration */
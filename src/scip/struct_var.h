@@ -126,7 +126,9 @@ struct SCIP_BdChgInfo
    unsigned int          redundant:1;        /**< does the bound change info belong to a redundant bound change? */
 };
 
-/** tracks changes of the variables' domains (static arrays, bound changes only) */
+/** tracks changes of the variables' domains (static arrays, bound changes only); the bound changes are stored in the
+ *  same memory block directly behind this structure
+ */
 struct SCIP_DomChgBound
 {
    unsigned int          nboundchgs:30;      /**< number of bound changes (must be first structure entry!) */
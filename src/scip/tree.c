@@ -3974,6 +3974,9 @@ SCIP_RETCODE focusnodeToDeadend(
    SCIPsetDebugMsg(set, "focusnode #%" SCIP_LONGINT_FORMAT " to dead-end at depth %d\n",
       SCIPnodeGetNumber(tree->focusnode), SCIPnodeGetDepth(tree->focusnode));
 
+   /* the rows created at this node are removed from the LP at the next path switch */
+   SCIPlpDiscardDeferredObsoletes(lp, set, stat);
+
    /* remove variables from the problem that are marked as deletable and were created at this node */
    SCIP_CALL( focusnodeCleanupVars(blkmem, set, stat, eventqueue, transprob, origprob, tree, reopt, lp, branchcand, cliquetable, TRUE) );
 
@@ -4013,6 +4016,9 @@ SCIP_RETCODE focusnodeToLeaf(
    SCIPsetDebugMsg(set, "focusnode #%" SCIP_LONGINT_FORMAT " to leaf at depth %d\n",
       SCIPnodeGetNumber(tree->focusnode), SCIPnodeGetDepth(tree->focusnode));
 
+   /* the rows created at this node are removed from the LP at the next path switch */
+   SCIPlpDiscardDeferredObsoletes(lp, set, stat);
+
    SCIP_CALL( nodeToLeaf(&tree->focusnode, blkmem, set, stat, eventfilter, eventqueue, tree, reopt, lp, lpstatefork, cutoffbound));
 
    return SCIP_OKAY;
@@ -4023,6 +4029,7 @@ static
 SCIP_RETCODE focusnodeToJunction(
    BMS_BLKMEM*           blkmem,             /**< block memory buffers */
    SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< dynamic problem statistics */
    SCIP_EVENTQUEUE*      eventqueue,         /**< event queue */
    SCIP_TREE*            tree,               /**< branch and bound tree */
    SCIP_LP*              lp                  /**< current LP data */
@@ -4038,6 +4045,9 @@ SCIP_RETCODE focusnodeToJunction(
    SCIPsetDebugMsg(set, "focusnode #%" SCIP_LONGINT_FORMAT " to junction at depth %d\n",
       SCIPnodeGetNumber(tree->focusnode), SCIPnodeGetDepth(tree->focusnode));
 
+   /* a junction does not store the rows created at this node */
+   SCIPlpDiscardDeferredObsoletes(lp, set, stat);
+
    /* convert node into junction */
    tree->focusnode->nodetype = SCIP_NODETYPE_JUNCTION; /*lint !e641*/
 
@@ -4062,6 +4072,7 @@ SCIP_RETCODE focusnodeToPseudofork(
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_STAT*            stat,               /**< dynamic problem statistics */
    SCIP_EVENTQUEUE*      eventqueue,         /**< event queue */
+   SCIP_EVENTFILTER*     eventfilter,        /**< global event filter */
    SCIP_PROB*            transprob,          /**< transformed problem after presolve */
    SCIP_PROB*            origprob,           /**< original problem */
    SCIP_TREE*            tree,               /**< branch and bound tree */
@@ -4085,6 +4096,11 @@ SCIP_RETCODE focusnodeToPseudofork(
    SCIPsetDebugMsg(set, "focusnode #%" SCIP_LONGINT_FORMAT " to pseudofork at depth %d\n",
       SCIPnodeGetNumber(tree->focusnode), SCIPnodeGetDepth(tree->focusnode));
 
+   /* remove obsolete rows whose removal was deferred during node processing, since the pseudofork keeps the rows
+    * created at this node
+    */
+   SCIP_CALL( SCIPlpRemoveDeferredObsoletes(lp, blkmem, set, stat, eventqueue, eventfilter) );
+
    /* remove variables from the problem that are marked as deletable and were created at this node */
    SCIP_CALL( focusnodeCleanupVars(blkmem, set, stat, eventqueue, transprob, origprob, tree, reopt, lp, branchcand, cliquetable, FALSE) );
 
@@ -4147,6 +4163,9 @@ SCIP_RETCODE focusnodeToFork(
    lperror = FALSE;
    if( !lp->resolvelperror && SCIPlpGetSolstat(lp) == SCIP_LPSOLSTAT_OPTIMAL )
    {
+      /* remove obsolete rows whose removal was deferred during node processing */
+      SCIP_CALL( SCIPlpRemoveDeferredObsoletes(lp, blkmem, set, stat, eventqueue, eventfilter) );
+
       /* clean up newly created part of LP to keep only necessary columns and rows */
       SCIP_CALL( SCIPlpCleanupNew(lp, blkmem, set, stat, eventqueue, eventfilter, (tree->focusnode->depth == 0)) );
 
@@ -4180,7 +4199,7 @@ SCIP_RETCODE focusnodeToFork(
       SCIP_CALL( SCIPlpShrinkRows(lp, blkmem, set, eventqueue, eventfilter, SCIPlpGetNRows(lp) - SCIPlpGetNNewrows(lp)) );
 
       /* convert node into a junction */
-      SCIP_CALL( focusnodeToJunction(blkmem, set, eventqueue, tree, lp) );
+      SCIP_CALL( focusnodeToJunction(blkmem, set, stat, eventqueue, tree, lp) );
 
       return SCIP_OKAY;
    }
@@ -4301,7 +4320,7 @@ SCIP_RETCODE focusnodeToSubroot(
       SCIP_CALL( SCIPlpShrinkRows(lp, blkmem, set, eventqueue, eventfilter, SCIPlpGetNRows(lp) - SCIPlpGetNNewrows(lp)) );
 
       /* convert node into a junction */
-      SCIP_CALL( focusnodeToJunction(blkmem, set, eventqueue, tree, lp) );
+      SCIP_CALL( focusnodeToJunction(blkmem, set, stat, eventqueue, tree, lp) );
 
       return SCIP_OKAY;
    }
@@ -4691,7 +4710,7 @@ SCIP_RETCODE SCIPnodeFocus(
       else if( tree->focuslpconstructed && (SCIPlpGetNNewcols(lp) > 0 || SCIPlpGetNNewrows(lp) > 0) )
       {
          /* convert old focus node into pseudofork */
-         SCIP_CALL( focusnodeToPseudofork(blkmem, set, stat, eventqueue, transprob, origprob, tree, reopt, lp,
+         SCIP_CALL( focusnodeToPseudofork(blkmem, set, stat, eventqueue, eventfilter, transprob, origprob, tree, reopt, lp,
                branchcand, cliquetable) );
          assert(SCIPnodeGetType(tree->focusnode) == SCIP_NODETYPE_PSEUDOFORK);
 
@@ -4714,7 +4733,7 @@ SCIP_RETCODE SCIPnodeFocus(
          SCIPlpMarkSize(lp);
 
          /* convert old focus node into junction */
-         SCIP_CALL( focusnodeToJunction(blkmem, set, eventqueue, tree, lp) );
+         SCIP_CALL( focusnodeToJunction(blkmem, set, stat, eventqueue, tree, lp) );
       }
    }
    else if( tree->focusnode != NULL )
@@ -40,6 +40,17 @@ extern "C" {
 
 typedef struct SCIP_Concurrent SCIP_CONCURRENT;     /**< scip data required for concurrent solve */
 
+/** job function that is executed by SCIPexecParallelJobs()
+ *
+ *  The job is possibly executed in a different thread than the one that owns the SCIP instance. It must therefore not
+ *  use SCIP's block or buffer memory, must not change any SCIP data structures, and must only work on the data that
+ *  is given in its argument.
+ *
+ *  input:
+ *  - jobarg          : the argument that was passed together with the job
+ */
+#define SCIP_DECL_PARALLELJOB(x) SCIP_RETCODE x (void* jobarg)
+
 #ifdef __cplusplus
 }
 #endif
@@ -171,6 +171,21 @@ typedef struct SCIP_DisjointSet SCIP_DISJOINTSET;
  */
 typedef struct SCIP_RowPrep SCIP_ROWPREP;
 
+/** regression forest data structure that predicts a value as the average of the leaf values of several regression
+ *  trees; read from a file in RFCSV format
+ */
+typedef struct SCIP_RegForest SCIP_REGFOREST;
+
+/** sparse copy of linear rows with bounds and activities for a fast propagation of the rows, which can be shared by
+ *  several threads that propagate on their own workers
+ */
+typedef struct SCIP_LinProp SCIP_LINPROP;
+
+/** thread-local bounds and activities for the propagation of the rows of a SCIP_LINPROP, with a trail to undo the
+ *  changes of the last fixing
+ */
+typedef struct SCIP_LinPropWorker SCIP_LINPROPWORKER;
+
 /** compares two element indices
  *  result:
  *    < 0: ind1 comes before (is better than) ind2
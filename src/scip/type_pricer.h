@@ -43,6 +43,8 @@ extern "C" {
 
 typedef struct SCIP_Pricer SCIP_PRICER;           /**< variable pricer data */
 typedef struct SCIP_PricerData SCIP_PRICERDATA;   /**< locally defined variable pricer data */
+typedef struct SCIP_PricingCol SCIP_PRICINGCOL;   /**< column found by a parallel pricing job, see SCIPexecPricingJobs() */
+typedef struct SCIP_PricingBuffer SCIP_PRICINGBUFFER; /**< thread-local column buffer of a parallel pricing job */
 
 
 /** copy method for pricer plugins (called when SCIP copies plugins)
@@ -173,6 +175,36 @@ typedef struct SCIP_PricerData SCIP_PRICERDATA;   /**< locally defined variable
  */
 #define SCIP_DECL_PRICERFARKAS(x) SCIP_RETCODE x (SCIP* scip, SCIP_PRICER* pricer, SCIP_RESULT* result)
 
+/** pricing job of a variable pricer that is executed by SCIPexecPricingJobs()
+ *
+ *  A pricing job usually solves one independent pricing subproblem, e.g., the subproblem of one resource. Since the
+ *  job is possibly executed in a different thread than the one that owns the SCIP instance, the restrictions of
+ *  SCIP_DECL_PARALLELJOB apply: the job must not use SCIP's block or buffer memory, must not change any SCIP data
+ *  structures, and must only work on its job data, which usually contains a copy of the dual values. Columns are not
+ *  added to SCIP directly, but are stored in the given thread-local buffer by SCIPpricingbufferAddCol(). Longer
+ *  running jobs should regularly check SCIPpricingbufferIsStopped() and return early if enough columns were found.
+ *
+ *  input:
+ *  - jobdata         : the data of this pricing job
+ *  - buffer          : thread-local buffer to store the found columns in
+ */
+#define SCIP_DECL_PRICINGJOB(x) SCIP_RETCODE x (void* jobdata, SCIP_PRICINGBUFFER* buffer)
+
+/** method to add a column that was found by a pricing job to the problem
+ *
+ *  The method is called by SCIPexecPricingJobs() in the thread that owns the SCIP instance, in the order of
+ *  increasing reduced costs of the columns. It should create the corresponding variable, add it to the problem by
+ *  SCIPaddPricedVar(), and add its coefficients to the constraints. The column data is owned by SCIP and is freed
+ *  after the call.
+ *
+ *  input:
+ *  - scip            : SCIP main data structure
+ *  - pricer          : the variable pricer itself
+ *  - coldata         : the column data that was passed to SCIPpricingbufferAddCol() by the pricing job
+ *  - redcost         : the reduced cost of the column as computed by the pricing job
+ */
+#define SCIP_DECL_PRICINGADDCOL(x) SCIP_RETCODE x (SCIP* scip, SCIP_PRICER* pricer, void* coldata, SCIP_Real redcost)
+
 #ifdef __cplusplus
 }
 #endif
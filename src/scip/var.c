@@ -1034,6 +1034,38 @@ SCIP_RETCODE boundchgReleaseData(
    return SCIP_OKAY;
 }
 
+/** size of a static domain change without hole changes, whose bound changes are stored in the same memory block
+ *  directly behind the domain change data
+ */
+#define domchgPackedSize(nboundchgs) (sizeof(SCIP_DOMCHGBOUND) + (size_t)(nboundchgs) * sizeof(SCIP_BOUNDCHG))
+
+/** creates static domain change data without hole changes that stores a copy of the given bound changes in the same
+ *  memory block; this halves the number of memory blocks of leaves and keeps the bound changes of a node next to each
+ *  other when the path is switched
+ */
+static
+SCIP_RETCODE domchgCreatePacked(
+   SCIP_DOMCHG**         domchg,             /**< pointer to domain change data */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_BOUNDCHG*        boundchgs,          /**< bound changes to copy */
+   int                   nboundchgs          /**< number of bound changes */
+   )
+{
+   assert(domchg != NULL);
+   assert(blkmem != NULL);
+   assert(boundchgs != NULL);
+   assert(nboundchgs > 0);
+   assert(sizeof(SCIP_DOMCHGBOUND) % sizeof(SCIP_Real) == 0);
+
+   SCIP_ALLOC( BMSallocBlockMemorySize(blkmem, domchg, domchgPackedSize(nboundchgs)) );
+   (*domchg)->domchgbound.domchgtype = SCIP_DOMCHGTYPE_BOUND; /*lint !e641*/
+   (*domchg)->domchgbound.nboundchgs = (unsigned int) nboundchgs;
+   (*domchg)->domchgbound.boundchgs = (SCIP_BOUNDCHG*) ((char*) (*domchg) + sizeof(SCIP_DOMCHGBOUND));
+   BMScopyMemoryArray((*domchg)->domchgbound.boundchgs, boundchgs, nboundchgs);
+
+   return SCIP_OKAY;
+}
+
 /** creates empty domain change data with dynamic arrays */
 static
 SCIP_RETCODE domchgCreate(
@@ -1082,8 +1114,8 @@ SCIP_RETCODE SCIPdomchgFree(
       switch( (*domchg)->domchgdyn.domchgtype )
       {
       case SCIP_DOMCHGTYPE_BOUND:
-         BMSfreeBlockMemoryArrayNull(blkmem, &(*domchg)->domchgbound.boundchgs, (*domchg)->domchgbound.nboundchgs);
-         BMSfreeBlockMemorySize(blkmem, domchg, sizeof(SCIP_DOMCHGBOUND));
+         /* the bound changes are stored in the same memory block */
+         BMSfreeBlockMemorySize(blkmem, domchg, domchgPackedSize((*domchg)->domchgbound.nboundchgs));
          break;
       case SCIP_DOMCHGTYPE_BOTH:
          BMSfreeBlockMemoryArrayNull(blkmem, &(*domchg)->domchgboth.boundchgs, (*domchg)->domchgboth.nboundchgs);
@@ -1125,13 +1157,19 @@ SCIP_RETCODE domchgMakeDynamic(
       switch( (*domchg)->domchgdyn.domchgtype )
       {
       case SCIP_DOMCHGTYPE_BOUND:
-         SCIP_ALLOC( BMSreallocBlockMemorySize(blkmem, domchg, sizeof(SCIP_DOMCHGBOUND), sizeof(SCIP_DOMCHGDYN)) );
-         (*domchg)->domchgdyn.nholechgs = 0;
-         (*domchg)->domchgdyn.holechgs = NULL;
-         (*domchg)->domchgdyn.boundchgssize = (int) (*domchg)->domchgdyn.nboundchgs;
-         (*domchg)->domchgdyn.holechgssize = 0;
-         (*domchg)->domchgdyn.domchgtype = SCIP_DOMCHGTYPE_DYNAMIC; /*lint !e641*/
+      {
+         SCIP_DOMCHG* packed = *domchg;
+         int nboundchgs = (int) packed->domchgbound.nboundchgs;
+
+         /* move the bound changes out of the packed memory block into a separate array */
+         SCIP_CALL( domchgCreate(domchg, blkmem) );
+         SCIP_ALLOC( BMSduplicateBlockMemoryArray(blkmem, &(*domchg)->domchgdyn.boundchgs, packed->domchgbound.boundchgs,
+               nboundchgs) );
+         (*domchg)->domchgdyn.nboundchgs = (unsigned int) nboundchgs;
+         (*domchg)->domchgdyn.boundchgssize = nboundchgs;
+         BMSfreeBlockMemorySize(blkmem, &packed, domchgPackedSize(nboundchgs));
          break;
+      }
       case SCIP_DOMCHGTYPE_BOTH:
          SCIP_ALLOC( BMSreallocBlockMemorySize(blkmem, domchg, sizeof(SCIP_DOMCHGBOTH), sizeof(SCIP_DOMCHGDYN)) );
          (*domchg)->domchgdyn.boundchgssize = (int) (*domchg)->domchgdyn.nboundchgs;
@@ -1190,8 +1228,14 @@ SCIP_RETCODE SCIPdomchgMakeStatic(
             }
             else
             {
-               SCIP_ALLOC( BMSreallocBlockMemorySize(blkmem, domchg, sizeof(SCIP_DOMCHGBOTH), sizeof(SCIP_DOMCHGBOUND)) );
-               (*domchg)->domchgdyn.domchgtype = SCIP_DOMCHGTYPE_BOUND; /*lint !e641*/
+               SCIP_DOMCHG* packed;
+
+               /* convert into static domain change with packed bound changes */
+               SCIP_CALL( domchgCreatePacked(&packed, blkmem, (*domchg)->domchgboth.boundchgs,
+                     (int) (*domchg)->domchgboth.nboundchgs) );
+               BMSfreeBlockMemoryArray(blkmem, &(*domchg)->domchgboth.boundchgs, (*domchg)->domchgboth.nboundchgs);
+               BMSfreeBlockMemorySize(blkmem, domchg, sizeof(SCIP_DOMCHGBOTH));
+               *domchg = packed;
             }
          }
          break;
@@ -1204,14 +1248,15 @@ SCIP_RETCODE SCIPdomchgMakeStatic(
             }
             else
             {
-               /* shrink dynamic size arrays to their minimal sizes */
-               SCIP_ALLOC( BMSreallocBlockMemoryArray(blkmem, &(*domchg)->domchgdyn.boundchgs, \
-                     (*domchg)->domchgdyn.boundchgssize, (*domchg)->domchgdyn.nboundchgs) ); /*lint !e571*/
-               BMSfreeBlockMemoryArrayNull(blkmem, &(*domchg)->domchgdyn.holechgs, (*domchg)->domchgdyn.holechgssize);
+               SCIP_DOMCHG* packed;
 
-               /* convert into static domain change */
-               SCIP_ALLOC( BMSreallocBlockMemorySize(blkmem, domchg, sizeof(SCIP_DOMCHGDYN), sizeof(SCIP_DOMCHGBOUND)) );
-               (*domchg)->domchgdyn.domchgtype = SCIP_DOMCHGTYPE_BOUND; /*lint !e641*/
+               /* convert into static domain change with packed bound changes */
+               SCIP_CALL( domchgCreatePacked(&packed, blkmem, (*domchg)->domchgdyn.boundchgs,
+                     (int) (*domchg)->domchgdyn.nboundchgs) );
+               BMSfreeBlockMemoryArray(blkmem, &(*domchg)->domchgdyn.boundchgs, (*domchg)->domchgdyn.boundchgssize);
+               BMSfreeBlockMemoryArrayNull(blkmem, &(*domchg)->domchgdyn.holechgs, (*domchg)->domchgdyn.holechgssize);
+               BMSfreeBlockMemorySize(blkmem, domchg, sizeof(SCIP_DOMCHGDYN));
+               *domchg = packed;
             }
          }
          else
@@ -147,6 +147,15 @@ SCIP_RETCODE SCIPtpiInit(
    SCIP_Bool             blockwhenfull       /**< should the queue block when full */
    );
 
+/** initializes tpi if it is not initialized yet; the check and the initialization are performed atomically */
+SCIP_EXPORT
+SCIP_RETCODE SCIPtpiTryInit(
+   int                   nthreads,           /**< the number of threads to be used */
+   int                   queuesize,          /**< the size of the queue */
+   SCIP_Bool             blockwhenfull,      /**< should the queue block when full */
+   SCIP_Bool*            initialized         /**< pointer to store whether the tpi has been initialized by this call */
+   );
+
 /** deinitializes the tpi */
 SCIP_EXPORT
 SCIP_RETCODE SCIPtpiExit(
@@ -157,6 +166,10 @@ SCIP_RETCODE SCIPtpiExit(
 SCIP_EXPORT
 SCIP_Bool SCIPtpiIsAvailable(void);
 
+/** indicate whether the TPI is currently initialized, i.e., between SCIPtpiInit() and SCIPtpiExit() */
+SCIP_EXPORT
+SCIP_Bool SCIPtpiIsInitialized(void);
+
 /** get name of library that the TPI interfaces to */
 SCIP_EXPORT
 void SCIPtpiGetLibraryName(
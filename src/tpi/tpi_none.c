@@ -213,6 +213,25 @@ SCIP_RETCODE SCIPtpiInit(
    return SCIP_ERROR;
 }
 
+/** initializes tpi if it is not initialized yet; the check and the initialization are performed atomically */
+SCIP_RETCODE SCIPtpiTryInit(
+   int         nthreads,                     /**< the number of threads to be used */
+   int         queuesize,                    /**< the size of the queue */
+   SCIP_Bool   blockwhenfull,                /**< should the queue block when full */
+   SCIP_Bool*  initialized                   /**< pointer to store whether the tpi has been initialized by this call */
+   )
+{
+   SCIP_UNUSED( nthreads );
+   SCIP_UNUSED( queuesize );
+   SCIP_UNUSED( blockwhenfull );
+
+   assert(initialized != NULL);
+
+   *initialized = FALSE;
+
+   return SCIP_OKAY;
+}
+
 /** deinitializes the tpi */
 SCIP_RETCODE SCIPtpiExit(
    void
@@ -227,6 +246,12 @@ SCIP_Bool SCIPtpiIsAvailable(void)
    return FALSE;
 }
 
+/** indicate whether the TPI is currently initialized, i.e., between SCIPtpiInit() and SCIPtpiExit() */
+SCIP_Bool SCIPtpiIsInitialized(void)
+{
+   return FALSE;
+}
+
 /** get name of library that the TPI interfaces to */
 void SCIPtpiGetLibraryName(
    char*                 name,               /**< buffer to store name */
@@ -599,12 +599,37 @@ SCIP_RETCODE SCIPtpiInit(
    SCIP_Bool             blockwhenfull       /**< should the queue block when full */
    )
 {
-   omp_set_num_threads(nthreads);
-   assert(_jobqueues == NULL);
+   SCIP_Bool initialized;
 
-   SCIP_CALL( createJobQueue(nthreads, queuesize, blockwhenfull) );
+   SCIP_CALL( SCIPtpiTryInit(nthreads, queuesize, blockwhenfull, &initialized) );
+   assert(initialized);
 
-   return SCIP_OKAY;
+   return initialized ? SCIP_OKAY : SCIP_ERROR;
+}
+
+/** initializes tpi if it is not initialized yet; the check and the initialization are performed atomically */
+SCIP_RETCODE SCIPtpiTryInit(
+   int                   nthreads,           /**< the number of threads to be used */
+   int                   queuesize,          /**< the size of the queue */
+   SCIP_Bool             blockwhenfull,      /**< should the queue block when full */
+   SCIP_Bool*            initialized         /**< pointer to store whether the tpi has been initialized by this call */
+   )
+{
+   SCIP_RETCODE retcode = SCIP_OKAY;
+
+   assert(initialized != NULL);
+
+#pragma omp critical (tpiinit)
+   {
+      *initialized = (_jobqueues == NULL);
+      if( *initialized )
+      {
+         omp_set_num_threads(nthreads);
+         retcode = createJobQueue(nthreads, queuesize, blockwhenfull);
+      }
+   }
+
+   return retcode;
 }
 
 /** deinitializes tpi */
@@ -612,14 +637,19 @@ SCIP_RETCODE SCIPtpiExit(
    void
    )
 {
+   SCIP_RETCODE retcode;
+
    assert(_jobqueues != NULL);
    assert(_jobqueues->finishedjobs.njobs == 0);
    assert(_jobqueues->jobqueue.njobs == 0);
    assert(_jobqueues->ncurrentjobs == 0);
 
-   SCIP_CALL( freeJobQueue() );
+#pragma omp critical (tpiinit)
+   {
+      retcode = freeJobQueue();
+   }
 
-   return SCIP_OKAY;
+   return retcode;
 }
 
 
@@ -710,6 +740,12 @@ SCIP_Bool SCIPtpiIsAvailable(void)
    return TRUE;
 }
 
+/** indicate whether the TPI is currently initialized, i.e., between SCIPtpiInit() and SCIPtpiExit() */
+SCIP_Bool SCIPtpiIsInitialized(void)
+{
+   return (_jobqueues != NULL);
+}
+
 /** get name of library that the TPI interfaces to */
 void SCIPtpiGetLibraryName(
    char*                 name,               /**< buffer to store name */
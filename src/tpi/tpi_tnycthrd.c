@@ -68,6 +68,8 @@ struct SCIP_Condition
 
 typedef struct SCIP_ThreadPool SCIP_THREADPOOL;
 static SCIP_THREADPOOL* _threadpool = NULL;
+static mtx_t _initlock;                      /**< lock protecting the initialization and deinitialization of the pool */
+static once_flag _initlockonce = ONCE_FLAG_INIT;
 _Thread_local int _threadnumber; /*lint !e129*/
 
 /** A job added to the queue */
@@ -585,9 +587,45 @@ SCIP_RETCODE SCIPtpiInit(
    SCIP_Bool             blockwhenfull       /**< should the queue block when full */
    )
 {
-   assert(_threadpool == NULL);
-   SCIP_CALL( createThreadPool(&_threadpool, nthreads, queuesize, blockwhenfull) );
-   return SCIP_OKAY;
+   SCIP_Bool initialized;
+
+   SCIP_CALL( SCIPtpiTryInit(nthreads, queuesize, blockwhenfull, &initialized) );
+   assert(initialized);
+
+   return initialized ? SCIP_OKAY : SCIP_ERROR;
+}
+
+/** creates the lock protecting the initialization of the thread pool */
+static
+void initInitLock(
+   void
+   )
+{
+   (void) mtx_init(&_initlock, mtx_plain);
+}
+
+/** initializes tpi if it is not initialized yet; the check and the initialization are performed atomically */
+SCIP_RETCODE SCIPtpiTryInit(
+   int                   nthreads,           /**< the number of threads to be used */
+   int                   queuesize,          /**< the size of the queue */
+   SCIP_Bool             blockwhenfull,      /**< should the queue block when full */
+   SCIP_Bool*            initialized         /**< pointer to store whether the tpi has been initialized by this call */
+   )
+{
+   SCIP_RETCODE retcode = SCIP_OKAY;
+
+   assert(initialized != NULL);
+
+   call_once(&_initlockonce, initInitLock);
+   SCIP_CALL( SCIPtnyAcquireLock(&_initlock) );
+
+   *initialized = (_threadpool == NULL);
+   if( *initialized )
+      retcode = createThreadPool(&_threadpool, nthreads, queuesize, blockwhenfull);
+
+   SCIP_CALL( SCIPtnyReleaseLock(&_initlock) );
+
+   return retcode;
 }
 
 /** deinitializes tpi */
@@ -595,11 +633,18 @@ SCIP_RETCODE SCIPtpiExit(
    void
    )
 {
+   SCIP_RETCODE retcode;
+
    assert(_threadpool != NULL);
 
-   SCIP_CALL( freeThreadPool(&_threadpool, TRUE, TRUE) );
+   call_once(&_initlockonce, initInitLock);
+   SCIP_CALL( SCIPtnyAcquireLock(&_initlock) );
 
-   return SCIP_OKAY;
+   retcode = freeThreadPool(&_threadpool, TRUE, TRUE);
+
+   SCIP_CALL( SCIPtnyReleaseLock(&_initlock) );
+
+   return retcode;
 }
 
 /** creates a job for parallel processing */
@@ -848,6 +893,12 @@ SCIP_Bool SCIPtpiIsAvailable(void)
    return TRUE;
 }
 
+/** indicate whether the TPI is currently initialized, i.e., between SCIPtpiInit() and SCIPtpiExit() */
+SCIP_Bool SCIPtpiIsInitialized(void)
+{
+   return (_threadpool != NULL);
+}
+
 /** get name of library that the TPI interfaces to */
 void SCIPtpiGetLibraryName(
    char*                 name,               /**< buffer to store name */
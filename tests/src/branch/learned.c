@@ -0,0 +1,194 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   learned.c
+ * @brief  unit test for reading the model of the learned branching rule and scoring candidates by it
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <stdio.h>
+
+#include "scip/scip.h"
+#include "scip/branch_learned.c"
+
+#include "include/scip_test.h"
+
+#define NCANDS 5
+
+static SCIP* scip;
+static SCIP_BRANCHRULEDATA branchruledata;
+static const char* filename = "learned.model";
+
+/** writes the given content to the model file */
+static
+void writeModel(
+   const char*           content             /**< content of the file */
+   )
+{
+   FILE* fp;
+
+   fp = fopen(filename, "w");
+   cr_assert(fp != NULL);
+   fprintf(fp, "%s", content);
+   fclose(fp);
+}
+
+/** returns the value of a feature of a candidate */
+static
+SCIP_Real getFeature(
+   int                   cand,               /**< candidate */
+   int                   f                   /**< feature */
+   )
+{
+   return 0.1 * (cand + 1) + 0.01 * f;
+}
+
+/** creates SCIP and stores features of the candidates in the branching rule data */
+static
+void setup(void)
+{
+   int f;
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+
+   BMSclearMemory(&branchruledata);
+   SCIP_CALL( ensureCandsSize(scip, &branchruledata, NCANDS) );
+   cr_assert(branchruledata.candssize >= NCANDS);
+
+   for( f = 0; f < NFEATURES; ++f )
+   {
+      for( i = 0; i < NCANDS; ++i )
+         branchruledata.features[f * branchruledata.candssize + i] = getFeature(i, f);
+   }
+}
+
+/** frees the branching rule data and SCIP */
+static
+void teardown(void)
+{
+   freeModel(scip, &branchruledata);
+   SCIPfreeBlockMemoryArrayNull(scip, &branchruledata.scores, branchruledata.candssize);
+   SCIPfreeBlockMemoryArrayNull(scip, &branchruledata.features, NFEATURES * branchruledata.candssize);
+
+   SCIP_CALL( SCIPfree(&scip) );
+   (void)remove(filename);
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+TestSuite(learned, .init = setup, .fini = teardown);
+
+Test(learned, defaultmodel, .description = "the default linear model uses the weights of reliability branching")
+{
+   int i;
+
+   predictScores(&branchruledata, NCANDS);
+
+   for( i = 0; i < NCANDS; ++i )
+   {
+      SCIP_Real expected = getFeature(i, FEATURE_PSCOST) + 0.01 * getFeature(i, FEATURE_CONFLICT)
+         + 0.0001 * getFeature(i, FEATURE_INFERENCE) + 0.0001 * getFeature(i, FEATURE_CUTOFF);
+
+      cr_assert_float_eq(branchruledata.scores[i], expected, 1e-12);
+   }
+}
+
+Test(learned, linearmodel, .description = "a linear model from a file scores by intercept plus weighted features")
+{
+   char content[SCIP_MAXSTRLEN];
+   int len;
+   int f;
+   int i;
+
+   /* intercept 1 and weight f - 4 for feature f */
+   len = SCIPsnprintf(content, SCIP_MAXSTRLEN, "### LINEAR FEATURE_DIM=%d\n1.0\n", NFEATURES);
+   for( f = 0; f < NFEATURES; ++f )
+      len += SCIPsnprintf(content + len, SCIP_MAXSTRLEN - len, "%d\n", f - 4);
+   writeModel(content);
+
+   SCIP_CALL( readModel(scip, &branchruledata, filename) );
+   cr_assert(branchruledata.weights != NULL);
+   cr_assert(branchruledata.regforest == NULL);
+
+   predictScores(&branchruledata, NCANDS);
+
+   for( i = 0; i < NCANDS; ++i )
+   {
+      SCIP_Real expected = 1.0;
+
+      for( f = 0; f < NFEATURES; ++f )
+         expected += (f - 4) * getFeature(i, f);
+
+      cr_assert_float_eq(branchruledata.scores[i], expected, 1e-12);
+   }
+}
+
+Test(learned, forestmodel, .description = "a regression forest from a file scores by its predictions")
+{
+   char content[SCIP_MAXSTRLEN];
+   int i;
+
+   /* a single tree that splits on the column density between the second and third candidate */
+   (void) SCIPsnprintf(content, SCIP_MAXSTRLEN, "### NTREES=1 FEATURE_DIM=%d LENGTH=3\n0,1,2,%d,%g\n1,-1,-1,-1,-1.0\n"
+      "2,-1,-1,-1,1.0\n", NFEATURES, FEATURE_DENSITY, getFeature(1, FEATURE_DENSITY) + 0.05);
+   writeModel(content);
+
+   SCIP_CALL( readModel(scip, &branchruledata, filename) );
+   cr_assert(branchruledata.weights == NULL);
+   cr_assert(branchruledata.regforest != NULL);
+
+   predictScores(&branchruledata, NCANDS);
+
+   for( i = 0; i < NCANDS; ++i )
+      cr_assert_float_eq(branchruledata.scores[i], i <= 1 ? -1.0 : 1.0, 1e-12);
+}
+
+Test(learned, invalid, .description = "models that do not match the features are rejected")
+{
+   char content[SCIP_MAXSTRLEN];
+
+   /* linear model of wrong dimension */
+   (void) SCIPsnprintf(content, SCIP_MAXSTRLEN, "### LINEAR FEATURE_DIM=%d\n0.0\n", NFEATURES + 1);
+   writeModel(content);
+   cr_assert_eq(readModel(scip, &branchruledata, filename), SCIP_READERROR);
+   cr_assert(branchruledata.weights == NULL);
+
+   /* linear model with missing weights */
+   (void) SCIPsnprintf(content, SCIP_MAXSTRLEN, "### LINEAR FEATURE_DIM=%d\n0.0\n1.0\n", NFEATURES);
+   writeModel(content);
+   cr_assert_eq(readModel(scip, &branchruledata, filename), SCIP_READERROR);
+   cr_assert(branchruledata.weights == NULL);
+
+   /* regression forest of wrong dimension */
+   writeModel("### NTREES=1 FEATURE_DIM=1 LENGTH=1\n0,-1,-1,-1,1.0\n");
+   cr_assert_eq(readModel(scip, &branchruledata, filename), SCIP_READERROR);
+   cr_assert(branchruledata.regforest == NULL);
+
+   /* unknown format */
+   writeModel("1.0\n");
+   cr_assert_eq(readModel(scip, &branchruledata, filename), SCIP_READERROR);
+   cr_assert(branchruledata.weights == NULL && branchruledata.regforest == NULL);
+}
@@ -317,3 +317,86 @@ Test(solveknapsackexactly, test_large, .description="large test")
    cr_assert( checkSetContainment(&items[250], solitems, 250, nsolitems) );
    cr_assert( checkSetContainment(items, nonsolitems, 250, nnonsolitems) );
 }
+
+/** solves the knapsack with the given small weights and capacity by a dynamic program over the capacity */
+static
+SCIP_Real solveKnapsackReference(
+   SCIP_Longint*         smallweights,       /**< small item weights */
+   SCIP_Longint          smallcapacity       /**< small capacity */
+   )
+{
+   SCIP_Real optvalues[MAX_ARRAYLEN];
+   int j;
+   int c;
+
+   cr_assert(smallcapacity < MAX_ARRAYLEN);
+
+   for( c = 0; c <= smallcapacity; ++c )
+      optvalues[c] = 0.0;
+
+   for( j = 0; j < nitems; ++j )
+   {
+      for( c = (int) smallcapacity; c >= smallweights[j]; --c )
+         optvalues[c] = MAX(optvalues[c], optvalues[c - smallweights[j]] + profits[j]);
+   }
+
+   return optvalues[smallcapacity];
+}
+
+/* large capacity test, which is solved by the core algorithm */
+Test(solveknapsackexactly, test_largecapacity, .description="test knapsacks whose capacity is too large for the dynamic programming table")
+{
+   SCIP_RANDNUMGEN* randnumgen;
+   SCIP_Longint smallweights[MAX_ARRAYLEN];
+   SCIP_Longint smallcapacity;
+   SCIP_Longint scale = 100000000LL;
+   int r;
+
+   SCIP_CALL( SCIPcreateRandom(scip, &randnumgen, 1234, TRUE) );
+
+   for( r = 0; r < 20; ++r )
+   {
+      SCIP_Longint solweight;
+      SCIP_Real value;
+      int j;
+
+      nitems = SCIPrandomGetInt(randnumgen, 20, 60);
+      smallcapacity = SCIPrandomGetInt(randnumgen, 50, 200);
+
+      /* the weights are scaled small weights plus distinct offsets, whose sum is smaller than the slack of the capacity,
+       * such that the optimal value is the one of the small knapsack, but the weights have no common divisor
+       */
+      for( j = 0; j < nitems; ++j )
+      {
+         smallweights[j] = SCIPrandomGetInt(randnumgen, 1, 40);
+         weights[j] = scale * smallweights[j] + j;
+         profits[j] = (SCIP_Real) (smallweights[j] + SCIPrandomGetInt(randnumgen, 0, 10));
+      }
+      capacity = scale * smallcapacity + nitems * nitems;
+
+      solveKnapsack();
+
+      cr_assert( success );
+      cr_assert( nsolitems + nnonsolitems == nitems );
+      cr_assert_float_eq(solval, solveKnapsackReference(smallweights, smallcapacity), EPS);
+
+      /* the solution is feasible and has the returned value */
+      solweight = 0;
+      value = 0.0;
+      for( j = 0; j < nsolitems; ++j )
+      {
+         solweight += weights[solitems[j]];
+         value += profits[solitems[j]];
+      }
+      cr_assert( solweight <= capacity );
+      cr_assert_float_eq(value, solval, EPS);
+
+      /* the same problem can be solved without using the dynamic programming table */
+      SCIP_CALL( SCIPsolveKnapsackExactlyLimited(scip, nitems, weights, profits, capacity, items, solitems, nonsolitems,
+            &nsolitems, &nnonsolitems, &value, 0.0, 1e+7, &success) );
+      cr_assert( success );
+      cr_assert_float_eq(value, solval, EPS);
+   }
+
+   SCIPfreeRandom(scip, &randnumgen);
+}
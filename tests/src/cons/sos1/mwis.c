@@ -0,0 +1,174 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   mwis.c
+ * @brief  unit tests for the greedy maximum weighted independent set heuristic of SOS1 constraints with several runs
+ */
+
+#include "scip/scip.h"
+#include "include/scip_test.h"
+#include "scip/cons_sos1.h"
+
+#define NVARS 12
+
+/** GLOBAL VARIABLES **/
+static SCIP* scip = NULL;
+static SCIP_CONSHDLR* conshdlr = NULL;
+
+/** creates a problem with overlapping SOS1 constraints, such that the conflict graph is used, and stops in SOLVING */
+static
+void setup(void)
+{
+   SCIP_VAR* vars[NVARS];
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeConshdlrSOS1(scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "mwis") );
+
+   /* maximize the sum of the variables */
+   SCIP_CALL( SCIPsetObjsense(scip, SCIP_OBJSENSE_MAXIMIZE) );
+   for (i = 0; i < NVARS; ++i)
+   {
+      char name[SCIP_MAXSTRLEN];
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &vars[i], name, 0.0, 1.0, 1.0, SCIP_VARTYPE_CONTINUOUS) );
+      SCIP_CALL( SCIPaddVar(scip, vars[i]) );
+   }
+
+   /* each variable is in three SOS1 constraints of three consecutive variables (cyclically) */
+   for (i = 0; i < NVARS; ++i)
+   {
+      SCIP_CONS* cons;
+      SCIP_VAR* consvars[3];
+      SCIP_Real weights[3] = { 1.0, 2.0, 3.0 };
+      char name[SCIP_MAXSTRLEN];
+
+      consvars[0] = vars[i];
+      consvars[1] = vars[(i + 1) % NVARS];
+      consvars[2] = vars[(i + 2) % NVARS];
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "sos%d", i);
+      SCIP_CALL( SCIPcreateConsBasicSOS1(scip, &cons, name, 3, consvars, weights) );
+      SCIP_CALL( SCIPaddCons(scip, cons) );
+      SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+   }
+
+   for (i = 0; i < NVARS; ++i)
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[i]) );
+   }
+
+   /* the SOS1 constraints must not be changed by presolving */
+   SCIP_CALL( SCIPsetPresolving(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+   SCIP_CALL( SCIPsetIntParam(scip, "parallel/maxnthreads", 4) );
+
+   SCIP_CALL( TESTscipSetStage(scip, SCIP_STAGE_SOLVING, FALSE) );
+
+   conshdlr = SCIPfindConshdlr(scip, "SOS1");
+   cr_assert( conshdlr != NULL );
+}
+
+/** deinitialization method */
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+/** turns the given point feasible for the SOS1 constraints with the given number of runs of the MWIS heuristic and
+ *  returns the objective value of the resulting solution
+ */
+static
+SCIP_Real makeFeasible(
+   SCIP_Real*            vals,               /**< values of the variables */
+   int                   mwisruns            /**< number of runs of the MWIS heuristic */
+   )
+{
+   SCIP_VAR** vars;
+   SCIP_SOL* sol;
+   SCIP_Real objval;
+   SCIP_Bool feasible;
+   SCIP_Bool changed;
+   SCIP_Bool success;
+   int i;
+
+   SCIP_CALL( SCIPsetIntParam(scip, "constraints/SOS1/mwisruns", mwisruns) );
+
+   vars = SCIPgetVars(scip);
+   cr_assert_eq(SCIPgetNVars(scip), NVARS);
+
+   SCIP_CALL( SCIPcreateSol(scip, &sol, NULL) );
+   for (i = 0; i < NVARS; ++i)
+   {
+      SCIP_CALL( SCIPsetSolVal(scip, sol, vars[i], vals[i]) );
+   }
+
+   SCIP_CALL( SCIPmakeSOS1sFeasible(scip, conshdlr, sol, &changed, &success) );
+   cr_assert( changed );
+   cr_assert( success );
+
+   SCIP_CALL( SCIPcheckSol(scip, sol, FALSE, FALSE, TRUE, TRUE, TRUE, &feasible) );
+   cr_assert( feasible );
+
+   objval = SCIPgetSolOrigObj(scip, sol);
+   SCIP_CALL( SCIPfreeSol(scip, &sol) );
+
+   return objval;
+}
+
+TestSuite(mwis, .init = setup, .fini = teardown);
+
+Test(mwis, runs, .description = "check that several runs of the MWIS heuristic give a feasible solution that is at least as good as a single run")
+{
+   SCIP_RANDNUMGEN* randnumgen;
+   SCIP_Real vals[NVARS];
+   int r;
+   int i;
+
+   SCIP_CALL( SCIPcreateRandom(scip, &randnumgen, 2024, TRUE) );
+
+   for (r = 0; r < 20; ++r)
+   {
+      SCIP_Real singleobj;
+      SCIP_Real multiobj;
+
+      for (i = 0; i < NVARS; ++i)
+         vals[i] = SCIPrandomGetReal(randnumgen, 0.1, 1.0);
+
+      singleobj = makeFeasible(vals, 1);
+      multiobj = makeFeasible(vals, 8);
+
+      /* the first run uses the unperturbed weights, and the best independent set is kept */
+      cr_assert( SCIPisGE(scip, multiobj, singleobj), "%d runs: %g < 1 run: %g", 8, multiobj, singleobj );
+
+      /* the result must not depend on the scheduling of the runs */
+      cr_assert( SCIPisEQ(scip, makeFeasible(vals, 8), multiobj) );
+   }
+
+   SCIPfreeRandom(scip, &randnumgen);
+}
@@ -42,6 +42,8 @@
 #include "scip/expr_var.h"
 #include "scip/expr_value.h"
 
+#include "scip/scipdefplugins.h"
+
 #include "include/scip_test.h"
 
 static SCIP* scip;
@@ -345,3 +347,98 @@ Test(heuristic, clusterPointsGreedy, .init = setup, .fini = teardown,
       SCIP_CALL( SCIPfreeSol(scip, &points[i]) );
    }
 }
+
+/** solves a nonconvex NLP with the multi-start heuristic and the parameter for parallel sub-NLP solves enabled
+ *
+ *  The sub-NLPs are only solved concurrently if Ipopt uses a thread-safe linear solver. Otherwise, the heuristic has
+ *  to fall back to solving them sequentially, which must work as well. The parallel path itself is tested by
+ *  parallelJobs below.
+ */
+Test(heuristic, parallel,
+   .description = "smoke test for the multi-start heuristic with parallel sub-NLP solves enabled"
+   )
+{
+   SCIP* parscip;
+
+   SCIP_CALL( SCIPcreate(&parscip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(parscip) );
+   SCIPsetMessagehdlrQuiet(parscip, TRUE);
+
+   /* the heuristic needs an NLP solver */
+   if( SCIPgetNNlpis(parscip) == 0 )
+   {
+      SCIP_CALL( SCIPfree(&parscip) );
+      return;
+   }
+
+   SCIP_CALL( SCIPreadProb(parscip, "../check/instances/MINLP/pointpack04.osil", NULL) );
+
+   /* run the multi-start heuristic in the root node only, with as many clusters as possible */
+   SCIP_CALL( SCIPsetIntParam(parscip, "heuristics/multistart/freq", 0) );
+   SCIP_CALL( SCIPsetIntParam(parscip, "heuristics/multistart/maxncluster", 8) );
+   SCIP_CALL( SCIPsetBoolParam(parscip, "heuristics/multistart/parallel", TRUE) );
+   SCIP_CALL( SCIPsetIntParam(parscip, "parallel/maxnthreads", 4) );
+   SCIP_CALL( SCIPsetLongintParam(parscip, "limits/nodes", 1LL) );
+
+   SCIP_CALL( SCIPsolve(parscip) );
+
+   cr_assert(SCIPheurGetNCalls(SCIPfindHeur(parscip, "multistart")) >= 1);
+   cr_assert(SCIPgetNSols(parscip) >= 1);
+
+   SCIP_CALL( SCIPfree(&parscip) );
+}
+
+/** solves the sub-NLPs of two clusters by the jobs of solveNLPsParallel(), independently of the NLP solver
+ *
+ *  The jobs run on two threads only if Ipopt uses a thread-safe linear solver, otherwise on a single thread.
+ */
+Test(heuristic, parallelJobs,
+   .description = "check solveNLPsParallel() subroutine of the multi-start heuristic"
+   )
+{
+   SCIP* parscip;
+   SCIP_RANDNUMGEN* randnumgen;
+   SCIP_SOL* points[NPOINTS];
+   int clusteridx[NPOINTS];
+   SCIP_RESULT result;
+   int npoints;
+   int i;
+
+   SCIP_CALL( SCIPcreate(&parscip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(parscip) );
+   SCIPsetMessagehdlrQuiet(parscip, TRUE);
+
+   /* the jobs need an NLP solver */
+   if( SCIPgetNNlpis(parscip) == 0 )
+   {
+      SCIP_CALL( SCIPfree(&parscip) );
+      return;
+   }
+
+   SCIP_CALL( SCIPreadProb(parscip, "../check/instances/MINLP/pointpack04.osil", NULL) );
+   SCIP_CALL( SCIPpresolve(parscip) );
+   cr_assert(SCIPgetStage(parscip) == SCIP_STAGE_PRESOLVED);
+
+   /* sample points and assign them alternately to two clusters, sorted by cluster as in the heuristic */
+   SCIP_CALL( SCIPcreateRandom(parscip, &randnumgen, 777, TRUE) );
+   SCIP_CALL( sampleRandomPoints(parscip, points, NPOINTS, 1000.0, randnumgen, SCIPinfinity(parscip), &npoints) );
+   cr_assert(npoints >= 2);
+
+   for( i = 0; i < npoints; ++i )
+      clusteridx[i] = i % 2;
+   SCIPsortIntPtr(clusteridx, (void**)points, npoints);
+
+   result = SCIP_DIDNOTFIND;
+   SCIP_CALL( solveNLPsParallel(parscip, SCIPfindHeur(parscip, "multistart"), points, clusteridx, npoints, 2,
+         isNLPSolverThreadsafe(parscip) ? 2 : 1, &result) );
+   cr_assert(result == SCIP_DIDNOTFIND || result == SCIP_FOUNDSOL);
+   cr_assert(result == SCIP_DIDNOTFIND || SCIPgetNSols(parscip) >= 1);
+
+   for( i = npoints - 1; i >= 0; --i )
+   {
+      SCIP_CALL( SCIPfreeSol(parscip, &points[i]) );
+   }
+   SCIPfreeRandom(parscip, &randnumgen);
+
+   SCIP_CALL( SCIPfree(&parscip) );
+}
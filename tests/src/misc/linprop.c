@@ -0,0 +1,150 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+
+/**@file   linprop.c
+ * @brief  unittest for the propagation of linear rows on thread-local bounds in misc_linprop.c
+ */
+
+/*--+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/pub_misc_linprop.h"
+
+#include "include/scip_test.h"
+
+#define INFTY    1e20
+#define FEASTOL  1e-6
+#define EPSILON  1e-9
+#define NSMALL   300
+
+static SCIP_LINPROP* linprop;
+static SCIP_LINPROPWORKER* worker;
+
+static
+void teardown(void)
+{
+   SCIPlinpropWorkerFree(&worker);
+   SCIPlinpropFree(&linprop);
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+TestSuite(linprop, .fini = teardown);
+
+/* x0 + x1 <= 1 with binary columns */
+Test(linprop, propagate_and_undo, .description = "fixing a column tightens the other column of the row until undone")
+{
+   int rowbeg[] = {0, 2};
+   int rowcols[] = {0, 1};
+   SCIP_Real rowvals[] = {1.0, 1.0};
+   SCIP_Real lhs[] = {-INFTY};
+   SCIP_Real rhs[] = {1.0};
+   SCIP_Real lb[] = {0.0, 0.0};
+   SCIP_Real ub[] = {1.0, 1.0};
+   SCIP_Bool isint[] = {TRUE, TRUE};
+
+   SCIP_CALL( SCIPlinpropCreate(&linprop, 1, 2, rowbeg, rowcols, rowvals, lhs, rhs, lb, ub, isint, INFTY, FEASTOL,
+         EPSILON) );
+   SCIP_CALL( SCIPlinpropWorkerCreate(&worker, linprop) );
+
+   cr_assert(SCIPlinpropWorkerFix(worker, 0, 1.0));
+   cr_assert_eq(SCIPlinpropWorkerGetUbs(worker)[1], 0.0);
+   cr_assert(SCIPlinpropWorkerIsColChanged(worker, 1));
+
+   SCIPlinpropWorkerUndo(worker);
+   cr_assert_eq(SCIPlinpropWorkerGetUbs(worker)[1], 1.0);
+   cr_assert_eq(SCIPlinpropWorkerGetUbs(worker)[0], 1.0);
+
+   /* fixing both columns to 1 is infeasible */
+   cr_assert(SCIPlinpropWorkerFix(worker, 1, 1.0));
+   SCIPlinpropWorkerCommit(worker);
+   cr_assert_not(SCIPlinpropWorkerFix(worker, 0, 1.0));
+}
+
+/* x + 1e7 y <= 1e7 + 2 with x integer in [0,10] and y binary */
+Test(linprop, bigm, .description = "the rounding tolerance of a big-M row still yields the exact integral bound")
+{
+   int rowbeg[] = {0, 2};
+   int rowcols[] = {0, 1};
+   SCIP_Real rowvals[] = {1.0, 1e7};
+   SCIP_Real lhs[] = {-INFTY};
+   SCIP_Real rhs[] = {1e7 + 2.0};
+   SCIP_Real lb[] = {0.0, 0.0};
+   SCIP_Real ub[] = {10.0, 1.0};
+   SCIP_Bool isint[] = {TRUE, TRUE};
+
+   SCIP_CALL( SCIPlinpropCreate(&linprop, 1, 2, rowbeg, rowcols, rowvals, lhs, rhs, lb, ub, isint, INFTY, FEASTOL,
+         EPSILON) );
+   SCIP_CALL( SCIPlinpropWorkerCreate(&worker, linprop) );
+
+   cr_assert(SCIPlinpropWorkerFix(worker, 1, 1.0));
+   cr_assert_eq(SCIPlinpropWorkerGetUbs(worker)[0], 2.0);
+   cr_assert(SCIPlinpropWorkerIsFeasible(worker));
+}
+
+/* 0.1 x_1 + ... + 0.1 x_NSMALL + z <= 0.1 NSMALL with binary x_i and integer z in [0,100] */
+Test(linprop, recompute, .description = "many incremental updates of a row do not cut off the last feasible value")
+{
+   int rowbeg[2];
+   int rowcols[NSMALL + 1];
+   SCIP_Real rowvals[NSMALL + 1];
+   SCIP_Real lhs[] = {-INFTY};
+   SCIP_Real rhs[1];
+   SCIP_Real lb[NSMALL + 1];
+   SCIP_Real ub[NSMALL + 1];
+   SCIP_Bool isint[NSMALL + 1];
+   int i;
+
+   for( i = 0; i <= NSMALL; ++i )
+   {
+      rowcols[i] = i;
+      rowvals[i] = (i < NSMALL ? 0.1 : 1.0);
+      lb[i] = 0.0;
+      ub[i] = (i < NSMALL ? 1.0 : 100.0);
+      isint[i] = TRUE;
+   }
+   rowbeg[0] = 0;
+   rowbeg[1] = NSMALL + 1;
+   rhs[0] = 0.1 * NSMALL;
+
+   SCIP_CALL( SCIPlinpropCreate(&linprop, 1, NSMALL + 1, rowbeg, rowcols, rowvals, lhs, rhs, lb, ub, isint, INFTY,
+         FEASTOL, EPSILON) );
+   SCIP_CALL( SCIPlinpropWorkerCreate(&worker, linprop) );
+
+   /* fix the binary columns one by one, such that the activities are updated incrementally more often than they are
+    * recomputed from scratch
+    */
+   for( i = 0; i < NSMALL - 10; ++i )
+   {
+      cr_assert(SCIPlinpropWorkerFix(worker, i, 1.0));
+      SCIPlinpropWorkerCommit(worker);
+   }
+   cr_assert_eq(SCIPlinpropWorkerGetUbs(worker)[NSMALL], 1.0);
+
+   for( i = NSMALL - 10; i < NSMALL; ++i )
+   {
+      cr_assert(SCIPlinpropWorkerFix(worker, i, 1.0));
+      SCIPlinpropWorkerCommit(worker);
+   }
+   cr_assert_eq(SCIPlinpropWorkerGetUbs(worker)[NSMALL], 0.0);
+
+   cr_assert(SCIPlinpropWorkerFix(worker, NSMALL, 0.0));
+   cr_assert(SCIPlinpropWorkerIsFeasible(worker));
+}
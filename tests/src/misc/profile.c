@@ -0,0 +1,145 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+
+/**@file   profile.c
+ * @brief  unittest for the bulk core insertion of the resource profile in misc.c
+ */
+
+/*--+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/pub_misc.h"
+
+#include "include/scip_test.h"
+
+static SCIP* scip;
+static SCIP_RANDNUMGEN* randnumgen;
+
+#define MAXNCORES 200
+
+static
+void setup(void)
+{
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPcreateRandom(scip, &randnumgen, 42, TRUE) );
+}
+
+static
+void teardown(void)
+{
+   SCIPfreeRandom(scip, &randnumgen);
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+/** inserts the cores one by one and at once into two profiles and checks that the resulting profiles are the same */
+static
+void checkInsertCores(
+   int*                  lefts,              /**< left sides of the cores */
+   int*                  rights,             /**< right sides of the cores */
+   int*                  heights,            /**< heights of the cores */
+   int                   ncores,             /**< number of cores */
+   int                   capacity            /**< capacity of the profiles */
+   )
+{
+   SCIP_PROFILE* single;
+   SCIP_PROFILE* bulk;
+   SCIP_Bool singleinfeasible;
+   SCIP_Bool bulkinfeasible;
+   int c;
+   int i;
+
+   SCIP_CALL( SCIPprofileCreate(&single, capacity) );
+   SCIP_CALL( SCIPprofileCreate(&bulk, capacity) );
+
+   singleinfeasible = FALSE;
+   for( c = 0; c < ncores && !singleinfeasible; ++c )
+   {
+      int pos;
+
+      SCIP_CALL( SCIPprofileInsertCore(single, lefts[c], rights[c], heights[c], &pos, &singleinfeasible) );
+   }
+
+   SCIP_CALL( SCIPprofileInsertCores(bulk, lefts, rights, heights, ncores, &bulkinfeasible) );
+
+   cr_assert_eq(bulkinfeasible, singleinfeasible);
+
+   if( bulkinfeasible )
+   {
+      /* the profile is left empty */
+      cr_assert_eq(SCIPprofileGetNTimepoints(bulk), 1);
+      cr_assert_eq(SCIPprofileGetLoad(bulk, 0), 0);
+   }
+   else
+   {
+      cr_assert_eq(SCIPprofileGetNTimepoints(bulk), SCIPprofileGetNTimepoints(single));
+
+      for( i = 0; i < SCIPprofileGetNTimepoints(single); ++i )
+      {
+         cr_assert_eq(SCIPprofileGetTime(bulk, i), SCIPprofileGetTime(single, i), "time point %d differs", i);
+         cr_assert_eq(SCIPprofileGetLoad(bulk, i), SCIPprofileGetLoad(single, i), "load at time point %d differs", i);
+      }
+   }
+
+   SCIPprofileFree(&bulk);
+   SCIPprofileFree(&single);
+}
+
+TestSuite(profile, .init = setup, .fini = teardown);
+
+Test(profile, random, .description = "compare bulk insertion of random cores with inserting them one by one")
+{
+   int lefts[MAXNCORES];
+   int rights[MAXNCORES];
+   int heights[MAXNCORES];
+   int r;
+
+   for( r = 0; r < 50; ++r )
+   {
+      int ncores;
+      int c;
+
+      ncores = SCIPrandomGetInt(randnumgen, 0, MAXNCORES);
+
+      /* use a small horizon, such that many cores share their start or end times */
+      for( c = 0; c < ncores; ++c )
+      {
+         lefts[c] = SCIPrandomGetInt(randnumgen, 0, 30);
+         rights[c] = lefts[c] + SCIPrandomGetInt(randnumgen, 1, 10);
+         heights[c] = SCIPrandomGetInt(randnumgen, 0, 5);
+      }
+
+      /* a capacity that is large enough for all cores and one that is likely exceeded */
+      checkInsertCores(lefts, rights, heights, ncores, 5 * MAXNCORES);
+      checkInsertCores(lefts, rights, heights, ncores, SCIPrandomGetInt(randnumgen, 1, 40));
+   }
+}
+
+Test(profile, special, .description = "check bulk insertion of adjacent, identical, and zero height cores")
+{
+   int lefts[] = { 0, 2, 2, 4, 7, 9 };
+   int rights[] = { 2, 4, 4, 7, 9, 10 };
+   int heights[] = { 1, 2, 2, 0, 3, 3 };
+
+   checkInsertCores(lefts, rights, heights, 6, 4);
+   checkInsertCores(lefts, rights, heights, 6, 3);
+   checkInsertCores(lefts, rights, heights, 0, 3);
+}
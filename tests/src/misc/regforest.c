@@ -0,0 +1,190 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   regforest.c
+ * @brief  unit test for reading regression forests in RFCSV format and predicting with them
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <stdio.h>
+
+#include "scip/scip.h"
+#include "scip/pub_misc_regforest.h"
+
+#include "include/scip_test.h"
+
+static const char* filename = "regforest.rfcsv";
+
+/** writes the given content to the test file */
+static
+void writeForest(
+   const char*           content             /**< content of the file */
+   )
+{
+   FILE* fp;
+
+   fp = fopen(filename, "w");
+   cr_assert(fp != NULL);
+   fprintf(fp, "%s", content);
+   fclose(fp);
+}
+
+/** removes the test file */
+static
+void teardown(void)
+{
+   (void)remove(filename);
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+/* a forest of two trees over two features; the first tree splits on feature 0 at 0.5, the second tree is a leaf */
+static const char* validforest =
+   "### NTREES=2 FEATURE_DIM=2 LENGTH=4\n"
+   "0,1,2,0,0.5\n"
+   "1,-1,-1,-1,1.0\n"
+   "2,-1,-1,-1,3.0\n"
+   "0,-1,-1,-1,2.0\n";
+
+TestSuite(regforest, .fini = teardown);
+
+Test(regforest, read, .description = "a well-formed forest is read and predicts the average of its trees")
+{
+   SCIP_REGFOREST* regforest;
+   SCIP_Real datapoint[2];
+
+   writeForest(validforest);
+
+   SCIP_CALL( SCIPregForestFromFile(&regforest, filename) );
+   cr_assert(regforest != NULL);
+   cr_assert_eq(SCIPregForestGetDim(regforest), 2);
+
+   datapoint[0] = 0.0;
+   datapoint[1] = 7.0;
+   cr_assert_float_eq(SCIPregForestPredict(regforest, datapoint), 1.5, 1e-12);
+
+   datapoint[0] = 1.0;
+   cr_assert_float_eq(SCIPregForestPredict(regforest, datapoint), 2.5, 1e-12);
+
+   /* the split value itself goes to the left child */
+   datapoint[0] = 0.5;
+   cr_assert_float_eq(SCIPregForestPredict(regforest, datapoint), 1.5, 1e-12);
+
+   SCIPregForestFree(&regforest);
+   cr_assert(regforest == NULL);
+}
+
+Test(regforest, batch, .description = "batch predictions equal the predictions of the single data points")
+{
+   SCIP_REGFOREST* regforest;
+   SCIP_Real data[2 * 4];
+   SCIP_Real predictions[3];
+   int i;
+
+   writeForest(validforest);
+
+   SCIP_CALL( SCIPregForestFromFile(&regforest, filename) );
+
+   /* three data points stored feature by feature with a stride of 4 */
+   data[0] = -1.0;
+   data[1] = 0.7;
+   data[2] = 0.5;
+   data[4] = 0.0;
+   data[5] = 1.0;
+   data[6] = 2.0;
+
+   SCIPregForestPredictBatch(regforest, data, 4, 3, predictions);
+
+   for( i = 0; i < 3; ++i )
+   {
+      SCIP_Real datapoint[2];
+
+      datapoint[0] = data[i];
+      datapoint[1] = data[4 + i];
+      cr_assert_float_eq(predictions[i], SCIPregForestPredict(regforest, datapoint), 1e-12);
+   }
+
+   SCIPregForestFree(&regforest);
+}
+
+Test(regforest, invalid, .description = "malformed forests are rejected")
+{
+   SCIP_REGFOREST* regforest;
+
+   /* missing file */
+   (void)remove(filename);
+   cr_assert_eq(SCIPregForestFromFile(&regforest, filename), SCIP_NOFILE);
+   cr_assert(regforest == NULL);
+
+   /* broken header */
+   writeForest("### NTREES=1 LENGTH=1\n0,-1,-1,-1,1.0\n");
+   cr_assert_eq(SCIPregForestFromFile(&regforest, filename), SCIP_READERROR);
+   cr_assert(regforest == NULL);
+
+   /* fewer nodes than trees */
+   writeForest("### NTREES=2 FEATURE_DIM=1 LENGTH=1\n0,-1,-1,-1,1.0\n");
+   cr_assert_eq(SCIPregForestFromFile(&regforest, filename), SCIP_READERROR);
+   cr_assert(regforest == NULL);
+
+   /* missing node line */
+   writeForest("### NTREES=1 FEATURE_DIM=1 LENGTH=3\n0,1,2,0,0.5\n1,-1,-1,-1,1.0\n");
+   cr_assert_eq(SCIPregForestFromFile(&regforest, filename), SCIP_READERROR);
+   cr_assert(regforest == NULL);
+
+   /* first node is not a root */
+   writeForest("### NTREES=1 FEATURE_DIM=1 LENGTH=1\n1,-1,-1,-1,1.0\n");
+   cr_assert_eq(SCIPregForestFromFile(&regforest, filename), SCIP_READERROR);
+   cr_assert(regforest == NULL);
+
+   /* more roots than trees */
+   writeForest("### NTREES=1 FEATURE_DIM=1 LENGTH=2\n0,-1,-1,-1,1.0\n0,-1,-1,-1,2.0\n");
+   cr_assert_eq(SCIPregForestFromFile(&regforest, filename), SCIP_READERROR);
+   cr_assert(regforest == NULL);
+
+   /* fewer roots than trees */
+   writeForest("### NTREES=2 FEATURE_DIM=1 LENGTH=3\n0,1,2,0,0.5\n1,-1,-1,-1,1.0\n2,-1,-1,-1,3.0\n");
+   cr_assert_eq(SCIPregForestFromFile(&regforest, filename), SCIP_READERROR);
+   cr_assert(regforest == NULL);
+
+   /* child before its parent, which would allow cycles */
+   writeForest("### NTREES=1 FEATURE_DIM=1 LENGTH=3\n0,1,2,0,0.5\n1,0,2,0,0.2\n2,-1,-1,-1,3.0\n");
+   cr_assert_eq(SCIPregForestFromFile(&regforest, filename), SCIP_READERROR);
+   cr_assert(regforest == NULL);
+
+   /* child outside of its tree */
+   writeForest("### NTREES=1 FEATURE_DIM=1 LENGTH=3\n0,1,3,0,0.5\n1,-1,-1,-1,1.0\n2,-1,-1,-1,3.0\n");
+   cr_assert_eq(SCIPregForestFromFile(&regforest, filename), SCIP_READERROR);
+   cr_assert(regforest == NULL);
+
+   /* split on a feature that does not exist */
+   writeForest("### NTREES=1 FEATURE_DIM=1 LENGTH=3\n0,1,2,1,0.5\n1,-1,-1,-1,1.0\n2,-1,-1,-1,3.0\n");
+   cr_assert_eq(SCIPregForestFromFile(&regforest, filename), SCIP_READERROR);
+   cr_assert(regforest == NULL);
+
+   /* invalid value */
+   writeForest("### NTREES=1 FEATURE_DIM=1 LENGTH=1\n0,-1,-1,-1,abc\n");
+   cr_assert_eq(SCIPregForestFromFile(&regforest, filename), SCIP_READERROR);
+   cr_assert(regforest == NULL);
+}
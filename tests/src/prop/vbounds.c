@@ -0,0 +1,298 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   vbounds.c
+ * @brief  unit test for the incremental topological order of the variable bound graph in prop_vbounds
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/prop_vbounds.c"
+
+#include "include/scip_test.h"
+
+#define NVARS  8
+#define NEDGES 60
+
+static SCIP* scip;
+static SCIP_VAR* origvars[NVARS];
+static SCIP_VAR* vars[NVARS];
+static SCIP_PROPDATA propdata;
+static int* stack;
+static int* fwdnodes;
+static int* bwdnodes;
+static int* fwdpreds;
+
+/* vbounds that were added without closing a cycle, i.e., that have to be respected by the order */
+static int edgestart[NEDGES];
+static int edgeend[NEDGES];
+static int nedges;
+
+/* creates scip, the problem, and propagator data with the identity as order and no vbounds */
+static
+void setup(void)
+{
+   char name[SCIP_MAXSTRLEN];
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "problem") );
+
+   for( i = 0; i < NVARS; ++i )
+   {
+      (void)SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &origvars[i], name, 0.0, 10.0, 0.0, SCIP_VARTYPE_CONTINUOUS) );
+      SCIP_CALL( SCIPaddVar(scip, origvars[i]) );
+   }
+
+   TESTscipSetStage(scip, SCIP_STAGE_SOLVING, TRUE);
+
+   for( i = 0; i < NVARS; ++i )
+      vars[i] = SCIPvarGetTransVar(origvars[i]);
+
+   BMSclearMemory(&propdata);
+   resetPropdata(&propdata);
+   propdata.vars = vars;
+   propdata.nbounds = 2 * NVARS;
+
+   SCIP_CALL( SCIPallocMemoryArray(scip, &propdata.topoorder, propdata.nbounds) );
+   SCIP_CALL( SCIPallocMemoryArray(scip, &propdata.topopos, propdata.nbounds) );
+   SCIP_CALL( SCIPallocClearMemoryArray(scip, &propdata.searchmark, propdata.nbounds) );
+   SCIP_CALL( SCIPallocClearMemoryArray(scip, &propdata.vboundbeg, propdata.nbounds) );
+   SCIP_CALL( SCIPallocClearMemoryArray(scip, &propdata.nvbounds, propdata.nbounds) );
+   SCIP_CALL( SCIPallocClearMemoryArray(scip, &propdata.vboundsize, propdata.nbounds) );
+   SCIP_CALL( SCIPallocClearMemoryArray(scip, &propdata.vboundinbeg, propdata.nbounds) );
+   SCIP_CALL( SCIPallocClearMemoryArray(scip, &propdata.nvboundsin, propdata.nbounds) );
+   SCIP_CALL( SCIPallocClearMemoryArray(scip, &propdata.vboundinsize, propdata.nbounds) );
+
+   for( i = 0; i < propdata.nbounds; ++i )
+   {
+      propdata.topoorder[i] = i;
+      propdata.topopos[i] = i;
+   }
+
+   SCIP_CALL( SCIPallocMemoryArray(scip, &stack, propdata.nbounds) );
+   SCIP_CALL( SCIPallocMemoryArray(scip, &fwdnodes, propdata.nbounds) );
+   SCIP_CALL( SCIPallocMemoryArray(scip, &bwdnodes, propdata.nbounds) );
+   SCIP_CALL( SCIPallocMemoryArray(scip, &fwdpreds, propdata.nbounds) );
+
+   nedges = 0;
+}
+
+/* frees the propagator data and scip */
+static
+void teardown(void)
+{
+   int i;
+
+   SCIPfreeMemoryArray(scip, &fwdpreds);
+   SCIPfreeMemoryArray(scip, &bwdnodes);
+   SCIPfreeMemoryArray(scip, &fwdnodes);
+   SCIPfreeMemoryArray(scip, &stack);
+
+   SCIPfreeMemoryArrayNull(scip, &propdata.vboundinidx);
+   SCIPfreeMemoryArrayNull(scip, &propdata.vboundconstants);
+   SCIPfreeMemoryArrayNull(scip, &propdata.vboundcoefs);
+   SCIPfreeMemoryArrayNull(scip, &propdata.vboundboundedidx);
+   SCIPfreeMemoryArray(scip, &propdata.vboundinsize);
+   SCIPfreeMemoryArray(scip, &propdata.nvboundsin);
+   SCIPfreeMemoryArray(scip, &propdata.vboundinbeg);
+   SCIPfreeMemoryArray(scip, &propdata.vboundsize);
+   SCIPfreeMemoryArray(scip, &propdata.nvbounds);
+   SCIPfreeMemoryArray(scip, &propdata.vboundbeg);
+   SCIPfreeMemoryArray(scip, &propdata.searchmark);
+   SCIPfreeMemoryArray(scip, &propdata.topopos);
+   SCIPfreeMemoryArray(scip, &propdata.topoorder);
+
+   for( i = NVARS - 1; i >= 0; --i )
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &origvars[i]) );
+   }
+
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+/* checks that the order is a permutation that respects all vbounds which did not close a cycle, and that the search
+ * marks were reset
+ */
+static
+void checkOrder(void)
+{
+   int i;
+
+   for( i = 0; i < propdata.nbounds; ++i )
+   {
+      cr_assert_eq(propdata.topopos[propdata.topoorder[i]], i, "order and positions do not match");
+      cr_assert_eq(propdata.searchmark[i], 0, "search mark of bound %d was not reset", i);
+   }
+
+   /* the order is reverse topological, so the influencing bound has the higher position */
+   for( i = 0; i < nedges; ++i )
+   {
+      cr_assert(propdata.topopos[edgestart[i]] > propdata.topopos[edgeend[i]],
+         "vbound %d -> %d violates the order", edgestart[i], edgeend[i]);
+   }
+}
+
+/* adds a vbound and updates the order */
+static
+void addEdge(
+   int                   startidx,           /**< index of the influencing bound */
+   int                   endidx,             /**< index of the influenced bound */
+   SCIP_Real             coef,               /**< coefficient of the vbound */
+   SCIP_Real             constant,           /**< constant of the vbound */
+   SCIP_Bool*            cycle,              /**< pointer to store whether the vbound closes a cycle */
+   SCIP_Real*            cyclecoef,          /**< pointer to store the aggregated coefficient of the cycle */
+   SCIP_Real*            cycleconstant       /**< pointer to store the aggregated constant of the cycle */
+   )
+{
+   SCIP_CALL( addVbound(scip, &propdata, startidx, endidx, coef, constant) );
+   SCIP_CALL( updateTopoorder(scip, &propdata, startidx, endidx, stack, fwdnodes, bwdnodes, fwdpreds, cycle,
+         cyclecoef, cycleconstant) );
+
+   if( !(*cycle) )
+   {
+      assert(nedges < NEDGES);
+      edgestart[nedges] = startidx;
+      edgeend[nedges] = endidx;
+      ++nedges;
+   }
+
+   checkOrder();
+}
+
+TestSuite(vbounds, .init = setup, .fini = teardown);
+
+Test(vbounds, violations, .description = "vbounds against the order reorder only the affected bounds")
+{
+   int oldorder[2 * NVARS];
+   SCIP_Real cyclecoef;
+   SCIP_Real cycleconstant;
+   SCIP_Bool cycle;
+   int i;
+
+   /* a chain of vbounds that all contradict the identity order */
+   for( i = 0; i < 4; ++i )
+   {
+      addEdge(getLbIndex(i), getLbIndex(i + 1), 1.0, 0.0, &cycle, &cyclecoef, &cycleconstant);
+      cr_assert_not(cycle);
+   }
+
+   /* the upper bounds are not affected by the chain of lower bounds */
+   for( i = 0; i < NVARS; ++i )
+      cr_assert_eq(propdata.topopos[getUbIndex(i)], getUbIndex(i));
+
+   /* a vbound that agrees with the order does not change it */
+   BMScopyMemoryArray(oldorder, propdata.topoorder, propdata.nbounds);
+   addEdge(getUbIndex(NVARS - 1), getLbIndex(0), 1.0, 0.0, &cycle, &cyclecoef, &cycleconstant);
+   cr_assert_not(cycle);
+   for( i = 0; i < propdata.nbounds; ++i )
+      cr_assert_eq(propdata.topoorder[i], oldorder[i]);
+}
+
+Test(vbounds, invariant, .description = "the order respects all vbounds after many insertions")
+{
+   SCIP_Real cyclecoef;
+   SCIP_Real cycleconstant;
+   SCIP_Bool cycle;
+   unsigned int seed;
+   int ncycles;
+   int i;
+
+   seed = 42;
+   ncycles = 0;
+   for( i = 0; i < NEDGES; ++i )
+   {
+      int startidx;
+      int endidx;
+
+      seed = 1103515245 * seed + 12345;
+      startidx = (int)((seed >> 16) % (unsigned int)propdata.nbounds);
+      seed = 1103515245 * seed + 12345;
+      endidx = (int)((seed >> 16) % (unsigned int)propdata.nbounds);
+
+      if( getVarIndex(startidx) == getVarIndex(endidx) || findVbound(&propdata, startidx, endidx) >= 0 )
+         continue;
+
+      addEdge(startidx, endidx, 1.0, 0.0, &cycle, &cyclecoef, &cycleconstant);
+      if( cycle )
+         ++ncycles;
+   }
+
+   cr_assert(nedges > 0);
+   cr_assert(ncycles > 0, "the sequence of vbounds should close at least one cycle");
+}
+
+Test(vbounds, cycle, .description = "a vbound closing a cycle keeps the order and aggregates the cycle")
+{
+   int oldorder[2 * NVARS];
+   SCIP_Real cyclecoef;
+   SCIP_Real cycleconstant;
+   SCIP_Bool infeasible;
+   SCIP_Bool cycle;
+   int i;
+
+   /* x1 >= 2 x0 + 1, x2 >= x1 + 3 */
+   addEdge(getLbIndex(0), getLbIndex(1), 2.0, 1.0, &cycle, &cyclecoef, &cycleconstant);
+   cr_assert_not(cycle);
+   addEdge(getLbIndex(1), getLbIndex(2), 1.0, 3.0, &cycle, &cyclecoef, &cycleconstant);
+   cr_assert_not(cycle);
+
+   /* x0 >= 0.5 x2 closes the cycle x2 >= x1 + 3 >= 2 x0 + 4 >= x2 + 4 */
+   BMScopyMemoryArray(oldorder, propdata.topoorder, propdata.nbounds);
+   addEdge(getLbIndex(2), getLbIndex(0), 0.5, 0.0, &cycle, &cyclecoef, &cycleconstant);
+   cr_assert(cycle);
+   cr_assert_float_eq(cyclecoef, 1.0, 1e-12);
+   cr_assert_float_eq(cycleconstant, 4.0, 1e-12);
+   for( i = 0; i < propdata.nbounds; ++i )
+      cr_assert_eq(propdata.topoorder[i], oldorder[i]);
+
+   SCIP_CALL( analyzeCycleRelation(scip, &propdata, getLbIndex(2), cyclecoef, cycleconstant, &infeasible) );
+   cr_assert(infeasible);
+}
+
+Test(vbounds, cyclefixing, .description = "a contracting cycle yields a bound change")
+{
+   SCIP_Real cyclecoef;
+   SCIP_Real cycleconstant;
+   SCIP_Bool infeasible;
+   SCIP_Bool cycle;
+
+   /* x1 >= 0.5 x0 + 1 */
+   addEdge(getLbIndex(0), getLbIndex(1), 0.5, 1.0, &cycle, &cyclecoef, &cycleconstant);
+   cr_assert_not(cycle);
+
+   /* x0 >= x1 closes the cycle x1 >= 0.5 x1 + 1, i.e., x1 >= 2 */
+   addEdge(getLbIndex(1), getLbIndex(0), 1.0, 0.0, &cycle, &cyclecoef, &cycleconstant);
+   cr_assert(cycle);
+   cr_assert_float_eq(cyclecoef, 0.5, 1e-12);
+   cr_assert_float_eq(cycleconstant, 1.0, 1e-12);
+
+   SCIP_CALL( analyzeCycleRelation(scip, &propdata, getLbIndex(1), cyclecoef, cycleconstant, &infeasible) );
+   cr_assert_not(infeasible);
+   cr_assert_float_eq(SCIPvarGetLbLocal(vars[1]), 2.0, 1e-9);
+}
@@ -0,0 +1,234 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*  Copyright (c) 2002-2024 Zuse Institute Berlin (ZIB)                      */
+/*                                                                           */
+/*  Licensed under the Apache License, Version 2.0 (the "License");          */
+/*  you may not use this file except in compliance with the License.         */
+/*  You may obtain a copy of the License at                                  */
+/*                                                                           */
+/*      http://www.apache.org/licenses/LICENSE-2.0                           */
+/*                                                                           */
+/*  Unless required by applicable law or agreed to in writing, software      */
+/*  distributed under the License is distributed on an "AS IS" BASIS,        */
+/*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. */
+/*  See the License for the specific language governing permissions and      */
+/*  limitations under the License.                                           */
+/*                                                                           */
+/*  You should have received a copy of the Apache-2.0 license                */
+/*  along with SCIP; see the file LICENSE. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   pricingjobs.c
+ * @brief  unit test for executing pricing jobs with thread-local column buffers by SCIPexecPricingJobs()
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+
+#include "include/scip_test.h"
+
+#define NJOBS      4
+#define MAXJOBCOLS 3
+#define MAXADDED   (NJOBS * MAXJOBCOLS)
+
+/** data of a pricing job: the reduced costs of the columns it finds */
+struct JobData
+{
+   int                   job;                /**< number of the job */
+   SCIP_Real             redcosts[MAXJOBCOLS]; /**< reduced costs of the columns found by the job */
+   int                   ncols;              /**< number of columns found by the job */
+};
+typedef struct JobData JOBDATA;
+
+/** data of a column found by a pricing job */
+struct ColData
+{
+   int                   job;                /**< number of the job that found the column */
+   int                   col;                /**< number of the column within the job */
+};
+typedef struct ColData COLDATA;
+
+static SCIP* scip;
+static SCIP_PRICER* pricer;
+static JOBDATA jobs[NJOBS];
+static void* jobdata[NJOBS];
+
+/* columns passed to the addcol method */
+static COLDATA addedcols[MAXADDED];
+static SCIP_Real addedredcosts[MAXADDED];
+static int nadded;
+
+/** pricing job that stores its columns in the buffer, reusing the same local column data for all of them */
+static
+SCIP_DECL_PRICINGJOB(pricingJobTest)
+{
+   JOBDATA* data = (JOBDATA*)jobdata;
+   COLDATA coldata;
+   int i;
+
+   for( i = 0; i < data->ncols; ++i )
+   {
+      coldata.job = data->job;
+      coldata.col = i;
+      SCIP_CALL( SCIPpricingbufferAddCol(buffer, (void*)&coldata, sizeof(COLDATA), data->redcosts[i]) );
+   }
+   assert(SCIPpricingbufferGetNCols(buffer) == data->ncols);
+
+   return SCIP_OKAY;
+}
+
+/** addcol method that records the columns */
+static
+SCIP_DECL_PRICINGADDCOL(pricingAddcolTest)
+{
+   assert(nadded < MAXADDED);
+
+   addedcols[nadded] = *(COLDATA*)coldata;
+   addedredcosts[nadded] = redcost;
+   ++nadded;
+
+   return SCIP_OKAY;
+}
+
+/** creates SCIP in solving stage and pricing jobs with one improving column each */
+static
+void setup(void)
+{
+   int j;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPcreateProbBasic(scip, "problem") );
+   TESTscipSetStage(scip, SCIP_STAGE_SOLVING, FALSE);
+
+   /* the pricer that is included to reach the solving stage owns the jobs */
+   pricer = SCIPfindPricer(scip, "pricerTest");
+   assert(pricer != NULL);
+
+   for( j = 0; j < NJOBS; ++j )
+   {
+      jobs[j].job = j;
+      jobs[j].redcosts[0] = -1.0 - j;
+      jobs[j].ncols = 1;
+      jobdata[j] = (void*)&jobs[j];
+   }
+
+   nadded = 0;
+}
+
+/** frees SCIP */
+static
+void teardown(void)
+{
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There is a memory leak!");
+}
+
+TestSuite(pricingjobs, .init = setup, .fini = teardown);
+
+Test(pricingjobs, merge, .description = "the improving columns of all jobs are added by increasing reduced cost")
+{
+   SCIP_Bool complete;
+   int naddedcols;
+   int j;
+
+   /* every job also finds a column with nonnegative reduced cost, and job 1 finds a second improving column */
+   for( j = 0; j < NJOBS; ++j )
+   {
+      jobs[j].redcosts[1] = 0.5;
+      jobs[j].ncols = 2;
+   }
+   jobs[1].redcosts[2] = -10.0;
+   jobs[1].ncols = 3;
+
+   SCIP_CALL( SCIPsetIntParam(scip, "parallel/maxnthreads", 4) );
+   SCIP_CALL( SCIPexecPricingJobs(scip, pricer, pricingJobTest, pricingAddcolTest, jobdata, NJOBS, -1, &naddedcols,
+         &complete) );
+
+   cr_assert(complete);
+   cr_assert_eq(naddedcols, NJOBS + 1);
+   cr_assert_eq(nadded, NJOBS + 1);
+
+   /* the best column comes first, then the columns of the jobs by decreasing job number */
+   cr_assert_eq(addedcols[0].job, 1);
+   cr_assert_eq(addedcols[0].col, 2);
+   for( j = 1; j <= NJOBS; ++j )
+   {
+      cr_assert_eq(addedcols[j].job, NJOBS - j);
+      cr_assert_eq(addedcols[j].col, 0);
+      cr_assert(addedredcosts[j - 1] <= addedredcosts[j]);
+   }
+}
+
+Test(pricingjobs, maxcols, .description = "at most maxcols columns are added, the best ones of the executed jobs")
+{
+   SCIP_Bool complete;
+   int naddedcols;
+   int j;
+
+   for( j = 0; j < NJOBS; ++j )
+   {
+      jobs[j].redcosts[1] = -20.0 - j;
+      jobs[j].ncols = 2;
+   }
+
+   SCIP_CALL( SCIPsetIntParam(scip, "parallel/maxnthreads", 4) );
+   SCIP_CALL( SCIPexecPricingJobs(scip, pricer, pricingJobTest, pricingAddcolTest, jobdata, NJOBS, 3, &naddedcols,
+         &complete) );
+
+   cr_assert_eq(naddedcols, 3);
+   cr_assert_eq(nadded, 3);
+   for( j = 1; j < nadded; ++j )
+      cr_assert(addedredcosts[j - 1] <= addedredcosts[j]);
+
+   /* the jobs stop after three improving columns, so at least two jobs were executed, whose second columns are the
+    * best ones
+    */
+   cr_assert_eq(addedcols[0].col, 1);
+   cr_assert_eq(addedcols[1].col, 1);
+}
+
+Test(pricingjobs, earlystop, .description = "jobs are skipped once enough columns were found and the next call continues")
+{
+   SCIP_Bool complete;
+   int naddedcols;
+
+   /* with one thread, the jobs are executed one after the other in the round-robin order */
+   SCIP_CALL( SCIPsetIntParam(scip, "parallel/maxnthreads", 1) );
+
+   SCIP_CALL( SCIPexecPricingJobs(scip, pricer, pricingJobTest, pricingAddcolTest, jobdata, NJOBS, 2, &naddedcols,
+         &complete) );
+
+   cr_assert_not(complete);
+   cr_assert_eq(naddedcols, 2);
+   cr_assert_eq(addedcols[0].job, 1);
+   cr_assert_eq(addedcols[1].job, 0);
+
+   /* the next call starts with the first skipped job */
+   nadded = 0;
+   SCIP_CALL( SCIPexecPricingJobs(scip, pricer, pricingJobTest, pricingAddcolTest, jobdata, NJOBS, 2, &naddedcols,
+         &complete) );
+
+   cr_assert_not(complete);
+   cr_assert_eq(naddedcols, 2);
+   cr_assert_eq(addedcols[0].job, 3);
+   cr_assert_eq(addedcols[1].job, 2);
+
+   /* without improving columns, all jobs are executed and nothing is added */
+   jobs[0].redcosts[0] = 1.0;
+   jobs[1].redcosts[0] = 1.0;
+   jobs[2].redcosts[0] = 1.0;
+   jobs[3].redcosts[0] = 1.0;
+   nadded = 0;
+   SCIP_CALL( SCIPexecPricingJobs(scip, pricer, pricingJobTest, pricingAddcolTest, jobdata, NJOBS, 2, &naddedcols,
+         &complete) );
+
+   cr_assert(complete);
+   cr_assert_eq(naddedcols, 0);
+   cr_assert_eq(nadded, 0);
+}